@@ -6,10 +6,38 @@
 #include <iostream>
 #include <stdio.h>
 
+#include "testing_gbtrf.hpp"
+#include "testing_gbtrs.hpp"
+#include "testing_gebltsv.hpp"
+#include "testing_gecon.hpp"
+#include "testing_geequ.hpp"
+#include "testing_geev.hpp"
+#include "testing_gehrd.hpp"
+#include "testing_gels.hpp"
+#include "testing_geqp3.hpp"
+#include "testing_geqrf.hpp"
+#include "testing_gerfs.hpp"
+#include "testing_gesv.hpp"
+#include "testing_gesvd.hpp"
+#include "testing_gesvdj.hpp"
+#include "testing_gesvdr.hpp"
 #include "testing_getf2.hpp"
 #include "testing_getrf.hpp"
+#include "testing_getri.hpp"
 #include "testing_getrs.hpp"
+#include "testing_gtsv.hpp"
+#include "testing_lange.hpp"
+#include "testing_lu_complex.hpp"
+#include "testing_lu_plan.hpp"
+#include "testing_orgqr.hpp"
+#include "testing_ormqr.hpp"
+#include "testing_pocon.hpp"
 #include "testing_potf2.hpp"
+#include "testing_potf2_complex.hpp"
+#include "testing_potrf.hpp"
+#include "testing_potupdate.hpp"
+#include "testing_syev.hpp"
+#include "testing_syevj.hpp"
 #include "utility.h"
 
 namespace po = boost::program_options;
@@ -54,6 +82,14 @@ int main(int argc, char *argv[]) {
          "Specific matrix size testing:sizek is only applicable to BLAS-3: the number of columns in "
          "A & C  and rows in B.")
 
+        ("kl",
+         po::value<rocblas_int>(&argus.kl)->default_value(32),
+         "Number of subdiagonals of a band matrix. Only applicable to band routines")
+
+        ("ku",
+         po::value<rocblas_int>(&argus.ku)->default_value(32),
+         "Number of superdiagonals of a band matrix. Only applicable to band routines")
+
         ("lda",
          po::value<rocblas_int>(&argus.lda)->default_value(1024),
          "Specific leading dimension of matrix A, is only applicable to "
@@ -100,7 +136,7 @@ int main(int argc, char *argv[]) {
               
         ("function,f",
          po::value<std::string>(&function)->default_value("potf2"),
-         "LAPACK function to test. Options: potf2, getf2, getrf, getrs")
+         "LAPACK function to test. Options: potf2, potrf, potupdate, potdowndate, getf2, getrf, getri, getrs, getrs_invdiag, lu_plan, lu_plan_equilibrated, gesv, gerfs, gecon, pocon, geequ, lange, lansy, lantr, gbtrf, gbtrs, gtsv, gtsv_strided_batched, gebltsv_strided_batched, geqr2, geqrf, geqp3, orgqr, ormqr, gels, syev, syevd, syevj_batched, syevj_strided_batched, gesvd, gesvdj_batched, gesvdj_strided_batched, gesvdr, gehrd, geev")
         
         ("precision,r", 
          po::value<char>(&precision)->default_value('s'), "Options: h,s,d,c,z")
@@ -125,10 +161,38 @@ int main(int argc, char *argv[]) {
          po::value<char>(&argus.diag_option)->default_value('N'),
          "U = unit diagonal, N = non unit diagonal. Only applicable to certain routines") // xtrsm
                                                                                           // xtrmm
+        ("norm",
+         po::value<char>(&argus.norm_option)->default_value('O'),
+         "O = one norm, I = infinity norm, M = largest absolute value, F = Frobenius norm. Only applicable to certain routines")
+
+        ("evect",
+         po::value<char>(&argus.evect_option)->default_value('N'),
+         "N = eigenvalues only, V = eigenvalues and eigenvectors. Only applicable to certain routines")
+
+        ("left_svect",
+         po::value<char>(&argus.left_svect_option)->default_value('N'),
+         "A = all left singular vectors, S = the first min(m,n) only, N = none. Only applicable to certain routines")
+
+        ("right_svect",
+         po::value<char>(&argus.right_svect_option)->default_value('N'),
+         "A = all right singular vectors, S = the first min(m,n) only, N = none. Only applicable to certain routines")
+
         ("batch",
          po::value<rocblas_int>(&argus.batch_count)->default_value(1),
          "Number of matrices. Only applicable to batched routines") // xtrsm xtrmm xgemm
 
+        ("oversample",
+         po::value<rocblas_int>(&argus.oversample)->default_value(10),
+         "Columns of the random sketch beyond the target rank sizek. Only applicable to randomized routines")
+
+        ("power_iters",
+         po::value<rocblas_int>(&argus.power_iters)->default_value(2),
+         "Power iterations of the random sketch. Only applicable to randomized routines")
+
+        ("pivot",
+         po::value<char>(&argus.pivot_option)->default_value('N'),
+         "N = diagonally dominant band, Y = dominant entries off the diagonal, forcing row interchanges. Only applicable to band routines")
+
         ("verify,v",
          po::value<rocblas_int>(&argus.norm_check)->default_value(0),
          "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
@@ -182,6 +246,25 @@ int main(int argc, char *argv[]) {
       testing_potf2<float>(argus);
     else if (precision == 'd')
       testing_potf2<double>(argus);
+    else if (precision == 'c')
+      testing_potf2_complex<rocblas_float_complex, float>(argus);
+    else if (precision == 'z')
+      testing_potf2_complex<rocblas_double_complex, double>(argus);
+  } else if (function == "potrf") {
+    if (precision == 's')
+      testing_potrf<float>(argus);
+    else if (precision == 'd')
+      testing_potrf<double>(argus);
+  } else if (function == "potupdate") {
+    if (precision == 's')
+      testing_potupdate<float>(argus);
+    else if (precision == 'd')
+      testing_potupdate<double>(argus);
+  } else if (function == "potdowndate") {
+    if (precision == 's')
+      testing_potdowndate<float>(argus);
+    else if (precision == 'd')
+      testing_potdowndate<double>(argus);
   } else if (function == "getf2") {
     if (precision == 's')
       testing_getf2<float>(argus);
@@ -192,11 +275,184 @@ int main(int argc, char *argv[]) {
       testing_getrf<float>(argus);
     else if (precision == 'd')
       testing_getrf<double>(argus);
+    else if (precision == 'c')
+      testing_getrf_complex<rocblas_float_complex, float>(argus);
+    else if (precision == 'z')
+      testing_getrf_complex<rocblas_double_complex, double>(argus);
+  } else if (function == "getri") {
+    if (precision == 's')
+      testing_getri<float>(argus);
+    else if (precision == 'd')
+      testing_getri<double>(argus);
   } else if (function == "getrs") {
     if (precision == 's')
       testing_getrs<float>(argus);
     else if (precision == 'd')
       testing_getrs<double>(argus);
+    else if (precision == 'c')
+      testing_getrs_complex<rocblas_float_complex, float>(argus);
+    else if (precision == 'z')
+      testing_getrs_complex<rocblas_double_complex, double>(argus);
+  } else if (function == "getrs_invdiag") {
+    if (precision == 's')
+      testing_getrs<float>(argus, true);
+    else if (precision == 'd')
+      testing_getrs<double>(argus, true);
+  } else if (function == "lu_plan") {
+    if (precision == 's')
+      testing_lu_plan<float>(argus);
+    else if (precision == 'd')
+      testing_lu_plan<double>(argus);
+  } else if (function == "lu_plan_equilibrated") {
+    if (precision == 's')
+      testing_lu_plan<float>(argus, true);
+    else if (precision == 'd')
+      testing_lu_plan<double>(argus, true);
+  } else if (function == "gesv") {
+    if (precision == 's')
+      testing_gesv<float>(argus);
+    else if (precision == 'd')
+      testing_gesv<double>(argus);
+  } else if (function == "gerfs") {
+    if (precision == 's')
+      testing_gerfs<float>(argus);
+    else if (precision == 'd')
+      testing_gerfs<double>(argus);
+  } else if (function == "gecon") {
+    if (precision == 's')
+      testing_gecon<float>(argus);
+    else if (precision == 'd')
+      testing_gecon<double>(argus);
+  } else if (function == "pocon") {
+    if (precision == 's')
+      testing_pocon<float>(argus);
+    else if (precision == 'd')
+      testing_pocon<double>(argus);
+  } else if (function == "geequ") {
+    if (precision == 's')
+      testing_geequ<float>(argus);
+    else if (precision == 'd')
+      testing_geequ<double>(argus);
+  } else if (function == "lange") {
+    if (precision == 's')
+      testing_lange<float>(argus);
+    else if (precision == 'd')
+      testing_lange<double>(argus);
+  } else if (function == "lansy") {
+    if (precision == 's')
+      testing_lansy<float>(argus);
+    else if (precision == 'd')
+      testing_lansy<double>(argus);
+  } else if (function == "lantr") {
+    if (precision == 's')
+      testing_lantr<float>(argus);
+    else if (precision == 'd')
+      testing_lantr<double>(argus);
+  } else if (function == "gbtrf") {
+    if (precision == 's')
+      testing_gbtrf<float>(argus);
+    else if (precision == 'd')
+      testing_gbtrf<double>(argus);
+  } else if (function == "gbtrs") {
+    if (precision == 's')
+      testing_gbtrs<float>(argus);
+    else if (precision == 'd')
+      testing_gbtrs<double>(argus);
+  } else if (function == "gtsv") {
+    if (precision == 's')
+      testing_gtsv<float>(argus, false);
+    else if (precision == 'd')
+      testing_gtsv<double>(argus, false);
+  } else if (function == "gtsv_strided_batched") {
+    if (precision == 's')
+      testing_gtsv<float>(argus, true);
+    else if (precision == 'd')
+      testing_gtsv<double>(argus, true);
+  } else if (function == "gebltsv_strided_batched") {
+    if (precision == 's')
+      testing_gebltsv<float>(argus);
+    else if (precision == 'd')
+      testing_gebltsv<double>(argus);
+  } else if (function == "geqr2") {
+    if (precision == 's')
+      testing_geqrf<float>(argus, true);
+    else if (precision == 'd')
+      testing_geqrf<double>(argus, true);
+  } else if (function == "geqrf") {
+    if (precision == 's')
+      testing_geqrf<float>(argus);
+    else if (precision == 'd')
+      testing_geqrf<double>(argus);
+  } else if (function == "geqp3") {
+    if (precision == 's')
+      testing_geqp3<float>(argus);
+    else if (precision == 'd')
+      testing_geqp3<double>(argus);
+  } else if (function == "orgqr") {
+    if (precision == 's')
+      testing_orgqr<float>(argus);
+    else if (precision == 'd')
+      testing_orgqr<double>(argus);
+  } else if (function == "ormqr") {
+    if (precision == 's')
+      testing_ormqr<float>(argus);
+    else if (precision == 'd')
+      testing_ormqr<double>(argus);
+  } else if (function == "gels") {
+    if (precision == 's')
+      testing_gels<float>(argus);
+    else if (precision == 'd')
+      testing_gels<double>(argus);
+  } else if (function == "syev") {
+    if (precision == 's')
+      testing_syev<float>(argus, false);
+    else if (precision == 'd')
+      testing_syev<double>(argus, false);
+  } else if (function == "syevd") {
+    if (precision == 's')
+      testing_syev<float>(argus, true);
+    else if (precision == 'd')
+      testing_syev<double>(argus, true);
+  } else if (function == "syevj_batched") {
+    if (precision == 's')
+      testing_syevj<float>(argus, false);
+    else if (precision == 'd')
+      testing_syevj<double>(argus, false);
+  } else if (function == "syevj_strided_batched") {
+    if (precision == 's')
+      testing_syevj<float>(argus, true);
+    else if (precision == 'd')
+      testing_syevj<double>(argus, true);
+  } else if (function == "gesvd") {
+    if (precision == 's')
+      testing_gesvd<float>(argus);
+    else if (precision == 'd')
+      testing_gesvd<double>(argus);
+  } else if (function == "gesvdj_batched") {
+    if (precision == 's')
+      testing_gesvdj<float>(argus, false);
+    else if (precision == 'd')
+      testing_gesvdj<double>(argus, false);
+  } else if (function == "gesvdj_strided_batched") {
+    if (precision == 's')
+      testing_gesvdj<float>(argus, true);
+    else if (precision == 'd')
+      testing_gesvdj<double>(argus, true);
+  } else if (function == "gesvdr") {
+    if (precision == 's')
+      testing_gesvdr<float>(argus);
+    else if (precision == 'd')
+      testing_gesvdr<double>(argus);
+  } else if (function == "gehrd") {
+    if (precision == 's')
+      testing_gehrd<float>(argus);
+    else if (precision == 'd')
+      testing_gehrd<double>(argus);
+  } else if (function == "geev") {
+    if (precision == 's')
+      testing_geev<float>(argus);
+    else if (precision == 'd')
+      testing_geev<double>(argus);
   } else {
     printf("Invalid value for --function \n");
     return -1;
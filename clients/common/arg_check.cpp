@@ -39,6 +39,45 @@ void potf2_arg_check(rocblas_status status, rocblas_int N) {
 #endif
 }
 
+void potrf_arg_check(rocblas_status status, rocblas_int N) {
+#ifdef GOOGLE_TEST
+  if (N < 0) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (N < 0) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << N << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << N << std::endl;
+  }
+#endif
+}
+
+void potupdate_arg_check(rocblas_status status, rocblas_int N, rocblas_int K,
+                         rocblas_int lda, rocblas_int ldx) {
+#ifdef GOOGLE_TEST
+  if (N < 0 || K < 0 || lda < std::max(1, N) || ldx < std::max(1, N)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (N < 0 || K < 0 || lda < std::max(1, N) || ldx < std::max(1, N)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << N << " and "
+                << K << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << N << " and " << K
+                << std::endl;
+  }
+#endif
+}
+
 void getf2_arg_check(rocblas_status status, rocblas_int M, rocblas_int N) {
 #ifdef GOOGLE_TEST
   if (M < 0 || N < 0) {
@@ -100,6 +139,457 @@ void getrs_arg_check(rocblas_status status, rocblas_int M, rocblas_int nhrs,
 #endif
 }
 
+void gesv_arg_check(rocblas_status status, rocblas_int N, rocblas_int nhrs,
+                    rocblas_int lda, rocblas_int ldb) {
+#ifdef GOOGLE_TEST
+  if (N < 0 || nhrs < 0 || lda < std::max(1, N) || ldb < std::max(1, N)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (N < 0 || nhrs < 0 || lda < std::max(1, N) || ldb < std::max(1, N)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << N << " and "
+                << nhrs << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << N << " and " << nhrs
+                << std::endl;
+  }
+#endif
+}
+
+void getri_arg_check(rocblas_status status, rocblas_int N, rocblas_int lda) {
+#ifdef GOOGLE_TEST
+  if (N < 0 || lda < std::max(1, N)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (N < 0 || lda < std::max(1, N)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << N << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << N << std::endl;
+  }
+#endif
+}
+
+void gecon_arg_check(rocblas_status status, rocblas_int N, rocblas_int lda) {
+#ifdef GOOGLE_TEST
+  if (N < 0 || lda < std::max(1, N)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (N < 0 || lda < std::max(1, N)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << N << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << N << std::endl;
+  }
+#endif
+}
+
+void pocon_arg_check(rocblas_status status, rocblas_int N, rocblas_int lda) {
+#ifdef GOOGLE_TEST
+  if (N < 0 || lda < std::max(1, N)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (N < 0 || lda < std::max(1, N)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << N << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << N << std::endl;
+  }
+#endif
+}
+
+void geequ_arg_check(rocblas_status status, rocblas_int M, rocblas_int N,
+                     rocblas_int lda) {
+#ifdef GOOGLE_TEST
+  if (M < 0 || N < 0 || lda < std::max(1, M)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (M < 0 || N < 0 || lda < std::max(1, M)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << M << " and "
+                << N << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << M << " and " << N
+                << std::endl;
+  }
+#endif
+}
+
+void lange_arg_check(rocblas_status status, rocblas_int M, rocblas_int N,
+                     rocblas_int lda, rocblas_int batch_count) {
+#ifdef GOOGLE_TEST
+  if (M < 0 || N < 0 || lda < std::max(1, M) || batch_count < 0) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (M < 0 || N < 0 || lda < std::max(1, M) || batch_count < 0) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << M << " and "
+                << N << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << M << " and " << N
+                << std::endl;
+  }
+#endif
+}
+
+void geqrf_arg_check(rocblas_status status, rocblas_int M, rocblas_int N,
+                     rocblas_int lda) {
+#ifdef GOOGLE_TEST
+  if (M < 0 || N < 0 || lda < std::max(1, M)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (M < 0 || N < 0 || lda < std::max(1, M)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << M << " and "
+                << N << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << M << " and " << N
+                << std::endl;
+  }
+#endif
+}
+
+void orgqr_arg_check(rocblas_status status, rocblas_int M, rocblas_int N,
+                     rocblas_int K, rocblas_int lda) {
+#ifdef GOOGLE_TEST
+  if (M < 0 || N < 0 || N > M || K < 0 || K > N || lda < std::max(1, M)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (M < 0 || N < 0 || N > M || K < 0 || K > N || lda < std::max(1, M)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << M << ", "
+                << N << " and " << K << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << M << ", " << N
+                << " and " << K << std::endl;
+  }
+#endif
+}
+
+void ormqr_arg_check(rocblas_status status, char side, rocblas_int M,
+                     rocblas_int N, rocblas_int K, rocblas_int lda,
+                     rocblas_int ldc) {
+#ifdef GOOGLE_TEST
+  if (M < 0 || N < 0 || K < 0 || K > (side == 'L' ? M : N) ||
+      lda < std::max(1, side == 'L' ? M : N) || ldc < std::max(1, M)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (M < 0 || N < 0 || K < 0 || K > (side == 'L' ? M : N) ||
+      lda < std::max(1, side == 'L' ? M : N) || ldc < std::max(1, M)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << M << ", "
+                << N << " and " << K << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << M << ", " << N
+                << " and " << K << std::endl;
+  }
+#endif
+}
+
+void gels_arg_check(rocblas_status status, rocblas_int M, rocblas_int N,
+                    rocblas_int nrhs, rocblas_int lda, rocblas_int ldb,
+                    rocblas_int batch_count) {
+#ifdef GOOGLE_TEST
+  if (M < 0 || N < 0 || nrhs < 0 || batch_count < 0 ||
+      lda < std::max(1, M) || ldb < std::max(1, std::max(M, N))) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (M < 0 || N < 0 || nrhs < 0 || batch_count < 0 ||
+      lda < std::max(1, M) || ldb < std::max(1, std::max(M, N))) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << M << ", "
+                << N << " and " << nrhs << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << M << ", " << N
+                << " and " << nrhs << std::endl;
+  }
+#endif
+}
+
+void syev_arg_check(rocblas_status status, rocblas_int N, rocblas_int lda) {
+#ifdef GOOGLE_TEST
+  if (N < 0 || lda < std::max(1, N)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (N < 0 || lda < std::max(1, N)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << N << " and "
+                << lda << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << N << " and "
+                << lda << std::endl;
+  }
+#endif
+}
+
+void syevj_arg_check(rocblas_status status, rocblas_int N, rocblas_int lda,
+                     rocblas_int batch_count) {
+#ifdef GOOGLE_TEST
+  if (N < 0 || batch_count < 0 || lda < std::max(1, N)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (N < 0 || batch_count < 0 || lda < std::max(1, N)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << N << ", "
+                << lda << " and " << batch_count << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << N << ", " << lda
+                << " and " << batch_count << std::endl;
+  }
+#endif
+}
+
+void gesvd_arg_check(rocblas_status status, rocblas_int M, rocblas_int N,
+                     rocblas_int lda) {
+#ifdef GOOGLE_TEST
+  if (M < 0 || N < 0 || lda < std::max(1, M)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (M < 0 || N < 0 || lda < std::max(1, M)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << M << ", " << N
+                << " and " << lda << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << M << ", " << N
+                << " and " << lda << std::endl;
+  }
+#endif
+}
+
+void gesvdj_arg_check(rocblas_status status, rocblas_int M, rocblas_int N,
+                      rocblas_int lda, rocblas_int batch_count) {
+#ifdef GOOGLE_TEST
+  if (M < 0 || N < 0 || batch_count < 0 || lda < std::max(1, M)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (M < 0 || N < 0 || batch_count < 0 || lda < std::max(1, M)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << M << ", " << N
+                << ", " << lda << " and " << batch_count << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << M << ", " << N
+                << ", " << lda << " and " << batch_count << std::endl;
+  }
+#endif
+}
+
+void gesvdr_arg_check(rocblas_status status, rocblas_int M, rocblas_int N,
+                      rocblas_int lda, rocblas_int rank, rocblas_int oversample,
+                      rocblas_int power_iters) {
+  const bool invalid = M < 0 || N < 0 || lda < std::max(1, M) || rank < 0 ||
+                       rank > std::min(M, N) || oversample < 0 ||
+                       power_iters < 0;
+#ifdef GOOGLE_TEST
+  if (invalid) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (invalid) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << M << ", " << N
+                << ", " << lda << " and rank " << rank << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << M << ", " << N
+                << ", " << lda << " and rank " << rank << std::endl;
+  }
+#endif
+}
+
+void gbtrf_arg_check(rocblas_status status, rocblas_int M, rocblas_int N,
+                     rocblas_int kl, rocblas_int ku, rocblas_int ldab) {
+#ifdef GOOGLE_TEST
+  if (M < 0 || N < 0 || kl < 0 || ku < 0 || ldab < 2 * kl + ku + 1) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (M < 0 || N < 0 || kl < 0 || ku < 0 || ldab < 2 * kl + ku + 1) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << M << " and "
+                << N << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << M << " and " << N
+                << std::endl;
+  }
+#endif
+}
+
+void gbtrs_arg_check(rocblas_status status, rocblas_int N, rocblas_int kl,
+                     rocblas_int ku, rocblas_int nhrs, rocblas_int ldab,
+                     rocblas_int ldb) {
+#ifdef GOOGLE_TEST
+  if (N < 0 || kl < 0 || ku < 0 || nhrs < 0 || ldab < 2 * kl + ku + 1 ||
+      ldb < std::max(1, N)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (N < 0 || kl < 0 || ku < 0 || nhrs < 0 || ldab < 2 * kl + ku + 1 ||
+      ldb < std::max(1, N)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << N << " and "
+                << nhrs << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << N << " and " << nhrs
+                << std::endl;
+  }
+#endif
+}
+
+void gtsv_arg_check(rocblas_status status, rocblas_int N, rocblas_int nhrs,
+                    rocblas_int ldb, rocblas_int batch_count) {
+#ifdef GOOGLE_TEST
+  if (N < 0 || nhrs < 0 || batch_count < 0 || ldb < std::max(1, N)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (N < 0 || nhrs < 0 || batch_count < 0 || ldb < std::max(1, N)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << N << ", "
+                << nhrs << " and " << batch_count << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << N << ", " << nhrs
+                << " and " << batch_count << std::endl;
+  }
+#endif
+}
+
+void gebltsv_arg_check(rocblas_status status, rocblas_int nb,
+                       rocblas_int nblocks, rocblas_int nhrs, rocblas_int lda,
+                       rocblas_int ldx, rocblas_int batch_count) {
+  const bool invalid = nb < 0 || nblocks < 0 || nhrs < 0 || batch_count < 0 ||
+                       lda < std::max(1, nb) || ldx < std::max(1, nb * nblocks);
+#ifdef GOOGLE_TEST
+  if (invalid) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (invalid) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << nb << ", "
+                << nblocks << ", " << nhrs << " and " << batch_count
+                << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << nb << ", "
+                << nblocks << ", " << nhrs << " and " << batch_count
+                << std::endl;
+  }
+#endif
+}
+
+void gehrd_arg_check(rocblas_status status, rocblas_int N,
+                     rocblas_int lda) {
+#ifdef GOOGLE_TEST
+  if (N < 0 || lda < std::max(1, N)) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (N < 0 || lda < std::max(1, N)) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << N << " and "
+                << lda << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << N << " and "
+                << lda << std::endl;
+  }
+#endif
+}
+
+void geev_arg_check(rocblas_status status, rocblas_int N, rocblas_int lda,
+                    rocblas_int ldv, bool vectors) {
+  const bool invalid = N < 0 || lda < std::max(1, N) || ldv < 1 ||
+                       (vectors && ldv < std::max(1, N));
+#ifdef GOOGLE_TEST
+  if (invalid) {
+    ASSERT_EQ(status, rocblas_status_invalid_size);
+  } else {
+    ASSERT_EQ(status, rocblas_status_success);
+  }
+#else
+  if (invalid) {
+    if (status != rocblas_status_invalid_size)
+      std::cerr << "result should be invalid size for size " << N << ", "
+                << lda << " and " << ldv << std::endl;
+  } else {
+    if (status != rocblas_status_success)
+      std::cerr << "result should be success for size " << N << ", " << lda
+                << " and " << ldv << std::endl;
+  }
+#endif
+}
+
 void verify_rocblas_status_invalid_pointer(rocblas_status status,
                                            const char *message) {
 #ifdef GOOGLE_TEST
@@ -8,6 +8,7 @@
 #include "utility.h"
 #include <memory>
 #include <typeinfo>
+#include <vector>
 
 /*!\file
  * \brief provide template functions interfaces to CBLAS C89 interfaces, it is
@@ -61,6 +62,150 @@ void zgetrs_(char *trans, int *n, int *nrhs, rocblas_double_complex *A,
              int *lda, int *ipiv, rocblas_double_complex *B, int *ldb,
              int *info);
 
+void sgesv_(int *n, int *nrhs, float *A, int *lda, int *ipiv, float *B,
+            int *ldb, int *info);
+void dgesv_(int *n, int *nrhs, double *A, int *lda, int *ipiv, double *B,
+            int *ldb, int *info);
+void cgesv_(int *n, int *nrhs, rocblas_float_complex *A, int *lda, int *ipiv,
+            rocblas_float_complex *B, int *ldb, int *info);
+void zgesv_(int *n, int *nrhs, rocblas_double_complex *A, int *lda, int *ipiv,
+            rocblas_double_complex *B, int *ldb, int *info);
+
+void sgetri_(int *n, float *A, int *lda, int *ipiv, float *work, int *lwork,
+             int *info);
+void dgetri_(int *n, double *A, int *lda, int *ipiv, double *work, int *lwork,
+             int *info);
+void cgetri_(int *n, rocblas_float_complex *A, int *lda, int *ipiv,
+             rocblas_float_complex *work, int *lwork, int *info);
+void zgetri_(int *n, rocblas_double_complex *A, int *lda, int *ipiv,
+             rocblas_double_complex *work, int *lwork, int *info);
+
+void sgecon_(char *norm, int *n, float *A, int *lda, float *anorm,
+             float *rcond, float *work, int *iwork, int *info);
+void dgecon_(char *norm, int *n, double *A, int *lda, double *anorm,
+             double *rcond, double *work, int *iwork, int *info);
+
+void spocon_(char *uplo, int *n, float *A, int *lda, float *anorm,
+             float *rcond, float *work, int *iwork, int *info);
+void dpocon_(char *uplo, int *n, double *A, int *lda, double *anorm,
+             double *rcond, double *work, int *iwork, int *info);
+
+void sgerfs_(char *trans, int *n, int *nrhs, float *A, int *lda, float *AF,
+             int *ldaf, int *ipiv, float *B, int *ldb, float *X, int *ldx,
+             float *ferr, float *berr, float *work, int *iwork, int *info);
+void dgerfs_(char *trans, int *n, int *nrhs, double *A, int *lda, double *AF,
+             int *ldaf, int *ipiv, double *B, int *ldb, double *X, int *ldx,
+             double *ferr, double *berr, double *work, int *iwork, int *info);
+
+void sgeequ_(int *m, int *n, float *A, int *lda, float *r, float *c,
+             float *rowcnd, float *colcnd, float *amax, int *info);
+void dgeequ_(int *m, int *n, double *A, int *lda, double *r, double *c,
+             double *rowcnd, double *colcnd, double *amax, int *info);
+
+void slaqge_(int *m, int *n, float *A, int *lda, float *r, float *c,
+             float *rowcnd, float *colcnd, float *amax, char *equed);
+void dlaqge_(int *m, int *n, double *A, int *lda, double *r, double *c,
+             double *rowcnd, double *colcnd, double *amax, char *equed);
+
+float slange_(char *norm, int *m, int *n, float *A, int *lda, float *work);
+double dlange_(char *norm, int *m, int *n, double *A, int *lda, double *work);
+
+float slansy_(char *norm, char *uplo, int *n, float *A, int *lda,
+              float *work);
+double dlansy_(char *norm, char *uplo, int *n, double *A, int *lda,
+               double *work);
+
+float slantr_(char *norm, char *uplo, char *diag, int *m, int *n, float *A,
+              int *lda, float *work);
+double dlantr_(char *norm, char *uplo, char *diag, int *m, int *n, double *A,
+               int *lda, double *work);
+
+void sgeqr2_(int *m, int *n, float *A, int *lda, float *tau, float *work,
+             int *info);
+void dgeqr2_(int *m, int *n, double *A, int *lda, double *tau, double *work,
+             int *info);
+
+void sgeqrf_(int *m, int *n, float *A, int *lda, float *tau, float *work,
+             int *lwork, int *info);
+void dgeqrf_(int *m, int *n, double *A, int *lda, double *tau, double *work,
+             int *lwork, int *info);
+
+void sgeqp3_(int *m, int *n, float *A, int *lda, int *jpvt, float *tau,
+             float *work, int *lwork, int *info);
+void dgeqp3_(int *m, int *n, double *A, int *lda, int *jpvt, double *tau,
+             double *work, int *lwork, int *info);
+
+void sorgqr_(int *m, int *n, int *k, float *A, int *lda, float *tau,
+             float *work, int *lwork, int *info);
+void dorgqr_(int *m, int *n, int *k, double *A, int *lda, double *tau,
+             double *work, int *lwork, int *info);
+
+void sormqr_(char *side, char *trans, int *m, int *n, int *k, float *A,
+             int *lda, float *tau, float *C, int *ldc, float *work, int *lwork,
+             int *info);
+void dormqr_(char *side, char *trans, int *m, int *n, int *k, double *A,
+             int *lda, double *tau, double *C, int *ldc, double *work,
+             int *lwork, int *info);
+
+void sgels_(char *trans, int *m, int *n, int *nrhs, float *A, int *lda,
+            float *B, int *ldb, float *work, int *lwork, int *info);
+void dgels_(char *trans, int *m, int *n, int *nrhs, double *A, int *lda,
+            double *B, int *ldb, double *work, int *lwork, int *info);
+
+void ssyev_(char *jobz, char *uplo, int *n, float *A, int *lda, float *W,
+            float *work, int *lwork, int *info);
+void dsyev_(char *jobz, char *uplo, int *n, double *A, int *lda, double *W,
+            double *work, int *lwork, int *info);
+
+void ssyevd_(char *jobz, char *uplo, int *n, float *A, int *lda, float *W,
+             float *work, int *lwork, int *iwork, int *liwork, int *info);
+void dsyevd_(char *jobz, char *uplo, int *n, double *A, int *lda, double *W,
+             double *work, int *lwork, int *iwork, int *liwork, int *info);
+
+void sgesvd_(char *jobu, char *jobvt, int *m, int *n, float *A, int *lda,
+             float *S, float *U, int *ldu, float *V, int *ldv, float *work,
+             int *lwork, int *info);
+void dgesvd_(char *jobu, char *jobvt, int *m, int *n, double *A, int *lda,
+             double *S, double *U, int *ldu, double *V, int *ldv, double *work,
+             int *lwork, int *info);
+
+void sgbtrf_(int *m, int *n, int *kl, int *ku, float *AB, int *ldab, int *ipiv,
+             int *info);
+void dgbtrf_(int *m, int *n, int *kl, int *ku, double *AB, int *ldab,
+             int *ipiv, int *info);
+void cgbtrf_(int *m, int *n, int *kl, int *ku, rocblas_float_complex *AB,
+             int *ldab, int *ipiv, int *info);
+void zgbtrf_(int *m, int *n, int *kl, int *ku, rocblas_double_complex *AB,
+             int *ldab, int *ipiv, int *info);
+
+void sgbtrs_(char *trans, int *n, int *kl, int *ku, int *nrhs, float *AB,
+             int *ldab, int *ipiv, float *B, int *ldb, int *info);
+void dgbtrs_(char *trans, int *n, int *kl, int *ku, int *nrhs, double *AB,
+             int *ldab, int *ipiv, double *B, int *ldb, int *info);
+void cgbtrs_(char *trans, int *n, int *kl, int *ku, int *nrhs,
+             rocblas_float_complex *AB, int *ldab, int *ipiv,
+             rocblas_float_complex *B, int *ldb, int *info);
+void zgbtrs_(char *trans, int *n, int *kl, int *ku, int *nrhs,
+             rocblas_double_complex *AB, int *ldab, int *ipiv,
+             rocblas_double_complex *B, int *ldb, int *info);
+
+void sgtsv_(int *n, int *nrhs, float *dl, float *d, float *du, float *B,
+            int *ldb, int *info);
+void dgtsv_(int *n, int *nrhs, double *dl, double *d, double *du, double *B,
+            int *ldb, int *info);
+
+void sgehrd_(int *n, int *ilo, int *ihi, float *A, int *lda, float *tau,
+             float *work, int *lwork, int *info);
+void dgehrd_(int *n, int *ilo, int *ihi, double *A, int *lda, double *tau,
+             double *work, int *lwork, int *info);
+
+void sgeev_(char *jobvl, char *jobvr, int *n, float *A, int *lda, float *WR,
+            float *WI, float *VL, int *ldvl, float *VR, int *ldvr, float *work,
+            int *lwork, int *info);
+void dgeev_(char *jobvl, char *jobvr, int *n, double *A, int *lda, double *WR,
+            double *WI, double *VL, int *ldvl, double *VR, int *ldvr,
+            double *work, int *lwork, int *info);
+
 #ifdef __cplusplus
 }
 #endif
@@ -593,6 +738,24 @@ rocblas_int cblas_potf2(rocblas_fill uplo, rocblas_int n, double *A,
   return info;
 }
 
+template <>
+rocblas_int cblas_potf2(rocblas_fill uplo, rocblas_int n,
+                        rocblas_float_complex *A, rocblas_int lda) {
+  rocblas_int info;
+  char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+  cpotf2_(&uploC, &n, A, &lda, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_potf2(rocblas_fill uplo, rocblas_int n,
+                        rocblas_double_complex *A, rocblas_int lda) {
+  rocblas_int info;
+  char uploC = (uplo == rocblas_fill_upper) ? 'U' : 'L';
+  zpotf2_(&uploC, &n, A, &lda, &info);
+  return info;
+}
+
 // getf2
 template <>
 rocblas_int cblas_getf2(rocblas_int m, rocblas_int n, float *A, rocblas_int lda,
@@ -792,4 +955,568 @@ rocblas_int cblas_getrs<rocblas_double_complex>(
   rocblas_int info;
   zgetrs_(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
   return info;
-}
\ No newline at end of file
+}
+
+// gesv
+template <>
+rocblas_int cblas_gesv<float>(rocblas_int n, rocblas_int nrhs, float *A,
+                              rocblas_int lda, rocblas_int *ipiv, float *B,
+                              rocblas_int ldb) {
+  rocblas_int info;
+  sgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_gesv<double>(rocblas_int n, rocblas_int nrhs, double *A,
+                               rocblas_int lda, rocblas_int *ipiv, double *B,
+                               rocblas_int ldb) {
+  rocblas_int info;
+  dgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_gesv<rocblas_float_complex>(
+    rocblas_int n, rocblas_int nrhs, rocblas_float_complex *A, rocblas_int lda,
+    rocblas_int *ipiv, rocblas_float_complex *B, rocblas_int ldb) {
+  rocblas_int info;
+  cgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_gesv<rocblas_double_complex>(
+    rocblas_int n, rocblas_int nrhs, rocblas_double_complex *A,
+    rocblas_int lda, rocblas_int *ipiv, rocblas_double_complex *B,
+    rocblas_int ldb) {
+  rocblas_int info;
+  zgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+  return info;
+}
+
+// getri
+template <>
+rocblas_int cblas_getri<float>(rocblas_int n, float *A, rocblas_int lda,
+                               rocblas_int *ipiv) {
+  rocblas_int info;
+  rocblas_int lwork = 64 * std::max(1, n);
+  std::vector<float> work(lwork);
+  sgetri_(&n, A, &lda, ipiv, work.data(), &lwork, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_getri<double>(rocblas_int n, double *A, rocblas_int lda,
+                                rocblas_int *ipiv) {
+  rocblas_int info;
+  rocblas_int lwork = 64 * std::max(1, n);
+  std::vector<double> work(lwork);
+  dgetri_(&n, A, &lda, ipiv, work.data(), &lwork, &info);
+  return info;
+}
+
+// gecon
+template <>
+rocblas_int cblas_gecon<float>(char norm, rocblas_int n, float *A,
+                               rocblas_int lda, float anorm, float *rcond) {
+  rocblas_int info;
+  std::vector<float> work(4 * std::max(1, n));
+  std::vector<rocblas_int> iwork(std::max(1, n));
+  sgecon_(&norm, &n, A, &lda, &anorm, rcond, work.data(), iwork.data(), &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_gecon<double>(char norm, rocblas_int n, double *A,
+                                rocblas_int lda, double anorm, double *rcond) {
+  rocblas_int info;
+  std::vector<double> work(4 * std::max(1, n));
+  std::vector<rocblas_int> iwork(std::max(1, n));
+  dgecon_(&norm, &n, A, &lda, &anorm, rcond, work.data(), iwork.data(), &info);
+  return info;
+}
+
+// gerfs
+template <>
+rocblas_int cblas_gerfs<float>(char trans, rocblas_int n, rocblas_int nrhs,
+                               float *A, rocblas_int lda, float *AF,
+                               rocblas_int ldaf, rocblas_int *ipiv, float *B,
+                               rocblas_int ldb, float *X, rocblas_int ldx,
+                               float *ferr, float *berr) {
+  rocblas_int info;
+  std::vector<float> work(3 * std::max(1, n));
+  std::vector<rocblas_int> iwork(std::max(1, n));
+  sgerfs_(&trans, &n, &nrhs, A, &lda, AF, &ldaf, ipiv, B, &ldb, X, &ldx, ferr,
+          berr, work.data(), iwork.data(), &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_gerfs<double>(char trans, rocblas_int n, rocblas_int nrhs,
+                                double *A, rocblas_int lda, double *AF,
+                                rocblas_int ldaf, rocblas_int *ipiv, double *B,
+                                rocblas_int ldb, double *X, rocblas_int ldx,
+                                double *ferr, double *berr) {
+  rocblas_int info;
+  std::vector<double> work(3 * std::max(1, n));
+  std::vector<rocblas_int> iwork(std::max(1, n));
+  dgerfs_(&trans, &n, &nrhs, A, &lda, AF, &ldaf, ipiv, B, &ldb, X, &ldx, ferr,
+          berr, work.data(), iwork.data(), &info);
+  return info;
+}
+
+// geequ
+template <>
+rocblas_int cblas_geequ<float>(rocblas_int m, rocblas_int n, float *A,
+                               rocblas_int lda, float *r, float *c,
+                               float *rowcnd, float *colcnd, float *amax) {
+  rocblas_int info;
+  sgeequ_(&m, &n, A, &lda, r, c, rowcnd, colcnd, amax, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_geequ<double>(rocblas_int m, rocblas_int n, double *A,
+                                rocblas_int lda, double *r, double *c,
+                                double *rowcnd, double *colcnd, double *amax) {
+  rocblas_int info;
+  dgeequ_(&m, &n, A, &lda, r, c, rowcnd, colcnd, amax, &info);
+  return info;
+}
+
+// laqge
+template <>
+void cblas_laqge<float>(rocblas_int m, rocblas_int n, float *A,
+                        rocblas_int lda, float *r, float *c, float rowcnd,
+                        float colcnd, float amax, char *equed) {
+  slaqge_(&m, &n, A, &lda, r, c, &rowcnd, &colcnd, &amax, equed);
+}
+
+template <>
+void cblas_laqge<double>(rocblas_int m, rocblas_int n, double *A,
+                         rocblas_int lda, double *r, double *c, double rowcnd,
+                         double colcnd, double amax, char *equed) {
+  dlaqge_(&m, &n, A, &lda, r, c, &rowcnd, &colcnd, &amax, equed);
+}
+
+// lange
+template <>
+float cblas_lange<float>(char norm, rocblas_int m, rocblas_int n, float *A,
+                         rocblas_int lda) {
+  std::vector<float> work(std::max(1, m));
+  return slange_(&norm, &m, &n, A, &lda, work.data());
+}
+
+template <>
+double cblas_lange<double>(char norm, rocblas_int m, rocblas_int n, double *A,
+                           rocblas_int lda) {
+  std::vector<double> work(std::max(1, m));
+  return dlange_(&norm, &m, &n, A, &lda, work.data());
+}
+
+// lansy
+template <>
+float cblas_lansy<float>(char norm, char uplo, rocblas_int n, float *A,
+                         rocblas_int lda) {
+  std::vector<float> work(std::max(1, n));
+  return slansy_(&norm, &uplo, &n, A, &lda, work.data());
+}
+
+template <>
+double cblas_lansy<double>(char norm, char uplo, rocblas_int n, double *A,
+                           rocblas_int lda) {
+  std::vector<double> work(std::max(1, n));
+  return dlansy_(&norm, &uplo, &n, A, &lda, work.data());
+}
+
+// lantr
+template <>
+float cblas_lantr<float>(char norm, char uplo, char diag, rocblas_int m,
+                         rocblas_int n, float *A, rocblas_int lda) {
+  std::vector<float> work(std::max(1, m));
+  return slantr_(&norm, &uplo, &diag, &m, &n, A, &lda, work.data());
+}
+
+template <>
+double cblas_lantr<double>(char norm, char uplo, char diag, rocblas_int m,
+                           rocblas_int n, double *A, rocblas_int lda) {
+  std::vector<double> work(std::max(1, m));
+  return dlantr_(&norm, &uplo, &diag, &m, &n, A, &lda, work.data());
+}
+
+// pocon
+template <>
+rocblas_int cblas_pocon<float>(char uplo, rocblas_int n, float *A,
+                               rocblas_int lda, float anorm, float *rcond) {
+  rocblas_int info;
+  std::vector<float> work(3 * std::max(1, n));
+  std::vector<rocblas_int> iwork(std::max(1, n));
+  spocon_(&uplo, &n, A, &lda, &anorm, rcond, work.data(), iwork.data(), &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_pocon<double>(char uplo, rocblas_int n, double *A,
+                                rocblas_int lda, double anorm, double *rcond) {
+  rocblas_int info;
+  std::vector<double> work(3 * std::max(1, n));
+  std::vector<rocblas_int> iwork(std::max(1, n));
+  dpocon_(&uplo, &n, A, &lda, &anorm, rcond, work.data(), iwork.data(), &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_getri<rocblas_float_complex>(rocblas_int n,
+                                               rocblas_float_complex *A,
+                                               rocblas_int lda,
+                                               rocblas_int *ipiv) {
+  rocblas_int info;
+  rocblas_int lwork = 64 * std::max(1, n);
+  std::vector<rocblas_float_complex> work(lwork);
+  cgetri_(&n, A, &lda, ipiv, work.data(), &lwork, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_getri<rocblas_double_complex>(rocblas_int n,
+                                                rocblas_double_complex *A,
+                                                rocblas_int lda,
+                                                rocblas_int *ipiv) {
+  rocblas_int info;
+  rocblas_int lwork = 64 * std::max(1, n);
+  std::vector<rocblas_double_complex> work(lwork);
+  zgetri_(&n, A, &lda, ipiv, work.data(), &lwork, &info);
+  return info;
+}
+// geqr2
+template <>
+void cblas_geqr2<float>(rocblas_int m, rocblas_int n, float *A,
+                        rocblas_int lda, float *tau) {
+  rocblas_int info;
+  std::vector<float> work(std::max(1, n));
+  sgeqr2_(&m, &n, A, &lda, tau, work.data(), &info);
+}
+
+template <>
+void cblas_geqr2<double>(rocblas_int m, rocblas_int n, double *A,
+                         rocblas_int lda, double *tau) {
+  rocblas_int info;
+  std::vector<double> work(std::max(1, n));
+  dgeqr2_(&m, &n, A, &lda, tau, work.data(), &info);
+}
+
+// geqrf
+template <>
+void cblas_geqrf<float>(rocblas_int m, rocblas_int n, float *A,
+                        rocblas_int lda, float *tau) {
+  rocblas_int info;
+  rocblas_int lwork = std::max(1, n) * 64;
+  std::vector<float> work(lwork);
+  sgeqrf_(&m, &n, A, &lda, tau, work.data(), &lwork, &info);
+}
+
+template <>
+void cblas_geqrf<double>(rocblas_int m, rocblas_int n, double *A,
+                         rocblas_int lda, double *tau) {
+  rocblas_int info;
+  rocblas_int lwork = std::max(1, n) * 64;
+  std::vector<double> work(lwork);
+  dgeqrf_(&m, &n, A, &lda, tau, work.data(), &lwork, &info);
+}
+
+// geqp3
+template <>
+void cblas_geqp3<float>(rocblas_int m, rocblas_int n, float *A,
+                        rocblas_int lda, rocblas_int *jpvt, float *tau) {
+  rocblas_int info;
+  rocblas_int lwork = std::max(1, n + 1) * 64;
+  std::vector<float> work(lwork);
+  for (rocblas_int j = 0; j < n; j++)
+    jpvt[j] = 0; // all columns free
+  sgeqp3_(&m, &n, A, &lda, jpvt, tau, work.data(), &lwork, &info);
+}
+
+template <>
+void cblas_geqp3<double>(rocblas_int m, rocblas_int n, double *A,
+                         rocblas_int lda, rocblas_int *jpvt, double *tau) {
+  rocblas_int info;
+  rocblas_int lwork = std::max(1, n + 1) * 64;
+  std::vector<double> work(lwork);
+  for (rocblas_int j = 0; j < n; j++)
+    jpvt[j] = 0; // all columns free
+  dgeqp3_(&m, &n, A, &lda, jpvt, tau, work.data(), &lwork, &info);
+}
+
+// orgqr
+template <>
+void cblas_orgqr<float>(rocblas_int m, rocblas_int n, rocblas_int k, float *A,
+                        rocblas_int lda, float *tau) {
+  rocblas_int info;
+  rocblas_int lwork = std::max(1, n) * 64;
+  std::vector<float> work(lwork);
+  sorgqr_(&m, &n, &k, A, &lda, tau, work.data(), &lwork, &info);
+}
+
+template <>
+void cblas_orgqr<double>(rocblas_int m, rocblas_int n, rocblas_int k,
+                         double *A, rocblas_int lda, double *tau) {
+  rocblas_int info;
+  rocblas_int lwork = std::max(1, n) * 64;
+  std::vector<double> work(lwork);
+  dorgqr_(&m, &n, &k, A, &lda, tau, work.data(), &lwork, &info);
+}
+
+// ormqr
+template <>
+void cblas_ormqr<float>(char side, char trans, rocblas_int m, rocblas_int n,
+                        rocblas_int k, float *A, rocblas_int lda, float *tau,
+                        float *C, rocblas_int ldc) {
+  rocblas_int info;
+  rocblas_int lwork = std::max(1, std::max(m, n)) * 64;
+  std::vector<float> work(lwork);
+  sormqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work.data(),
+          &lwork, &info);
+}
+
+template <>
+void cblas_ormqr<double>(char side, char trans, rocblas_int m, rocblas_int n,
+                         rocblas_int k, double *A, rocblas_int lda,
+                         double *tau, double *C, rocblas_int ldc) {
+  rocblas_int info;
+  rocblas_int lwork = std::max(1, std::max(m, n)) * 64;
+  std::vector<double> work(lwork);
+  dormqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work.data(),
+          &lwork, &info);
+}
+
+// gels
+template <>
+void cblas_gels<float>(char trans, rocblas_int m, rocblas_int n,
+                       rocblas_int nrhs, float *A, rocblas_int lda, float *B,
+                       rocblas_int ldb) {
+  rocblas_int info;
+  rocblas_int lwork = std::max(1, std::min(m, n) + std::max(m, n)) * 64;
+  std::vector<float> work(std::max(lwork, nrhs * 64));
+  lwork = work.size();
+  sgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work.data(), &lwork, &info);
+}
+
+template <>
+void cblas_gels<double>(char trans, rocblas_int m, rocblas_int n,
+                        rocblas_int nrhs, double *A, rocblas_int lda,
+                        double *B, rocblas_int ldb) {
+  rocblas_int info;
+  rocblas_int lwork = std::max(1, std::min(m, n) + std::max(m, n)) * 64;
+  std::vector<double> work(std::max(lwork, nrhs * 64));
+  lwork = work.size();
+  dgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work.data(), &lwork, &info);
+}
+
+// syev
+template <>
+void cblas_syev<float>(char jobz, char uplo, rocblas_int n, float *A,
+                       rocblas_int lda, float *W) {
+  rocblas_int info;
+  rocblas_int lwork = std::max(1, n) * 64;
+  std::vector<float> work(lwork);
+  ssyev_(&jobz, &uplo, &n, A, &lda, W, work.data(), &lwork, &info);
+}
+
+template <>
+void cblas_syev<double>(char jobz, char uplo, rocblas_int n, double *A,
+                        rocblas_int lda, double *W) {
+  rocblas_int info;
+  rocblas_int lwork = std::max(1, n) * 64;
+  std::vector<double> work(lwork);
+  dsyev_(&jobz, &uplo, &n, A, &lda, W, work.data(), &lwork, &info);
+}
+
+// syevd
+template <>
+void cblas_syevd<float>(char jobz, char uplo, rocblas_int n, float *A,
+                        rocblas_int lda, float *W) {
+  rocblas_int info;
+  rocblas_int lwork = 1 + 6 * n + 2 * n * n;
+  rocblas_int liwork = 3 + 5 * n;
+  std::vector<float> work(lwork);
+  std::vector<rocblas_int> iwork(liwork);
+  ssyevd_(&jobz, &uplo, &n, A, &lda, W, work.data(), &lwork, iwork.data(),
+          &liwork, &info);
+}
+
+template <>
+void cblas_syevd<double>(char jobz, char uplo, rocblas_int n, double *A,
+                         rocblas_int lda, double *W) {
+  rocblas_int info;
+  rocblas_int lwork = 1 + 6 * n + 2 * n * n;
+  rocblas_int liwork = 3 + 5 * n;
+  std::vector<double> work(lwork);
+  std::vector<rocblas_int> iwork(liwork);
+  dsyevd_(&jobz, &uplo, &n, A, &lda, W, work.data(), &lwork, iwork.data(),
+          &liwork, &info);
+}
+
+// gesvd
+template <>
+void cblas_gesvd<float>(char jobu, char jobvt, rocblas_int m, rocblas_int n,
+                        float *A, rocblas_int lda, float *S, float *U,
+                        rocblas_int ldu, float *V, rocblas_int ldv) {
+  rocblas_int info;
+  rocblas_int lwork = (std::max(m, n) + 5 * std::min(m, n) + 1) * 64;
+  std::vector<float> work(lwork);
+  sgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work.data(),
+          &lwork, &info);
+}
+
+template <>
+void cblas_gesvd<double>(char jobu, char jobvt, rocblas_int m, rocblas_int n,
+                         double *A, rocblas_int lda, double *S, double *U,
+                         rocblas_int ldu, double *V, rocblas_int ldv) {
+  rocblas_int info;
+  rocblas_int lwork = (std::max(m, n) + 5 * std::min(m, n) + 1) * 64;
+  std::vector<double> work(lwork);
+  dgesvd_(&jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, V, &ldv, work.data(),
+          &lwork, &info);
+}
+
+// gbtrf
+template <>
+rocblas_int cblas_gbtrf<float>(rocblas_int m, rocblas_int n, rocblas_int kl,
+                               rocblas_int ku, float *AB, rocblas_int ldab,
+                               rocblas_int *ipiv) {
+  rocblas_int info;
+  sgbtrf_(&m, &n, &kl, &ku, AB, &ldab, ipiv, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_gbtrf<double>(rocblas_int m, rocblas_int n, rocblas_int kl,
+                                rocblas_int ku, double *AB, rocblas_int ldab,
+                                rocblas_int *ipiv) {
+  rocblas_int info;
+  dgbtrf_(&m, &n, &kl, &ku, AB, &ldab, ipiv, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_gbtrf<rocblas_float_complex>(
+    rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku,
+    rocblas_float_complex *AB, rocblas_int ldab, rocblas_int *ipiv) {
+  rocblas_int info;
+  cgbtrf_(&m, &n, &kl, &ku, AB, &ldab, ipiv, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_gbtrf<rocblas_double_complex>(
+    rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku,
+    rocblas_double_complex *AB, rocblas_int ldab, rocblas_int *ipiv) {
+  rocblas_int info;
+  zgbtrf_(&m, &n, &kl, &ku, AB, &ldab, ipiv, &info);
+  return info;
+}
+
+// gbtrs
+template <>
+rocblas_int cblas_gbtrs<float>(char trans, rocblas_int n, rocblas_int kl,
+                               rocblas_int ku, rocblas_int nrhs, float *AB,
+                               rocblas_int ldab, rocblas_int *ipiv, float *B,
+                               rocblas_int ldb) {
+  rocblas_int info;
+  sgbtrs_(&trans, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_gbtrs<double>(char trans, rocblas_int n, rocblas_int kl,
+                                rocblas_int ku, rocblas_int nrhs, double *AB,
+                                rocblas_int ldab, rocblas_int *ipiv, double *B,
+                                rocblas_int ldb) {
+  rocblas_int info;
+  dgbtrs_(&trans, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_gbtrs<rocblas_float_complex>(
+    char trans, rocblas_int n, rocblas_int kl, rocblas_int ku, rocblas_int nrhs,
+    rocblas_float_complex *AB, rocblas_int ldab, rocblas_int *ipiv,
+    rocblas_float_complex *B, rocblas_int ldb) {
+  rocblas_int info;
+  cgbtrs_(&trans, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_gbtrs<rocblas_double_complex>(
+    char trans, rocblas_int n, rocblas_int kl, rocblas_int ku, rocblas_int nrhs,
+    rocblas_double_complex *AB, rocblas_int ldab, rocblas_int *ipiv,
+    rocblas_double_complex *B, rocblas_int ldb) {
+  rocblas_int info;
+  zgbtrs_(&trans, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, &info);
+  return info;
+}
+
+// gtsv
+template <>
+rocblas_int cblas_gtsv<float>(rocblas_int n, rocblas_int nrhs, float *dl,
+                              float *d, float *du, float *B, rocblas_int ldb) {
+  rocblas_int info;
+  sgtsv_(&n, &nrhs, dl, d, du, B, &ldb, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_gtsv<double>(rocblas_int n, rocblas_int nrhs, double *dl,
+                               double *d, double *du, double *B,
+                               rocblas_int ldb) {
+  rocblas_int info;
+  dgtsv_(&n, &nrhs, dl, d, du, B, &ldb, &info);
+  return info;
+}
+
+// gehrd
+template <>
+void cblas_gehrd<float>(rocblas_int n, float *A, rocblas_int lda, float *tau) {
+  rocblas_int ilo = 1, info;
+  rocblas_int lwork = std::max(1, n) * 64;
+  std::vector<float> work(lwork);
+  sgehrd_(&n, &ilo, &n, A, &lda, tau, work.data(), &lwork, &info);
+}
+
+template <>
+void cblas_gehrd<double>(rocblas_int n, double *A, rocblas_int lda,
+                         double *tau) {
+  rocblas_int ilo = 1, info;
+  rocblas_int lwork = std::max(1, n) * 64;
+  std::vector<double> work(lwork);
+  dgehrd_(&n, &ilo, &n, A, &lda, tau, work.data(), &lwork, &info);
+}
+
+// geev, right eigenvectors only
+template <>
+rocblas_int cblas_geev<float>(char jobvr, rocblas_int n, float *A,
+                              rocblas_int lda, float *WR, float *WI, float *V,
+                              rocblas_int ldv) {
+  char jobvl = 'N';
+  rocblas_int ldvl = 1, info;
+  rocblas_int lwork = std::max(1, n) * 64;
+  std::vector<float> work(lwork);
+  sgeev_(&jobvl, &jobvr, &n, A, &lda, WR, WI, nullptr, &ldvl, V, &ldv,
+         work.data(), &lwork, &info);
+  return info;
+}
+
+template <>
+rocblas_int cblas_geev<double>(char jobvr, rocblas_int n, double *A,
+                               rocblas_int lda, double *WR, double *WI,
+                               double *V, rocblas_int ldv) {
+  char jobvl = 'N';
+  rocblas_int ldvl = 1, info;
+  rocblas_int lwork = std::max(1, n) * 64;
+  std::vector<double> work(lwork);
+  dgeev_(&jobvl, &jobvr, &n, A, &lda, WR, WI, nullptr, &ldvl, V, &ldv,
+         work.data(), &lwork, &info);
+  return info;
+}
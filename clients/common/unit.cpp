@@ -5,6 +5,7 @@
 
 #include "unit.h"
 #include "rocblas.h"
+#include <algorithm>
 #include <iostream>
 
 #define PRINT_IF_HIP_ERROR(INPUT_STATUS_FOR_CHECK)                             \
@@ -152,6 +153,38 @@ void potf2_err_res_check(double max_error, rocblas_int N,
 #endif
 }
 
+template <>
+void potrf_err_res_check(float max_error, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void potrf_err_res_check(double max_error, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void potupdate_err_res_check(float max_error, rocblas_int N,
+                             float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void potupdate_err_res_check(double max_error, rocblas_int N,
+                             double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
 template <>
 void getf2_err_res_check(float max_error, rocblas_int M, rocblas_int N,
                          float forward_tolerance, float eps) {
@@ -198,4 +231,324 @@ void getrs_err_res_check(double max_error, rocblas_int M, rocblas_int nhrs,
 #ifdef GOOGLE_TEST
   ASSERT_LE(max_error, forward_tolerance * eps);
 #endif
-}
\ No newline at end of file
+}
+
+template <>
+void gesv_err_res_check(float max_error, rocblas_int N, rocblas_int nhrs,
+                        float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void gesv_err_res_check(double max_error, rocblas_int N, rocblas_int nhrs,
+                        double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void getri_err_res_check(float max_error, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void getri_err_res_check(double max_error, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void gecon_err_res_check(float max_error, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void gecon_err_res_check(double max_error, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void pocon_err_res_check(float max_error, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void pocon_err_res_check(double max_error, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void gerfs_err_res_check(float max_error, rocblas_int N, rocblas_int nhrs,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void gerfs_err_res_check(double max_error, rocblas_int N, rocblas_int nhrs,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void geequ_err_res_check(float max_error, rocblas_int M, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void geequ_err_res_check(double max_error, rocblas_int M, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void lange_err_res_check(float max_error, rocblas_int M, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * std::max(M, N));
+#endif
+}
+
+template <>
+void lange_err_res_check(double max_error, rocblas_int M, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * std::max(M, N));
+#endif
+}
+
+template <>
+void geqrf_err_res_check(float max_error, rocblas_int M, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void geqrf_err_res_check(double max_error, rocblas_int M, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void geqp3_err_res_check(float max_error, rocblas_int M, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * std::max(M, N));
+#endif
+}
+
+template <>
+void geqp3_err_res_check(double max_error, rocblas_int M, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * std::max(M, N));
+#endif
+}
+
+template <>
+void orgqr_err_res_check(float max_error, rocblas_int M, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void orgqr_err_res_check(double max_error, rocblas_int M, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void ormqr_err_res_check(float max_error, rocblas_int M, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void ormqr_err_res_check(double max_error, rocblas_int M, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void gels_err_res_check(float max_error, rocblas_int M, rocblas_int N,
+                        float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * std::max(M, N));
+#endif
+}
+
+template <>
+void gels_err_res_check(double max_error, rocblas_int M, rocblas_int N,
+                        double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * std::max(M, N));
+#endif
+}
+
+template <>
+void syev_err_res_check(float max_error, rocblas_int N,
+                        float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void syev_err_res_check(double max_error, rocblas_int N,
+                        double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void gesvd_err_res_check(float max_error, rocblas_int M, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * std::max(M, N));
+#endif
+}
+
+template <>
+void gesvd_err_res_check(double max_error, rocblas_int M, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * std::max(M, N));
+#endif
+}
+
+template <>
+void gbtrf_err_res_check(float max_error, rocblas_int M, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void gbtrf_err_res_check(double max_error, rocblas_int M, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void gbtrs_err_res_check(float max_error, rocblas_int N, rocblas_int nhrs,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void gbtrs_err_res_check(double max_error, rocblas_int N, rocblas_int nhrs,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void gtsv_err_res_check(float max_error, rocblas_int N, rocblas_int nhrs,
+                        float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void gtsv_err_res_check(double max_error, rocblas_int N, rocblas_int nhrs,
+                        double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void gebltsv_err_res_check(float max_error, rocblas_int N, rocblas_int nhrs,
+                           float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void gebltsv_err_res_check(double max_error, rocblas_int N, rocblas_int nhrs,
+                           double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps);
+#endif
+}
+
+template <>
+void gehrd_err_res_check(float max_error, rocblas_int N,
+                         float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void gehrd_err_res_check(double max_error, rocblas_int N,
+                         double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void geev_err_res_check(float max_error, rocblas_int N,
+                        float forward_tolerance, float eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
+
+template <>
+void geev_err_res_check(double max_error, rocblas_int N,
+                        double forward_tolerance, double eps) {
+#ifdef GOOGLE_TEST
+  ASSERT_LE(max_error, forward_tolerance * eps * N);
+#endif
+}
@@ -204,6 +204,38 @@ rocblas_side char2rocblas_side(char value) {
   return rocblas_side_left;
 }
 
+rocsolver_evect char2rocsolver_evect(char value) {
+  switch (value) {
+  case 'V':
+    return rocsolver_evect_original;
+  case 'N':
+    return rocsolver_evect_none;
+  case 'v':
+    return rocsolver_evect_original;
+  case 'n':
+    return rocsolver_evect_none;
+  }
+  return rocsolver_evect_none;
+}
+
+rocsolver_svect char2rocsolver_svect(char value) {
+  switch (value) {
+  case 'A':
+    return rocsolver_svect_all;
+  case 'S':
+    return rocsolver_svect_singular;
+  case 'N':
+    return rocsolver_svect_none;
+  case 'a':
+    return rocsolver_svect_all;
+  case 's':
+    return rocsolver_svect_singular;
+  case 'n':
+    return rocsolver_svect_none;
+  }
+  return rocsolver_svect_none;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,198 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gbtrs.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,
+// std::tuple is good enough;
+
+typedef std::tuple<vector<int>, vector<int>, vector<int>, char, char>
+    gbtrs_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one
+which invalidates the matrix. like lda pairs with M, and "lda must >= M". case
+"lda < M" will be guarded by argument-checkers inside API of course. Yet, the
+goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not
+necessary
+=================================================================== */
+
+// each is a {N}
+const vector<vector<int>> matrix_size_range = {
+    {-1}, {10}, {40}, {500},
+};
+
+// vector of vector, each vector is a {kl, ku, ldab};
+// add/delete as a group
+const vector<vector<int>> band_range = {
+    {0, 0, 1}, {1, 1, 4}, {5, 3, 16}, {50, 50, 151}, {3, 2, 5}, {33, 2, 69},
+};
+
+// vector of vector, each vector is a {nhrs, ldb};
+// add/delete as a group
+const vector<vector<int>> rhs_range = {
+    {1, 500}, {10, 600},
+};
+
+const vector<vector<int>> large_matrix_size_range = {
+    {1000}, {10000}, {100000},
+};
+
+const vector<vector<int>> large_band_range = {
+    {50, 50, 151}, {100, 20, 221},
+};
+
+const vector<vector<int>> large_rhs_range = {
+    {1, 100000}, {16, 100000},
+};
+
+// vector of char, each is a pivot option: a diagonally dominant band (N),
+// or one dominant off the diagonal, factored with row interchanges (Y)
+const vector<char> pivot_range = {'N', 'Y'};
+
+const vector<char> transpose = {
+    'N',
+    'T',
+};
+
+/* ===============Google Unit
+ * Test==================================================== */
+
+/* =====================================================================
+     LAPACK gbtrs:
+=================================================================== */
+
+/* ============================Setup
+ * Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to
+// templated testers; Some routines may not touch/use certain "members" of
+// objects "argus". like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not
+// have ldb, ldc; That is fine. These testers & routines will leave untouched
+// members alone. Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like
+// "std::get<0>" which is not intuitive and error-prone
+
+Arguments setup_gbtrs_arguments(gbtrs_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  vector<int> band = std::get<1>(tup);
+  vector<int> rhs = std::get<2>(tup);
+
+  Arguments arg;
+
+  // see the comments about the ranges above
+  arg.M = matrix_size[0];
+  arg.kl = band[0];
+  arg.ku = band[1];
+  arg.lda = band[2];
+  arg.N = rhs[0];
+  arg.ldb = rhs[1];
+  arg.transA_option = std::get<3>(tup);
+  arg.pivot_option = std::get<4>(tup);
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class gbtrs_gtest : public ::TestWithParam<gbtrs_tuple> {
+protected:
+  gbtrs_gtest() {}
+  virtual ~gbtrs_gtest() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(gbtrs_gtest, gbtrs_gtest_float) {
+  // GetParam return a tuple. Tee setup routine unpack the tuple
+  // and initializes arg(Arguments) which will be passed to testing routine
+  // The Arguments data struture have physical meaning associated.
+  // while the tuple is non-intuitive.
+
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrs<float>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.kl < 0 || arg.ku < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < 2 * arg.kl + arg.ku + 1 || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else {
+      // a wrong pivot is reported as an internal error
+      EXPECT_EQ(rocblas_status_success, status);
+    }
+  }
+}
+
+TEST_P(gbtrs_gtest, gbtrs_gtest_double) {
+  // GetParam return a tuple. Tee setup routine unpack the tuple
+  // and initializes arg(Arguments) which will be passed to testing routine
+  // The Arguments data struture have physical meaning associated.
+  // while the tuple is non-intuitive.
+
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrs<double>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.kl < 0 || arg.ku < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < 2 * arg.kl + arg.ku + 1 || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else {
+      // a wrong pivot is reported as an internal error
+      EXPECT_EQ(rocblas_status_success, status);
+    }
+  }
+}
+
+// notice we are using vector of vector
+// so each element in xxx_range is a vector,
+// ValuesIn take each element (a vector) and combine them and feed them to
+// test_p The combinations are  { {N}, {kl, ku, ldab}, {nhrs, ldb}, trans,
+// pivot }
+
+// This function mainly test the scope of matrix_size.
+INSTANTIATE_TEST_CASE_P(daily_lapack, gbtrs_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                ValuesIn(large_band_range),
+                                ValuesIn(large_rhs_range),
+                                ValuesIn(transpose), Values('N')));
+
+// THis function mainly test the scope of band_range, the scope of
+// matrix_size_range is small
+INSTANTIATE_TEST_CASE_P(checkin_lapack, gbtrs_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(band_range), ValuesIn(rhs_range),
+                                ValuesIn(transpose), ValuesIn(pivot_range)));
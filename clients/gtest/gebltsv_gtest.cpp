@@ -0,0 +1,147 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gebltsv.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,
+// std::tuple is good enough;
+
+typedef vector<int> gebltsv_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one
+which invalidates the matrix. like lda pairs with M, and "lda must >= M". case
+"lda < M" will be guarded by argument-checkers inside API of course. Yet, the
+goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not
+necessary
+=================================================================== */
+
+// vector of vector, each vector is a {nb, nblocks, nhrs, lda, ldx,
+// batch_count}; add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1, 1, 1, 1, 1},      {4, -1, 1, 4, 4, 1},     {4, 4, -1, 4, 16, 1},
+    {4, 4, 1, 3, 16, 1},      {4, 4, 1, 4, 15, 1},     {4, 4, 1, 4, 16, -1},
+    {0, 4, 1, 1, 1, 2},       {4, 0, 1, 4, 1, 2},      {4, 4, 1, 4, 16, 0},
+    {1, 1, 1, 1, 1, 1},       {1, 9, 2, 1, 9, 3},      {4, 1, 1, 4, 4, 5},
+    {4, 10, 2, 5, 44, 3},     {8, 33, 1, 8, 264, 2},   {16, 17, 3, 20, 272, 2},
+    {32, 9, 2, 32, 300, 2},   {5, 100, 1, 5, 500, 10},
+};
+
+// many systems of thousands of block rows
+const vector<vector<int>> large_matrix_size_range = {
+    {4, 2000, 1, 4, 8000, 100},
+    {8, 1000, 2, 8, 8000, 20},
+    {16, 1000, 1, 16, 16000, 10},
+    {32, 500, 1, 32, 16000, 4},
+};
+
+/* ===============Google Unit
+ * Test==================================================== */
+
+/* =====================================================================
+     LAPACK gebltsv_strided_batched:
+=================================================================== */
+
+/* ============================Setup
+ * Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to
+// templated testers; Some routines may not touch/use certain "members" of
+// objects "argus". like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not
+// have ldb, ldc; That is fine. These testers & routines will leave untouched
+// members alone. Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like
+// "std::get<0>" which is not intuitive and error-prone
+
+Arguments setup_gebltsv_arguments(gebltsv_tuple matrix_size) {
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_size[0];
+  arg.N = matrix_size[1];
+  arg.K = matrix_size[2];
+  arg.lda = matrix_size[3];
+  arg.ldb = matrix_size[4];
+  arg.batch_count = matrix_size[5];
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class gebltsv_gtest : public ::TestWithParam<gebltsv_tuple> {
+protected:
+  gebltsv_gtest() {}
+  virtual ~gebltsv_gtest() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(gebltsv_gtest, gebltsv_strided_batched_gtest_float) {
+  Arguments arg = setup_gebltsv_arguments(GetParam());
+
+  rocblas_status status = testing_gebltsv<float>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M * arg.N) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(gebltsv_gtest, gebltsv_strided_batched_gtest_double) {
+  Arguments arg = setup_gebltsv_arguments(GetParam());
+
+  rocblas_status status = testing_gebltsv<double>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M * arg.N) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+// notice we are using vector of vector
+// so each element in xxx_range is a vector,
+// ValuesIn take each element (a vector) and feed them to test_p
+// The combinations are  { nb, nblocks, nhrs, lda, ldx, batch_count }
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, gebltsv_gtest,
+                        ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, gebltsv_gtest,
+                        ValuesIn(matrix_size_range));
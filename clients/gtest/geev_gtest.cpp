@@ -0,0 +1,150 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_geev.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,
+// std::tuple is good enough;
+
+typedef std::tuple<vector<int>, char> geev_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one
+which invalidates the matrix. like lda pairs with M, and "lda must >= M". case
+"lda < M" will be guarded by argument-checkers inside API of course. Yet, the
+goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not
+necessary
+=================================================================== */
+
+// vector of vector, each vector is a {N, lda};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1},  {10, 5},  {0, 1},   {1, 1},    {2, 2},    {3, 10},
+    {20, 20}, {33, 40}, {66, 66}, {74, 74},  {75, 80},  {97, 100},
+    {130, 130},
+};
+
+// sizes past several panels of the Hessenberg reduction, and windows of the
+// multishift QR iteration with 64 shifts from n = 590 on
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192}, {300, 310}, {500, 512}, {1100, 1100}, {2048, 2048},
+};
+
+// vector of char, each is an evect, which can be "eigenvalues only (N) or
+// also the eigenvectors (V)"
+
+const vector<char> evect_range = {'N', 'V'};
+
+/* ===============Google Unit
+ * Test==================================================== */
+
+/* =====================================================================
+     LAPACK geev:
+=================================================================== */
+
+/* ============================Setup
+ * Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to
+// templated testers; Some routines may not touch/use certain "members" of
+// objects "argus". like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not
+// have ldb, ldc; That is fine. These testers & routines will leave untouched
+// members alone. Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like
+// "std::get<0>" which is not intuitive and error-prone
+
+Arguments setup_geev_arguments(geev_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  char evect = std::get<1>(tup);
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.N = matrix_size[0];
+  arg.lda = matrix_size[1];
+
+  arg.evect_option = evect;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class geev_gtest : public ::TestWithParam<geev_tuple> {
+protected:
+  geev_gtest() {}
+  virtual ~geev_gtest() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(geev_gtest, geev_gtest_float) {
+  Arguments arg = setup_geev_arguments(GetParam());
+
+  rocblas_status status = testing_geev<float>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.N) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(geev_gtest, geev_gtest_double) {
+  Arguments arg = setup_geev_arguments(GetParam());
+
+  rocblas_status status = testing_geev<double>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.N) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+// notice we are using vector of vector
+// so each element in xxx_range is a vector,
+// ValuesIn take each element (a vector) and combine them and feed them to
+// test_p The combinations are  { {N, lda}, evect }
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, geev_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                ValuesIn(evect_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, geev_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(evect_range)));
@@ -0,0 +1,174 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gels.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,
+// std::tuple is good enough;
+
+typedef std::tuple<vector<int>, char> gels_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one
+which invalidates the matrix. like lda pairs with M, and "lda must >= M". case
+"lda < M" will be guarded by argument-checkers inside API of course. Yet, the
+goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not
+necessary
+=================================================================== */
+
+// vector of vector, each vector is a {M, N, nrhs, lda, ldb, batch_count};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1, 1, 1, 1, 1},       {1, -1, 1, 1, 1, 1},
+    {1, 1, -1, 1, 1, 1},       {10, 10, 1, 5, 10, 1},
+    {10, 20, 1, 10, 10, 1},    {10, 10, 1, 10, 10, -1},
+    {0, 10, 3, 1, 10, 2},      {10, 0, 3, 10, 10, 2},
+    {10, 10, 0, 10, 10, 1},    {1, 1, 1, 1, 1, 1},
+    {40, 20, 5, 40, 40, 1},    {20, 40, 5, 20, 40, 3},
+    {50, 50, 7, 60, 60, 0},    {300, 64, 10, 300, 300, 5},
+    {64, 300, 2, 64, 310, 4},
+};
+
+// sizes past the single kernel of small problems
+const vector<vector<int>> large_matrix_size_range = {
+    {1000, 100, 10, 1000, 1000, 1}, {100, 1000, 10, 100, 1000, 2},
+    {2000, 500, 30, 2000, 2000, 1}, {20000, 64, 4, 20000, 20000, 1},
+    {1024, 64, 16, 1024, 1024, 16},
+};
+
+// vector of char, each is an operation on A, which can be "no transpose (N)
+// or transpose (T)"
+
+const vector<char> trans_range = {'N', 'T'};
+
+/* ===============Google Unit
+ * Test==================================================== */
+
+/* =====================================================================
+     LAPACK gels:
+=================================================================== */
+
+/* ============================Setup
+ * Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to
+// templated testers; Some routines may not touch/use certain "members" of
+// objects "argus". like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not
+// have ldb, ldc; That is fine. These testers & routines will leave untouched
+// members alone. Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like
+// "std::get<0>" which is not intuitive and error-prone
+
+Arguments setup_gels_arguments(gels_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  char trans = std::get<1>(tup);
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_size[0];
+  arg.N = matrix_size[1];
+  arg.K = matrix_size[2];
+  arg.lda = matrix_size[3];
+  arg.ldb = matrix_size[4];
+  arg.batch_count = matrix_size[5];
+
+  arg.transA_option = trans;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class gels_gtest : public ::TestWithParam<gels_tuple> {
+protected:
+  gels_gtest() {}
+  virtual ~gels_gtest() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(gels_gtest, gels_gtest_float) {
+  // GetParam return a tuple. Tee setup routine unpack the tuple
+  // and initializes arg(Arguments) which will be passed to testing routine
+  // The Arguments data struture have physical meaning associated.
+  // while the tuple is non-intuitive.
+
+  Arguments arg = setup_gels_arguments(GetParam());
+
+  rocblas_status status = testing_gels<float>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.K < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < max(arg.M, arg.N)) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.batch_count < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(gels_gtest, gels_gtest_double) {
+  // GetParam return a tuple. Tee setup routine unpack the tuple
+  // and initializes arg(Arguments) which will be passed to testing routine
+  // The Arguments data struture have physical meaning associated.
+  // while the tuple is non-intuitive.
+
+  Arguments arg = setup_gels_arguments(GetParam());
+
+  rocblas_status status = testing_gels<double>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.K < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < max(arg.M, arg.N)) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.batch_count < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+// notice we are using vector of vector
+// so each element in xxx_range is a vector,
+// ValuesIn take each element (a vector) and feed them to test_p
+// The combinations are  { {M, N, nrhs, lda, ldb, batch_count}, trans }
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, gels_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                ValuesIn(trans_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, gels_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(trans_range)));
@@ -0,0 +1,183 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_geqrf.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,
+// std::tuple is good enough;
+
+typedef std::vector<int> geqrf_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one
+which invalidates the matrix. like lda pairs with M, and "lda must >= M". case
+"lda < M" will be guarded by argument-checkers inside API of course. Yet, the
+goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not
+necessary
+=================================================================== */
+
+// vector of vector, each vector is a {M, N, lda};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1, 1},   {1, -1, 1},   {10, 10, 5},   {0, 10, 1},   {10, 0, 10},
+    {1, 1, 1},    {10, 30, 20}, {300, 20, 300}, {20, 300, 20}, {150, 150, 160},
+};
+
+// sizes past the switch to the blocked algorithm
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192, 192},   {640, 960, 960},      {1000, 1000, 1000},
+    {2000, 500, 2000}, {100000, 64, 100000}, {70000, 256, 70000},
+};
+
+// tall and skinny matrices, factored by geqrf through TSQR (as are the
+// last ones of large_matrix_size_range)
+const vector<vector<int>> tall_matrix_size_range = {
+    {1024, 1, 1024}, {2048, 20, 2050}, {5000, 40, 5000}, {9000, 9, 9000},
+};
+
+/* ===============Google Unit
+ * Test==================================================== */
+
+/* =====================================================================
+     LAPACK geqrf:
+=================================================================== */
+
+/* ============================Setup
+ * Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to
+// templated testers; Some routines may not touch/use certain "members" of
+// objects "argus". like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not
+// have ldb, ldc; That is fine. These testers & routines will leave untouched
+// members alone. Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like
+// "std::get<0>" which is not intuitive and error-prone
+
+Arguments setup_geqrf_arguments(geqrf_tuple tup) {
+
+  vector<int> matrix_size = tup;
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_size[0];
+  arg.N = matrix_size[1];
+  arg.lda = matrix_size[2];
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class geqrf_gtest : public ::TestWithParam<geqrf_tuple> {
+protected:
+  geqrf_gtest() {}
+  virtual ~geqrf_gtest() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(geqrf_gtest, geqrf_gtest_float) {
+  Arguments arg = setup_geqrf_arguments(GetParam());
+
+  rocblas_status status = testing_geqrf<float>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(geqrf_gtest, geqrf_gtest_double) {
+  Arguments arg = setup_geqrf_arguments(GetParam());
+
+  rocblas_status status = testing_geqrf<double>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(geqrf_gtest, geqr2_gtest_float) {
+  Arguments arg = setup_geqrf_arguments(GetParam());
+
+  rocblas_status status = testing_geqrf<float>(arg, true);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(geqrf_gtest, geqr2_gtest_double) {
+  Arguments arg = setup_geqrf_arguments(GetParam());
+
+  rocblas_status status = testing_geqrf<double>(arg, true);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+// notice we are using vector of vector
+// so each element in xxx_range is a vector,
+// ValuesIn take each element (a vector) and feed them to test_p
+// The combinations are  { {M, N, lda} }
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, geqrf_gtest,
+                        ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, geqrf_gtest,
+                        ValuesIn(matrix_size_range));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack_tall, geqrf_gtest,
+                        ValuesIn(tall_matrix_size_range));
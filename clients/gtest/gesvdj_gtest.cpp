@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesvdj.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,
+// std::tuple is good enough;
+
+typedef std::tuple<vector<int>, char, char> gesvdj_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one
+which invalidates the matrix. like lda pairs with M, and "lda must >= M". case
+"lda < M" will be guarded by argument-checkers inside API of course. Yet, the
+goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not
+necessary
+=================================================================== */
+
+// vector of vector, each vector is a {M, N, lda, batch_count};
+// add/delete as a group; wide matrices are decomposed through their
+// transpose
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1, 1, 1},    {1, -1, 1, 1},   {10, 10, 5, 1},  {10, 10, 10, -1},
+    {0, 0, 1, 3},     {0, 5, 1, 3},    {3, 3, 3, 0},    {1, 1, 1, 2},
+    {2, 2, 2, 5},     {3, 3, 3, 100},  {8, 5, 10, 10},  {5, 8, 5, 10},
+    {20, 13, 20, 20}, {13, 20, 16, 7}, {64, 64, 64, 5}, {64, 30, 70, 3},
+    {30, 64, 30, 3},  {65, 20, 65, 2},
+};
+
+// a large batch of small matrices, and matrices past the size kept in LDS
+const vector<vector<int>> large_matrix_size_range = {
+    {3, 3, 3, 100000},
+    {16, 8, 16, 20000},
+    {64, 64, 64, 2000},
+    {100, 80, 100, 10},
+};
+
+// vector of char, each is an svect, which can be "all the singular vectors
+// (A), the first min(M,N) only (S) or none (N)"
+
+// Each letter is capitalizied, e.g. do not use 'a', but use 'A' instead.
+
+const vector<char> svect_range = {'A', 'S', 'N'};
+
+/* ===============Google Unit
+ * Test==================================================== */
+
+/* =====================================================================
+     LAPACK gesvdj_batched and gesvdj_strided_batched:
+=================================================================== */
+
+/* ============================Setup
+ * Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to
+// templated testers; Some routines may not touch/use certain "members" of
+// objects "argus". like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not
+// have ldb, ldc; That is fine. These testers & routines will leave untouched
+// members alone. Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like
+// "std::get<0>" which is not intuitive and error-prone
+
+Arguments setup_gesvdj_arguments(gesvdj_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  char left_svect = std::get<1>(tup);
+  char right_svect = std::get<2>(tup);
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_size[0];
+  arg.N = matrix_size[1];
+  arg.lda = matrix_size[2];
+  arg.batch_count = matrix_size[3];
+
+  arg.left_svect_option = left_svect;
+  arg.right_svect_option = right_svect;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class gesvdj_gtest : public ::TestWithParam<gesvdj_tuple> {
+protected:
+  gesvdj_gtest() {}
+  virtual ~gesvdj_gtest() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(gesvdj_gtest, gesvdj_batched_gtest_float) {
+  Arguments arg = setup_gesvdj_arguments(GetParam());
+
+  rocblas_status status = testing_gesvdj<float>(arg, false);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.batch_count < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(gesvdj_gtest, gesvdj_batched_gtest_double) {
+  Arguments arg = setup_gesvdj_arguments(GetParam());
+
+  rocblas_status status = testing_gesvdj<double>(arg, false);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.batch_count < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(gesvdj_gtest, gesvdj_strided_batched_gtest_float) {
+  Arguments arg = setup_gesvdj_arguments(GetParam());
+
+  rocblas_status status = testing_gesvdj<float>(arg, true);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.batch_count < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(gesvdj_gtest, gesvdj_strided_batched_gtest_double) {
+  Arguments arg = setup_gesvdj_arguments(GetParam());
+
+  rocblas_status status = testing_gesvdj<double>(arg, true);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.batch_count < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+// notice we are using vector of vector
+// so each element in xxx_range is a vector,
+// ValuesIn take each element (a vector) and combine them and feed them to
+// test_p The combinations are  { {M, N, lda, batch_count}, left_svect,
+// right_svect }
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, gesvdj_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                ValuesIn(svect_range), ValuesIn(svect_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, gesvdj_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(svect_range), ValuesIn(svect_range)));
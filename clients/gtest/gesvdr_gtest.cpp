@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesvdr.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,
+// std::tuple is good enough;
+
+typedef std::tuple<vector<int>, char, char> gesvdr_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one
+which invalidates the matrix. like lda pairs with M, and "lda must >= M". case
+"lda < M" will be guarded by argument-checkers inside API of course. Yet, the
+goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not
+necessary
+=================================================================== */
+
+// vector of vector, each vector is a {M, N, lda, rank, oversample,
+// power_iters}; add/delete as a group; the sketch is clipped to min(M,N)
+// columns
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1, 1, 0, 5, 1},      {1, -1, 1, 0, 5, 1},
+    {10, 10, 5, 2, 5, 1},     {10, 10, 10, 11, 5, 1},
+    {10, 10, 10, 2, -1, 1},   {10, 10, 10, 2, 5, -1},
+    {0, 0, 1, 0, 5, 1},       {10, 3, 10, 0, 5, 1},
+    {5, 5, 5, 5, 3, 1},       {100, 40, 100, 8, 10, 2},
+    {40, 100, 40, 8, 10, 2},  {150, 150, 160, 20, 0, 0},
+    {300, 60, 300, 10, 5, 3}, {60, 300, 64, 10, 5, 3},
+};
+
+// tall and wide matrices whose sketch goes through TSQR
+const vector<vector<int>> large_matrix_size_range = {
+    {20000, 500, 20000, 50, 10, 2},
+    {500, 20000, 500, 50, 10, 2},
+    {4000, 2000, 4000, 200, 20, 1},
+};
+
+// vector of char, each is an svect, which can be "the leading singular
+// vectors (S) or none (N)"
+
+// Each letter is capitalizied, e.g. do not use 's', but use 'S' instead.
+
+const vector<char> svect_range = {'S', 'N'};
+
+/* ===============Google Unit
+ * Test==================================================== */
+
+/* =====================================================================
+     LAPACK gesvdr:
+=================================================================== */
+
+/* ============================Setup
+ * Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to
+// templated testers; Some routines may not touch/use certain "members" of
+// objects "argus". like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not
+// have ldb, ldc; That is fine. These testers & routines will leave untouched
+// members alone. Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like
+// "std::get<0>" which is not intuitive and error-prone
+
+Arguments setup_gesvdr_arguments(gesvdr_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  char left_svect = std::get<1>(tup);
+  char right_svect = std::get<2>(tup);
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_size[0];
+  arg.N = matrix_size[1];
+  arg.lda = matrix_size[2];
+  arg.K = matrix_size[3];
+  arg.oversample = matrix_size[4];
+  arg.power_iters = matrix_size[5];
+
+  arg.left_svect_option = left_svect;
+  arg.right_svect_option = right_svect;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class gesvdr_gtest : public ::TestWithParam<gesvdr_tuple> {
+protected:
+  gesvdr_gtest() {}
+  virtual ~gesvdr_gtest() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(gesvdr_gtest, gesvdr_gtest_float) {
+  Arguments arg = setup_gesvdr_arguments(GetParam());
+
+  rocblas_status status = testing_gesvdr<float>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.oversample < 0 ||
+        arg.power_iters < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.K > min(arg.M, arg.N)) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(gesvdr_gtest, gesvdr_gtest_double) {
+  Arguments arg = setup_gesvdr_arguments(GetParam());
+
+  rocblas_status status = testing_gesvdr<double>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.oversample < 0 ||
+        arg.power_iters < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.K > min(arg.M, arg.N)) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+// notice we are using vector of vector
+// so each element in xxx_range is a vector,
+// ValuesIn take each element (a vector) and combine them and feed them to
+// test_p The combinations are  { {M, N, lda, rank, oversample, power_iters},
+// left_svect, right_svect }
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, gesvdr_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                ValuesIn(svect_range), ValuesIn(svect_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, gesvdr_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(svect_range), ValuesIn(svect_range)));
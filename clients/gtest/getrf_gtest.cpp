@@ -50,12 +50,14 @@ const vector<int> n_size_range = {
     1, 20, 40, 600, 600,
 };
 
+// sizes from 2048 on run through the task graph
 const vector<vector<int>> large_matrix_size_range = {
-    {192, 192}, {640, 640}, {1000, 1000}, {1024, 1024}, {2000, 2000},
+    {192, 192},   {640, 640},   {1000, 1000},
+    {1024, 1024}, {2000, 2000}, {2500, 2600},
 };
 
 const vector<int> large_n_size_range = {
-    192, 640, 1000, 1024, 2000,
+    192, 640, 1000, 1024, 2000, 2500,
 };
 
 /* ===============Google Unit
@@ -51,6 +51,11 @@ const vector<vector<int>> matrix_sizeB_range = {
     {-1, 1}, {10, 10}, {10, 20}, {500, 500}, {500, 750},
 };
 
+// few right hand sides ({nrhs, ldb}) go through the fused getrs kernel
+const vector<vector<int>> narrow_matrix_sizeB_range = {
+    {1, 500}, {3, 750}, {8, 500},
+};
+
 const vector<vector<int>> large_matrix_sizeA_range = {
     {192, 192}, {640, 640}, {1000, 1000}, {1024, 1024}, {2000, 2000},
 };
@@ -153,6 +158,36 @@ TEST_P(getrs_gtest, getrs_gtest_double) {
   }
 }
 
+TEST_P(getrs_gtest, getrs_invdiag_gtest_float) {
+  Arguments arg = setup_getrs_arguments(GetParam());
+
+  rocblas_status status = testing_getrs<float>(arg, true);
+
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(getrs_gtest, getrs_invdiag_gtest_double) {
+  Arguments arg = setup_getrs_arguments(GetParam());
+
+  rocblas_status status = testing_getrs<double>(arg, true);
+
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
 // notice we are using vector of vector
 // so each element in xxx_range is a vector,
 // ValuesIn take each element (a vector) and combine them and feed them to
@@ -170,3 +205,9 @@ INSTANTIATE_TEST_CASE_P(checkin_lapack, getrs_gtest,
                         Combine(ValuesIn(matrix_sizeA_range),
                                 ValuesIn(matrix_sizeA_range),
                                 ValuesIn(transpose)));
+
+// This function mainly tests the fused path for few right hand sides
+INSTANTIATE_TEST_CASE_P(checkin_lapack_narrow, getrs_gtest,
+                        Combine(ValuesIn(matrix_sizeA_range),
+                                ValuesIn(narrow_matrix_sizeB_range),
+                                ValuesIn(transpose)));
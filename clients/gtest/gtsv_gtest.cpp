@@ -0,0 +1,180 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gtsv.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,
+// std::tuple is good enough;
+
+typedef vector<int> gtsv_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one
+which invalidates the matrix. like lda pairs with M, and "lda must >= M". case
+"lda < M" will be guarded by argument-checkers inside API of course. Yet, the
+goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not
+necessary
+=================================================================== */
+
+// vector of vector, each vector is a {M, nhrs, ldb, batch_count};
+// add/delete as a group; orders past 1024 take the partitioned algorithm,
+// past 32 * 1024 with two levels of separators
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1, 1, 1},      {10, -1, 10, 1},    {10, 1, 5, 1},
+    {10, 1, 10, -1},    {0, 1, 1, 3},       {10, 0, 10, 3},
+    {10, 1, 10, 0},     {1, 1, 1, 1},       {2, 3, 2, 5},
+    {7, 2, 10, 100},    {64, 1, 64, 10},    {100, 4, 120, 7},
+    {1023, 2, 1023, 3}, {1024, 1, 1024, 2}, {1025, 3, 1030, 2},
+    {3000, 2, 3000, 3},
+};
+
+// many small systems, as from ADI sweeps, and large ones
+const vector<vector<int>> large_matrix_size_range = {
+    {16, 1, 16, 100000},
+    {256, 1, 256, 20000},
+    {40000, 2, 40000, 4},
+    {1000000, 1, 1000000, 1},
+};
+
+/* ===============Google Unit
+ * Test==================================================== */
+
+/* =====================================================================
+     LAPACK gtsv and gtsv_strided_batched:
+=================================================================== */
+
+/* ============================Setup
+ * Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to
+// templated testers; Some routines may not touch/use certain "members" of
+// objects "argus". like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not
+// have ldb, ldc; That is fine. These testers & routines will leave untouched
+// members alone. Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like
+// "std::get<0>" which is not intuitive and error-prone
+
+Arguments setup_gtsv_arguments(gtsv_tuple matrix_size) {
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_size[0];
+  arg.N = matrix_size[1];
+  arg.ldb = matrix_size[2];
+  arg.batch_count = matrix_size[3];
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class gtsv_gtest : public ::TestWithParam<gtsv_tuple> {
+protected:
+  gtsv_gtest() {}
+  virtual ~gtsv_gtest() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(gtsv_gtest, gtsv_gtest_float) {
+  Arguments arg = setup_gtsv_arguments(GetParam());
+
+  rocblas_status status = testing_gtsv<float>(arg, false);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(gtsv_gtest, gtsv_gtest_double) {
+  Arguments arg = setup_gtsv_arguments(GetParam());
+
+  rocblas_status status = testing_gtsv<double>(arg, false);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(gtsv_gtest, gtsv_strided_batched_gtest_float) {
+  Arguments arg = setup_gtsv_arguments(GetParam());
+
+  rocblas_status status = testing_gtsv<float>(arg, true);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.batch_count < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(gtsv_gtest, gtsv_strided_batched_gtest_double) {
+  Arguments arg = setup_gtsv_arguments(GetParam());
+
+  rocblas_status status = testing_gtsv<double>(arg, true);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0 || arg.batch_count < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+// notice we are using vector of vector
+// so each element in xxx_range is a vector,
+// ValuesIn take each element (a vector) and feed them to test_p
+// The combinations are  { M, nhrs, ldb, batch_count }
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, gtsv_gtest,
+                        ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, gtsv_gtest,
+                        ValuesIn(matrix_size_range));
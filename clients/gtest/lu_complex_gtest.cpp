@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_lu_complex.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> getrf_complex_tuple;
+typedef std::tuple<vector<int>, vector<int>, char> getrs_complex_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        the complex LU factorization and solve with google test
+     =================================================================== */
+
+// vector of vector, each vector is a {M, lda};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1}, {10, 10}, {10, 20}, {500, 500}, {500, 750},
+};
+
+// each is a N; below GETRF_GETF2_SWITCHSIZE getrf is done by getf2
+const vector<int> n_size_range = {
+    1, 20, 40, 600,
+};
+
+// few right hand sides ({nrhs, ldb}) go through the fused getrs kernel
+const vector<vector<int>> matrix_sizeB_range = {
+    {1, 500}, {3, 750}, {10, 500}, {500, 500},
+};
+
+const vector<vector<int>> large_matrix_size_range = {
+    {640, 640}, {1024, 1024}, {2500, 2600},
+};
+
+const vector<int> large_n_size_range = {
+    640, 1024, 2500,
+};
+
+const vector<char> transpose = {
+    'N',
+    'T',
+    'C',
+};
+
+/* =====================================================================
+     LAPACK getrf, complex:
+=================================================================== */
+
+Arguments setup_getrf_complex_arguments(getrf_complex_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  int n_size = std::get<1>(tup);
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_size[0];
+  arg.N = n_size;
+  arg.lda = matrix_size[1];
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class getrf_complex_gtest : public ::TestWithParam<getrf_complex_tuple> {
+protected:
+  getrf_complex_gtest() {}
+  virtual ~getrf_complex_gtest() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(getrf_complex_gtest, getrf_gtest_float_complex) {
+  Arguments arg = setup_getrf_complex_arguments(GetParam());
+
+  rocblas_status status =
+      testing_getrf_complex<rocblas_float_complex, float>(arg);
+
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(getrf_complex_gtest, getrf_gtest_double_complex) {
+  Arguments arg = setup_getrf_complex_arguments(GetParam());
+
+  rocblas_status status =
+      testing_getrf_complex<rocblas_double_complex, double>(arg);
+
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, getrf_complex_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, getrf_complex_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(n_size_range)));
+
+/* =====================================================================
+     LAPACK getrs, complex:
+=================================================================== */
+
+Arguments setup_getrs_complex_arguments(getrs_complex_tuple tup) {
+
+  vector<int> matrix_sizeA = std::get<0>(tup);
+  vector<int> matrix_sizeB = std::get<1>(tup);
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_sizeA[0];
+  arg.N = matrix_sizeB[0];
+  arg.lda = matrix_sizeA[1];
+  arg.ldb = matrix_sizeB[1];
+  arg.transA_option = std::get<2>(tup);
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class getrs_complex_gtest : public ::TestWithParam<getrs_complex_tuple> {
+protected:
+  getrs_complex_gtest() {}
+  virtual ~getrs_complex_gtest() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(getrs_complex_gtest, getrs_gtest_float_complex) {
+  Arguments arg = setup_getrs_complex_arguments(GetParam());
+
+  rocblas_status status =
+      testing_getrs_complex<rocblas_float_complex, float>(arg);
+
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(getrs_complex_gtest, getrs_gtest_double_complex) {
+  Arguments arg = setup_getrs_complex_arguments(GetParam());
+
+  rocblas_status status =
+      testing_getrs_complex<rocblas_double_complex, double>(arg);
+
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0 || arg.N < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M || arg.ldb < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+// the solves with few right hand sides take the fused kernel, the others the
+// trsm path
+INSTANTIATE_TEST_CASE_P(checkin_lapack, getrs_complex_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(matrix_sizeB_range),
+                                ValuesIn(transpose)));
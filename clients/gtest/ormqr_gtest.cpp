@@ -0,0 +1,163 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_ormqr.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,
+// std::tuple is good enough;
+
+typedef std::tuple<vector<int>, char, char> ormqr_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one
+which invalidates the matrix. like lda pairs with M, and "lda must >= M". case
+"lda < M" will be guarded by argument-checkers inside API of course. Yet, the
+goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not
+necessary
+=================================================================== */
+
+// vector of vector, each vector is a {M, N, K, lda, ldc}; lda is large
+// enough for the order of Q from either side
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1, 1, 1, 1},        {10, 10, 11, 10, 10},  {10, 10, 5, 5, 10},
+    {10, 10, 5, 10, 5},      {0, 10, 0, 10, 1},     {10, 0, 0, 10, 10},
+    {1, 1, 1, 1, 1},         {30, 20, 10, 40, 30},  {20, 30, 0, 30, 20},
+    {300, 40, 20, 300, 300}, {40, 300, 20, 300, 40}, {150, 150, 150, 150, 150},
+};
+
+// sizes past the switch to the blocked algorithm
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192, 192, 192, 192},
+    {640, 320, 300, 640, 640},
+    {1000, 1000, 900, 1000, 1000},
+    {2000, 500, 500, 2000, 2000},
+};
+
+const vector<char> side = {
+    'L',
+    'R',
+};
+
+const vector<char> transpose = {
+    'N',
+    'T',
+};
+
+/* ===============Google Unit
+ * Test==================================================== */
+
+/* =====================================================================
+     LAPACK ormqr:
+=================================================================== */
+
+/* ============================Setup
+ * Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to
+// templated testers; Some routines may not touch/use certain "members" of
+// objects "argus". like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not
+// have ldb, ldc; That is fine. These testers & routines will leave untouched
+// members alone. Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like
+// "std::get<0>" which is not intuitive and error-prone
+
+Arguments setup_ormqr_arguments(ormqr_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+
+  Arguments arg;
+
+  // see the comments about matrix_size_range above
+  arg.M = matrix_size[0];
+  arg.N = matrix_size[1];
+  arg.K = matrix_size[2];
+  arg.lda = matrix_size[3];
+  arg.ldc = matrix_size[4];
+  arg.side_option = std::get<1>(tup);
+  arg.transA_option = std::get<2>(tup);
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class ormqr_gtest : public ::TestWithParam<ormqr_tuple> {
+protected:
+  ormqr_gtest() {}
+  virtual ~ormqr_gtest() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(ormqr_gtest, ormqr_gtest_float) {
+  Arguments arg = setup_ormqr_arguments(GetParam());
+
+  rocblas_status status = testing_ormqr<float>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    int nq = (arg.side_option == 'L') ? arg.M : arg.N;
+    if (arg.M < 0 || arg.N < 0 || arg.K < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.K > nq || arg.lda < nq || arg.ldc < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(ormqr_gtest, ormqr_gtest_double) {
+  Arguments arg = setup_ormqr_arguments(GetParam());
+
+  rocblas_status status = testing_ormqr<double>(arg);
+
+  // if not success, then the input argument is problematic, so detect the error
+  // message
+  if (status != rocblas_status_success) {
+
+    int nq = (arg.side_option == 'L') ? arg.M : arg.N;
+    if (arg.M < 0 || arg.N < 0 || arg.K < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.K > nq || arg.lda < nq || arg.ldc < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+// notice we are using vector of vector
+// so each element in xxx_range is a vector,
+// ValuesIn take each element (a vector) and combine them and feed them to
+// test_p The combinations are  { {M, N, K, lda, ldc}, side, trans }
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, ormqr_gtest,
+                        Combine(ValuesIn(large_matrix_size_range),
+                                ValuesIn(side), ValuesIn(transpose)));
+
+INSTANTIATE_TEST_CASE_P(checkin_lapack, ormqr_gtest,
+                        Combine(ValuesIn(matrix_size_range), ValuesIn(side),
+                                ValuesIn(transpose)));
@@ -4,6 +4,7 @@
  * ************************************************************************ */
 
 #include "testing_potf2.hpp"
+#include "testing_potf2_complex.hpp"
 #include "utility.h"
 #include <gtest/gtest.h>
 #include <math.h>
@@ -145,6 +146,38 @@ TEST_P(potf2_gtest, potf2_gtest_double) {
   }
 }
 
+TEST_P(potf2_gtest, potf2_gtest_float_complex) {
+  Arguments arg = setup_potf2_arguments(GetParam());
+
+  rocblas_status status =
+      testing_potf2_complex<rocblas_float_complex, float>(arg);
+
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
+TEST_P(potf2_gtest, potf2_gtest_double_complex) {
+  Arguments arg = setup_potf2_arguments(GetParam());
+
+  rocblas_status status =
+      testing_potf2_complex<rocblas_double_complex, double>(arg);
+
+  if (status != rocblas_status_success) {
+
+    if (arg.M < 0) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    } else if (arg.lda < arg.M) {
+      EXPECT_EQ(rocblas_status_invalid_size, status);
+    }
+  }
+}
+
 // notice we are using vector of vector
 // so each element in xxx_range is a vector,
 // ValuesIn take each element (a vector) and combine them and feed them to
@@ -31,6 +31,11 @@
 
 void potf2_arg_check(rocsolver_status status, rocsolver_int N);
 
+void potrf_arg_check(rocsolver_status status, rocsolver_int N);
+
+void potupdate_arg_check(rocsolver_status status, rocsolver_int N,
+                         rocsolver_int K, rocsolver_int lda, rocsolver_int ldx);
+
 void getf2_arg_check(rocsolver_status status, rocsolver_int M, rocsolver_int N);
 
 void getrf_arg_check(rocsolver_status status, rocsolver_int M, rocsolver_int N);
@@ -38,6 +43,77 @@ void getrf_arg_check(rocsolver_status status, rocsolver_int M, rocsolver_int N);
 void getrs_arg_check(rocsolver_status status, rocsolver_int M,
                      rocsolver_int nhrs, rocblas_int lda, rocblas_int ldb);
 
+void gesv_arg_check(rocsolver_status status, rocsolver_int N,
+                    rocsolver_int nhrs, rocsolver_int lda, rocsolver_int ldb);
+
+void getri_arg_check(rocsolver_status status, rocsolver_int N,
+                     rocsolver_int lda);
+
+void gecon_arg_check(rocsolver_status status, rocsolver_int N,
+                     rocsolver_int lda);
+
+void pocon_arg_check(rocsolver_status status, rocsolver_int N,
+                     rocsolver_int lda);
+
+void geequ_arg_check(rocsolver_status status, rocsolver_int M, rocsolver_int N,
+                     rocsolver_int lda);
+
+void lange_arg_check(rocsolver_status status, rocsolver_int M, rocsolver_int N,
+                     rocsolver_int lda, rocsolver_int batch_count);
+
+void geqrf_arg_check(rocsolver_status status, rocsolver_int M, rocsolver_int N,
+                     rocsolver_int lda);
+
+void orgqr_arg_check(rocsolver_status status, rocsolver_int M, rocsolver_int N,
+                     rocsolver_int K, rocsolver_int lda);
+
+void ormqr_arg_check(rocsolver_status status, char side, rocsolver_int M,
+                     rocsolver_int N, rocsolver_int K, rocsolver_int lda,
+                     rocsolver_int ldc);
+
+void gels_arg_check(rocsolver_status status, rocsolver_int M, rocsolver_int N,
+                    rocsolver_int nrhs, rocsolver_int lda, rocsolver_int ldb,
+                    rocsolver_int batch_count);
+
+void syev_arg_check(rocsolver_status status, rocsolver_int N,
+                    rocsolver_int lda);
+
+void syevj_arg_check(rocsolver_status status, rocsolver_int N,
+                     rocsolver_int lda, rocsolver_int batch_count);
+
+void gesvd_arg_check(rocsolver_status status, rocsolver_int M, rocsolver_int N,
+                     rocsolver_int lda);
+
+void gesvdj_arg_check(rocsolver_status status, rocsolver_int M,
+                      rocsolver_int N, rocsolver_int lda,
+                      rocsolver_int batch_count);
+
+void gesvdr_arg_check(rocsolver_status status, rocsolver_int M,
+                      rocsolver_int N, rocsolver_int lda, rocsolver_int rank,
+                      rocsolver_int oversample, rocsolver_int power_iters);
+
+void gbtrf_arg_check(rocsolver_status status, rocsolver_int M, rocsolver_int N,
+                     rocsolver_int kl, rocsolver_int ku, rocsolver_int ldab);
+
+void gbtrs_arg_check(rocsolver_status status, rocsolver_int N,
+                     rocsolver_int kl, rocsolver_int ku, rocsolver_int nhrs,
+                     rocsolver_int ldab, rocsolver_int ldb);
+
+void gtsv_arg_check(rocsolver_status status, rocsolver_int N,
+                    rocsolver_int nhrs, rocsolver_int ldb,
+                    rocsolver_int batch_count);
+
+void gebltsv_arg_check(rocsolver_status status, rocsolver_int nb,
+                       rocsolver_int nblocks, rocsolver_int nhrs,
+                       rocsolver_int lda, rocsolver_int ldx,
+                       rocsolver_int batch_count);
+
+void gehrd_arg_check(rocsolver_status status, rocsolver_int N,
+                     rocsolver_int lda);
+
+void geev_arg_check(rocsolver_status status, rocsolver_int N,
+                    rocsolver_int lda, rocsolver_int ldv, bool vectors);
+
 template <typename T> void verify_not_nan(T arg);
 
 template <typename T> void verify_equal(T arg1, T arg2, const char *message);
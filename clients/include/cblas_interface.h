@@ -110,8 +110,106 @@ rocblas_int cblas_getrs(char trans, rocblas_int n, rocblas_int nrhs, T *A,
                         rocblas_int lda, rocblas_int *ipiv, T *B,
                         rocblas_int ldb);
 
+template <typename T>
+rocblas_int cblas_getri(rocblas_int n, T *A, rocblas_int lda,
+                        rocblas_int *ipiv);
+
+template <typename T>
+rocblas_int cblas_gecon(char norm, rocblas_int n, T *A, rocblas_int lda,
+                        T anorm, T *rcond);
+
+template <typename T>
+rocblas_int cblas_pocon(char uplo, rocblas_int n, T *A, rocblas_int lda,
+                        T anorm, T *rcond);
+
+template <typename T>
+rocblas_int cblas_gerfs(char trans, rocblas_int n, rocblas_int nrhs, T *A,
+                        rocblas_int lda, T *AF, rocblas_int ldaf,
+                        rocblas_int *ipiv, T *B, rocblas_int ldb, T *X,
+                        rocblas_int ldx, T *ferr, T *berr);
+
+template <typename T>
+rocblas_int cblas_geequ(rocblas_int m, rocblas_int n, T *A, rocblas_int lda,
+                        T *r, T *c, T *rowcnd, T *colcnd, T *amax);
+
+template <typename T>
+void cblas_laqge(rocblas_int m, rocblas_int n, T *A, rocblas_int lda, T *r,
+                 T *c, T rowcnd, T colcnd, T amax, char *equed);
+
+template <typename T>
+T cblas_lange(char norm, rocblas_int m, rocblas_int n, T *A, rocblas_int lda);
+
+template <typename T>
+T cblas_lansy(char norm, char uplo, rocblas_int n, T *A, rocblas_int lda);
+
+template <typename T>
+T cblas_lantr(char norm, char uplo, char diag, rocblas_int m, rocblas_int n,
+              T *A, rocblas_int lda);
+
+template <typename T>
+rocblas_int cblas_gesv(rocblas_int n, rocblas_int nrhs, T *A, rocblas_int lda,
+                       rocblas_int *ipiv, T *B, rocblas_int ldb);
+
 template <typename T>
 rocblas_int cblas_potrf(char uplo, rocblas_int m, T *A, rocblas_int lda);
+
+template <typename T>
+void cblas_geqr2(rocblas_int m, rocblas_int n, T *A, rocblas_int lda, T *tau);
+
+template <typename T>
+void cblas_geqrf(rocblas_int m, rocblas_int n, T *A, rocblas_int lda, T *tau);
+
+template <typename T>
+void cblas_geqp3(rocblas_int m, rocblas_int n, T *A, rocblas_int lda,
+                 rocblas_int *jpvt, T *tau);
+
+template <typename T>
+void cblas_orgqr(rocblas_int m, rocblas_int n, rocblas_int k, T *A,
+                 rocblas_int lda, T *tau);
+
+template <typename T>
+void cblas_ormqr(char side, char trans, rocblas_int m, rocblas_int n,
+                 rocblas_int k, T *A, rocblas_int lda, T *tau, T *C,
+                 rocblas_int ldc);
+
+template <typename T>
+void cblas_gels(char trans, rocblas_int m, rocblas_int n, rocblas_int nrhs,
+                T *A, rocblas_int lda, T *B, rocblas_int ldb);
+
+template <typename T>
+void cblas_syev(char jobz, char uplo, rocblas_int n, T *A, rocblas_int lda,
+                T *W);
+
+template <typename T>
+void cblas_syevd(char jobz, char uplo, rocblas_int n, T *A, rocblas_int lda,
+                 T *W);
+
+template <typename T>
+void cblas_gesvd(char jobu, char jobvt, rocblas_int m, rocblas_int n, T *A,
+                 rocblas_int lda, T *S, T *U, rocblas_int ldu, T *V,
+                 rocblas_int ldv);
+
+template <typename T>
+rocblas_int cblas_gbtrf(rocblas_int m, rocblas_int n, rocblas_int kl,
+                        rocblas_int ku, T *AB, rocblas_int ldab,
+                        rocblas_int *ipiv);
+
+template <typename T>
+rocblas_int cblas_gbtrs(char trans, rocblas_int n, rocblas_int kl,
+                        rocblas_int ku, rocblas_int nrhs, T *AB,
+                        rocblas_int ldab, rocblas_int *ipiv, T *B,
+                        rocblas_int ldb);
+
+template <typename T>
+rocblas_int cblas_gtsv(rocblas_int n, rocblas_int nrhs, T *dl, T *d, T *du,
+                       T *B, rocblas_int ldb);
+
+template <typename T>
+void cblas_gehrd(rocblas_int n, T *A, rocblas_int lda, T *tau);
+
+template <typename T>
+rocblas_int cblas_geev(char jobvr, rocblas_int n, T *A, rocblas_int lda, T *WR,
+                       T *WI, T *V, rocblas_int ldv);
 /* ============================================================================================
  */
 
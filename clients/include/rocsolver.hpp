@@ -21,6 +21,87 @@ inline rocblas_status rocsolver_potf2(rocblas_handle handle, rocblas_fill uplo,
   return rocsolver_dpotf2(handle, uplo, n, A, lda);
 }
 
+template <>
+inline rocblas_status rocsolver_potf2(rocblas_handle handle, rocblas_fill uplo,
+                                      rocblas_int n, rocblas_float_complex *A,
+                                      rocblas_int lda) {
+  return rocsolver_cpotf2(handle, uplo, n, A, lda);
+}
+
+template <>
+inline rocblas_status rocsolver_potf2(rocblas_handle handle, rocblas_fill uplo,
+                                      rocblas_int n, rocblas_double_complex *A,
+                                      rocblas_int lda) {
+  return rocsolver_zpotf2(handle, uplo, n, A, lda);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_potrf(rocblas_handle handle, rocblas_fill uplo,
+                                      rocblas_int n, T *A, rocblas_int lda);
+
+template <>
+inline rocblas_status rocsolver_potrf(rocblas_handle handle, rocblas_fill uplo,
+                                      rocblas_int n, float *A,
+                                      rocblas_int lda) {
+  return rocsolver_spotrf(handle, uplo, n, A, lda);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf(rocblas_handle handle, rocblas_fill uplo,
+                                      rocblas_int n, double *A,
+                                      rocblas_int lda) {
+  return rocsolver_dpotrf(handle, uplo, n, A, lda);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_potupdate(rocblas_handle handle,
+                                          rocblas_fill uplo, rocblas_int n,
+                                          rocblas_int k, T *A, rocblas_int lda,
+                                          T *X, rocblas_int ldx);
+
+template <>
+inline rocblas_status rocsolver_potupdate(rocblas_handle handle,
+                                          rocblas_fill uplo, rocblas_int n,
+                                          rocblas_int k, float *A,
+                                          rocblas_int lda, float *X,
+                                          rocblas_int ldx) {
+  return rocsolver_spotupdate(handle, uplo, n, k, A, lda, X, ldx);
+}
+
+template <>
+inline rocblas_status rocsolver_potupdate(rocblas_handle handle,
+                                          rocblas_fill uplo, rocblas_int n,
+                                          rocblas_int k, double *A,
+                                          rocblas_int lda, double *X,
+                                          rocblas_int ldx) {
+  return rocsolver_dpotupdate(handle, uplo, n, k, A, lda, X, ldx);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_potdowndate(rocblas_handle handle,
+                                            rocblas_fill uplo, rocblas_int n,
+                                            rocblas_int k, T *A,
+                                            rocblas_int lda, T *X,
+                                            rocblas_int ldx);
+
+template <>
+inline rocblas_status rocsolver_potdowndate(rocblas_handle handle,
+                                            rocblas_fill uplo, rocblas_int n,
+                                            rocblas_int k, float *A,
+                                            rocblas_int lda, float *X,
+                                            rocblas_int ldx) {
+  return rocsolver_spotdowndate(handle, uplo, n, k, A, lda, X, ldx);
+}
+
+template <>
+inline rocblas_status rocsolver_potdowndate(rocblas_handle handle,
+                                            rocblas_fill uplo, rocblas_int n,
+                                            rocblas_int k, double *A,
+                                            rocblas_int lda, double *X,
+                                            rocblas_int ldx) {
+  return rocsolver_dpotdowndate(handle, uplo, n, k, A, lda, X, ldx);
+}
+
 template <typename T>
 inline rocblas_status rocsolver_getf2(rocblas_handle handle, rocblas_int m,
                                       rocblas_int n, T *A, rocblas_int lda,
@@ -40,6 +121,20 @@ inline rocblas_status rocsolver_getf2(rocblas_handle handle, rocblas_int m,
   return rocsolver_dgetf2(handle, m, n, A, lda, ipiv);
 }
 
+template <>
+inline rocblas_status rocsolver_getf2(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_float_complex *A,
+                                      rocblas_int lda, rocblas_int *ipiv) {
+  return rocsolver_cgetf2(handle, m, n, A, lda, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_getf2(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_double_complex *A,
+                                      rocblas_int lda, rocblas_int *ipiv) {
+  return rocsolver_zgetf2(handle, m, n, A, lda, ipiv);
+}
+
 template <typename T>
 inline rocblas_status rocsolver_getrf(rocblas_handle handle, rocblas_int m,
                                       rocblas_int n, T *A, rocblas_int lda,
@@ -59,6 +154,20 @@ inline rocblas_status rocsolver_getrf(rocblas_handle handle, rocblas_int m,
   return rocsolver_dgetrf(handle, m, n, A, lda, ipiv);
 }
 
+template <>
+inline rocblas_status rocsolver_getrf(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_float_complex *A,
+                                      rocblas_int lda, rocblas_int *ipiv) {
+  return rocsolver_cgetrf(handle, m, n, A, lda, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_double_complex *A,
+                                      rocblas_int lda, rocblas_int *ipiv) {
+  return rocsolver_zgetrf(handle, m, n, A, lda, ipiv);
+}
+
 template <typename T>
 inline rocblas_status
 rocsolver_getrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
@@ -81,4 +190,1056 @@ rocsolver_getrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
   return rocsolver_dgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
 }
 
+template <>
+inline rocblas_status
+rocsolver_getrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                rocblas_int nrhs, const rocblas_float_complex *A,
+                rocblas_int lda, const rocblas_int *ipiv,
+                rocblas_float_complex *B, rocblas_int ldb) {
+  return rocsolver_cgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+template <>
+inline rocblas_status
+rocsolver_getrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                rocblas_int nrhs, const rocblas_double_complex *A,
+                rocblas_int lda, const rocblas_int *ipiv,
+                rocblas_double_complex *B, rocblas_int ldb) {
+  return rocsolver_zgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_getrs_invdiag(rocblas_handle handle,
+                                              rocblas_int n, const T *A,
+                                              rocblas_int lda, T *invD);
+
+template <>
+inline rocblas_status rocsolver_getrs_invdiag(rocblas_handle handle,
+                                              rocblas_int n, const float *A,
+                                              rocblas_int lda, float *invD) {
+  return rocsolver_sgetrs_invdiag(handle, n, A, lda, invD);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_invdiag(rocblas_handle handle,
+                                              rocblas_int n, const double *A,
+                                              rocblas_int lda, double *invD) {
+  return rocsolver_dgetrs_invdiag(handle, n, A, lda, invD);
+}
+
+template <typename T>
+inline rocblas_status
+rocsolver_getrs_with_invdiag(rocblas_handle handle, rocblas_operation trans,
+                             rocblas_int n, rocblas_int nrhs, const T *A,
+                             rocblas_int lda, const rocblas_int *ipiv,
+                             const T *invD, T *B, rocblas_int ldb);
+
+template <>
+inline rocblas_status rocsolver_getrs_with_invdiag(
+    rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+    rocblas_int nrhs, const float *A, rocblas_int lda, const rocblas_int *ipiv,
+    const float *invD, float *B, rocblas_int ldb) {
+  return rocsolver_sgetrs_with_invdiag(handle, trans, n, nrhs, A, lda, ipiv,
+                                       invD, B, ldb);
+}
+
+template <>
+inline rocblas_status rocsolver_getrs_with_invdiag(
+    rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+    rocblas_int nrhs, const double *A, rocblas_int lda, const rocblas_int *ipiv,
+    const double *invD, double *B, rocblas_int ldb) {
+  return rocsolver_dgetrs_with_invdiag(handle, trans, n, nrhs, A, lda, ipiv,
+                                       invD, B, ldb);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_lu_plan_factor(rocsolver_lu_plan plan,
+                                               const T *A, rocblas_int lda);
+
+template <>
+inline rocblas_status rocsolver_lu_plan_factor(rocsolver_lu_plan plan,
+                                               const float *A,
+                                               rocblas_int lda) {
+  return rocsolver_slu_plan_factor(plan, A, lda);
+}
+
+template <>
+inline rocblas_status rocsolver_lu_plan_factor(rocsolver_lu_plan plan,
+                                               const double *A,
+                                               rocblas_int lda) {
+  return rocsolver_dlu_plan_factor(plan, A, lda);
+}
+
+template <typename T>
+inline rocblas_status
+rocsolver_lu_plan_factor_equilibrated(rocsolver_lu_plan plan, const T *A,
+                                      rocblas_int lda, const T *r, const T *c);
+
+template <>
+inline rocblas_status
+rocsolver_lu_plan_factor_equilibrated(rocsolver_lu_plan plan, const float *A,
+                                      rocblas_int lda, const float *r,
+                                      const float *c) {
+  return rocsolver_slu_plan_factor_equilibrated(plan, A, lda, r, c);
+}
+
+template <>
+inline rocblas_status
+rocsolver_lu_plan_factor_equilibrated(rocsolver_lu_plan plan, const double *A,
+                                      rocblas_int lda, const double *r,
+                                      const double *c) {
+  return rocsolver_dlu_plan_factor_equilibrated(plan, A, lda, r, c);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_lu_plan_solve(rocsolver_lu_plan plan,
+                                              rocblas_operation trans,
+                                              rocblas_int nrhs, T *B,
+                                              rocblas_int ldb);
+
+template <>
+inline rocblas_status rocsolver_lu_plan_solve(rocsolver_lu_plan plan,
+                                              rocblas_operation trans,
+                                              rocblas_int nrhs, float *B,
+                                              rocblas_int ldb) {
+  return rocsolver_slu_plan_solve(plan, trans, nrhs, B, ldb);
+}
+
+template <>
+inline rocblas_status rocsolver_lu_plan_solve(rocsolver_lu_plan plan,
+                                              rocblas_operation trans,
+                                              rocblas_int nrhs, double *B,
+                                              rocblas_int ldb) {
+  return rocsolver_dlu_plan_solve(plan, trans, nrhs, B, ldb);
+}
+
+// precision of a plan for the data type T
+template <typename T> inline rocblas_precision rocsolver_precision_of();
+
+template <> inline rocblas_precision rocsolver_precision_of<float>() {
+  return rocblas_precision_single;
+}
+
+template <> inline rocblas_precision rocsolver_precision_of<double>() {
+  return rocblas_precision_double;
+}
+
+template <typename T>
+inline rocblas_status rocsolver_gesv(rocblas_handle handle, rocblas_int n,
+                                     rocblas_int nrhs, T *A, rocblas_int lda,
+                                     rocblas_int *ipiv, T *B, rocblas_int ldb);
+
+template <>
+inline rocblas_status rocsolver_gesv(rocblas_handle handle, rocblas_int n,
+                                     rocblas_int nrhs, float *A,
+                                     rocblas_int lda, rocblas_int *ipiv,
+                                     float *B, rocblas_int ldb) {
+  return rocsolver_sgesv(handle, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+template <>
+inline rocblas_status rocsolver_gesv(rocblas_handle handle, rocblas_int n,
+                                     rocblas_int nrhs, double *A,
+                                     rocblas_int lda, rocblas_int *ipiv,
+                                     double *B, rocblas_int ldb) {
+  return rocsolver_dgesv(handle, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_getri(rocblas_handle handle, rocblas_int n,
+                                      T *A, rocblas_int lda,
+                                      const rocblas_int *ipiv);
+
+template <>
+inline rocblas_status rocsolver_getri(rocblas_handle handle, rocblas_int n,
+                                      float *A, rocblas_int lda,
+                                      const rocblas_int *ipiv) {
+  return rocsolver_sgetri(handle, n, A, lda, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_getri(rocblas_handle handle, rocblas_int n,
+                                      double *A, rocblas_int lda,
+                                      const rocblas_int *ipiv) {
+  return rocsolver_dgetri(handle, n, A, lda, ipiv);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_gecon(rocblas_handle handle,
+                                      rocsolver_norm_type norm, rocblas_int n,
+                                      const T *A, rocblas_int lda,
+                                      const T *anorm, T *rcond);
+
+template <>
+inline rocblas_status rocsolver_gecon(rocblas_handle handle,
+                                      rocsolver_norm_type norm, rocblas_int n,
+                                      const float *A, rocblas_int lda,
+                                      const float *anorm, float *rcond) {
+  return rocsolver_sgecon(handle, norm, n, A, lda, anorm, rcond);
+}
+
+template <>
+inline rocblas_status rocsolver_gecon(rocblas_handle handle,
+                                      rocsolver_norm_type norm, rocblas_int n,
+                                      const double *A, rocblas_int lda,
+                                      const double *anorm, double *rcond) {
+  return rocsolver_dgecon(handle, norm, n, A, lda, anorm, rcond);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_pocon(rocblas_handle handle, rocblas_fill uplo,
+                                      rocblas_int n, const T *A,
+                                      rocblas_int lda, const T *anorm,
+                                      T *rcond);
+
+template <>
+inline rocblas_status rocsolver_pocon(rocblas_handle handle, rocblas_fill uplo,
+                                      rocblas_int n, const float *A,
+                                      rocblas_int lda, const float *anorm,
+                                      float *rcond) {
+  return rocsolver_spocon(handle, uplo, n, A, lda, anorm, rcond);
+}
+
+template <>
+inline rocblas_status rocsolver_pocon(rocblas_handle handle, rocblas_fill uplo,
+                                      rocblas_int n, const double *A,
+                                      rocblas_int lda, const double *anorm,
+                                      double *rcond) {
+  return rocsolver_dpocon(handle, uplo, n, A, lda, anorm, rcond);
+}
+
+template <typename T>
+inline rocblas_status
+rocsolver_gerfs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                rocblas_int nrhs, const T *A, rocblas_int lda, const T *AF,
+                rocblas_int ldaf, const rocblas_int *ipiv, const T *B,
+                rocblas_int ldb, T *X, rocblas_int ldx, T *ferr, T *berr);
+
+template <>
+inline rocblas_status
+rocsolver_gerfs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                rocblas_int nrhs, const float *A, rocblas_int lda,
+                const float *AF, rocblas_int ldaf, const rocblas_int *ipiv,
+                const float *B, rocblas_int ldb, float *X, rocblas_int ldx,
+                float *ferr, float *berr) {
+  return rocsolver_sgerfs(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, B,
+                          ldb, X, ldx, ferr, berr);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gerfs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                rocblas_int nrhs, const double *A, rocblas_int lda,
+                const double *AF, rocblas_int ldaf, const rocblas_int *ipiv,
+                const double *B, rocblas_int ldb, double *X, rocblas_int ldx,
+                double *ferr, double *berr) {
+  return rocsolver_dgerfs(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, B,
+                          ldb, X, ldx, ferr, berr);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_geequ(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, const T *A,
+                                      rocblas_int lda, T *r, T *c, T *rowcnd,
+                                      T *colcnd, T *amax);
+
+template <>
+inline rocblas_status rocsolver_geequ(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, const float *A,
+                                      rocblas_int lda, float *r, float *c,
+                                      float *rowcnd, float *colcnd,
+                                      float *amax) {
+  return rocsolver_sgeequ(handle, m, n, A, lda, r, c, rowcnd, colcnd, amax);
+}
+
+template <>
+inline rocblas_status rocsolver_geequ(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, const double *A,
+                                      rocblas_int lda, double *r, double *c,
+                                      double *rowcnd, double *colcnd,
+                                      double *amax) {
+  return rocsolver_dgeequ(handle, m, n, A, lda, r, c, rowcnd, colcnd, amax);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_laqge(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *A, rocblas_int lda,
+                                      const T *r, const T *c, const T *rowcnd,
+                                      const T *colcnd, const T *amax,
+                                      rocsolver_equed *equed);
+
+template <>
+inline rocblas_status rocsolver_laqge(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *A, rocblas_int lda,
+                                      const float *r, const float *c,
+                                      const float *rowcnd, const float *colcnd,
+                                      const float *amax,
+                                      rocsolver_equed *equed) {
+  return rocsolver_slaqge(handle, m, n, A, lda, r, c, rowcnd, colcnd, amax,
+                          equed);
+}
+
+template <>
+inline rocblas_status rocsolver_laqge(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *A, rocblas_int lda,
+                                      const double *r, const double *c,
+                                      const double *rowcnd,
+                                      const double *colcnd, const double *amax,
+                                      rocsolver_equed *equed) {
+  return rocsolver_dlaqge(handle, m, n, A, lda, r, c, rowcnd, colcnd, amax,
+                          equed);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_lange(rocblas_handle handle,
+                                      rocsolver_norm_type norm, rocblas_int m,
+                                      rocblas_int n, const T *A,
+                                      rocblas_int lda, T *result);
+
+template <>
+inline rocblas_status rocsolver_lange(rocblas_handle handle,
+                                      rocsolver_norm_type norm, rocblas_int m,
+                                      rocblas_int n, const float *A,
+                                      rocblas_int lda, float *result) {
+  return rocsolver_slange(handle, norm, m, n, A, lda, result);
+}
+
+template <>
+inline rocblas_status rocsolver_lange(rocblas_handle handle,
+                                      rocsolver_norm_type norm, rocblas_int m,
+                                      rocblas_int n, const double *A,
+                                      rocblas_int lda, double *result) {
+  return rocsolver_dlange(handle, norm, m, n, A, lda, result);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_lange_strided_batched(rocblas_handle handle,
+                                                      rocsolver_norm_type norm,
+                                                      rocblas_int m,
+                                                      rocblas_int n, const T *A,
+                                                      rocblas_int lda,
+                                                      rocblas_int strideA,
+                                                      T *result,
+                                                      rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_lange_strided_batched(rocblas_handle handle,
+                                                      rocsolver_norm_type norm,
+                                                      rocblas_int m,
+                                                      rocblas_int n,
+                                                      const float *A,
+                                                      rocblas_int lda,
+                                                      rocblas_int strideA,
+                                                      float *result,
+                                                      rocblas_int batch_count) {
+  return rocsolver_slange_strided_batched(handle, norm, m, n, A, lda, strideA,
+                                          result, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_lange_strided_batched(rocblas_handle handle,
+                                                      rocsolver_norm_type norm,
+                                                      rocblas_int m,
+                                                      rocblas_int n,
+                                                      const double *A,
+                                                      rocblas_int lda,
+                                                      rocblas_int strideA,
+                                                      double *result,
+                                                      rocblas_int batch_count) {
+  return rocsolver_dlange_strided_batched(handle, norm, m, n, A, lda, strideA,
+                                          result, batch_count);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_lansy(rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_fill uplo, rocblas_int n,
+                                      const T *A, rocblas_int lda, T *result);
+
+template <>
+inline rocblas_status rocsolver_lansy(rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_fill uplo, rocblas_int n,
+                                      const float *A, rocblas_int lda,
+                                      float *result) {
+  return rocsolver_slansy(handle, norm, uplo, n, A, lda, result);
+}
+
+template <>
+inline rocblas_status rocsolver_lansy(rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_fill uplo, rocblas_int n,
+                                      const double *A, rocblas_int lda,
+                                      double *result) {
+  return rocsolver_dlansy(handle, norm, uplo, n, A, lda, result);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_lansy_strided_batched(rocblas_handle handle,
+                                                      rocsolver_norm_type norm,
+                                                      rocblas_fill uplo,
+                                                      rocblas_int n, const T *A,
+                                                      rocblas_int lda,
+                                                      rocblas_int strideA,
+                                                      T *result,
+                                                      rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_lansy_strided_batched(rocblas_handle handle,
+                                                      rocsolver_norm_type norm,
+                                                      rocblas_fill uplo,
+                                                      rocblas_int n,
+                                                      const float *A,
+                                                      rocblas_int lda,
+                                                      rocblas_int strideA,
+                                                      float *result,
+                                                      rocblas_int batch_count) {
+  return rocsolver_slansy_strided_batched(handle, norm, uplo, n, A, lda,
+                                          strideA, result, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_lansy_strided_batched(rocblas_handle handle,
+                                                      rocsolver_norm_type norm,
+                                                      rocblas_fill uplo,
+                                                      rocblas_int n,
+                                                      const double *A,
+                                                      rocblas_int lda,
+                                                      rocblas_int strideA,
+                                                      double *result,
+                                                      rocblas_int batch_count) {
+  return rocsolver_dlansy_strided_batched(handle, norm, uplo, n, A, lda,
+                                          strideA, result, batch_count);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_lantr(rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_fill uplo, rocblas_diagonal diag,
+                                      rocblas_int m, rocblas_int n, const T *A,
+                                      rocblas_int lda, T *result);
+
+template <>
+inline rocblas_status rocsolver_lantr(rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_fill uplo, rocblas_diagonal diag,
+                                      rocblas_int m, rocblas_int n,
+                                      const float *A, rocblas_int lda,
+                                      float *result) {
+  return rocsolver_slantr(handle, norm, uplo, diag, m, n, A, lda, result);
+}
+
+template <>
+inline rocblas_status rocsolver_lantr(rocblas_handle handle,
+                                      rocsolver_norm_type norm,
+                                      rocblas_fill uplo, rocblas_diagonal diag,
+                                      rocblas_int m, rocblas_int n,
+                                      const double *A, rocblas_int lda,
+                                      double *result) {
+  return rocsolver_dlantr(handle, norm, uplo, diag, m, n, A, lda, result);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_lantr_strided_batched(rocblas_handle handle,
+                                                      rocsolver_norm_type norm,
+                                                      rocblas_fill uplo,
+                                                      rocblas_diagonal diag,
+                                                      rocblas_int m,
+                                                      rocblas_int n, const T *A,
+                                                      rocblas_int lda,
+                                                      rocblas_int strideA,
+                                                      T *result,
+                                                      rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_lantr_strided_batched(rocblas_handle handle,
+                                                      rocsolver_norm_type norm,
+                                                      rocblas_fill uplo,
+                                                      rocblas_diagonal diag,
+                                                      rocblas_int m,
+                                                      rocblas_int n,
+                                                      const float *A,
+                                                      rocblas_int lda,
+                                                      rocblas_int strideA,
+                                                      float *result,
+                                                      rocblas_int batch_count) {
+  return rocsolver_slantr_strided_batched(handle, norm, uplo, diag, m, n, A,
+                                          lda, strideA, result, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_lantr_strided_batched(rocblas_handle handle,
+                                                      rocsolver_norm_type norm,
+                                                      rocblas_fill uplo,
+                                                      rocblas_diagonal diag,
+                                                      rocblas_int m,
+                                                      rocblas_int n,
+                                                      const double *A,
+                                                      rocblas_int lda,
+                                                      rocblas_int strideA,
+                                                      double *result,
+                                                      rocblas_int batch_count) {
+  return rocsolver_dlantr_strided_batched(handle, norm, uplo, diag, m, n, A,
+                                          lda, strideA, result, batch_count);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_geqr2(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *A, rocblas_int lda,
+                                      T *tau);
+
+template <>
+inline rocblas_status rocsolver_geqr2(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *A, rocblas_int lda,
+                                      float *tau) {
+  return rocsolver_sgeqr2(handle, m, n, A, lda, tau);
+}
+
+template <>
+inline rocblas_status rocsolver_geqr2(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *A, rocblas_int lda,
+                                      double *tau) {
+  return rocsolver_dgeqr2(handle, m, n, A, lda, tau);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_geqrf(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *A, rocblas_int lda,
+                                      T *tau);
+
+template <>
+inline rocblas_status rocsolver_geqrf(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *A, rocblas_int lda,
+                                      float *tau) {
+  return rocsolver_sgeqrf(handle, m, n, A, lda, tau);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *A, rocblas_int lda,
+                                      double *tau) {
+  return rocsolver_dgeqrf(handle, m, n, A, lda, tau);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_geqp3(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *A, rocblas_int lda,
+                                      rocblas_int *jpvt, T *tau);
+
+template <>
+inline rocblas_status rocsolver_geqp3(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *A, rocblas_int lda,
+                                      rocblas_int *jpvt, float *tau) {
+  return rocsolver_sgeqp3(handle, m, n, A, lda, jpvt, tau);
+}
+
+template <>
+inline rocblas_status rocsolver_geqp3(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *A, rocblas_int lda,
+                                      rocblas_int *jpvt, double *tau) {
+  return rocsolver_dgeqp3(handle, m, n, A, lda, jpvt, tau);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_orgqr(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_int k, T *A,
+                                      rocblas_int lda, const T *tau);
+
+template <>
+inline rocblas_status rocsolver_orgqr(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_int k, float *A,
+                                      rocblas_int lda, const float *tau) {
+  return rocsolver_sorgqr(handle, m, n, k, A, lda, tau);
+}
+
+template <>
+inline rocblas_status rocsolver_orgqr(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_int k, double *A,
+                                      rocblas_int lda, const double *tau) {
+  return rocsolver_dorgqr(handle, m, n, k, A, lda, tau);
+}
+
+template <typename T>
+inline rocblas_status
+rocsolver_ormqr(rocblas_handle handle, rocblas_side side,
+                rocblas_operation trans, rocblas_int m, rocblas_int n,
+                rocblas_int k, const T *A, rocblas_int lda, const T *tau, T *C,
+                rocblas_int ldc);
+
+template <>
+inline rocblas_status
+rocsolver_ormqr(rocblas_handle handle, rocblas_side side,
+                rocblas_operation trans, rocblas_int m, rocblas_int n,
+                rocblas_int k, const float *A, rocblas_int lda,
+                const float *tau, float *C, rocblas_int ldc) {
+  return rocsolver_sormqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc);
+}
+
+template <>
+inline rocblas_status
+rocsolver_ormqr(rocblas_handle handle, rocblas_side side,
+                rocblas_operation trans, rocblas_int m, rocblas_int n,
+                rocblas_int k, const double *A, rocblas_int lda,
+                const double *tau, double *C, rocblas_int ldc) {
+  return rocsolver_dormqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_gels(rocblas_handle handle,
+                                     rocblas_operation trans, rocblas_int m,
+                                     rocblas_int n, rocblas_int nrhs, T *A,
+                                     rocblas_int lda, T *B, rocblas_int ldb);
+
+template <>
+inline rocblas_status rocsolver_gels(rocblas_handle handle,
+                                     rocblas_operation trans, rocblas_int m,
+                                     rocblas_int n, rocblas_int nrhs, float *A,
+                                     rocblas_int lda, float *B,
+                                     rocblas_int ldb) {
+  return rocsolver_sgels(handle, trans, m, n, nrhs, A, lda, B, ldb);
+}
+
+template <>
+inline rocblas_status rocsolver_gels(rocblas_handle handle,
+                                     rocblas_operation trans, rocblas_int m,
+                                     rocblas_int n, rocblas_int nrhs,
+                                     double *A, rocblas_int lda, double *B,
+                                     rocblas_int ldb) {
+  return rocsolver_dgels(handle, trans, m, n, nrhs, A, lda, B, ldb);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_gels_strided_batched(
+    rocblas_handle handle, rocblas_operation trans, rocblas_int m,
+    rocblas_int n, rocblas_int nrhs, T *A, rocblas_int lda,
+    rocblas_int strideA, T *B, rocblas_int ldb, rocblas_int strideB,
+    rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_gels_strided_batched(
+    rocblas_handle handle, rocblas_operation trans, rocblas_int m,
+    rocblas_int n, rocblas_int nrhs, float *A, rocblas_int lda,
+    rocblas_int strideA, float *B, rocblas_int ldb, rocblas_int strideB,
+    rocblas_int batch_count) {
+  return rocsolver_sgels_strided_batched(handle, trans, m, n, nrhs, A, lda,
+                                         strideA, B, ldb, strideB,
+                                         batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_gels_strided_batched(
+    rocblas_handle handle, rocblas_operation trans, rocblas_int m,
+    rocblas_int n, rocblas_int nrhs, double *A, rocblas_int lda,
+    rocblas_int strideA, double *B, rocblas_int ldb, rocblas_int strideB,
+    rocblas_int batch_count) {
+  return rocsolver_dgels_strided_batched(handle, trans, m, n, nrhs, A, lda,
+                                         strideA, B, ldb, strideB,
+                                         batch_count);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_syev(rocblas_handle handle,
+                                     rocsolver_evect evect, rocblas_fill uplo,
+                                     rocblas_int n, T *A, rocblas_int lda,
+                                     T *W);
+
+template <>
+inline rocblas_status rocsolver_syev(rocblas_handle handle,
+                                     rocsolver_evect evect, rocblas_fill uplo,
+                                     rocblas_int n, float *A, rocblas_int lda,
+                                     float *W) {
+  return rocsolver_ssyev(handle, evect, uplo, n, A, lda, W);
+}
+
+template <>
+inline rocblas_status rocsolver_syev(rocblas_handle handle,
+                                     rocsolver_evect evect, rocblas_fill uplo,
+                                     rocblas_int n, double *A, rocblas_int lda,
+                                     double *W) {
+  return rocsolver_dsyev(handle, evect, uplo, n, A, lda, W);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_syevd(rocblas_handle handle,
+                                      rocsolver_evect evect, rocblas_fill uplo,
+                                      rocblas_int n, T *A, rocblas_int lda,
+                                      T *W);
+
+template <>
+inline rocblas_status rocsolver_syevd(rocblas_handle handle,
+                                      rocsolver_evect evect, rocblas_fill uplo,
+                                      rocblas_int n, float *A, rocblas_int lda,
+                                      float *W) {
+  return rocsolver_ssyevd(handle, evect, uplo, n, A, lda, W);
+}
+
+template <>
+inline rocblas_status rocsolver_syevd(rocblas_handle handle,
+                                      rocsolver_evect evect, rocblas_fill uplo,
+                                      rocblas_int n, double *A,
+                                      rocblas_int lda, double *W) {
+  return rocsolver_dsyevd(handle, evect, uplo, n, A, lda, W);
+}
+
+template <typename T>
+inline rocblas_status
+rocsolver_syevj_batched(rocblas_handle handle, rocsolver_evect evect,
+                        rocblas_fill uplo, rocblas_int n, T *const A[],
+                        rocblas_int lda, T tol, rocblas_int max_sweeps, T *W,
+                        rocblas_int strideW, rocblas_int *info,
+                        rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_syevj_batched(rocblas_handle handle, rocsolver_evect evect,
+                        rocblas_fill uplo, rocblas_int n, float *const A[],
+                        rocblas_int lda, float tol, rocblas_int max_sweeps,
+                        float *W, rocblas_int strideW, rocblas_int *info,
+                        rocblas_int batch_count) {
+  return rocsolver_ssyevj_batched(handle, evect, uplo, n, A, lda, tol,
+                                  max_sweeps, W, strideW, info, batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_syevj_batched(rocblas_handle handle, rocsolver_evect evect,
+                        rocblas_fill uplo, rocblas_int n, double *const A[],
+                        rocblas_int lda, double tol, rocblas_int max_sweeps,
+                        double *W, rocblas_int strideW, rocblas_int *info,
+                        rocblas_int batch_count) {
+  return rocsolver_dsyevj_batched(handle, evect, uplo, n, A, lda, tol,
+                                  max_sweeps, W, strideW, info, batch_count);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_syevj_strided_batched(
+    rocblas_handle handle, rocsolver_evect evect, rocblas_fill uplo,
+    rocblas_int n, T *A, rocblas_int lda, rocblas_int strideA, T tol,
+    rocblas_int max_sweeps, T *W, rocblas_int strideW, rocblas_int *info,
+    rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_syevj_strided_batched(
+    rocblas_handle handle, rocsolver_evect evect, rocblas_fill uplo,
+    rocblas_int n, float *A, rocblas_int lda, rocblas_int strideA, float tol,
+    rocblas_int max_sweeps, float *W, rocblas_int strideW, rocblas_int *info,
+    rocblas_int batch_count) {
+  return rocsolver_ssyevj_strided_batched(handle, evect, uplo, n, A, lda,
+                                          strideA, tol, max_sweeps, W,
+                                          strideW, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_syevj_strided_batched(
+    rocblas_handle handle, rocsolver_evect evect, rocblas_fill uplo,
+    rocblas_int n, double *A, rocblas_int lda, rocblas_int strideA,
+    double tol, rocblas_int max_sweeps, double *W, rocblas_int strideW,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_dsyevj_strided_batched(handle, evect, uplo, n, A, lda,
+                                          strideA, tol, max_sweeps, W,
+                                          strideW, info, batch_count);
+}
+
+template <typename T>
+inline rocblas_status
+rocsolver_gesvd(rocblas_handle handle, rocsolver_svect left_svect,
+                rocsolver_svect right_svect, rocblas_int m, rocblas_int n,
+                T *A, rocblas_int lda, T *S, T *U, rocblas_int ldu, T *V,
+                rocblas_int ldv, rocblas_int *info);
+
+template <>
+inline rocblas_status
+rocsolver_gesvd(rocblas_handle handle, rocsolver_svect left_svect,
+                rocsolver_svect right_svect, rocblas_int m, rocblas_int n,
+                float *A, rocblas_int lda, float *S, float *U, rocblas_int ldu,
+                float *V, rocblas_int ldv, rocblas_int *info) {
+  return rocsolver_sgesvd(handle, left_svect, right_svect, m, n, A, lda, S, U,
+                          ldu, V, ldv, info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesvd(rocblas_handle handle, rocsolver_svect left_svect,
+                rocsolver_svect right_svect, rocblas_int m, rocblas_int n,
+                double *A, rocblas_int lda, double *S, double *U,
+                rocblas_int ldu, double *V, rocblas_int ldv,
+                rocblas_int *info) {
+  return rocsolver_dgesvd(handle, left_svect, right_svect, m, n, A, lda, S, U,
+                          ldu, V, ldv, info);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_gesvdj_batched(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n, T *const A[],
+    rocblas_int lda, T tol, rocblas_int max_sweeps, T *S, rocblas_int strideS,
+    T *U, rocblas_int ldu, rocblas_int strideU, T *V, rocblas_int ldv,
+    rocblas_int strideV, rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_gesvdj_batched(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n,
+    float *const A[], rocblas_int lda, float tol, rocblas_int max_sweeps,
+    float *S, rocblas_int strideS, float *U, rocblas_int ldu,
+    rocblas_int strideU, float *V, rocblas_int ldv, rocblas_int strideV,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_sgesvdj_batched(handle, left_svect, right_svect, m, n, A,
+                                   lda, tol, max_sweeps, S, strideS, U, ldu,
+                                   strideU, V, ldv, strideV, info,
+                                   batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_gesvdj_batched(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n,
+    double *const A[], rocblas_int lda, double tol, rocblas_int max_sweeps,
+    double *S, rocblas_int strideS, double *U, rocblas_int ldu,
+    rocblas_int strideU, double *V, rocblas_int ldv, rocblas_int strideV,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_dgesvdj_batched(handle, left_svect, right_svect, m, n, A,
+                                   lda, tol, max_sweeps, S, strideS, U, ldu,
+                                   strideU, V, ldv, strideV, info,
+                                   batch_count);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_gesvdj_strided_batched(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n, T *A,
+    rocblas_int lda, rocblas_int strideA, T tol, rocblas_int max_sweeps, T *S,
+    rocblas_int strideS, T *U, rocblas_int ldu, rocblas_int strideU, T *V,
+    rocblas_int ldv, rocblas_int strideV, rocblas_int *info,
+    rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_gesvdj_strided_batched(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n, float *A,
+    rocblas_int lda, rocblas_int strideA, float tol, rocblas_int max_sweeps,
+    float *S, rocblas_int strideS, float *U, rocblas_int ldu,
+    rocblas_int strideU, float *V, rocblas_int ldv, rocblas_int strideV,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_sgesvdj_strided_batched(
+      handle, left_svect, right_svect, m, n, A, lda, strideA, tol, max_sweeps,
+      S, strideS, U, ldu, strideU, V, ldv, strideV, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_gesvdj_strided_batched(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n, double *A,
+    rocblas_int lda, rocblas_int strideA, double tol, rocblas_int max_sweeps,
+    double *S, rocblas_int strideS, double *U, rocblas_int ldu,
+    rocblas_int strideU, double *V, rocblas_int ldv, rocblas_int strideV,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_dgesvdj_strided_batched(
+      handle, left_svect, right_svect, m, n, A, lda, strideA, tol, max_sweeps,
+      S, strideS, U, ldu, strideU, V, ldv, strideV, info, batch_count);
+}
+
+template <typename T>
+inline rocblas_status
+rocsolver_gesvdr(rocblas_handle handle, rocsolver_svect left_svect,
+                 rocsolver_svect right_svect, rocblas_int m, rocblas_int n,
+                 T *A, rocblas_int lda, rocblas_int rank,
+                 rocblas_int oversample, rocblas_int power_iters, T *S, T *U,
+                 rocblas_int ldu, T *V, rocblas_int ldv, rocblas_int *info);
+
+template <>
+inline rocblas_status
+rocsolver_gesvdr(rocblas_handle handle, rocsolver_svect left_svect,
+                 rocsolver_svect right_svect, rocblas_int m, rocblas_int n,
+                 float *A, rocblas_int lda, rocblas_int rank,
+                 rocblas_int oversample, rocblas_int power_iters, float *S,
+                 float *U, rocblas_int ldu, float *V, rocblas_int ldv,
+                 rocblas_int *info) {
+  return rocsolver_sgesvdr(handle, left_svect, right_svect, m, n, A, lda, rank,
+                           oversample, power_iters, S, U, ldu, V, ldv, info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesvdr(rocblas_handle handle, rocsolver_svect left_svect,
+                 rocsolver_svect right_svect, rocblas_int m, rocblas_int n,
+                 double *A, rocblas_int lda, rocblas_int rank,
+                 rocblas_int oversample, rocblas_int power_iters, double *S,
+                 double *U, rocblas_int ldu, double *V, rocblas_int ldv,
+                 rocblas_int *info) {
+  return rocsolver_dgesvdr(handle, left_svect, right_svect, m, n, A, lda, rank,
+                           oversample, power_iters, S, U, ldu, V, ldv, info);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_gbtrf(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_int kl,
+                                      rocblas_int ku, T *AB, rocblas_int ldab,
+                                      rocblas_int *ipiv);
+
+template <>
+inline rocblas_status rocsolver_gbtrf(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_int kl,
+                                      rocblas_int ku, float *AB,
+                                      rocblas_int ldab, rocblas_int *ipiv) {
+  return rocsolver_sgbtrf(handle, m, n, kl, ku, AB, ldab, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_gbtrf(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_int kl,
+                                      rocblas_int ku, double *AB,
+                                      rocblas_int ldab, rocblas_int *ipiv) {
+  return rocsolver_dgbtrf(handle, m, n, kl, ku, AB, ldab, ipiv);
+}
+
+template <typename T>
+inline rocblas_status
+rocsolver_gbtrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                rocblas_int kl, rocblas_int ku, rocblas_int nrhs, const T *AB,
+                rocblas_int ldab, const rocblas_int *ipiv, T *B,
+                rocblas_int ldb);
+
+template <>
+inline rocblas_status
+rocsolver_gbtrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                rocblas_int kl, rocblas_int ku, rocblas_int nrhs,
+                const float *AB, rocblas_int ldab, const rocblas_int *ipiv,
+                float *B, rocblas_int ldb) {
+  return rocsolver_sgbtrs(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, B,
+                          ldb);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gbtrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                rocblas_int kl, rocblas_int ku, rocblas_int nrhs,
+                const double *AB, rocblas_int ldab, const rocblas_int *ipiv,
+                double *B, rocblas_int ldb) {
+  return rocsolver_dgbtrs(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, B,
+                          ldb);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_gtsv(rocblas_handle handle, rocblas_int n,
+                                     rocblas_int nrhs, const T *dl,
+                                     const T *d, const T *du, T *B,
+                                     rocblas_int ldb, rocblas_int *info);
+
+template <>
+inline rocblas_status rocsolver_gtsv(rocblas_handle handle, rocblas_int n,
+                                     rocblas_int nrhs, const float *dl,
+                                     const float *d, const float *du,
+                                     float *B, rocblas_int ldb,
+                                     rocblas_int *info) {
+  return rocsolver_sgtsv(handle, n, nrhs, dl, d, du, B, ldb, info);
+}
+
+template <>
+inline rocblas_status rocsolver_gtsv(rocblas_handle handle, rocblas_int n,
+                                     rocblas_int nrhs, const double *dl,
+                                     const double *d, const double *du,
+                                     double *B, rocblas_int ldb,
+                                     rocblas_int *info) {
+  return rocsolver_dgtsv(handle, n, nrhs, dl, d, du, B, ldb, info);
+}
+
+template <typename T>
+inline rocblas_status
+rocsolver_gtsv_strided_batched(rocblas_handle handle, rocblas_int n,
+                               rocblas_int nrhs, const T *dl, const T *d,
+                               const T *du, rocblas_int strideD, T *B,
+                               rocblas_int ldb, rocblas_int strideB,
+                               rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_gtsv_strided_batched(
+    rocblas_handle handle, rocblas_int n, rocblas_int nrhs, const float *dl,
+    const float *d, const float *du, rocblas_int strideD, float *B,
+    rocblas_int ldb, rocblas_int strideB, rocblas_int *info,
+    rocblas_int batch_count) {
+  return rocsolver_sgtsv_strided_batched(handle, n, nrhs, dl, d, du, strideD,
+                                         B, ldb, strideB, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_gtsv_strided_batched(
+    rocblas_handle handle, rocblas_int n, rocblas_int nrhs, const double *dl,
+    const double *d, const double *du, rocblas_int strideD, double *B,
+    rocblas_int ldb, rocblas_int strideB, rocblas_int *info,
+    rocblas_int batch_count) {
+  return rocsolver_dgtsv_strided_batched(handle, n, nrhs, dl, d, du, strideD,
+                                         B, ldb, strideB, info, batch_count);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_gebltsv_strided_batched(
+    rocblas_handle handle, rocblas_int nb, rocblas_int nblocks,
+    rocblas_int nrhs, T *A, T *B, T *C, rocblas_int lda, rocblas_int strideA,
+    T *X, rocblas_int ldx, rocblas_int strideX, rocblas_int *info,
+    rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_gebltsv_strided_batched(
+    rocblas_handle handle, rocblas_int nb, rocblas_int nblocks,
+    rocblas_int nrhs, float *A, float *B, float *C, rocblas_int lda,
+    rocblas_int strideA, float *X, rocblas_int ldx, rocblas_int strideX,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_sgebltsv_strided_batched(handle, nb, nblocks, nrhs, A, B, C,
+                                            lda, strideA, X, ldx, strideX,
+                                            info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_gebltsv_strided_batched(
+    rocblas_handle handle, rocblas_int nb, rocblas_int nblocks,
+    rocblas_int nrhs, double *A, double *B, double *C, rocblas_int lda,
+    rocblas_int strideA, double *X, rocblas_int ldx, rocblas_int strideX,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_dgebltsv_strided_batched(handle, nb, nblocks, nrhs, A, B,
+                                            C, lda, strideA, X, ldx, strideX,
+                                            info, batch_count);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_gehrd(rocblas_handle handle, rocblas_int n,
+                                      T *A, rocblas_int lda, T *tau);
+
+template <>
+inline rocblas_status rocsolver_gehrd(rocblas_handle handle, rocblas_int n,
+                                      float *A, rocblas_int lda, float *tau) {
+  return rocsolver_sgehrd(handle, n, A, lda, tau);
+}
+
+template <>
+inline rocblas_status rocsolver_gehrd(rocblas_handle handle, rocblas_int n,
+                                      double *A, rocblas_int lda,
+                                      double *tau) {
+  return rocsolver_dgehrd(handle, n, A, lda, tau);
+}
+
+template <typename T>
+inline rocblas_status rocsolver_geev(rocblas_handle handle,
+                                     rocsolver_evect evect, rocblas_int n,
+                                     T *A, rocblas_int lda, T *WR, T *WI, T *V,
+                                     rocblas_int ldv, rocblas_int *info);
+
+template <>
+inline rocblas_status rocsolver_geev(rocblas_handle handle,
+                                     rocsolver_evect evect, rocblas_int n,
+                                     float *A, rocblas_int lda, float *WR,
+                                     float *WI, float *V, rocblas_int ldv,
+                                     rocblas_int *info) {
+  return rocsolver_sgeev(handle, evect, n, A, lda, WR, WI, V, ldv, info);
+}
+
+template <>
+inline rocblas_status rocsolver_geev(rocblas_handle handle,
+                                     rocsolver_evect evect, rocblas_int n,
+                                     double *A, rocblas_int lda, double *WR,
+                                     double *WI, double *V, rocblas_int ldv,
+                                     rocblas_int *info) {
+  return rocsolver_dgeev(handle, evect, n, A, lda, WR, WI, V, ldv, info);
+}
+
 #endif /* ROCSOLVER_HPP */
@@ -0,0 +1,221 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element after the LU
+#define GBTRF_ERROR_EPS_MULTIPLIER 500
+
+using namespace std;
+
+template <typename T> rocblas_status testing_gbtrf(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int N = argus.N;
+  rocblas_int kl = argus.kl;
+  rocblas_int ku = argus.ku;
+  rocblas_int ldab = argus.lda;
+  const bool pivot = (argus.pivot_option == 'Y');
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_AB = ldab * N;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || N < 0 || kl < 0 || ku < 0 || ldab < 2 * kl + ku + 1) {
+    auto dAB_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dAB = (T *)dAB_managed.get();
+    if (!dAB) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    auto dIpiv_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * safe_size),
+                           rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+    status = rocsolver_gbtrf<T>(handle, M, N, kl, ku, dAB, ldab, dIpiv);
+
+    gbtrf_arg_check(status, M, N, kl, ku, ldab);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hAB(size_AB);
+  vector<T> hABRes(size_AB);
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GBTRF_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dAB_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_AB),
+                         rocblas_test::device_free};
+  T *dAB = (T *)dAB_managed.get();
+  if (!dAB) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize the band with entries in [1, 10], the rows reserved for the
+  //  fill-in are zero
+  rocblas_init<T>(hAB, ldab, N, ldab);
+  for (int i = 0; i < kl; i++) {
+    for (int j = 0; j < N; j++) {
+      hAB[i + j * ldab] = 0.0;
+    }
+  }
+
+  // now make it diagonally dominant; to check the pivoting, the dominant
+  // entries are instead moved s = min(kl, ku) rows off the diagonal, swapping
+  // the halves of each block of 2s columns, so that the interchanges and the
+  // fill-in are well defined while the matrix stays well conditioned
+  const int s = pivot ? min(kl, ku) : 0;
+  for (int j = 0; j < min(M, N); j++) {
+    const int b = s > 0 ? j - j % (2 * s) : j;
+    int r = j;
+    if (s > 0 && b + 2 * s <= min(M, N))
+      r = (j - b < s) ? j + s : j - s;
+    hAB[kl + ku + r - j + j * ldab] *= 420.0;
+  }
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(
+      hipMemcpy(dAB, hAB.data(), sizeof(T) * size_AB, hipMemcpyHostToDevice));
+
+  // allocate space for the pivoting array
+  vector<int> hIpiv(min(M, N));
+  auto dIpiv_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * min(M, N)),
+                         rocblas_test::device_free};
+  rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    const rocblas_status retGPU =
+        rocsolver_gbtrf<T>(handle, M, N, kl, ku, dAB, ldab, dIpiv);
+
+    CHECK_HIP_ERROR(hipMemcpy(hABRes.data(), dAB, sizeof(T) * size_AB,
+                              hipMemcpyDeviceToHost));
+
+    const int retCBLAS =
+        cblas_gbtrf<T>(M, N, kl, ku, hAB.data(), ldab, hIpiv.data());
+
+    if (retCBLAS != 0) {
+      // error encountered - we expect the same to happen from the GPU!
+      if (retGPU == rocblas_status_success) {
+        fprintf(stderr, "rocBLAS should fail also but doesn't!");
+        return rocblas_status_internal_error;
+      }
+    } else {
+      CHECK_ROCBLAS_ERROR(retGPU);
+
+      // Error Check
+
+      // check if the pivoting returned is identical
+      vector<int> hIpivGPU(min(M, N));
+      CHECK_HIP_ERROR(hipMemcpy(hIpivGPU.data(), dIpiv, sizeof(int) * min(M, N),
+                                hipMemcpyDeviceToHost));
+      for (int j = 0; j < min(M, N); j++) {
+        const int refPiv = hIpiv[j];
+        const int gpuPiv = hIpivGPU[j];
+        if (refPiv != gpuPiv) {
+          cerr << "reference pivot " << j << ": " << refPiv << " vs " << gpuPiv
+               << endl;
+          return rocblas_status_internal_error;
+        }
+      }
+
+      // hABRes contains the calculated band factors, so error is hAB - hABRes;
+      // the blocked update sums in a different order than LAPACK, and the
+      // factors grow with the diagonal or the interchanges, so the error is
+      // relative to the largest of them
+      T max_val = 0.0;
+      for (int i = 0; i < ldab; i++) {
+        for (int j = 0; j < N; j++) {
+          const T err = abs(hABRes[i + j * ldab] - hAB[i + j * ldab]);
+          max_err_1 = max_err_1 > err ? max_err_1 : err;
+          max_val = max(max_val, abs(hAB[i + j * ldab]));
+        }
+      }
+      if (max_val > 0)
+        max_err_1 /= max_val;
+      gbtrf_err_res_check<T>(max_err_1, M, N, error_eps_multiplier, eps);
+    }
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    const rocblas_status retGPU =
+        rocsolver_gbtrf<T>(handle, M, N, kl, ku, dAB, ldab, dIpiv);
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    const int retCBLAS =
+        cblas_gbtrf<T>(M, N, kl, ku, hAB.data(), ldab, hIpiv.data());
+
+    if (retCBLAS != 0) {
+      // error encountered - we expect the same to happen from the GPU!
+      if (retGPU == rocblas_status_success) {
+        fprintf(stderr, "rocBLAS should fail also but doesn't!");
+      }
+    } else {
+      CHECK_ROCBLAS_ERROR(retGPU);
+    }
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , N , kl , ku , ldab , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ",norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << N << " , " << kl << " , " << ku << " , " << ldab
+         << " , " << gpu_time_used << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GBTRF_ERROR_EPS_MULTIPLIER
@@ -0,0 +1,250 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element after the solution
+#define GBTRS_ERROR_EPS_MULTIPLIER 500
+
+using namespace std;
+
+template <typename T> rocblas_status testing_gbtrs(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int nhrs = argus.N;
+  rocblas_int kl = argus.kl;
+  rocblas_int ku = argus.ku;
+  rocblas_int ldab = argus.lda;
+  rocblas_int ldb = argus.ldb;
+  char trans = argus.transA_option;
+  const bool pivot = (argus.pivot_option == 'Y');
+
+  rocblas_operation transRoc;
+  if (trans == 'N') {
+    transRoc = rocblas_operation_none;
+  } else if (trans == 'T') {
+    transRoc = rocblas_operation_transpose;
+  } else {
+    throw runtime_error("Unsupported transpose operation.");
+  }
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_AB = ldab * M;
+  rocblas_int size_B = max(ldb, M) * nhrs;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || nhrs < 0 || kl < 0 || ku < 0 || ldab < 2 * kl + ku + 1 ||
+      ldb < std::max(1, M)) {
+    auto dAB_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dAB = (T *)dAB_managed.get();
+    if (!dAB) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    auto dB_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dB = (T *)dB_managed.get();
+    if (!dB) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    auto dIpiv_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * safe_size),
+                           rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+    status = rocsolver_gbtrs<T>(handle, transRoc, M, kl, ku, nhrs, dAB, ldab,
+                                dIpiv, dB, ldb);
+
+    gbtrs_arg_check(status, M, kl, ku, nhrs, ldab, ldb);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hAB(size_AB);
+  vector<T> hB(size_B);
+  vector<T> hBRes(size_B);
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GBTRS_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dAB_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_AB),
+                         rocblas_test::device_free};
+  T *dAB = (T *)dAB_managed.get();
+  if (!dAB) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  auto dB_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B),
+                         rocblas_test::device_free};
+  T *dB = (T *)dB_managed.get();
+  if (!dB) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize the band and hB with entries in [1, 10], the rows reserved
+  //  for the fill-in are zero
+  rocblas_init<T>(hAB, ldab, M, ldab);
+  rocblas_init<T>(hB, M, nhrs, ldb);
+  for (int i = 0; i < kl; i++) {
+    for (int j = 0; j < M; j++) {
+      hAB[i + j * ldab] = 0.0;
+    }
+  }
+  for (int i = M; i < ldb; i++) {
+    for (int j = 0; j < nhrs; j++) {
+      hB[i + j * ldb] = 0.0;
+    }
+  }
+
+  // now make it diagonally dominant; to check the pivoting, the dominant
+  // entries are instead moved s = min(kl, ku) rows off the diagonal, swapping
+  // the halves of each block of 2s columns, so that the interchanges and the
+  // fill-in are well defined while the matrix stays well conditioned
+  const int s = pivot ? min(kl, ku) : 0;
+  for (int j = 0; j < M; j++) {
+    const int b = s > 0 ? j - j % (2 * s) : j;
+    int r = j;
+    if (s > 0 && b + 2 * s <= M)
+      r = (j - b < s) ? j + s : j - s;
+    hAB[kl + ku + r - j + j * ldab] *= 420.0;
+  }
+
+  // allocate space for the pivoting array
+  vector<int> hIpiv(M);
+  auto dIpiv_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(int) * M), rocblas_test::device_free};
+  rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+  // do the band LU decomposition of matrix A w/ the reference LAPACK routine
+  const int retCBLAS =
+      cblas_gbtrf<T>(M, M, kl, ku, hAB.data(), ldab, hIpiv.data());
+  if (retCBLAS != 0) {
+    // error encountered - unlucky pick of random numbers? no use to continue
+    return rocblas_status_success;
+  }
+
+  // now copy pivoting indices and matrices to the GPU
+  CHECK_HIP_ERROR(
+      hipMemcpy(dAB, hAB.data(), sizeof(T) * size_AB, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(
+      hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(
+      hipMemcpy(dIpiv, hIpiv.data(), sizeof(int) * M, hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    const rocblas_status retGPU = rocsolver_gbtrs<T>(
+        handle, transRoc, M, kl, ku, nhrs, dAB, ldab, dIpiv, dB, ldb);
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hBRes.data(), dB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+
+    const int retCBLAS = cblas_gbtrs<T>(trans, M, kl, ku, nhrs, hAB.data(),
+                                        ldab, hIpiv.data(), hB.data(), ldb);
+
+    if (retCBLAS != 0) {
+      // error encountered - we expect the same to happen from the GPU!
+      if (retGPU == rocblas_status_success) {
+        fprintf(stderr, "rocBLAS should fail also but doesn't!");
+        return rocblas_status_internal_error;
+      }
+    } else {
+      CHECK_ROCBLAS_ERROR(retGPU);
+
+      // Error Check
+
+      // hBRes contains calculated solution, so error is hBres - hB
+      for (int i = 0; i < M; i++) {
+        for (int j = 0; j < nhrs; j++) {
+          const T err = abs(hBRes[i + j * ldb] - hB[i + j * ldb]);
+          max_err_1 = max_err_1 > err ? max_err_1 : err;
+        }
+      }
+      gbtrs_err_res_check<T>(max_err_1, M, nhrs, error_eps_multiplier, eps);
+    }
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    const rocblas_status retGPU = rocsolver_gbtrs<T>(
+        handle, transRoc, M, kl, ku, nhrs, dAB, ldab, dIpiv, dB, ldb);
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    const int retCBLAS = cblas_gbtrs<T>(trans, M, kl, ku, nhrs, hAB.data(),
+                                        ldab, hIpiv.data(), hB.data(), ldb);
+
+    if (retCBLAS != 0) {
+      // error encountered - we expect the same to happen from the GPU!
+      if (retGPU == rocblas_status_success) {
+        fprintf(stderr, "rocBLAS should fail also but doesn't!");
+      }
+    } else {
+      CHECK_ROCBLAS_ERROR(retGPU);
+    }
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , nhrs , kl , ku , ldab , ldb , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << nhrs << " , " << kl << " , " << ku << " , " << ldab
+         << " , " << ldb << " , " << gpu_time_used << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GBTRS_ERROR_EPS_MULTIPLIER
@@ -0,0 +1,255 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element of the solution against LAPACK's, relative
+// to its largest entry; the systems are block diagonally dominant
+#define GEBLTSV_ERROR_EPS_MULTIPLIER 1000
+
+using namespace std;
+
+template <typename T> rocblas_status testing_gebltsv(Arguments argus) {
+
+  rocblas_int nb = argus.M;
+  rocblas_int nblocks = argus.N;
+  rocblas_int nhrs = argus.K;
+  rocblas_int lda = argus.lda;
+  rocblas_int ldx = argus.ldb;
+  rocblas_int batch_count = argus.batch_count;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int N = nb * nblocks;
+  rocblas_int strideA = lda * N;
+  rocblas_int strideX = ldx * nhrs;
+  rocblas_int size_A = strideA * max(batch_count, 1);
+  rocblas_int size_X = strideX * max(batch_count, 1);
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (nb < 0 || nblocks < 0 || nhrs < 0 || batch_count < 0 ||
+      lda < std::max(1, nb) || ldx < std::max(1, N)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dInfo_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(rocblas_int) * safe_size),
+        rocblas_test::device_free};
+    rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+    if (!dA || !dInfo) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = rocsolver_gebltsv_strided_batched<T>(
+        handle, nb, nblocks, nhrs, dA, dA, dA, lda, strideA, dA, ldx, strideX,
+        dInfo, batch_count);
+
+    gebltsv_arg_check(status, nb, nblocks, nhrs, lda, ldx, batch_count);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(max(size_A, 1));
+  vector<T> hB(max(size_A, 1));
+  vector<T> hC(max(size_A, 1));
+  vector<T> hX(max(size_X, 1));
+  vector<T> hXRes(max(size_X, 1));
+  vector<rocblas_int> hInfo(max(batch_count, 1));
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GEBLTSV_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hA.size()),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  auto dB_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hB.size()),
+                         rocblas_test::device_free};
+  T *dB = (T *)dB_managed.get();
+  auto dC_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hC.size()),
+                         rocblas_test::device_free};
+  T *dC = (T *)dC_managed.get();
+  auto dX_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hX.size()),
+                         rocblas_test::device_free};
+  T *dX = (T *)dX_managed.get();
+  auto dInfo_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(rocblas_int) * hInfo.size()),
+      rocblas_test::device_free};
+  rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+  if (!dA || !dB || !dC || !dX || !dInfo) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize the blocks and hX with entries in [1, 10], then make the
+  //  systems block diagonally dominant
+  rocblas_init<T>(hA, lda, N * max(batch_count, 1), lda);
+  rocblas_init<T>(hB, lda, N * max(batch_count, 1), lda);
+  rocblas_init<T>(hC, lda, N * max(batch_count, 1), lda);
+  rocblas_init<T>(hX, ldx, nhrs * max(batch_count, 1), ldx);
+  for (int b = 0; b < batch_count; b++) {
+    for (int i = 0; i < N; i++)
+      hB[b * strideA + i % nb + i * lda] += 30 * nb;
+  }
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(
+      hipMemcpy(dX, hX.data(), sizeof(T) * hX.size(), hipMemcpyHostToDevice));
+
+  // the systems as band matrices for LAPACK, with kl = ku = 2 * nb - 1
+  const rocblas_int kl = max(2 * nb - 1, 0);
+  const rocblas_int ldab = 3 * kl + 1;
+  vector<T> hAB(max(ldab * N, 1));
+  vector<rocblas_int> hIpiv(max(N, 1));
+  auto band = [&](int b) {
+    std::fill(hAB.begin(), hAB.end(), 0);
+    for (int k = 0; k < nblocks; k++) {
+      for (int j = 0; j < nb; j++) {
+        for (int i = 0; i < nb; i++) {
+          const int r = k * nb + i;
+          const size_t e = b * strideA + i + (k * nb + j) * lda;
+          hAB[2 * kl + r - (k * nb + j) + (k * nb + j) * ldab] = hB[e];
+          if (k > 0)
+            hAB[2 * kl + r - ((k - 1) * nb + j) + ((k - 1) * nb + j) * ldab] =
+                hA[e];
+          if (k < nblocks - 1)
+            hAB[2 * kl + r - ((k + 1) * nb + j) + ((k + 1) * nb + j) * ldab] =
+                hC[e];
+        }
+      }
+    }
+  };
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    // the blocks are overwritten, so they are copied before every call
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * hA.size(),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * hB.size(),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * hC.size(),
+                              hipMemcpyHostToDevice));
+    CHECK_ROCBLAS_ERROR(rocsolver_gebltsv_strided_batched<T>(
+        handle, nb, nblocks, nhrs, dA, dB, dC, lda, strideA, dX, ldx, strideX,
+        dInfo, batch_count));
+
+    CHECK_HIP_ERROR(hipMemcpy(hXRes.data(), dX, sizeof(T) * hX.size(),
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hInfo.data(), dInfo,
+                              sizeof(rocblas_int) * hInfo.size(),
+                              hipMemcpyDeviceToHost));
+
+    // Error Check
+
+    // the solution of every system against LAPACK's band LU
+    for (int b = 0; b < batch_count; b++) {
+      if (N == 0 || nhrs == 0)
+        break;
+      band(b);
+      cblas_gbtrf<T>(N, N, kl, kl, hAB.data(), ldab, hIpiv.data());
+      cblas_gbtrs<T>('N', N, kl, kl, nhrs, hAB.data(), ldab, hIpiv.data(),
+                     hX.data() + b * strideX, ldx);
+      T xmax = 0;
+      for (int j = 0; j < nhrs; j++)
+        for (int i = 0; i < N; i++)
+          xmax = max(xmax, T(abs(hX[b * strideX + i + j * ldx])));
+      for (int j = 0; j < nhrs; j++) {
+        for (int i = 0; i < N; i++) {
+          const T err = abs(hXRes[b * strideX + i + j * ldx] -
+                            hX[b * strideX + i + j * ldx]) /
+                        xmax;
+          max_err_1 = max_err_1 > err ? max_err_1 : err;
+        }
+      }
+      if (hInfo[b] != 0)
+        max_err_1 = 1;
+    }
+    gebltsv_err_res_check<T>(max_err_1, N, nhrs, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * hA.size(),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * hB.size(),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * hC.size(),
+                              hipMemcpyHostToDevice));
+
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_gebltsv_strided_batched<T>(
+        handle, nb, nblocks, nhrs, dA, dB, dC, lda, strideA, dX, ldx, strideX,
+        dInfo, batch_count));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas, the band LU of one system at a time
+    cpu_time_used = get_time_us();
+
+    for (int b = 0; b < batch_count; b++) {
+      if (N == 0 || nhrs == 0)
+        break;
+      band(b);
+      cblas_gbtrf<T>(N, N, kl, kl, hAB.data(), ldab, hIpiv.data());
+      cblas_gbtrs<T>('N', N, kl, kl, nhrs, hAB.data(), ldab, hIpiv.data(),
+                     hX.data() + b * strideX, ldx);
+    }
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "nb , nblocks , nhrs , lda , ldx , batch_count , us [gpu] , "
+            "us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << nb << " , " << nblocks << " , " << nhrs << " , " << lda << " , "
+         << ldx << " , " << batch_count << " , " << gpu_time_used << " , "
+         << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GEBLTSV_ERROR_EPS_MULTIPLIER
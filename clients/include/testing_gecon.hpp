@@ -0,0 +1,201 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max relative error of the estimate PER dimension
+#define GECON_ERROR_EPS_MULTIPLIER 500
+
+using namespace std;
+
+template <typename T> rocblas_status testing_gecon(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int lda = argus.lda;
+  char char_norm = argus.norm_option;
+
+  rocsolver_norm_type norm;
+  if (char_norm == 'O' || char_norm == '1') {
+    norm = rocsolver_norm_one;
+  } else if (char_norm == 'I') {
+    norm = rocsolver_norm_inf;
+  } else {
+    throw runtime_error("Unsupported norm.");
+  }
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_A = max(lda, M) * M;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // the norm of A and the result live on the device
+  auto dRes_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * 2),
+                         rocblas_test::device_free};
+  T *dAnorm = (T *)dRes_managed.get();
+  if (!dAnorm) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+  T *dRcond = dAnorm + 1;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || lda < std::max(1, M)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = rocsolver_gecon<T>(handle, norm, M, dA, lda, dAnorm, dRcond);
+
+    gecon_arg_check(status, M, lda);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(size_A);
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GECON_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  if (!dA) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrix hA with all entries in [1, 10]
+  rocblas_init<T>(hA, M, M, lda);
+
+  //  pad untouched area into zero
+  for (int i = M; i < lda; i++) {
+    for (int j = 0; j < M; j++) {
+      hA[i + j * lda] = 0.0;
+    }
+  }
+
+  // now make it diagonally dominant, and reverse the order of the rows so
+  // that the factorization has to pivot
+  for (int i = 0; i < M; i++) {
+    hA[i + i * lda] *= 420.0;
+  }
+  for (int i = 0; i < M / 2; i++) {
+    for (int j = 0; j < M; j++) {
+      std::swap(hA[i + j * lda], hA[M - 1 - i + j * lda]);
+    }
+  }
+
+  // the norm of the original matrix
+  T anorm = 0;
+  for (int k = 0; k < M; k++) {
+    T sum = 0;
+    for (int l = 0; l < M; l++) {
+      sum += (norm == rocsolver_norm_one) ? abs(hA[l + k * lda])
+                                          : abs(hA[k + l * lda]);
+    }
+    anorm = max(anorm, sum);
+  }
+
+  // the factors come from the reference LAPACK routine
+  vector<int> hIpiv(M);
+  const int retCBLAS = cblas_getrf<T>(M, M, hA.data(), lda, hIpiv.data());
+  if (retCBLAS != 0) {
+    // error encountered - unlucky pick of random numbers? no use to continue
+    return rocblas_status_success;
+  }
+
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(
+      hipMemcpy(dAnorm, &anorm, sizeof(T), hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_gecon<T>(handle, norm, M, dA, lda, dAnorm, dRcond));
+
+    T rcond;
+    CHECK_HIP_ERROR(
+        hipMemcpy(&rcond, dRcond, sizeof(T), hipMemcpyDeviceToHost));
+
+    T rcondRef;
+    cblas_gecon<T>(char_norm, M, hA.data(), lda, anorm, &rcondRef);
+
+    // Error Check
+
+    // both estimate the same way, so they should agree up to rounding
+    max_err_1 = abs(rcond - rcondRef) / rcondRef;
+    gecon_err_res_check<T>(max_err_1, M, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_gecon<T>(handle, norm, M, dA, lda, dAnorm, dRcond));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    T rcondRef;
+    cblas_gecon<T>(char_norm, M, hA.data(), lda, anorm, &rcondRef);
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , lda , norm , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << lda << " , " << char_norm << " , " << gpu_time_used
+         << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GECON_ERROR_EPS_MULTIPLIER
@@ -0,0 +1,234 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max relative error of the scale factors and the scaled matrix
+#define GEEQU_ERROR_EPS_MULTIPLIER 10
+
+using namespace std;
+
+// the LAPACK equed character of a laqge result
+inline char geequ_equed_char(rocsolver_equed equed) {
+  if (equed == rocsolver_equed_row)
+    return 'R';
+  else if (equed == rocsolver_equed_column)
+    return 'C';
+  else if (equed == rocsolver_equed_both)
+    return 'B';
+  return 'N';
+}
+
+template <typename T> rocblas_status testing_geequ(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int N = argus.N;
+  rocblas_int lda = argus.lda;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_A = max(lda, M) * N;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || N < 0 || lda < std::max(1, M)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = rocsolver_geequ<T>(handle, M, N, dA, lda, dA, dA, dA, dA, dA);
+
+    geequ_arg_check(status, M, N, lda);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(size_A);
+  vector<T> hAScaled(size_A);
+  vector<T> hR(max(M, 1));
+  vector<T> hC(max(N, 1));
+  vector<T> hRRes(hR.size());
+  vector<T> hCRes(hC.size());
+  vector<T> hCnd(3);
+  vector<T> hCndRes(3);
+  rocsolver_equed equedRes;
+  char equed;
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GEEQU_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  if (!dA) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  // r, c and rowcnd, colcnd, amax next to each other
+  auto dRC_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(T) * (hR.size() + hC.size() + 3)),
+      rocblas_test::device_free};
+  T *dR = (T *)dRC_managed.get();
+  if (!dR) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+  T *dC = dR + hR.size();
+  T *dCnd = dC + hC.size();
+
+  auto dEqued_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(rocsolver_equed)),
+      rocblas_test::device_free};
+  rocsolver_equed *dEqued = (rocsolver_equed *)dEqued_managed.get();
+  if (!dEqued) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrix hA with all entries in [1, 10], then
+  //  scale its rows and columns over several orders of magnitude so that
+  //  it needs equilibrating
+  rocblas_init<T>(hA, M, N, lda);
+  for (int i = 0; i < M; i++) {
+    for (int j = 0; j < N; j++) {
+      hA[i + j * lda] *= pow(T(10), T(i % 7 - 3)) * pow(T(10), T(j % 5 - 2));
+    }
+  }
+
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(rocsolver_geequ<T>(handle, M, N, dA, lda, dR, dC,
+                                           dCnd, dCnd + 1, dCnd + 2));
+
+    CHECK_HIP_ERROR(hipMemcpy(hRRes.data(), dR, sizeof(T) * M,
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hCRes.data(), dC, sizeof(T) * N,
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hCndRes.data(), dCnd, sizeof(T) * 3,
+                              hipMemcpyDeviceToHost));
+
+    const int retCBLAS = cblas_geequ<T>(M, N, hA.data(), lda, hR.data(),
+                                        hC.data(), &hCnd[0], &hCnd[1],
+                                        &hCnd[2]);
+    if (retCBLAS != 0) {
+      // a zero row or column shows as a zero ratio
+      if (hCndRes[retCBLAS <= M ? 0 : 1] != 0) {
+        fprintf(stderr, "rocBLAS should find the zero row or column!");
+        return rocblas_status_internal_error;
+      }
+      return rocblas_status_success;
+    }
+
+    // Error Check
+
+    // relative error of every scale factor and of the ratios
+    auto rel_err = [](T res, T ref) {
+      return (ref == 0) ? abs(res) : abs(res - ref) / abs(ref);
+    };
+    for (int i = 0; i < M; i++)
+      max_err_1 = max(max_err_1, rel_err(hRRes[i], hR[i]));
+    for (int j = 0; j < N; j++)
+      max_err_1 = max(max_err_1, rel_err(hCRes[j], hC[j]));
+    for (int k = 0; k < 3; k++)
+      max_err_1 = max(max_err_1, rel_err(hCndRes[k], hCnd[k]));
+    geequ_err_res_check<T>(max_err_1, M, N, error_eps_multiplier, eps);
+
+    // then equilibrate with the factors just computed
+    CHECK_ROCBLAS_ERROR(rocsolver_laqge<T>(handle, M, N, dA, lda, dR, dC, dCnd,
+                                           dCnd + 1, dCnd + 2, dEqued));
+
+    CHECK_HIP_ERROR(hipMemcpy(hAScaled.data(), dA, sizeof(T) * size_A,
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(&equedRes, dEqued, sizeof(rocsolver_equed),
+                              hipMemcpyDeviceToHost));
+
+    cblas_laqge<T>(M, N, hA.data(), lda, hRRes.data(), hCRes.data(),
+                   hCndRes[0], hCndRes[1], hCndRes[2], &equed);
+
+#ifdef GOOGLE_TEST
+    EXPECT_EQ(geequ_equed_char(equedRes), equed);
+#endif
+
+    for (int i = 0; i < M; i++) {
+      for (int j = 0; j < N; j++) {
+        max_err_1 = max(max_err_1, rel_err(hAScaled[i + j * lda],
+                                           hA[i + j * lda]));
+      }
+    }
+    geequ_err_res_check<T>(max_err_1, M, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_geequ<T>(handle, M, N, dA, lda, dR, dC,
+                                           dCnd, dCnd + 1, dCnd + 2));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    cblas_geequ<T>(M, N, hA.data(), lda, hR.data(), hC.data(), &hCnd[0],
+                   &hCnd[1], &hCnd[2]);
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , N , lda , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << N << " , " << lda << " , " << gpu_time_used << " , "
+         << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GEEQU_ERROR_EPS_MULTIPLIER
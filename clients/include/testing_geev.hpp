@@ -0,0 +1,238 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <complex>
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER dimension of the eigenvalues against LAPACK's and,
+// with the eigenvectors v, of A * v - lambda * v relative to the largest
+// eigenvalue and of |v| - 1
+#define GEEV_ERROR_EPS_MULTIPLIER 100
+
+using namespace std;
+
+template <typename T> rocblas_status testing_geev(Arguments argus) {
+
+  rocblas_int N = argus.N;
+  rocblas_int lda = argus.lda;
+  char char_evect = argus.evect_option;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocsolver_evect evect = char2rocsolver_evect(char_evect);
+
+  rocblas_int ldv = max(1, N);
+  rocblas_int size_A = lda * N;
+  rocblas_int size_V = ldv * N;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  const bool vectors = (evect == rocsolver_evect_original);
+
+  // check here to prevent undefined memory allocation error
+  if (N < 0 || lda < std::max(1, N)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dInfo_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(rocblas_int)),
+                           rocblas_test::device_free};
+    rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+    if (!dA || !dInfo) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = rocsolver_geev<T>(handle, evect, N, dA, lda, dA, dA, dA, ldv,
+                               dInfo);
+
+    geev_arg_check(status, N, lda, ldv, vectors);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(max(size_A, 1));
+  vector<T> hB(max(size_A, 1));
+  vector<T> hV(max(size_V, 1));
+  vector<T> hVRes(max(size_V, 1));
+  vector<T> hWR(max(N, 1));
+  vector<T> hWI(max(N, 1));
+  vector<T> hWRRes(max(N, 1));
+  vector<T> hWIRes(max(N, 1));
+  rocblas_int hInfo;
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GEEV_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hA.size()),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  auto dV_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hV.size()),
+                         rocblas_test::device_free};
+  T *dV = (T *)dV_managed.get();
+  auto dWR_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hWR.size()),
+                         rocblas_test::device_free};
+  T *dWR = (T *)dWR_managed.get();
+  auto dWI_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hWI.size()),
+                         rocblas_test::device_free};
+  T *dWI = (T *)dWI_managed.get();
+  auto dInfo_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(rocblas_int)),
+                         rocblas_test::device_free};
+  rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+  if (!dA || !dV || !dWR || !dWI || !dInfo) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrix hA with all entries in [1, 10]
+  rocblas_init<T>(hA, N, N, lda);
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(rocsolver_geev<T>(handle, evect, N, dA, lda, dWR, dWI,
+                                          dV, ldv, dInfo));
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hWRRes.data(), dWR, sizeof(T) * N, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hWIRes.data(), dWI, sizeof(T) * N, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hVRes.data(), dV, sizeof(T) * size_V, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(&hInfo, dInfo, sizeof(rocblas_int),
+                              hipMemcpyDeviceToHost));
+
+    // Error Check
+
+    // the eigenvalues against LAPACK's, in whatever order: each one is
+    // matched with the nearest of LAPACK's not taken yet
+    hB = hA;
+    cblas_geev<T>('N', N, hB.data(), lda, hWR.data(), hWI.data(), hV.data(),
+                  ldv);
+    T wmax = 0;
+    for (int i = 0; i < N; i++)
+      wmax = max(wmax, T(abs(complex<T>(hWR[i], hWI[i]))));
+    vector<bool> taken(N, false);
+    for (int i = 0; i < N; i++) {
+      const complex<T> w(hWRRes[i], hWIRes[i]);
+      int best = 0;
+      T dist = numeric_limits<T>::max();
+      for (int j = 0; j < N; j++) {
+        const T d = abs(w - complex<T>(hWR[j], hWI[j]));
+        if (!taken[j] && d < dist) {
+          best = j;
+          dist = d;
+        }
+      }
+      taken[best] = true;
+      max_err_1 = max(max_err_1, dist);
+    }
+
+    // A * v - lambda * v and |v| - 1, v = V(:,k) + i * V(:,k+1) for the
+    // first eigenvalue of a complex conjugate pair
+    if (vectors) {
+      for (int k = 0; k < N; k++) {
+        const bool pair = (hWIRes[k] != 0 && k < N - 1);
+        const complex<T> lambda(hWRRes[k], hWIRes[k]);
+        T vnorm = 0;
+        for (int i = 0; i < N; i++) {
+          complex<T> r = 0;
+          for (int l = 0; l < N; l++)
+            r += hA[i + l * lda] *
+                 complex<T>(hVRes[l + k * ldv],
+                            pair ? hVRes[l + (k + 1) * ldv] : T(0));
+          r -= lambda * complex<T>(hVRes[i + k * ldv],
+                                   pair ? hVRes[i + (k + 1) * ldv] : T(0));
+          max_err_1 = max(max_err_1, T(abs(r)));
+          vnorm += hVRes[i + k * ldv] * hVRes[i + k * ldv];
+          if (pair)
+            vnorm += hVRes[i + (k + 1) * ldv] * hVRes[i + (k + 1) * ldv];
+        }
+        max_err_1 = max(max_err_1, T(abs(vnorm - 1) * wmax));
+        if (pair)
+          k++;
+      }
+    }
+    if (wmax > 0)
+      max_err_1 /= wmax;
+    if (hInfo != 0)
+      max_err_1 = 1;
+
+    geev_err_res_check<T>(max_err_1, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_geev<T>(handle, evect, N, dA, lda, dWR, dWI,
+                                          dV, ldv, dInfo));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    cblas_geev<T>(char_evect, N, hA.data(), lda, hWR.data(), hWI.data(),
+                  hV.data(), ldv);
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "N , lda , evect , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << N << " , " << lda << " , " << char_evect << " , "
+         << gpu_time_used << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GEEV_ERROR_EPS_MULTIPLIER
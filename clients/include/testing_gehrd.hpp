@@ -0,0 +1,182 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER dimension of Q**T * A * Q - H relative to the norm
+// of A
+#define GEHRD_ERROR_EPS_MULTIPLIER 100
+
+using namespace std;
+
+template <typename T> rocblas_status testing_gehrd(Arguments argus) {
+
+  rocblas_int N = argus.N;
+  rocblas_int lda = argus.lda;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_A = lda * N;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (N < 0 || lda < std::max(1, N)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = rocsolver_gehrd<T>(handle, N, dA, lda, dA);
+
+    gehrd_arg_check(status, N, lda);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(max(size_A, 1));
+  vector<T> hARes(max(size_A, 1));
+  vector<T> hTau(max(N, 1));
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GEHRD_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hA.size()),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  auto dTau_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hTau.size()),
+                         rocblas_test::device_free};
+  T *dTau = (T *)dTau_managed.get();
+  if (!dA || !dTau) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrix hA with all entries in [1, 10]
+  rocblas_init<T>(hA, N, N, lda);
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(rocsolver_gehrd<T>(handle, N, dA, lda, dTau));
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hARes.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hTau.data(), dTau, sizeof(T) * hTau.size(),
+                              hipMemcpyDeviceToHost));
+
+    // Error Check
+
+    // Q**T * A * Q - H relative to the Frobenius norm of A, with Q applied
+    // one reflector at a time from the vectors left below the subdiagonal
+    vector<T> hB = hA;
+    vector<T> v(max(N, 1));
+    T anorm = 0;
+    for (int j = 0; j < N; j++)
+      for (int i = 0; i < N; i++)
+        anorm += hA[i + j * lda] * hA[i + j * lda];
+    anorm = sqrt(anorm);
+    for (int c = 0; c < N - 1; c++) {
+      for (int i = 0; i < N; i++)
+        v[i] = (i <= c) ? 0 : (i == c + 1) ? 1 : hARes[i + c * lda];
+      // B := H(c) * B * H(c)
+      for (int j = 0; j < N; j++) {
+        T d = 0;
+        for (int i = c + 1; i < N; i++)
+          d += v[i] * hB[i + j * lda];
+        for (int i = c + 1; i < N; i++)
+          hB[i + j * lda] -= hTau[c] * d * v[i];
+      }
+      for (int i = 0; i < N; i++) {
+        T d = 0;
+        for (int j = c + 1; j < N; j++)
+          d += hB[i + j * lda] * v[j];
+        for (int j = c + 1; j < N; j++)
+          hB[i + j * lda] -= hTau[c] * d * v[j];
+      }
+    }
+    for (int j = 0; j < N; j++) {
+      for (int i = 0; i < N; i++) {
+        const T h = (i <= j + 1) ? hARes[i + j * lda] : 0;
+        max_err_1 = max(max_err_1, T(abs(hB[i + j * lda] - h)));
+      }
+    }
+    if (anorm > 0)
+      max_err_1 /= anorm;
+
+    gehrd_err_res_check<T>(max_err_1, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_gehrd<T>(handle, N, dA, lda, dTau));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    cblas_gehrd<T>(N, hA.data(), lda, hTau.data());
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "N , lda , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << N << " , " << lda << " , " << gpu_time_used << " , "
+         << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GEHRD_ERROR_EPS_MULTIPLIER
@@ -0,0 +1,225 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error of the solutions PER dimension, relative to the largest
+// entry of the reference solutions
+#define GELS_ERROR_EPS_MULTIPLIER 1000
+
+using namespace std;
+
+// gels on the first problem, or the strided batched variant on batch_count
+// problems
+template <typename T>
+rocblas_status testing_gels_calls(rocblas_handle handle, bool batched,
+                                  rocblas_operation trans, rocblas_int M,
+                                  rocblas_int N, rocblas_int nrhs, T *dA,
+                                  rocblas_int lda, rocblas_int strideA, T *dB,
+                                  rocblas_int ldb, rocblas_int strideB,
+                                  rocblas_int batch_count) {
+  return batched ? rocsolver_gels_strided_batched<T>(
+                       handle, trans, M, N, nrhs, dA, lda, strideA, dB, ldb,
+                       strideB, batch_count)
+                 : rocsolver_gels<T>(handle, trans, M, N, nrhs, dA, lda, dB,
+                                     ldb);
+}
+
+template <typename T> rocblas_status testing_gels(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int N = argus.N;
+  rocblas_int nrhs = argus.K;
+  rocblas_int lda = argus.lda;
+  rocblas_int ldb = argus.ldb;
+  rocblas_int batch_count = argus.batch_count;
+  char char_trans = argus.transA_option;
+
+  rocblas_operation trans = (char_trans == 'T') ? rocblas_operation_transpose
+                                                : rocblas_operation_none;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int strideA = max(lda, M) * N;
+  rocblas_int strideB = max(ldb, max(M, N)) * nrhs;
+  rocblas_int size_A = strideA * max(batch_count, 1);
+  rocblas_int size_B = strideB * max(batch_count, 1);
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || N < 0 || nrhs < 0 || batch_count < 0 || lda < std::max(1, M) ||
+      ldb < std::max(1, std::max(M, N))) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = testing_gels_calls<T>(handle, true, trans, M, N, nrhs, dA, lda,
+                                   0, dA, ldb, 0, batch_count);
+
+    gels_arg_check(status, M, N, nrhs, lda, ldb, batch_count);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(size_A);
+  vector<T> hB(size_B);
+  vector<T> hARef(size_A);
+  vector<T> hBRef(size_B);
+  vector<T> hBRes(size_B);
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GELS_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  auto dB_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B),
+                         rocblas_test::device_free};
+  T *dB = (T *)dB_managed.get();
+  if ((size_A && !dA) || (size_B && !dB)) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrices hA and hB with all entries in [1, 10],
+  //  and add a heavy diagonal to every A_b, so that it is well conditioned
+  vector<T> hAb(strideA);
+  vector<T> hBb(strideB);
+  for (int b = 0; b < batch_count; b++) {
+    rocblas_init<T>(hAb, M, N, lda);
+    rocblas_init<T>(hBb, max(M, N), nrhs, ldb);
+    for (int i = 0; i < min(M, N); i++)
+      hAb[i + i * lda] += 400;
+    copy(hAb.begin(), hAb.end(), hA.begin() + b * strideA);
+    copy(hBb.begin(), hBb.end(), hB.begin() + b * strideB);
+  }
+
+  // the reference LAPACK solutions
+  auto cblas_solve = [&]() {
+    hARef = hA;
+    hBRef = hB;
+    for (int b = 0; b < batch_count; b++)
+      cblas_gels<T>(char_trans, M, N, nrhs, hARef.data() + b * strideA, lda,
+                    hBRef.data() + b * strideB, ldb);
+  };
+
+  // the rows of a solution
+  const rocblas_int rows = (char_trans == 'T') ? M : N;
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    cblas_solve();
+
+    // the single problem interface on the first problem, then the whole batch
+    for (int batched = 0; batched < 2; batched++) {
+      CHECK_HIP_ERROR(
+          hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+      CHECK_HIP_ERROR(
+          hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+      CHECK_ROCBLAS_ERROR(testing_gels_calls<T>(handle, batched == 1, trans, M,
+                                                N, nrhs, dA, lda, strideA, dB,
+                                                ldb, strideB, batch_count));
+
+      CHECK_HIP_ERROR(hipMemcpy(hBRes.data(), dB, sizeof(T) * size_B,
+                                hipMemcpyDeviceToHost));
+
+      // Error Check
+
+      // the solutions relative to the largest entry of the reference ones
+      const int nres = batched ? batch_count : min(batch_count, 1);
+      for (int b = 0; b < nres; b++) {
+        T err = 0, xmax = 0;
+        for (int i = 0; i < rows; i++) {
+          for (int j = 0; j < nrhs; j++) {
+            const int k = b * strideB + i + j * ldb;
+            err = max(err, abs(hBRes[k] - hBRef[k]));
+            xmax = max(xmax, abs(hBRef[k]));
+          }
+        }
+        if (xmax > 0)
+          err /= xmax;
+        max_err_1 = max_err_1 > err ? max_err_1 : err;
+      }
+      gels_err_res_check<T>(max_err_1, M, N, error_eps_multiplier, eps);
+    }
+  }
+
+  if (argus.timing) {
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(testing_gels_calls<T>(handle, true, trans, M, N, nrhs,
+                                              dA, lda, strideA, dB, ldb,
+                                              strideB, batch_count));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    cblas_solve();
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , N , nrhs , lda , ldb , trans , batch_count , us [gpu] , "
+            "us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << N << " , " << nrhs << " , " << lda << " , " << ldb
+         << " , " << char_trans << " , " << batch_count << " , "
+         << gpu_time_used << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GELS_ERROR_EPS_MULTIPLIER
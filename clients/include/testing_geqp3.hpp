@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER dimension of Q * R against A * P relative to the
+// largest entry of A, and of the first negligible diagonal entry of R
+// relative to the first one
+#define GEQP3_ERROR_EPS_MULTIPLIER 100
+
+using namespace std;
+
+// with 0 < K < min(M, N), A is built with rank K and R(K,K) must reveal it;
+// the pivots are not compared with LAPACK's, as ties between columns of
+// about the same norm may go either way
+template <typename T> rocblas_status testing_geqp3(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int N = argus.N;
+  rocblas_int K = argus.K;
+  rocblas_int lda = argus.lda;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_A = max(lda, M) * N;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || N < 0 || lda < std::max(1, M)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dJpvt_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(rocblas_int) * safe_size),
+        rocblas_test::device_free};
+    rocblas_int *dJpvt = (rocblas_int *)dJpvt_managed.get();
+    if (!dA || !dJpvt) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = rocsolver_geqp3<T>(handle, M, N, dA, lda, dJpvt, dA);
+
+    geqrf_arg_check(status, M, N, lda);
+
+    return status;
+  }
+
+  const rocblas_int kmin = min(M, N);
+  const bool low_rank = K > 0 && K < kmin;
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(size_A);
+  vector<T> hARes(size_A);
+  vector<T> hQ(size_A);
+  vector<T> hTau(max(kmin, 1));
+  vector<rocblas_int> hJpvt(max(N, 1));
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GEQP3_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  auto dTau_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hTau.size()),
+                         rocblas_test::device_free};
+  T *dTau = (T *)dTau_managed.get();
+  auto dJpvt_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(rocblas_int) * hJpvt.size()),
+      rocblas_test::device_free};
+  rocblas_int *dJpvt = (rocblas_int *)dJpvt_managed.get();
+  if (!dA || !dTau || !dJpvt) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrix hA with all entries in [1, 10], or the
+  //  product of M x K and K x N such matrices with alternating signs
+  if (low_rank) {
+    vector<T> hX(M * K);
+    vector<T> hY(K * N);
+    rocblas_init_alternating_sign<T>(hX, M, K, M);
+    rocblas_init_alternating_sign<T>(hY, K, N, K);
+    for (int i = 0; i < M; i++) {
+      for (int j = 0; j < N; j++) {
+        T s = 0;
+        for (int l = 0; l < K; l++)
+          s += hX[i + l * M] * hY[l + j * K];
+        hA[i + j * lda] = s;
+      }
+    }
+  } else {
+    rocblas_init<T>(hA, M, N, lda);
+  }
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(rocsolver_geqp3<T>(handle, M, N, dA, lda, dJpvt, dTau));
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hARes.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hTau.data(), dTau, sizeof(T) * kmin,
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hJpvt.data(), dJpvt, sizeof(rocblas_int) * N,
+                              hipMemcpyDeviceToHost));
+
+    // Error Check
+
+    // jpvt must be a permutation
+    vector<int> seen(N, 0);
+    for (int j = 0; j < N; j++) {
+      if (hJpvt[j] < 1 || hJpvt[j] > N || seen[hJpvt[j] - 1]++) {
+        geqp3_err_res_check<T>(1, M, N, error_eps_multiplier, eps);
+        return rocblas_status_success;
+      }
+    }
+
+    // Q * R against A * P, with Q formed on the CPU from the reflectors
+    hQ = hARes;
+    if (kmin > 0)
+      cblas_orgqr<T>(M, kmin, kmin, hQ.data(), lda, hTau.data());
+    T amax = 0;
+    for (int i = 0; i < M; i++) {
+      for (int j = 0; j < N; j++) {
+        T s = 0;
+        for (int l = 0; l <= min(j, kmin - 1); l++)
+          s += hQ[i + l * lda] * hARes[l + j * lda];
+        max_err_1 = max(max_err_1, abs(s - hA[i + (hJpvt[j] - 1) * lda]));
+        amax = max(amax, abs(hA[i + j * lda]));
+      }
+    }
+    if (amax > 0)
+      max_err_1 /= amax;
+
+    // the rank shows on the diagonal of R
+    if (low_rank)
+      max_err_1 = max(max_err_1, abs(hARes[K + K * lda] / hARes[0]));
+
+    geqp3_err_res_check<T>(max_err_1, M, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_geqp3<T>(handle, M, N, dA, lda, dJpvt, dTau));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    cblas_geqp3<T>(M, N, hA.data(), lda, hJpvt.data(), hTau.data());
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , N , lda , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << N << " , " << lda << " , " << gpu_time_used << " , "
+         << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GEQP3_ERROR_EPS_MULTIPLIER
@@ -0,0 +1,185 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error of the factorization relative to its largest entry; the
+// scalar factors of the last reflectors (very few nonzeros left to
+// annihilate) are the most sensitive to the order of the rounding
+#define GEQRF_ERROR_EPS_MULTIPLIER 5000
+
+using namespace std;
+
+// with unblocked = true the factorization goes through geqr2
+template <typename T>
+rocblas_status testing_geqrf(Arguments argus, bool unblocked = false) {
+
+  rocblas_int M = argus.M;
+  rocblas_int N = argus.N;
+  rocblas_int lda = argus.lda;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_A = max(lda, M) * N;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || N < 0 || lda < std::max(1, M)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    if (unblocked)
+      status = rocsolver_geqr2<T>(handle, M, N, dA, lda, dA);
+    else
+      status = rocsolver_geqrf<T>(handle, M, N, dA, lda, dA);
+
+    geqrf_arg_check(status, M, N, lda);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(size_A);
+  vector<T> hARes(size_A);
+  vector<T> hTau(max(min(M, N), 1));
+  vector<T> hTauRes(hTau.size());
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GEQRF_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  if (!dA) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  auto dTau_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hTau.size()),
+                         rocblas_test::device_free};
+  T *dTau = (T *)dTau_managed.get();
+  if (!dTau) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrix hA with all entries in [1, 10]
+  rocblas_init<T>(hA, M, N, lda);
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    if (unblocked) {
+      CHECK_ROCBLAS_ERROR(rocsolver_geqr2<T>(handle, M, N, dA, lda, dTau));
+    } else {
+      CHECK_ROCBLAS_ERROR(rocsolver_geqrf<T>(handle, M, N, dA, lda, dTau));
+    }
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hARes.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hTauRes.data(), dTau, sizeof(T) * min(M, N),
+                              hipMemcpyDeviceToHost));
+
+    if (unblocked)
+      cblas_geqr2<T>(M, N, hA.data(), lda, hTau.data());
+    else
+      cblas_geqrf<T>(M, N, hA.data(), lda, hTau.data());
+
+    // Error Check
+
+    // R and the reflectors relative to the largest entry of the reference,
+    // and the scalar factors, which are in [0, 2]
+    T amax = 0;
+    for (int i = 0; i < M; i++) {
+      for (int j = 0; j < N; j++) {
+        max_err_1 = max(max_err_1, abs(hARes[i + j * lda] - hA[i + j * lda]));
+        amax = max(amax, abs(hA[i + j * lda]));
+      }
+    }
+    if (amax > 0)
+      max_err_1 /= amax;
+    for (int j = 0; j < min(M, N); j++) {
+      max_err_1 = max(max_err_1, abs(hTauRes[j] - hTau[j]));
+    }
+    geqrf_err_res_check<T>(max_err_1, M, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    if (unblocked) {
+      CHECK_ROCBLAS_ERROR(rocsolver_geqr2<T>(handle, M, N, dA, lda, dTau));
+    } else {
+      CHECK_ROCBLAS_ERROR(rocsolver_geqrf<T>(handle, M, N, dA, lda, dTau));
+    }
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    if (unblocked)
+      cblas_geqr2<T>(M, N, hA.data(), lda, hTau.data());
+    else
+      cblas_geqrf<T>(M, N, hA.data(), lda, hTau.data());
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , N , lda , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << N << " , " << lda << " , " << gpu_time_used << " , "
+         << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GEQRF_ERROR_EPS_MULTIPLIER
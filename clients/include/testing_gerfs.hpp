@@ -0,0 +1,267 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max relative error of the refined solution and max backward error
+#define GERFS_ERROR_EPS_MULTIPLIER 100
+// both error bounds are estimates: they must agree within this factor
+#define GERFS_FERR_FACTOR 4
+
+using namespace std;
+
+template <typename T> rocblas_status testing_gerfs(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int nhrs = argus.N;
+  rocblas_int lda = argus.lda;
+  rocblas_int ldb = argus.ldb;
+  char trans = argus.transA_option;
+
+  rocblas_operation transRoc;
+  if (trans == 'N') {
+    transRoc = rocblas_operation_none;
+  } else if (trans == 'T') {
+    transRoc = rocblas_operation_transpose;
+  } else {
+    throw runtime_error("Unsupported transpose operation.");
+  }
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_A = max(lda, M) * M;
+  rocblas_int size_B = max(ldb, M) * nhrs;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || nhrs < 0 || lda < std::max(1, M) || ldb < std::max(1, M)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    auto dIpiv_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(int) * safe_size),
+        rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+    status = rocsolver_gerfs<T>(handle, transRoc, M, nhrs, dA, lda, dA, lda,
+                                dIpiv, dA, ldb, dA, ldb, dA, dA);
+
+    getrs_arg_check(status, M, nhrs, lda, ldb);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(size_A);
+  vector<T> hAF(size_A);
+  vector<T> hB(size_B);
+  vector<T> hX(size_B);
+  vector<T> hXRes(size_B);
+  vector<T> hFerr(max(nhrs, 1));
+  vector<T> hBerr(max(nhrs, 1));
+  vector<T> hFerrRes(max(nhrs, 1));
+  vector<T> hBerrRes(max(nhrs, 1));
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GERFS_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A * 2),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  if (!dA) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+  T *dAF = dA + size_A;
+
+  auto dB_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B * 2),
+                         rocblas_test::device_free};
+  T *dB = (T *)dB_managed.get();
+  if (!dB) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+  T *dX = dB + size_B;
+
+  // ferr and berr next to each other
+  auto dErr_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(T) * 2 * hFerr.size()),
+      rocblas_test::device_free};
+  T *dFerr = (T *)dErr_managed.get();
+  if (!dFerr) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+  T *dBerr = dFerr + hFerr.size();
+
+  //  initialize full random matrix hA, hB with all entries in [1, 10]
+  rocblas_init<T>(hA, M, M, lda);
+  rocblas_init<T>(hB, M, nhrs, ldb);
+
+  //  pad untouched area into zero
+  for (int i = M; i < lda; i++) {
+    for (int j = 0; j < M; j++) {
+      hA[i + j * lda] = 0.0;
+    }
+  }
+  for (int i = M; i < ldb; i++) {
+    for (int j = 0; j < nhrs; j++) {
+      hB[i + j * ldb] = 0.0;
+    }
+  }
+
+  // now make it diagonally dominant
+  for (int i = 0; i < M; i++) {
+    hA[i + i * lda] *= 420.0;
+  }
+
+  // allocate space for the pivoting array
+  vector<int> hIpiv(max(M, 1));
+  auto dIpiv_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(int) * hIpiv.size()),
+      rocblas_test::device_free};
+  rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+  // factor A and solve w/ the reference LAPACK routines, then spoil the
+  // solution in its last half digits so that there is something to refine
+  hAF = hA;
+  const int retCBLAS = cblas_getrf<T>(M, M, hAF.data(), lda, hIpiv.data());
+  if (retCBLAS != 0) {
+    // error encountered - unlucky pick of random numbers? no use to continue
+    return rocblas_status_success;
+  }
+  hX = hB;
+  cblas_getrs<T>(trans, M, nhrs, hAF.data(), lda, hIpiv.data(), hX.data(),
+                 ldb);
+  for (int i = 0; i < M; i++) {
+    for (int j = 0; j < nhrs; j++) {
+      hX[i + j * ldb] *= 1 + sqrt(eps) * ((i + j) % 3 - 1);
+    }
+  }
+
+  // now copy pivoting indices and matrices to the GPU
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(
+      hipMemcpy(dAF, hAF.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(
+      hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(
+      hipMemcpy(dX, hX.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(
+      hipMemcpy(dIpiv, hIpiv.data(), sizeof(int) * M, hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(rocsolver_gerfs<T>(handle, transRoc, M, nhrs, dA, lda,
+                                           dAF, lda, dIpiv, dB, ldb, dX, ldb,
+                                           dFerr, dBerr));
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hXRes.data(), dX, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hFerrRes.data(), dFerr, sizeof(T) * nhrs,
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hBerrRes.data(), dBerr, sizeof(T) * nhrs,
+                              hipMemcpyDeviceToHost));
+
+    cblas_gerfs<T>(trans, M, nhrs, hA.data(), lda, hAF.data(), lda,
+                   hIpiv.data(), hB.data(), ldb, hX.data(), ldb, hFerr.data(),
+                   hBerr.data());
+
+    // Error Check
+
+    // normwise relative error of every refined solution, and the backward
+    // errors, which must both be small
+    for (int j = 0; j < nhrs; j++) {
+      T diff = 0, xmax = 0;
+      for (int i = 0; i < M; i++) {
+        diff = max(diff, abs(hXRes[i + j * ldb] - hX[i + j * ldb]));
+        xmax = max(xmax, abs(hX[i + j * ldb]));
+      }
+      max_err_1 = max(max_err_1, xmax > 0 ? diff / xmax : diff);
+      max_err_1 = max(max_err_1, hBerrRes[j]);
+    }
+    gerfs_err_res_check<T>(max_err_1, M, nhrs, error_eps_multiplier, eps);
+
+#ifdef GOOGLE_TEST
+    for (int j = 0; j < nhrs; j++) {
+      EXPECT_LE(hFerrRes[j], GERFS_FERR_FACTOR * hFerr[j]);
+      EXPECT_LE(hFerr[j], GERFS_FERR_FACTOR * hFerrRes[j]);
+    }
+#endif
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_gerfs<T>(handle, transRoc, M, nhrs, dA, lda,
+                                           dAF, lda, dIpiv, dB, ldb, dX, ldb,
+                                           dFerr, dBerr));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    cblas_gerfs<T>(trans, M, nhrs, hA.data(), lda, hAF.data(), lda,
+                   hIpiv.data(), hB.data(), ldb, hX.data(), ldb, hFerr.data(),
+                   hBerr.data());
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , nhrs , lda , ldb , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << nhrs << " , " << lda << " , " << ldb << " , "
+         << gpu_time_used << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GERFS_ERROR_EPS_MULTIPLIER
+#undef GERFS_FERR_FACTOR
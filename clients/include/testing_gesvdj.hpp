@@ -0,0 +1,309 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER dimension of the singular values against LAPACK's
+// and, with the singular vectors, of A - U * diag(S) * V**T relative to the
+// largest singular value and of U**T * U - I and V**T * V - I, over the batch
+#define GESVDJ_ERROR_EPS_MULTIPLIER 100
+
+// sweeps allowed to every matrix, far more than it takes to converge
+#define GESVDJ_MAX_SWEEPS 100
+
+using namespace std;
+
+// the strided batched variant if strided, otherwise the batched one on an
+// array of pointers to the same matrices
+template <typename T>
+rocblas_status
+testing_gesvdj_calls(rocblas_handle handle, bool strided,
+                     rocsolver_svect left_svect, rocsolver_svect right_svect,
+                     rocblas_int M, rocblas_int N, T *dA, T *const dAarray[],
+                     rocblas_int lda, rocblas_int strideA, T *dS,
+                     rocblas_int strideS, T *dU, rocblas_int ldu,
+                     rocblas_int strideU, T *dV, rocblas_int ldv,
+                     rocblas_int strideV, rocblas_int *dInfo,
+                     rocblas_int batch_count) {
+  return strided ? rocsolver_gesvdj_strided_batched<T>(
+                       handle, left_svect, right_svect, M, N, dA, lda,
+                       strideA, 0, GESVDJ_MAX_SWEEPS, dS, strideS, dU, ldu,
+                       strideU, dV, ldv, strideV, dInfo, batch_count)
+                 : rocsolver_gesvdj_batched<T>(
+                       handle, left_svect, right_svect, M, N, dAarray, lda, 0,
+                       GESVDJ_MAX_SWEEPS, dS, strideS, dU, ldu, strideU, dV,
+                       ldv, strideV, dInfo, batch_count);
+}
+
+template <typename T>
+rocblas_status testing_gesvdj(Arguments argus, bool strided) {
+
+  rocblas_int M = argus.M;
+  rocblas_int N = argus.N;
+  rocblas_int lda = argus.lda;
+  rocblas_int batch_count = argus.batch_count;
+  char char_left = argus.left_svect_option;
+  char char_right = argus.right_svect_option;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocsolver_svect left_svect = char2rocsolver_svect(char_left);
+  rocsolver_svect right_svect = char2rocsolver_svect(char_right);
+
+  rocblas_int ldu = max(1, M);
+  rocblas_int ldv = max(1, N);
+  rocblas_int K = min(M, N);
+  rocblas_int strideA = lda * N;
+  rocblas_int strideS = K;
+  rocblas_int strideU = ldu * M;
+  rocblas_int strideV = ldv * N;
+  rocblas_int size_A = strideA * max(batch_count, 1);
+  rocblas_int size_S = strideS * max(batch_count, 1);
+  rocblas_int size_U = strideU * max(batch_count, 1);
+  rocblas_int size_V = strideV * max(batch_count, 1);
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || N < 0 || batch_count < 0 || lda < std::max(1, M)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dInfo_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(rocblas_int) * safe_size),
+        rocblas_test::device_free};
+    rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+    auto dAarray_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T *) * safe_size),
+                           rocblas_test::device_free};
+    T **dAarray = (T **)dAarray_managed.get();
+    if (!dA || !dInfo || !dAarray) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = testing_gesvdj_calls<T>(handle, strided, left_svect, right_svect,
+                                     M, N, dA, dAarray, lda, 0, dA, 0, dA, ldu,
+                                     0, dA, ldv, 0, dInfo, batch_count);
+
+    gesvdj_arg_check(status, M, N, lda, batch_count);
+
+    return status;
+  }
+
+  const rocblas_int ucols =
+      (left_svect == rocsolver_svect_all)
+          ? M
+          : (left_svect == rocsolver_svect_singular) ? K : 0;
+  const rocblas_int vrows =
+      (right_svect == rocsolver_svect_all)
+          ? N
+          : (right_svect == rocsolver_svect_singular) ? K : 0;
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(max(size_A, 1));
+  vector<T> hS(max(size_S, 1));
+  vector<T> hSRes(max(size_S, 1));
+  vector<T> hU(max(size_U, 1));
+  vector<T> hV(max(size_V, 1));
+  vector<rocblas_int> hInfo(max(batch_count, 1));
+  vector<T *> hAarray(max(batch_count, 1));
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GESVDJ_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hA.size()),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  auto dS_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hS.size()),
+                         rocblas_test::device_free};
+  T *dS = (T *)dS_managed.get();
+  auto dU_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hU.size()),
+                         rocblas_test::device_free};
+  T *dU = (T *)dU_managed.get();
+  auto dV_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hV.size()),
+                         rocblas_test::device_free};
+  T *dV = (T *)dV_managed.get();
+  auto dInfo_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(rocblas_int) * hInfo.size()),
+      rocblas_test::device_free};
+  rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+  auto dAarray_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(T *) * hAarray.size()),
+      rocblas_test::device_free};
+  T **dAarray = (T **)dAarray_managed.get();
+  if (!dA || !dS || !dU || !dV || !dInfo || !dAarray) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrices hA with all entries in [1, 10]
+  vector<T> hAb(max(strideA, 1));
+  for (int b = 0; b < batch_count; b++) {
+    rocblas_init<T>(hAb, M, N, lda);
+    copy(hAb.begin(), hAb.begin() + strideA, hA.begin() + b * strideA);
+    hAarray[b] = dA + b * strideA;
+  }
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(hipMemcpy(dAarray, hAarray.data(),
+                            sizeof(T *) * hAarray.size(),
+                            hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(testing_gesvdj_calls<T>(
+        handle, strided, left_svect, right_svect, M, N, dA, dAarray, lda,
+        strideA, dS, strideS, dU, ldu, strideU, dV, ldv, strideV, dInfo,
+        batch_count));
+
+    CHECK_HIP_ERROR(hipMemcpy(hSRes.data(), dS, sizeof(T) * size_S,
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hU.data(), dU, sizeof(T) * size_U, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hV.data(), dV, sizeof(T) * size_V, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hInfo.data(), dInfo,
+                              sizeof(rocblas_int) * batch_count,
+                              hipMemcpyDeviceToHost));
+
+    // Error Check
+
+    vector<T> hB(max(strideA, 1));
+    vector<T> hUb(1), hVb(1);
+    for (int b = 0; b < batch_count; b++) {
+      T *A = hA.data() + b * strideA;
+      T *S = hSRes.data() + b * strideS;
+      T *U = hU.data() + b * strideU;
+      T *V = hV.data() + b * strideV;
+      T err = 0;
+
+      // the singular values against LAPACK's, both in descending order
+      copy(A, A + strideA, hB.begin());
+      cblas_gesvd<T>('N', 'N', M, N, hB.data(), lda, hS.data(), hUb.data(), 1,
+                     hVb.data(), 1);
+      T smax = (K > 0) ? hS[0] : 0;
+      for (int i = 0; i < K; i++)
+        err = max(err, abs(S[i] - hS[i]));
+
+      // U**T * U - I and V**T * V - I
+      for (int j = 0; j < ucols; j++) {
+        for (int i = 0; i < ucols; i++) {
+          T g = (i == j) ? -1 : 0;
+          for (int l = 0; l < M; l++)
+            g += U[l + i * ldu] * U[l + j * ldu];
+          err = max(err, abs(g) * smax);
+        }
+      }
+      for (int j = 0; j < vrows; j++) {
+        for (int i = 0; i < vrows; i++) {
+          T g = (i == j) ? -1 : 0;
+          for (int l = 0; l < N; l++)
+            g += V[i + l * ldv] * V[j + l * ldv];
+          err = max(err, abs(g) * smax);
+        }
+      }
+
+      // A - U * diag(S) * V**T
+      if (ucols > 0 && vrows > 0) {
+        for (int j = 0; j < N; j++) {
+          for (int i = 0; i < M; i++) {
+            T r = A[i + j * lda];
+            for (int l = 0; l < K; l++)
+              r -= U[i + l * ldu] * S[l] * V[l + j * ldv];
+            err = max(err, abs(r));
+          }
+        }
+      }
+      if (smax > 0)
+        err /= smax;
+
+      // the sweeps must have converged
+      if (hInfo[b] != 0)
+        err = 1;
+
+      max_err_1 = max(max_err_1, err);
+    }
+
+    gesvd_err_res_check<T>(max_err_1, M, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(testing_gesvdj_calls<T>(
+        handle, strided, left_svect, right_svect, M, N, dA, dAarray, lda,
+        strideA, dS, strideS, dU, ldu, strideU, dV, ldv, strideV, dInfo,
+        batch_count));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    for (int b = 0; b < batch_count; b++)
+      cblas_gesvd<T>(char_left, char_right, M, N, hA.data() + b * strideA, lda,
+                     hS.data() + b * strideS, hU.data() + b * strideU, ldu,
+                     hV.data() + b * strideV, ldv);
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , N , lda , left_svect , right_svect , batch_count , us [gpu] "
+            ", us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << N << " , " << lda << " , " << char_left << " , "
+         << char_right << " , " << batch_count << " , " << gpu_time_used
+         << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GESVDJ_ERROR_EPS_MULTIPLIER
+#undef GESVDJ_MAX_SWEEPS
@@ -0,0 +1,256 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER dimension of the leading singular values against
+// LAPACK's and, with the singular vectors, of A - U * diag(S) * V**T
+// relative to the largest singular value and of U**T * U - I and V**T * V -
+// I; A has rank K, so the randomized range is exact up to rounding
+#define GESVDR_ERROR_EPS_MULTIPLIER 100
+
+using namespace std;
+
+template <typename T> rocblas_status testing_gesvdr(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int N = argus.N;
+  rocblas_int K = argus.K;
+  rocblas_int lda = argus.lda;
+  rocblas_int oversample = argus.oversample;
+  rocblas_int power_iters = argus.power_iters;
+  char char_left = argus.left_svect_option;
+  char char_right = argus.right_svect_option;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocsolver_svect left_svect = char2rocsolver_svect(char_left);
+  rocsolver_svect right_svect = char2rocsolver_svect(char_right);
+
+  rocblas_int ldu = max(1, M);
+  rocblas_int ldv = max(1, K);
+  rocblas_int size_A = lda * N;
+  rocblas_int size_U = ldu * K;
+  rocblas_int size_V = ldv * N;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || N < 0 || lda < std::max(1, M) || K < 0 || K > min(M, N) ||
+      oversample < 0 || power_iters < 0) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dInfo_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(rocblas_int)),
+                           rocblas_test::device_free};
+    rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+    if (!dA || !dInfo) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = rocsolver_gesvdr<T>(handle, left_svect, right_svect, M, N, dA,
+                                 lda, K, oversample, power_iters, dA, dA, ldu,
+                                 dA, ldv, dInfo);
+
+    gesvdr_arg_check(status, M, N, lda, K, oversample, power_iters);
+
+    return status;
+  }
+
+  const rocblas_int ucols = (left_svect == rocsolver_svect_none) ? 0 : K;
+  const rocblas_int vrows = (right_svect == rocsolver_svect_none) ? 0 : K;
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(max(size_A, 1));
+  vector<T> hB(max(size_A, 1));
+  vector<T> hS(max(min(M, N), 1));
+  vector<T> hSRes(max(K, 1));
+  vector<T> hU(max(size_U, 1));
+  vector<T> hV(max(size_V, 1));
+  rocblas_int hInfo = 0;
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GESVDR_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hA.size()),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  auto dS_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hSRes.size()),
+                         rocblas_test::device_free};
+  T *dS = (T *)dS_managed.get();
+  auto dU_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hU.size()),
+                         rocblas_test::device_free};
+  T *dU = (T *)dU_managed.get();
+  auto dV_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hV.size()),
+                         rocblas_test::device_free};
+  T *dV = (T *)dV_managed.get();
+  auto dInfo_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(rocblas_int)),
+                         rocblas_test::device_free};
+  rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+  if (!dA || !dS || !dU || !dV || !dInfo) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize hA = X * Y**T of rank K, X and Y random with all entries in
+  //  [1, 10] (centered so that the singular values are not all in the first)
+  vector<T> hX(max(M * K, 1));
+  vector<T> hY(max(N * K, 1));
+  rocblas_init<T>(hX, M, K, M);
+  rocblas_init<T>(hY, N, K, N);
+  for (int j = 0; j < N; j++) {
+    for (int i = 0; i < M; i++) {
+      T a = 0;
+      for (int l = 0; l < K; l++)
+        a += (hX[i + l * M] - 5) * (hY[j + l * N] - 5);
+      hA[i + j * lda] = a;
+    }
+  }
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(rocsolver_gesvdr<T>(handle, left_svect, right_svect,
+                                            M, N, dA, lda, K, oversample,
+                                            power_iters, dS, dU, ldu, dV, ldv,
+                                            dInfo));
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hSRes.data(), dS, sizeof(T) * K, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hU.data(), dU, sizeof(T) * size_U, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hV.data(), dV, sizeof(T) * size_V, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(&hInfo, dInfo, sizeof(rocblas_int),
+                              hipMemcpyDeviceToHost));
+
+    // Error Check
+
+    // the leading singular values against LAPACK's, both in descending order
+    hB = hA;
+    vector<T> hUb(1), hVb(1);
+    cblas_gesvd<T>('N', 'N', M, N, hB.data(), lda, hS.data(), hUb.data(), 1,
+                   hVb.data(), 1);
+    T smax = (K > 0) ? hS[0] : 0;
+    for (int i = 0; i < K; i++)
+      max_err_1 = max(max_err_1, abs(hSRes[i] - hS[i]));
+
+    // U**T * U - I and V**T * V - I
+    for (int j = 0; j < ucols; j++) {
+      for (int i = 0; i < ucols; i++) {
+        T g = (i == j) ? -1 : 0;
+        for (int l = 0; l < M; l++)
+          g += hU[l + i * ldu] * hU[l + j * ldu];
+        max_err_1 = max(max_err_1, abs(g) * smax);
+      }
+    }
+    for (int j = 0; j < vrows; j++) {
+      for (int i = 0; i < vrows; i++) {
+        T g = (i == j) ? -1 : 0;
+        for (int l = 0; l < N; l++)
+          g += hV[i + l * ldv] * hV[j + l * ldv];
+        max_err_1 = max(max_err_1, abs(g) * smax);
+      }
+    }
+
+    // A - U * diag(S) * V**T
+    if (ucols > 0 && vrows > 0) {
+      for (int j = 0; j < N; j++) {
+        for (int i = 0; i < M; i++) {
+          T r = hA[i + j * lda];
+          for (int l = 0; l < K; l++)
+            r -= hU[i + l * ldu] * hSRes[l] * hV[l + j * ldv];
+          max_err_1 = max(max_err_1, abs(r));
+        }
+      }
+    }
+    if (smax > 0)
+      max_err_1 /= smax;
+
+    // the QR iteration of the small SVD must have converged
+    if (hInfo != 0)
+      max_err_1 = 1;
+
+    gesvd_err_res_check<T>(max_err_1, M, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_gesvdr<T>(handle, left_svect, right_svect,
+                                            M, N, dA, lda, K, oversample,
+                                            power_iters, dS, dU, ldu, dV, ldv,
+                                            dInfo));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas, the full decomposition
+    vector<T> hUc(max(M * min(M, N), 1));
+    vector<T> hVc(max(min(M, N) * N, 1));
+    hB = hA;
+    cpu_time_used = get_time_us();
+
+    cblas_gesvd<T>(char_left, char_right, M, N, hB.data(), lda, hS.data(),
+                   hUc.data(), max(1, M), hVc.data(), max(1, min(M, N)));
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , N , lda , rank , oversample , power_iters , left_svect , "
+            "right_svect , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << N << " , " << lda << " , " << K << " , "
+         << oversample << " , " << power_iters << " , " << char_left << " , "
+         << char_right << " , " << gpu_time_used << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GESVDR_ERROR_EPS_MULTIPLIER
@@ -0,0 +1,190 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is the max error relative to the largest element of the inverse
+#define GETRI_ERROR_EPS_MULTIPLIER 500
+
+using namespace std;
+
+template <typename T> rocblas_status testing_getri(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int lda = argus.lda;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_A = max(lda, M) * M;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || lda < std::max(1, M)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    auto dIpiv_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(int) * safe_size),
+        rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+    status = rocsolver_getri<T>(handle, M, dA, lda, dIpiv);
+
+    getri_arg_check(status, M, lda);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(size_A);
+  vector<T> hARes(size_A);
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GETRI_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  if (!dA) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrix hA with all entries in [1, 10]
+  rocblas_init<T>(hA, M, M, lda);
+
+  //  pad untouched area into zero
+  for (int i = M; i < lda; i++) {
+    for (int j = 0; j < M; j++) {
+      hA[i + j * lda] = 0.0;
+    }
+  }
+
+  // now make it diagonally dominant, and reverse the order of the rows so
+  // that the factorization has to pivot
+  for (int i = 0; i < M; i++) {
+    hA[i + i * lda] *= 420.0;
+  }
+  for (int i = 0; i < M / 2; i++) {
+    for (int j = 0; j < M; j++) {
+      std::swap(hA[i + j * lda], hA[M - 1 - i + j * lda]);
+    }
+  }
+
+  // allocate space for the pivoting array
+  vector<int> hIpiv(M);
+  auto dIpiv_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(int) * M), rocblas_test::device_free};
+  rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+
+  // do the LU decomposition of matrix A w/ the reference LAPACK routine
+  const int retCBLAS = cblas_getrf<T>(M, M, hA.data(), lda, hIpiv.data());
+  if (retCBLAS != 0) {
+    // error encountered - unlucky pick of random numbers? no use to continue
+    return rocblas_status_success;
+  }
+
+  // now copy pivoting indices and factors to the GPU
+  CHECK_HIP_ERROR(
+      hipMemcpy(dIpiv, hIpiv.data(), sizeof(int) * M, hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    CHECK_ROCBLAS_ERROR(rocsolver_getri<T>(handle, M, dA, lda, dIpiv));
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hARes.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+
+    vector<T> hAInv = hA;
+    cblas_getri<T>(M, hAInv.data(), lda, hIpiv.data());
+
+    // Error Check
+    // hARes contains the computed inverse, compare it with hAInv relative to
+    // the largest element of the inverse
+    T max_val = 0.0;
+    for (int i = 0; i < M; i++) {
+      for (int j = 0; j < M; j++) {
+        const T err = abs(hARes[i + j * lda] - hAInv[i + j * lda]);
+        const T val = abs(hAInv[i + j * lda]);
+        max_err_1 = max_err_1 > err ? max_err_1 : err;
+        max_val = max_val > val ? max_val : val;
+      }
+    }
+    if (max_val > 0)
+      max_err_1 /= max_val;
+    getri_err_res_check<T>(max_err_1, M, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_getri<T>(handle, M, dA, lda, dIpiv));
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    cblas_getri<T>(M, hA.data(), lda, hIpiv.data());
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , lda , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << lda << " , " << gpu_time_used << " , "
+         << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GETRI_ERROR_EPS_MULTIPLIER
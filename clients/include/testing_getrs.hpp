@@ -26,7 +26,10 @@
 
 using namespace std;
 
-template <typename T> rocblas_status testing_getrs(Arguments argus) {
+// with invdiag = true the diagonal blocks of the factors are inverted once by
+// getrs_invdiag and the solves go through getrs_with_invdiag
+template <typename T>
+rocblas_status testing_getrs(Arguments argus, bool invdiag = false) {
 
   rocblas_int M = argus.M;
   rocblas_int nhrs = argus.N;
@@ -79,8 +82,12 @@ template <typename T> rocblas_status testing_getrs(Arguments argus) {
                            rocblas_test::device_free};
     rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
 
-    status =
-        rocsolver_getrs<T>(handle, transRoc, M, nhrs, dA, lda, dIpiv, dB, ldb);
+    if (invdiag)
+      status = rocsolver_getrs_with_invdiag<T>(handle, transRoc, M, nhrs, dA,
+                                               lda, dIpiv, dA, dB, ldb);
+    else
+      status = rocsolver_getrs<T>(handle, transRoc, M, nhrs, dA, lda, dIpiv,
+                                  dB, ldb);
 
     getrs_arg_check(status, M, nhrs, lda, ldb);
 
@@ -164,10 +171,29 @@ template <typename T> rocblas_status testing_getrs(Arguments argus) {
   CHECK_HIP_ERROR(
       hipMemcpy(dIpiv, hIpiv.data(), sizeof(int) * M, hipMemcpyHostToDevice));
 
+  // invert the diagonal blocks once, outside of the timed solves
+  rocblas_int size_invD = 0;
+  if (invdiag)
+    CHECK_ROCBLAS_ERROR(rocsolver_getrs_invdiag_size(M, &size_invD));
+  auto dInvD_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(T) * max(1, size_invD)),
+      rocblas_test::device_free};
+  T *dInvD = (T *)dInvD_managed.get();
+  if (!dInvD) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+  if (invdiag)
+    CHECK_ROCBLAS_ERROR(rocsolver_getrs_invdiag<T>(handle, M, dA, lda, dInvD));
+
   T max_err_1 = 0.0;
   if (argus.unit_check || argus.norm_check) {
     const rocblas_status retGPU =
-        rocsolver_getrs<T>(handle, transRoc, M, nhrs, dA, lda, dIpiv, dB, ldb);
+        invdiag ? rocsolver_getrs_with_invdiag<T>(handle, transRoc, M, nhrs,
+                                                  dA, lda, dIpiv, dInvD, dB,
+                                                  ldb)
+                : rocsolver_getrs<T>(handle, transRoc, M, nhrs, dA, lda, dIpiv,
+                                     dB, ldb);
 
     CHECK_HIP_ERROR(
         hipMemcpy(hBRes.data(), dB, sizeof(T) * size_B, hipMemcpyDeviceToHost));
@@ -208,7 +234,11 @@ template <typename T> rocblas_status testing_getrs(Arguments argus) {
     gpu_time_used = get_time_us(); // in microseconds
 
     const rocblas_status retGPU =
-        rocsolver_getrs<T>(handle, transRoc, M, nhrs, dA, lda, dIpiv, dB, ldb);
+        invdiag ? rocsolver_getrs_with_invdiag<T>(handle, transRoc, M, nhrs,
+                                                  dA, lda, dIpiv, dInvD, dB,
+                                                  ldb)
+                : rocsolver_getrs<T>(handle, transRoc, M, nhrs, dA, lda, dIpiv,
+                                     dB, ldb);
 
     gpu_time_used = get_time_us() - gpu_time_used;
 
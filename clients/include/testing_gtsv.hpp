@@ -0,0 +1,229 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element of the solution against LAPACK's; the
+// systems are diagonally dominant, so both are well conditioned
+#define GTSV_ERROR_EPS_MULTIPLIER 100
+
+using namespace std;
+
+template <typename T>
+rocblas_status testing_gtsv_calls(rocblas_handle handle, bool batched,
+                                  rocblas_int M, rocblas_int nhrs, T *dDL,
+                                  T *dD, T *dDU, rocblas_int strideD, T *dB,
+                                  rocblas_int ldb, rocblas_int strideB,
+                                  rocblas_int *dInfo,
+                                  rocblas_int batch_count) {
+  return batched ? rocsolver_gtsv_strided_batched<T>(
+                       handle, M, nhrs, dDL, dD, dDU, strideD, dB, ldb,
+                       strideB, dInfo, batch_count)
+                 : rocsolver_gtsv<T>(handle, M, nhrs, dDL, dD, dDU, dB, ldb,
+                                     dInfo);
+}
+
+template <typename T>
+rocblas_status testing_gtsv(Arguments argus, bool batched) {
+
+  rocblas_int M = argus.M;
+  rocblas_int nhrs = argus.N;
+  rocblas_int ldb = argus.ldb;
+  rocblas_int batch_count = batched ? argus.batch_count : 1;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int strideD = M;
+  rocblas_int strideB = ldb * nhrs;
+  rocblas_int size_D = strideD * max(batch_count, 1);
+  rocblas_int size_B = strideB * max(batch_count, 1);
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || nhrs < 0 || batch_count < 0 || ldb < std::max(1, M)) {
+    auto dD_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dD = (T *)dD_managed.get();
+    auto dInfo_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(rocblas_int) * safe_size),
+        rocblas_test::device_free};
+    rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+    if (!dD || !dInfo) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = testing_gtsv_calls<T>(handle, batched, M, nhrs, dD, dD, dD, M,
+                                   dD, ldb, strideB, dInfo, batch_count);
+
+    gtsv_arg_check(status, M, nhrs, ldb, batch_count);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hDL(max(size_D, 1));
+  vector<T> hD(max(size_D, 1));
+  vector<T> hDU(max(size_D, 1));
+  vector<T> hB(max(size_B, 1));
+  vector<T> hBRes(max(size_B, 1));
+  vector<rocblas_int> hInfo(max(batch_count, 1));
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = GTSV_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dDL_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hDL.size()),
+                         rocblas_test::device_free};
+  T *dDL = (T *)dDL_managed.get();
+  auto dD_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hD.size()),
+                         rocblas_test::device_free};
+  T *dD = (T *)dD_managed.get();
+  auto dDU_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hDU.size()),
+                         rocblas_test::device_free};
+  T *dDU = (T *)dDU_managed.get();
+  auto dB_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hB.size()),
+                         rocblas_test::device_free};
+  T *dB = (T *)dB_managed.get();
+  auto dInfo_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(rocblas_int) * hInfo.size()),
+      rocblas_test::device_free};
+  rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+  if (!dDL || !dD || !dDU || !dB || !dInfo) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize the diagonals and hB with entries in [1, 10], then make the
+  //  systems diagonally dominant
+  rocblas_init<T>(hDL, M, max(batch_count, 1), M);
+  rocblas_init<T>(hD, M, max(batch_count, 1), M);
+  rocblas_init<T>(hDU, M, max(batch_count, 1), M);
+  rocblas_init<T>(hB, ldb, nhrs * max(batch_count, 1), ldb);
+  for (size_t i = 0; i < hD.size(); i++)
+    hD[i] += 20;
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(hipMemcpy(dDL, hDL.data(), sizeof(T) * hDL.size(),
+                            hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(
+      hipMemcpy(dD, hD.data(), sizeof(T) * hD.size(), hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(hipMemcpy(dDU, hDU.data(), sizeof(T) * hDU.size(),
+                            hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(
+      hipMemcpy(dB, hB.data(), sizeof(T) * hB.size(), hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(testing_gtsv_calls<T>(handle, batched, M, nhrs, dDL,
+                                              dD, dDU, strideD, dB, ldb,
+                                              strideB, dInfo, batch_count));
+
+    CHECK_HIP_ERROR(hipMemcpy(hBRes.data(), dB, sizeof(T) * hB.size(),
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hInfo.data(), dInfo,
+                              sizeof(rocblas_int) * hInfo.size(),
+                              hipMemcpyDeviceToHost));
+
+    // Error Check
+
+    // the solution of every system against LAPACK's (which destroys its
+    // copy of the diagonals)
+    for (int b = 0; b < batch_count; b++) {
+      vector<T> hL(hDL.begin() + b * strideD,
+                   hDL.begin() + b * strideD + max(M - 1, 0));
+      vector<T> hE(hD.begin() + b * strideD, hD.begin() + b * strideD + M);
+      vector<T> hU(hDU.begin() + b * strideD,
+                   hDU.begin() + b * strideD + max(M - 1, 0));
+      if (M > 0)
+        cblas_gtsv<T>(M, nhrs, hL.data(), hE.data(), hU.data(),
+                      hB.data() + b * strideB, ldb);
+      for (int j = 0; j < nhrs; j++) {
+        for (int i = 0; i < M; i++) {
+          const T err = abs(hBRes[b * strideB + i + j * ldb] -
+                            hB[b * strideB + i + j * ldb]);
+          max_err_1 = max_err_1 > err ? max_err_1 : err;
+        }
+      }
+      if (hInfo[b] != 0)
+        max_err_1 = 1;
+    }
+    gtsv_err_res_check<T>(max_err_1, M, nhrs, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(testing_gtsv_calls<T>(handle, batched, M, nhrs, dDL,
+                                              dD, dDU, strideD, dB, ldb,
+                                              strideB, dInfo, batch_count));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas, one system at a time
+    cpu_time_used = get_time_us();
+
+    for (int b = 0; b < batch_count; b++) {
+      vector<T> hL(hDL.begin() + b * strideD,
+                   hDL.begin() + b * strideD + max(M - 1, 0));
+      vector<T> hE(hD.begin() + b * strideD, hD.begin() + b * strideD + M);
+      vector<T> hU(hDU.begin() + b * strideD,
+                   hDU.begin() + b * strideD + max(M - 1, 0));
+      if (M > 0)
+        cblas_gtsv<T>(M, nhrs, hL.data(), hE.data(), hU.data(),
+                      hB.data() + b * strideB, ldb);
+    }
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , nhrs , ldb , batch_count , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << nhrs << " , " << ldb << " , " << batch_count << " , "
+         << gpu_time_used << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef GTSV_ERROR_EPS_MULTIPLIER
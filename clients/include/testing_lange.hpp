@@ -0,0 +1,251 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max relative error of the norm PER dimension
+#define LANGE_ERROR_EPS_MULTIPLIER 10
+
+using namespace std;
+
+// the norm of lange, lansy and lantr for a norm option of the client
+inline rocsolver_norm_type lange_norm_type(char char_norm) {
+  if (char_norm == 'O' || char_norm == '1')
+    return rocsolver_norm_one;
+  else if (char_norm == 'I')
+    return rocsolver_norm_inf;
+  else if (char_norm == 'M')
+    return rocsolver_norm_max;
+  else if (char_norm == 'F' || char_norm == 'E')
+    return rocsolver_norm_frobenius;
+  throw runtime_error("Unsupported norm.");
+}
+
+/*
+ * Run lange (kind 'G'), lansy (kind 'S', m x m) or lantr (kind 'T') on one
+ * matrix, or the strided batched variant on batch_count matrices.
+ */
+template <typename T>
+rocblas_status testing_lange_calls(rocblas_handle handle, char kind,
+                                   bool batched, rocsolver_norm_type norm,
+                                   rocblas_fill uplo, rocblas_diagonal diag,
+                                   rocblas_int M, rocblas_int N, const T *dA,
+                                   rocblas_int lda, rocblas_int strideA,
+                                   T *dRes, rocblas_int batch_count) {
+  if (kind == 'S')
+    return batched ? rocsolver_lansy_strided_batched<T>(
+                         handle, norm, uplo, M, dA, lda, strideA, dRes,
+                         batch_count)
+                   : rocsolver_lansy<T>(handle, norm, uplo, M, dA, lda, dRes);
+  else if (kind == 'T')
+    return batched ? rocsolver_lantr_strided_batched<T>(
+                         handle, norm, uplo, diag, M, N, dA, lda, strideA,
+                         dRes, batch_count)
+                   : rocsolver_lantr<T>(handle, norm, uplo, diag, M, N, dA,
+                                        lda, dRes);
+  return batched ? rocsolver_lange_strided_batched<T>(
+                       handle, norm, M, N, dA, lda, strideA, dRes, batch_count)
+                 : rocsolver_lange<T>(handle, norm, M, N, dA, lda, dRes);
+}
+
+template <typename T>
+rocblas_status testing_lange_kind(Arguments argus, char kind) {
+
+  rocblas_int M = argus.M;
+  rocblas_int N = (kind == 'S') ? argus.M : argus.N;
+  rocblas_int lda = argus.lda;
+  rocblas_int batch_count = argus.batch_count;
+  char char_norm = argus.norm_option;
+  char char_uplo = argus.uplo_option;
+  char char_diag = argus.diag_option;
+
+  rocsolver_norm_type norm = lange_norm_type(char_norm);
+  rocblas_fill uplo =
+      (char_uplo == 'U') ? rocblas_fill_upper : rocblas_fill_lower;
+  rocblas_diagonal diag = (char_diag == 'U') ? rocblas_diagonal_unit
+                                             : rocblas_diagonal_non_unit;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int strideA = max(lda, M) * N;
+  rocblas_int size_A = strideA * max(batch_count, 1);
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || N < 0 || lda < std::max(1, M) || batch_count < 0) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = testing_lange_calls<T>(handle, kind, true, norm, uplo, diag, M, N,
+                                    dA, lda, 0, dA, batch_count);
+
+    lange_arg_check(status, M, N, lda, batch_count);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(size_A);
+  vector<T> hRes(max(batch_count, 1));
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = LANGE_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  if (!dA) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  auto dRes_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(T) * hRes.size()),
+      rocblas_test::device_free};
+  T *dRes = (T *)dRes_managed.get();
+  if (!dRes) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrices hA with entries in [1, 10], and flip
+  //  the sign of some of them; whatever must not be read is NaN, so that it
+  //  shows in the norms
+  vector<T> hAb(strideA);
+  for (int b = 0; b < batch_count; b++) {
+    rocblas_init<T>(hAb, M, N, lda);
+    for (int i = 0; i < lda; i++) {
+      for (int j = 0; j < N; j++) {
+        const bool stored =
+            i < M && (kind == 'G' || (char_uplo == 'U' ? i <= j : i >= j)) &&
+            !(kind == 'T' && char_diag == 'U' && i == j);
+        T a = hAb[i + j * lda];
+        if (!stored)
+          a = std::numeric_limits<T>::quiet_NaN();
+        else if ((i + 2 * j) % 3 == 0)
+          a = -a;
+        hA[b * strideA + i + j * lda] = a;
+      }
+    }
+  }
+
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+  // the reference LAPACK norms
+  auto cblas_norm = [&](int b) {
+    T *hAb = hA.data() + b * strideA;
+    if (kind == 'S')
+      return cblas_lansy<T>(char_norm, char_uplo, M, hAb, lda);
+    else if (kind == 'T')
+      return cblas_lantr<T>(char_norm, char_uplo, char_diag, M, N, hAb, lda);
+    return cblas_lange<T>(char_norm, M, N, hAb, lda);
+  };
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    // the single matrix interface on the first matrix, then the whole batch
+    for (int batched = 0; batched < 2; batched++) {
+      CHECK_ROCBLAS_ERROR(testing_lange_calls<T>(
+          handle, kind, batched == 1, norm, uplo, diag, M, N, dA, lda, strideA,
+          dRes, batch_count));
+
+      const int nres = batched ? batch_count : min(batch_count, 1);
+      CHECK_HIP_ERROR(hipMemcpy(hRes.data(), dRes, sizeof(T) * nres,
+                                hipMemcpyDeviceToHost));
+
+      // Error Check
+
+      // relative error of each norm, absolute for a zero norm
+      for (int b = 0; b < nres; b++) {
+        const T ref = cblas_norm(b);
+        const T err = (ref == 0) ? abs(hRes[b]) : abs(hRes[b] - ref) / ref;
+        max_err_1 = max_err_1 > err ? max_err_1 : err;
+      }
+      lange_err_res_check<T>(max_err_1, M, N, error_eps_multiplier, eps);
+    }
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(testing_lange_calls<T>(handle, kind, true, norm, uplo,
+                                               diag, M, N, dA, lda, strideA,
+                                               dRes, batch_count));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    for (int b = 0; b < batch_count; b++)
+      hRes[b] = cblas_norm(b);
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , N , lda , norm , batch_count , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << N << " , " << lda << " , " << char_norm << " , "
+         << batch_count << " , " << gpu_time_used << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+template <typename T> rocblas_status testing_lange(Arguments argus) {
+  return testing_lange_kind<T>(argus, 'G');
+}
+
+template <typename T> rocblas_status testing_lansy(Arguments argus) {
+  return testing_lange_kind<T>(argus, 'S');
+}
+
+template <typename T> rocblas_status testing_lantr(Arguments argus) {
+  return testing_lange_kind<T>(argus, 'T');
+}
+
+#undef LANGE_ERROR_EPS_MULTIPLIER
@@ -0,0 +1,363 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <complex>
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element of the factors and of the solutions,
+// relative to the largest entry of the matrix and of the solutions
+#define LU_COMPLEX_ERROR_EPS_MULTIPLIER 500
+
+using namespace std;
+
+/*
+ * Testers for the complex LU factorization and solve: T is
+ * rocblas_float_complex or rocblas_double_complex and R the matching real
+ * type. The matrix has random real and imaginary parts in [1, 10] and a
+ * diagonal made dominant, as in testing_getrf.
+ */
+
+template <typename T, typename R> R lu_complex_abs(const T &z) {
+  return abs(complex<R>(z.x, z.y));
+}
+
+template <typename T, typename R>
+void lu_complex_init(vector<T> &A, rocblas_int M, rocblas_int N,
+                     rocblas_int lda, R diag) {
+  for (int j = 0; j < N; j++) {
+    for (int i = 0; i < lda; i++) {
+      A[i + j * lda].x = (i < M) ? random_generator<R>() : 0;
+      A[i + j * lda].y = (i < M) ? random_generator<R>() : 0;
+    }
+  }
+  for (int i = 0; i < min(M, N); i++) {
+    A[i + i * lda].x *= diag;
+    A[i + i * lda].y *= diag;
+  }
+}
+
+template <typename T, typename R>
+rocblas_status testing_getrf_complex(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int N = argus.N;
+  rocblas_int lda = argus.lda;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_A = max(lda, M) * N;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || N < 0 || lda < M) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dIpiv_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(int) * safe_size),
+        rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+    if (!dA || !dIpiv) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = rocsolver_getrf<T>(handle, M, N, dA, lda, dIpiv);
+
+    getrf_arg_check(status, M, N);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(max(size_A, 1));
+  vector<T> hARes(max(size_A, 1));
+  vector<int> hIpiv(max(min(M, N), 1));
+  vector<int> hIpivRes(max(min(M, N), 1));
+
+  double gpu_time_used, cpu_time_used;
+  R error_eps_multiplier = LU_COMPLEX_ERROR_EPS_MULTIPLIER;
+  R eps = std::numeric_limits<R>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hA.size()),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  auto dIpiv_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(int) * hIpiv.size()),
+      rocblas_test::device_free};
+  rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+  if (!dA || !dIpiv) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  lu_complex_init<T, R>(hA, M, N, lda, 420);
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+  R max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf<T>(handle, M, N, dA, lda, dIpiv));
+
+    CHECK_HIP_ERROR(hipMemcpy(hARes.data(), dA, sizeof(T) * size_A,
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hIpivRes.data(), dIpiv,
+                              sizeof(int) * min(M, N), hipMemcpyDeviceToHost));
+
+    // Error Check
+
+    // the factors against LAPACK's, relative to the largest entry of A;
+    // with the same pivots
+    R amax = 0;
+    for (int j = 0; j < N; j++)
+      for (int i = 0; i < M; i++)
+        amax = max(amax, lu_complex_abs<T, R>(hA[i + j * lda]));
+    cblas_getrf<T>(M, N, hA.data(), lda, hIpiv.data());
+    for (int j = 0; j < min(M, N); j++)
+      if (hIpiv[j] != hIpivRes[j])
+        max_err_1 = 1;
+    for (int j = 0; j < N; j++) {
+      for (int i = 0; i < M; i++) {
+        T d;
+        d.x = hARes[i + j * lda].x - hA[i + j * lda].x;
+        d.y = hARes[i + j * lda].y - hA[i + j * lda].y;
+        max_err_1 = max(max_err_1, lu_complex_abs<T, R>(d) / amax);
+      }
+    }
+
+    getrf_err_res_check<R>(max_err_1, M, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    lu_complex_init<T, R>(hA, M, N, lda, 420);
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf<T>(handle, M, N, dA, lda, dIpiv));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    cblas_getrf<T>(M, N, hA.data(), lda, hIpiv.data());
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , N , lda , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << N << " , " << lda << " , " << gpu_time_used << " , "
+         << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+template <typename T, typename R>
+rocblas_status testing_getrs_complex(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int nhrs = argus.N;
+  rocblas_int lda = argus.lda;
+  rocblas_int ldb = argus.ldb;
+  char trans = argus.transA_option;
+
+  rocblas_operation transRoc;
+  if (trans == 'N') {
+    transRoc = rocblas_operation_none;
+  } else if (trans == 'T') {
+    transRoc = rocblas_operation_transpose;
+  } else if (trans == 'C') {
+    transRoc = rocblas_operation_conjugate_transpose;
+  } else {
+    throw runtime_error("Unsupported transpose operation.");
+  }
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_A = max(lda, M) * M;
+  rocblas_int size_B = max(ldb, M) * nhrs;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || nhrs < 0 || lda < std::max(1, M) || ldb < std::max(1, M)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dIpiv_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(int) * safe_size),
+        rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+    if (!dA || !dIpiv) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = rocsolver_getrs<T>(handle, transRoc, M, nhrs, dA, lda, dIpiv, dA,
+                                ldb);
+
+    getrs_arg_check(status, M, nhrs, lda, ldb);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(max(size_A, 1));
+  vector<T> hB(max(size_B, 1));
+  vector<T> hBRes(max(size_B, 1));
+  vector<int> hIpiv(max(M, 1));
+
+  double gpu_time_used, cpu_time_used;
+  R error_eps_multiplier = LU_COMPLEX_ERROR_EPS_MULTIPLIER;
+  R eps = std::numeric_limits<R>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hA.size()),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  auto dB_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hB.size()),
+                         rocblas_test::device_free};
+  T *dB = (T *)dB_managed.get();
+  auto dIpiv_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(int) * hIpiv.size()),
+      rocblas_test::device_free};
+  rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+  if (!dA || !dB || !dIpiv) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  // the factors come from the reference LAPACK, so that only the solve is
+  // tested
+  lu_complex_init<T, R>(hA, M, M, lda, 420);
+  lu_complex_init<T, R>(hB, M, nhrs, ldb, 1);
+  if (cblas_getrf<T>(M, M, hA.data(), lda, hIpiv.data()) != 0) {
+    // error encountered - unlucky pick of random numbers? no use to continue
+    return rocblas_status_success;
+  }
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(
+      hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(
+      hipMemcpy(dIpiv, hIpiv.data(), sizeof(int) * M, hipMemcpyHostToDevice));
+
+  R max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(rocsolver_getrs<T>(handle, transRoc, M, nhrs, dA, lda,
+                                           dIpiv, dB, ldb));
+
+    CHECK_HIP_ERROR(hipMemcpy(hBRes.data(), dB, sizeof(T) * size_B,
+                              hipMemcpyDeviceToHost));
+
+    // Error Check
+
+    // the solutions against LAPACK's, relative to their largest entry
+    cblas_getrs<T>(trans, M, nhrs, hA.data(), lda, hIpiv.data(), hB.data(),
+                   ldb);
+    R xmax = 0;
+    for (int j = 0; j < nhrs; j++) {
+      for (int i = 0; i < M; i++) {
+        T d;
+        d.x = hBRes[i + j * ldb].x - hB[i + j * ldb].x;
+        d.y = hBRes[i + j * ldb].y - hB[i + j * ldb].y;
+        max_err_1 = max(max_err_1, lu_complex_abs<T, R>(d));
+        xmax = max(xmax, lu_complex_abs<T, R>(hB[i + j * ldb]));
+      }
+    }
+    if (xmax > 0)
+      max_err_1 /= xmax;
+
+    getrs_err_res_check<R>(max_err_1, M, nhrs, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_getrs<T>(handle, transRoc, M, nhrs, dA, lda,
+                                           dIpiv, dB, ldb));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    cblas_getrs<T>(trans, M, nhrs, hA.data(), lda, hIpiv.data(), hB.data(),
+                   ldb);
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , nhrs , lda , ldb , trans , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << nhrs << " , " << lda << " , " << ldb << " , "
+         << trans << " , " << gpu_time_used << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef LU_COMPLEX_ERROR_EPS_MULTIPLIER
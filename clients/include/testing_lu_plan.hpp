@@ -0,0 +1,335 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element after the solution
+#define LU_PLAN_ERROR_EPS_MULTIPLIER 500
+
+using namespace std;
+
+// create, factor and solve with a plan, and release it again
+template <typename T>
+rocblas_status testing_lu_plan_calls(rocblas_handle handle, rocblas_int M,
+                                     rocblas_int nhrs, T *dA, rocblas_int lda,
+                                     T *dB, rocblas_int ldb) {
+  rocsolver_lu_plan plan;
+  rocblas_status status = rocsolver_lu_plan_create(
+      handle, rocsolver_precision_of<T>(), M, nhrs, &plan);
+  if (status != rocblas_status_success)
+    return status;
+
+  status = rocsolver_lu_plan_factor<T>(plan, dA, lda);
+  if (status == rocblas_status_success)
+    status = rocsolver_lu_plan_solve<T>(plan, rocblas_operation_none, nhrs, dB,
+                                        ldb);
+
+  rocsolver_lu_plan_destroy(plan);
+  return status;
+}
+
+/*
+ * With equilibrate, the plan factors the matrix scaled by the factors of
+ * geequ, checked against the reference factors of the same scaled matrix.
+ */
+template <typename T>
+rocblas_status testing_lu_plan(Arguments argus, bool equilibrate = false) {
+
+  rocblas_int M = argus.M;
+  rocblas_int nhrs = argus.N;
+  rocblas_int lda = argus.lda;
+  rocblas_int ldb = argus.ldb;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_A = max(lda, M) * M;
+  rocblas_int size_B = max(ldb, M) * nhrs;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || nhrs < 0 || lda < std::max(1, M) || ldb < std::max(1, M)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    auto dB_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dB = (T *)dB_managed.get();
+    if (!dB) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = testing_lu_plan_calls<T>(handle, M, nhrs, dA, lda, dB, ldb);
+
+    gesv_arg_check(status, M, nhrs, lda, ldb);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(size_A);
+  vector<T> hB(size_B);
+  vector<T> hBRes(size_B);
+  vector<T> hR(max(M, 1), 1);
+  vector<T> hC(max(M, 1), 1);
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = LU_PLAN_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  if (!dA) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  auto dB_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B),
+                         rocblas_test::device_free};
+  T *dB = (T *)dB_managed.get();
+  if (!dB) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrix hA, hB with all entries in [1, 10]
+  rocblas_init<T>(hA, M, M, lda);
+  rocblas_init<T>(hB, M, nhrs, ldb);
+
+  //  pad untouched area into zero
+  for (int i = M; i < lda; i++) {
+    for (int j = 0; j < M; j++) {
+      hA[i + j * lda] = 0.0;
+    }
+  }
+  for (int i = M; i < ldb; i++) {
+    for (int j = 0; j < nhrs; j++) {
+      hB[i + j * ldb] = 0.0;
+    }
+  }
+
+  // now make it diagonally dominant, and reverse the order of the rows so
+  // that the factorization has to pivot
+  for (int i = 0; i < M; i++) {
+    hA[i + i * lda] *= 420.0;
+  }
+  for (int i = 0; i < M / 2; i++) {
+    for (int j = 0; j < M; j++) {
+      std::swap(hA[i + j * lda], hA[M - 1 - i + j * lda]);
+    }
+  }
+
+  // then scale rows and columns for the equilibrated plan to undo
+  if (equilibrate) {
+    for (int i = 0; i < M; i++) {
+      for (int j = 0; j < M; j++) {
+        hA[i + j * lda] *= pow(T(10), T(i % 3 - 1)) * pow(T(10), T(j % 2));
+      }
+    }
+  }
+
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+  // the scale factors r, c and rowcnd, colcnd, amax
+  auto dRC_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * (2 * M + 3)),
+                         rocblas_test::device_free};
+  T *dR = (T *)dRC_managed.get();
+  if (!dR) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+  T *dC = dR + M;
+
+  if (equilibrate) {
+    CHECK_ROCBLAS_ERROR(rocsolver_geequ<T>(handle, M, M, dA, lda, dR, dC,
+                                           dC + M, dC + M + 1, dC + M + 2));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hR.data(), dR, sizeof(T) * M, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hC.data(), dC, sizeof(T) * M, hipMemcpyDeviceToHost));
+    for (int i = 0; i < M; i++) {
+      for (int j = 0; j < M; j++) {
+        hA[i + j * lda] *= hR[i] * hC[j];
+      }
+    }
+  }
+
+  auto plan_factor = [&](rocsolver_lu_plan plan) {
+    return equilibrate ? rocsolver_lu_plan_factor_equilibrated<T>(plan, dA,
+                                                                   lda, dR, dC)
+                       : rocsolver_lu_plan_factor<T>(plan, dA, lda);
+  };
+
+  rocsolver_lu_plan plan;
+  CHECK_ROCBLAS_ERROR(rocsolver_lu_plan_create(
+      handle, rocsolver_precision_of<T>(), M, nhrs, &plan));
+
+  // the reference factors (of the scaled matrix), shared by all solves as
+  // those of the plan
+  vector<int> hIpiv(M);
+  const int retCBLAS = cblas_getrf<T>(M, M, hA.data(), lda, hIpiv.data());
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    const rocblas_status retGPU = plan_factor(plan);
+
+    if (retCBLAS != 0) {
+      // error encountered - we expect the same to happen from the GPU!
+      rocsolver_lu_plan_destroy(plan);
+      if (retGPU == rocblas_status_success) {
+        fprintf(stderr, "rocBLAS should fail also but doesn't!");
+        return rocblas_status_internal_error;
+      }
+      return rocblas_status_success;
+    }
+    CHECK_ROCBLAS_ERROR(retGPU);
+
+    // solve both systems with the same factorization
+    const char transposes[] = {'N', 'T'};
+    for (char trans : transposes) {
+      CHECK_HIP_ERROR(
+          hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+      CHECK_ROCBLAS_ERROR(rocsolver_lu_plan_solve<T>(
+          plan,
+          trans == 'N' ? rocblas_operation_none : rocblas_operation_transpose,
+          nhrs, dB, ldb));
+
+      CHECK_HIP_ERROR(hipMemcpy(hBRes.data(), dB, sizeof(T) * size_B,
+                                hipMemcpyDeviceToHost));
+
+      // x = C * (R*A*C)**-1 * R * b, or R * (R*A*C)**-T * C * b
+      const vector<T> &pre = (trans == 'N') ? hR : hC;
+      const vector<T> &post = (trans == 'N') ? hC : hR;
+      vector<T> hX = hB;
+      for (int i = 0; i < M; i++) {
+        for (int j = 0; j < nhrs; j++) {
+          hX[i + j * ldb] *= pre[i];
+        }
+      }
+      cblas_getrs<T>(trans, M, nhrs, hA.data(), lda, hIpiv.data(), hX.data(),
+                     ldb);
+      T max_x = 0;
+      for (int i = 0; i < M; i++) {
+        for (int j = 0; j < nhrs; j++) {
+          hX[i + j * ldb] *= post[i];
+          max_x = max(max_x, abs(hX[i + j * ldb]));
+        }
+      }
+
+      // Error Check
+
+      // hBRes contains calculated solution, so error is hBres - hX, relative
+      // to the largest element of the solution when it has been equilibrated
+      for (int i = 0; i < M; i++) {
+        for (int j = 0; j < nhrs; j++) {
+          T err = abs(hBRes[i + j * ldb] - hX[i + j * ldb]);
+          if (equilibrate && max_x > 0)
+            err /= max_x;
+          max_err_1 = max_err_1 > err ? max_err_1 : err;
+        }
+      }
+      gesv_err_res_check<T>(max_err_1, M, nhrs, error_eps_multiplier, eps);
+    }
+  }
+
+  if (argus.timing) {
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+    // GPU rocBLAS, the factorization and one solve
+    gpu_time_used = get_time_us(); // in microseconds
+
+    rocblas_status retGPU = plan_factor(plan);
+    if (retGPU == rocblas_status_success)
+      retGPU = rocsolver_lu_plan_solve<T>(plan, rocblas_operation_none, nhrs,
+                                          dB, ldb);
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // then a repeated solve alone
+    double gpu_solve_time_used = get_time_us();
+
+    if (retGPU == rocblas_status_success) {
+      retGPU = rocsolver_lu_plan_solve<T>(plan, rocblas_operation_none, nhrs,
+                                          dB, ldb);
+      hipDeviceSynchronize();
+    }
+
+    gpu_solve_time_used = get_time_us() - gpu_solve_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    cblas_getrs<T>('N', M, nhrs, hA.data(), lda, hIpiv.data(), hB.data(), ldb);
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    if (retCBLAS != 0) {
+      // error encountered - we expect the same to happen from the GPU!
+      if (retGPU == rocblas_status_success) {
+        fprintf(stderr, "rocBLAS should fail also but doesn't!");
+      }
+    } else {
+      CHECK_ROCBLAS_ERROR(retGPU);
+    }
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , nhrs , lda , ldb , us [gpu] , us [gpu solve] , us [cpu solve]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << nhrs << " , " << lda << " , " << ldb << " , "
+         << gpu_time_used << " , " << gpu_solve_time_used << " , "
+         << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+
+  rocsolver_lu_plan_destroy(plan);
+  return rocblas_status_success;
+}
+
+#undef LU_PLAN_ERROR_EPS_MULTIPLIER
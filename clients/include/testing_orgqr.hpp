@@ -0,0 +1,164 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element of Q, whose entries are at most 1
+#define ORGQR_ERROR_EPS_MULTIPLIER 1000
+
+using namespace std;
+
+template <typename T> rocblas_status testing_orgqr(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int N = argus.N;
+  rocblas_int K = argus.K;
+  rocblas_int lda = argus.lda;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_A = max(lda, M) * N;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || N < 0 || N > M || K < 0 || K > N || lda < std::max(1, M)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = rocsolver_orgqr<T>(handle, M, N, K, dA, lda, dA);
+
+    orgqr_arg_check(status, M, N, K, lda);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(size_A);
+  vector<T> hQ(size_A);
+  vector<T> hQRes(size_A);
+  vector<T> hTau(max(N, 1));
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = ORGQR_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  if (!dA) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  auto dTau_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hTau.size()),
+                         rocblas_test::device_free};
+  T *dTau = (T *)dTau_managed.get();
+  if (!dTau) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrix hA with all entries in [1, 10] and
+  //  factor it w/ the reference LAPACK routine, so that both sides start
+  //  from the same reflectors
+  rocblas_init<T>(hA, M, N, lda);
+  cblas_geqrf<T>(M, N, hA.data(), lda, hTau.data());
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(hipMemcpy(dTau, hTau.data(), sizeof(T) * hTau.size(),
+                            hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(rocsolver_orgqr<T>(handle, M, N, K, dA, lda, dTau));
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hQRes.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+
+    hQ = hA;
+    cblas_orgqr<T>(M, N, K, hQ.data(), lda, hTau.data());
+
+    // Error Check
+
+    for (int i = 0; i < M; i++) {
+      for (int j = 0; j < N; j++) {
+        max_err_1 = max(max_err_1, abs(hQRes[i + j * lda] - hQ[i + j * lda]));
+      }
+    }
+    orgqr_err_res_check<T>(max_err_1, M, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_orgqr<T>(handle, M, N, K, dA, lda, dTau));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    hQ = hA;
+    cpu_time_used = get_time_us();
+
+    cblas_orgqr<T>(M, N, K, hQ.data(), lda, hTau.data());
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , N , K , lda , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << N << " , " << K << " , " << lda << " , "
+         << gpu_time_used << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef ORGQR_ERROR_EPS_MULTIPLIER
@@ -0,0 +1,207 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error of the product relative to its largest entry
+#define ORMQR_ERROR_EPS_MULTIPLIER 1000
+
+using namespace std;
+
+template <typename T> rocblas_status testing_ormqr(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int N = argus.N;
+  rocblas_int K = argus.K;
+  rocblas_int lda = argus.lda;
+  rocblas_int ldc = argus.ldc;
+  char side = argus.side_option;
+  char trans = argus.transA_option;
+
+  rocblas_side sideRoc;
+  if (side == 'L') {
+    sideRoc = rocblas_side_left;
+  } else if (side == 'R') {
+    sideRoc = rocblas_side_right;
+  } else {
+    throw runtime_error("Unsupported side.");
+  }
+
+  rocblas_operation transRoc;
+  if (trans == 'N') {
+    transRoc = rocblas_operation_none;
+  } else if (trans == 'T') {
+    transRoc = rocblas_operation_transpose;
+  } else {
+    throw runtime_error("Unsupported transpose operation.");
+  }
+
+  // order of Q
+  rocblas_int NQ = (side == 'L') ? M : N;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_int size_A = max(lda, NQ) * K;
+  rocblas_int size_C = max(ldc, M) * N;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || N < 0 || K < 0 || K > NQ || lda < std::max(1, NQ) ||
+      ldc < std::max(1, M)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = rocsolver_ormqr<T>(handle, sideRoc, transRoc, M, N, K, dA, lda,
+                                dA, dA, ldc);
+
+    ormqr_arg_check(status, side, M, N, K, lda, ldc);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(max(size_A, 1));
+  vector<T> hC(max(size_C, 1));
+  vector<T> hCRes(hC.size());
+  vector<T> hTau(max(K, 1));
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = ORMQR_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hA.size()),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  if (!dA) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  auto dC_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hC.size()),
+                         rocblas_test::device_free};
+  T *dC = (T *)dC_managed.get();
+  if (!dC) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  auto dTau_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hTau.size()),
+                         rocblas_test::device_free};
+  T *dTau = (T *)dTau_managed.get();
+  if (!dTau) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrices hA, hC with all entries in [1, 10] and
+  //  factor hA w/ the reference LAPACK routine, so that both sides start from
+  //  the same reflectors
+  rocblas_init<T>(hA, NQ, K, lda);
+  rocblas_init<T>(hC, M, N, ldc);
+  cblas_geqrf<T>(NQ, K, hA.data(), lda, hTau.data());
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * hA.size(),
+                            hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(hipMemcpy(dTau, hTau.data(), sizeof(T) * hTau.size(),
+                            hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * hC.size(),
+                            hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(rocsolver_ormqr<T>(handle, sideRoc, transRoc, M, N, K,
+                                           dA, lda, dTau, dC, ldc));
+
+    CHECK_HIP_ERROR(hipMemcpy(hCRes.data(), dC, sizeof(T) * hC.size(),
+                              hipMemcpyDeviceToHost));
+
+    cblas_ormqr<T>(side, trans, M, N, K, hA.data(), lda, hTau.data(),
+                   hC.data(), ldc);
+
+    // Error Check
+
+    T cmax = 0;
+    for (int i = 0; i < M; i++) {
+      for (int j = 0; j < N; j++) {
+        max_err_1 = max(max_err_1, abs(hCRes[i + j * ldc] - hC[i + j * ldc]));
+        cmax = max(cmax, abs(hC[i + j * ldc]));
+      }
+    }
+    if (cmax > 0)
+      max_err_1 /= cmax;
+    ormqr_err_res_check<T>(max_err_1, M, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_ormqr<T>(handle, sideRoc, transRoc, M, N, K,
+                                           dA, lda, dTau, dC, ldc));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    cblas_ormqr<T>(side, trans, M, N, K, hA.data(), lda, hTau.data(),
+                   hC.data(), ldc);
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "side , trans , M , N , K , lda , ldc , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << side << " , " << trans << " , " << M << " , " << N << " , " << K
+         << " , " << lda << " , " << ldc << " , " << gpu_time_used << " , "
+         << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef ORMQR_ERROR_EPS_MULTIPLIER
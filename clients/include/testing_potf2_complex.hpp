@@ -0,0 +1,188 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <complex>
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+
+// this is max error PER element of the factor, relative to its largest entry
+#define POTF2_COMPLEX_ERROR_EPS_MULTIPLIER 10
+
+using namespace std;
+
+/*
+ * Tester for the complex Cholesky factorization: T is rocblas_float_complex
+ * or rocblas_double_complex and R the matching real type. The Hermitian
+ * positive definite matrix is B * B**H + M * I, with the real and imaginary
+ * parts of B random in [0.1, 1], and an imaginary part of the diagonal
+ * that the factorization has to ignore.
+ */
+
+template <typename T, typename R> R potf2_complex_abs(const T &z) {
+  return abs(complex<R>(z.x, z.y));
+}
+
+template <typename T, typename R>
+void potf2_complex_init(vector<T> &A, rocblas_int M, rocblas_int lda) {
+  vector<complex<R>> B(M * M);
+  for (auto &b : B)
+    b = complex<R>(random_generator<R>() / 10, random_generator<R>() / 10);
+
+  for (int j = 0; j < M; j++) {
+    for (int i = 0; i < lda; i++) {
+      complex<R> s = 0;
+      if (i < M)
+        for (int k = 0; k < M; k++)
+          s += B[i + k * M] * conj(B[j + k * M]);
+      if (i == j)
+        s = complex<R>(s.real() + M, random_generator<R>());
+      A[i + j * lda].x = s.real();
+      A[i + j * lda].y = s.imag();
+    }
+  }
+}
+
+template <typename T, typename R>
+rocblas_status testing_potf2_complex(Arguments argus) {
+
+  rocblas_int M = argus.M;
+  rocblas_int lda = argus.lda;
+
+  char char_uplo = argus.uplo_option;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_fill uplo = char2rocblas_fill(char_uplo);
+
+  rocblas_int size_A = lda * M;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (M < 0 || lda < M) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = rocsolver_potf2<T>(handle, uplo, M, dA, lda);
+
+    potf2_arg_check(status, M);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(max(size_A, 1));
+  vector<T> hARes(max(size_A, 1));
+
+  double gpu_time_used, cpu_time_used;
+  R error_eps_multiplier = POTF2_COMPLEX_ERROR_EPS_MULTIPLIER;
+  R eps = std::numeric_limits<R>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hA.size()),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  if (!dA) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  potf2_complex_init<T, R>(hA, M, lda);
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(
+      hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+  R max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(rocsolver_potf2<T>(handle, uplo, M, dA, lda));
+
+    CHECK_HIP_ERROR(hipMemcpy(hARes.data(), dA, sizeof(T) * size_A,
+                              hipMemcpyDeviceToHost));
+
+    cblas_potf2<T>(uplo, M, hA.data(), lda);
+
+    // Error Check
+
+    // the factor against LAPACK's, relative to its largest entry; the
+    // triangle that is not referenced is left as it is by both
+    R amax = 0;
+    for (int j = 0; j < M; j++)
+      for (int i = 0; i < M; i++)
+        amax = max(amax, potf2_complex_abs<T, R>(hA[i + j * lda]));
+    for (int j = 0; j < M; j++) {
+      for (int i = 0; i < M; i++) {
+        T d;
+        d.x = hARes[i + j * lda].x - hA[i + j * lda].x;
+        d.y = hARes[i + j * lda].y - hA[i + j * lda].y;
+        max_err_1 = max(max_err_1, potf2_complex_abs<T, R>(d) / amax);
+      }
+    }
+
+    potf2_err_res_check<R>(max_err_1, M, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    potf2_complex_init<T, R>(hA, M, lda);
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(rocsolver_potf2<T>(handle, uplo, M, dA, lda));
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    cblas_potf2<T>(uplo, M, hA.data(), lda);
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "M , lda , uplo , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << " , norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << M << " , " << lda << " , " << char_uplo << " , " << gpu_time_used
+         << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef POTF2_COMPLEX_ERROR_EPS_MULTIPLIER
@@ -0,0 +1,236 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is for the single precision case, which is not very stable
+#define POTUPDATE_ERROR_EPS_MULTIPLIER 4000
+
+using namespace std;
+
+/*
+ * With M = A*A' + I and P = M + X*X', the update must turn the factor of M
+ * into the one of P, and the downdate the factor of P into the one of M;
+ * both reference factors come from the LAPACK potrf.
+ */
+template <typename T>
+rocblas_status testing_potupdate_template(Arguments argus, bool downdate) {
+
+  rocblas_int N = argus.N;
+  rocblas_int K = argus.K;
+  rocblas_int lda = argus.lda;
+  rocblas_int ldx = argus.ldb;
+
+  char char_uplo = argus.uplo_option;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_fill uplo = char2rocblas_fill(char_uplo);
+
+  rocblas_int size_A = lda * N;
+  rocblas_int size_X = ldx * K;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (N < 0 || K < 0 || lda < N || ldx < N) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    auto dX_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dX = (T *)dX_managed.get();
+    if (!dX) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    if (downdate)
+      status = rocsolver_potdowndate<T>(handle, uplo, N, K, dA, lda, dX, ldx);
+    else
+      status = rocsolver_potupdate<T>(handle, uplo, N, K, dA, lda, dX, ldx);
+
+    potupdate_arg_check(status, N, K, lda, ldx);
+
+    return status;
+  }
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(size_A);
+  vector<T> hM(size_A);
+  vector<T> hP(size_A);
+  vector<T> hX(size_X);
+  vector<T> hRes(size_A);
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = POTUPDATE_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  if (!dA) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  auto dX_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_X),
+                         rocblas_test::device_free};
+  T *dX = (T *)dX_managed.get();
+  if (!dX) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrices hA and hX with all entries in [1, 10]
+  rocblas_init<T>(hA, N, N, lda);
+  rocblas_init<T>(hX, N, K, ldx);
+
+  //  pad untouched area into zero
+  for (int i = N; i < lda; i++) {
+    for (int j = 0; j < N; j++) {
+      hA[i + j * lda] = 0.0;
+    }
+  }
+  for (int i = N; i < ldx; i++) {
+    for (int j = 0; j < K; j++) {
+      hX[i + j * ldx] = 0.0;
+    }
+  }
+
+  //  hM = hA * hA ^ T + I is positive-definite, and so is hP = hM + hX * hX^T
+  cblas_gemm(rocblas_operation_none, rocblas_operation_transpose, N, N, N,
+             (T)1.0, hA.data(), lda, hA.data(), lda, (T)0.0, hM.data(), lda);
+  for (int i = 0; i < N; i++) {
+    hM[i + i * lda] += 1;
+  }
+  hP = hM;
+  cblas_gemm(rocblas_operation_none, rocblas_operation_transpose, N, N, K,
+             (T)1.0, hX.data(), ldx, hX.data(), ldx, (T)1.0, hP.data(), lda);
+
+  // reference factors
+  cblas_potrf<T>(char_uplo, N, hM.data(), lda);
+  cblas_potrf<T>(char_uplo, N, hP.data(), lda);
+
+  vector<T> &hIn = downdate ? hP : hM;
+  vector<T> &hOut = downdate ? hM : hP;
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hIn.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dX, hX.data(), sizeof(T) * size_X, hipMemcpyHostToDevice));
+
+    if (downdate) {
+      CHECK_ROCBLAS_ERROR(
+          rocsolver_potdowndate<T>(handle, uplo, N, K, dA, lda, dX, ldx));
+    } else {
+      CHECK_ROCBLAS_ERROR(
+          rocsolver_potupdate<T>(handle, uplo, N, K, dA, lda, dX, ldx));
+    }
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hRes.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+
+    // Error Check
+    // hRes contains the modified factor, compare its triangle with hOut
+    for (int j = 0; j < N; j++) {
+      for (int i = 0; i < N; i++) {
+        if (char_uplo == 'L' ? i >= j : i <= j) {
+          const T err = abs(hRes[i + j * lda] - hOut[i + j * lda]);
+          max_err_1 = max_err_1 > err ? max_err_1 : err;
+        }
+      }
+    }
+    potupdate_err_res_check<T>(max_err_1, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hIn.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dX, hX.data(), sizeof(T) * size_X, hipMemcpyHostToDevice));
+
+    // GPU rocBLAS
+    gpu_time_used = get_time_us(); // in microseconds
+
+    if (downdate) {
+      CHECK_ROCBLAS_ERROR(
+          rocsolver_potdowndate<T>(handle, uplo, N, K, dA, lda, dX, ldx));
+    } else {
+      CHECK_ROCBLAS_ERROR(
+          rocsolver_potupdate<T>(handle, uplo, N, K, dA, lda, dX, ldx));
+    }
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas: refactoring the modified matrix is the alternative
+    if (downdate)
+      hOut = hIn;
+    cpu_time_used = get_time_us();
+
+    cblas_potrf<T>(char_uplo, N, hOut.data(), lda);
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "N , K , lda , ldx , uplo , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << " , norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << N << " , " << K << " , " << lda << " , " << ldx << " , "
+         << char_uplo << " , " << gpu_time_used << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+template <typename T> rocblas_status testing_potupdate(Arguments argus) {
+  return testing_potupdate_template<T>(argus, false);
+}
+
+template <typename T> rocblas_status testing_potdowndate(Arguments argus) {
+  return testing_potupdate_template<T>(argus, true);
+}
+
+#undef POTUPDATE_ERROR_EPS_MULTIPLIER
@@ -0,0 +1,222 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER dimension of the eigenvalues against LAPACK's and,
+// with the eigenvectors V, of A * V - V * diag(W) relative to the largest
+// eigenvalue and of V**T * V - I
+#define SYEV_ERROR_EPS_MULTIPLIER 100
+
+using namespace std;
+
+// syevd (divide and conquer) when divide, syev (QL iteration) otherwise;
+// only the triangle of A given by uplo is passed in, the other one is
+// filled with values the routine must not read
+template <typename T>
+rocblas_status testing_syev(Arguments argus, bool divide) {
+
+  rocblas_int N = argus.N;
+  rocblas_int lda = argus.lda;
+  char char_uplo = argus.uplo_option;
+  char char_evect = argus.evect_option;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_fill uplo = char2rocblas_fill(char_uplo);
+  rocsolver_evect evect = char2rocsolver_evect(char_evect);
+
+  rocblas_int size_A = lda * N;
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (N < 0 || lda < std::max(1, N)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    if (!dA) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    if (divide)
+      status = rocsolver_syevd<T>(handle, evect, uplo, N, dA, lda, dA);
+    else
+      status = rocsolver_syev<T>(handle, evect, uplo, N, dA, lda, dA);
+
+    syev_arg_check(status, N, lda);
+
+    return status;
+  }
+
+  const bool vectors = (evect == rocsolver_evect_original);
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(max(size_A, 1));
+  vector<T> hARes(max(size_A, 1));
+  vector<T> hW(max(N, 1));
+  vector<T> hWRes(max(N, 1));
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = SYEV_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hA.size()),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  auto dW_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hW.size()),
+                         rocblas_test::device_free};
+  T *dW = (T *)dW_managed.get();
+  if (!dA || !dW) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random matrix hA with all entries in [1, 10], made
+  //  symmetric from the triangle given by uplo and with the other triangle
+  //  then overwritten
+  rocblas_init<T>(hA, N, N, lda);
+  for (int j = 0; j < N; j++) {
+    for (int i = j + 1; i < N; i++) {
+      if (uplo == rocblas_fill_lower)
+        hA[j + i * lda] = hA[i + j * lda];
+      else
+        hA[i + j * lda] = hA[j + i * lda];
+    }
+  }
+  hARes = hA;
+  for (int j = 0; j < N; j++) {
+    for (int i = j + 1; i < N; i++) {
+      if (uplo == rocblas_fill_lower)
+        hARes[j + i * lda] = -1000;
+      else
+        hARes[i + j * lda] = -1000;
+    }
+  }
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(hipMemcpy(dA, hARes.data(), sizeof(T) * size_A,
+                            hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    if (divide) {
+      CHECK_ROCBLAS_ERROR(
+          rocsolver_syevd<T>(handle, evect, uplo, N, dA, lda, dW));
+    } else {
+      CHECK_ROCBLAS_ERROR(
+          rocsolver_syev<T>(handle, evect, uplo, N, dA, lda, dW));
+    }
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hARes.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hWRes.data(), dW, sizeof(T) * N, hipMemcpyDeviceToHost));
+
+    // Error Check
+
+    // the eigenvalues against LAPACK's, both in ascending order
+    vector<T> hB = hA;
+    cblas_syevd<T>('N', char_uplo, N, hB.data(), lda, hW.data());
+    T wmax = 0;
+    for (int i = 0; i < N; i++)
+      wmax = max(wmax, abs(hW[i]));
+    for (int i = 0; i < N; i++)
+      max_err_1 = max(max_err_1, abs(hWRes[i] - hW[i]));
+
+    // A * V - V * diag(W) and V**T * V - I
+    if (vectors) {
+      for (int j = 0; j < N; j++) {
+        for (int i = 0; i < N; i++) {
+          T r = -hARes[i + j * lda] * hWRes[j];
+          T g = (i == j) ? -1 : 0;
+          for (int l = 0; l < N; l++) {
+            r += hA[i + l * lda] * hARes[l + j * lda];
+            g += hARes[l + i * lda] * hARes[l + j * lda];
+          }
+          max_err_1 = max(max_err_1, abs(r));
+          max_err_1 = max(max_err_1, abs(g) * wmax);
+        }
+      }
+    }
+    if (wmax > 0)
+      max_err_1 /= wmax;
+
+    syev_err_res_check<T>(max_err_1, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    gpu_time_used = get_time_us(); // in microseconds
+
+    if (divide) {
+      CHECK_ROCBLAS_ERROR(
+          rocsolver_syevd<T>(handle, evect, uplo, N, dA, lda, dW));
+    } else {
+      CHECK_ROCBLAS_ERROR(
+          rocsolver_syev<T>(handle, evect, uplo, N, dA, lda, dW));
+    }
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    if (divide)
+      cblas_syevd<T>(char_evect, char_uplo, N, hA.data(), lda, hW.data());
+    else
+      cblas_syev<T>(char_evect, char_uplo, N, hA.data(), lda, hW.data());
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "N , lda , evect , uplo , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << N << " , " << lda << " , " << char_evect << " , " << char_uplo
+         << " , " << gpu_time_used << " , " << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef SYEV_ERROR_EPS_MULTIPLIER
@@ -0,0 +1,279 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER dimension of the eigenvalues against LAPACK's and,
+// with the eigenvectors V, of A * V - V * diag(W) relative to the largest
+// eigenvalue and of V**T * V - I, over the batch
+#define SYEVJ_ERROR_EPS_MULTIPLIER 100
+
+// sweeps allowed to every matrix, far more than it takes to converge
+#define SYEVJ_MAX_SWEEPS 100
+
+using namespace std;
+
+// the strided batched variant if strided, otherwise the batched one on an
+// array of pointers to the same matrices
+template <typename T>
+rocblas_status testing_syevj_calls(rocblas_handle handle, bool strided,
+                                   rocsolver_evect evect, rocblas_fill uplo,
+                                   rocblas_int N, T *dA, T *const dAarray[],
+                                   rocblas_int lda, rocblas_int strideA, T *dW,
+                                   rocblas_int strideW, rocblas_int *dInfo,
+                                   rocblas_int batch_count) {
+  return strided ? rocsolver_syevj_strided_batched<T>(
+                       handle, evect, uplo, N, dA, lda, strideA, 0,
+                       SYEVJ_MAX_SWEEPS, dW, strideW, dInfo, batch_count)
+                 : rocsolver_syevj_batched<T>(handle, evect, uplo, N, dAarray,
+                                              lda, 0, SYEVJ_MAX_SWEEPS, dW,
+                                              strideW, dInfo, batch_count);
+}
+
+template <typename T>
+rocblas_status testing_syevj(Arguments argus, bool strided) {
+
+  rocblas_int N = argus.N;
+  rocblas_int lda = argus.lda;
+  rocblas_int batch_count = argus.batch_count;
+  char char_uplo = argus.uplo_option;
+  char char_evect = argus.evect_option;
+
+  rocblas_int safe_size = 100; // arbitrarily set to 100
+
+  rocblas_fill uplo = char2rocblas_fill(char_uplo);
+  rocsolver_evect evect = char2rocsolver_evect(char_evect);
+
+  rocblas_int strideA = lda * N;
+  rocblas_int strideW = N;
+  rocblas_int size_A = strideA * max(batch_count, 1);
+  rocblas_int size_W = strideW * max(batch_count, 1);
+
+  rocblas_status status;
+
+  std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(
+      new rocblas_test::handle_struct);
+  rocblas_handle handle = unique_ptr_handle->handle;
+
+  // check here to prevent undefined memory allocation error
+  if (N < 0 || batch_count < 0 || lda < std::max(1, N)) {
+    auto dA_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * safe_size),
+                           rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dInfo_managed = rocblas_unique_ptr{
+        rocblas_test::device_malloc(sizeof(rocblas_int) * safe_size),
+        rocblas_test::device_free};
+    rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+    auto dAarray_managed =
+        rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T *) * safe_size),
+                           rocblas_test::device_free};
+    T **dAarray = (T **)dAarray_managed.get();
+    if (!dA || !dInfo || !dAarray) {
+      PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+      return rocblas_status_memory_error;
+    }
+
+    status = testing_syevj_calls<T>(handle, strided, evect, uplo, N, dA,
+                                    dAarray, lda, 0, dA, 0, dInfo,
+                                    batch_count);
+
+    syevj_arg_check(status, N, lda, batch_count);
+
+    return status;
+  }
+
+  const bool vectors = (evect == rocsolver_evect_original);
+
+  // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+  vector<T> hA(max(size_A, 1));
+  vector<T> hARes(max(size_A, 1));
+  vector<T> hW(max(size_W, 1));
+  vector<T> hWRes(max(size_W, 1));
+  vector<rocblas_int> hInfo(max(batch_count, 1));
+  vector<T *> hAarray(max(batch_count, 1));
+
+  double gpu_time_used, cpu_time_used;
+  T error_eps_multiplier = SYEVJ_ERROR_EPS_MULTIPLIER;
+  T eps = std::numeric_limits<T>::epsilon();
+
+  // allocate memory on device
+  auto dA_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hA.size()),
+                         rocblas_test::device_free};
+  T *dA = (T *)dA_managed.get();
+  auto dW_managed =
+      rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * hW.size()),
+                         rocblas_test::device_free};
+  T *dW = (T *)dW_managed.get();
+  auto dInfo_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(rocblas_int) * hInfo.size()),
+      rocblas_test::device_free};
+  rocblas_int *dInfo = (rocblas_int *)dInfo_managed.get();
+  auto dAarray_managed = rocblas_unique_ptr{
+      rocblas_test::device_malloc(sizeof(T *) * hAarray.size()),
+      rocblas_test::device_free};
+  T **dAarray = (T **)dAarray_managed.get();
+  if (!dA || !dW || !dInfo || !dAarray) {
+    PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+    return rocblas_status_memory_error;
+  }
+
+  //  initialize full random symmetric matrices hA with all entries in
+  //  [1, 10]; only the triangle given by uplo is passed, the other one is
+  //  overwritten
+  vector<T> hAb(max(strideA, 1));
+  for (int b = 0; b < batch_count; b++) {
+    rocblas_init<T>(hAb, N, N, lda);
+    for (int j = 0; j < N; j++) {
+      for (int i = j + 1; i < N; i++) {
+        if (uplo == rocblas_fill_lower)
+          hAb[j + i * lda] = hAb[i + j * lda];
+        else
+          hAb[i + j * lda] = hAb[j + i * lda];
+      }
+    }
+    copy(hAb.begin(), hAb.begin() + strideA, hA.begin() + b * strideA);
+  }
+  hARes = hA;
+  for (int b = 0; b < batch_count; b++) {
+    for (int j = 0; j < N; j++) {
+      for (int i = j + 1; i < N; i++) {
+        if (uplo == rocblas_fill_lower)
+          hARes[b * strideA + j + i * lda] = -1000;
+        else
+          hARes[b * strideA + i + j * lda] = -1000;
+      }
+    }
+    hAarray[b] = dA + b * strideA;
+  }
+
+  // copy data from CPU to device
+  CHECK_HIP_ERROR(hipMemcpy(dA, hARes.data(), sizeof(T) * size_A,
+                            hipMemcpyHostToDevice));
+  CHECK_HIP_ERROR(hipMemcpy(dAarray, hAarray.data(),
+                            sizeof(T *) * hAarray.size(),
+                            hipMemcpyHostToDevice));
+
+  T max_err_1 = 0.0;
+  if (argus.unit_check || argus.norm_check) {
+    CHECK_ROCBLAS_ERROR(testing_syevj_calls<T>(
+        handle, strided, evect, uplo, N, dA, dAarray, lda, strideA, dW,
+        strideW, dInfo, batch_count));
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hARes.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hWRes.data(), dW, sizeof(T) * size_W,
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hInfo.data(), dInfo,
+                              sizeof(rocblas_int) * batch_count,
+                              hipMemcpyDeviceToHost));
+
+    // Error Check
+
+    for (int b = 0; b < batch_count; b++) {
+      T *A = hA.data() + b * strideA;
+      T *V = hARes.data() + b * strideA;
+      T *W = hWRes.data() + b * strideW;
+      T err = 0;
+
+      // the eigenvalues against LAPACK's, both in ascending order
+      vector<T> hB(A, A + strideA);
+      cblas_syevd<T>('N', char_uplo, N, hB.data(), lda, hW.data());
+      T wmax = 0;
+      for (int i = 0; i < N; i++)
+        wmax = max(wmax, abs(hW[i]));
+      for (int i = 0; i < N; i++)
+        err = max(err, abs(W[i] - hW[i]));
+
+      // A * V - V * diag(W) and V**T * V - I
+      if (vectors) {
+        for (int j = 0; j < N; j++) {
+          for (int i = 0; i < N; i++) {
+            T r = -V[i + j * lda] * W[j];
+            T g = (i == j) ? -1 : 0;
+            for (int l = 0; l < N; l++) {
+              r += A[i + l * lda] * V[l + j * lda];
+              g += V[l + i * lda] * V[l + j * lda];
+            }
+            err = max(err, abs(r));
+            err = max(err, abs(g) * wmax);
+          }
+        }
+      }
+      if (wmax > 0)
+        err /= wmax;
+
+      // the sweeps must have converged
+      if (hInfo[b] != 0)
+        err = 1;
+
+      max_err_1 = max(max_err_1, err);
+    }
+
+    syev_err_res_check<T>(max_err_1, N, error_eps_multiplier, eps);
+  }
+
+  if (argus.timing) {
+    // GPU rocBLAS
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+
+    gpu_time_used = get_time_us(); // in microseconds
+
+    CHECK_ROCBLAS_ERROR(testing_syevj_calls<T>(
+        handle, strided, evect, uplo, N, dA, dAarray, lda, strideA, dW,
+        strideW, dInfo, batch_count));
+    hipDeviceSynchronize();
+
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    // CPU cblas
+    cpu_time_used = get_time_us();
+
+    for (int b = 0; b < batch_count; b++)
+      cblas_syevd<T>(char_evect, char_uplo, N, hA.data() + b * strideA, lda,
+                     hW.data() + b * strideW);
+
+    cpu_time_used = get_time_us() - cpu_time_used;
+
+    // only norm_check return an norm error, unit check won't return anything
+    cout << "N , lda , evect , uplo , batch_count , us [gpu] , us [cpu]";
+
+    if (argus.norm_check)
+      cout << ", norm_error_host_ptr";
+
+    cout << endl;
+
+    cout << N << " , " << lda << " , " << char_evect << " , " << char_uplo
+         << " , " << batch_count << " , " << gpu_time_used << " , "
+         << cpu_time_used;
+
+    if (argus.norm_check)
+      cout << " , " << max_err_1;
+
+    cout << endl;
+  }
+  return rocblas_status_success;
+}
+
+#undef SYEVJ_ERROR_EPS_MULTIPLIER
+#undef SYEVJ_MAX_SWEEPS
@@ -41,6 +41,14 @@ template <typename T>
 void potf2_err_res_check(T max_error, rocblas_int N, T forward_tolerance,
                          T eps);
 
+template <typename T>
+void potrf_err_res_check(T max_error, rocblas_int N, T forward_tolerance,
+                         T eps);
+
+template <typename T>
+void potupdate_err_res_check(T max_error, rocblas_int N, T forward_tolerance,
+                             T eps);
+
 template <typename T>
 void getf2_err_res_check(T max_error, rocblas_int M, rocblas_int N,
                          T forward_tolerance, T eps);
@@ -53,4 +61,84 @@ template <typename T>
 void getrf_err_res_check(T max_error, rocblas_int M, rocblas_int N,
                          T forward_tolerance, T eps);
 
+template <typename T>
+void gesv_err_res_check(T max_error, rocblas_int N, rocblas_int nhrs,
+                        T forward_tolerance, T eps);
+
+template <typename T>
+void getri_err_res_check(T max_error, rocblas_int N, T forward_tolerance,
+                         T eps);
+
+template <typename T>
+void gecon_err_res_check(T max_error, rocblas_int N, T forward_tolerance,
+                         T eps);
+
+template <typename T>
+void pocon_err_res_check(T max_error, rocblas_int N, T forward_tolerance,
+                         T eps);
+
+template <typename T>
+void gerfs_err_res_check(T max_error, rocblas_int N, rocblas_int nhrs,
+                         T forward_tolerance, T eps);
+
+template <typename T>
+void geequ_err_res_check(T max_error, rocblas_int M, rocblas_int N,
+                         T forward_tolerance, T eps);
+
+template <typename T>
+void lange_err_res_check(T max_error, rocblas_int M, rocblas_int N,
+                         T forward_tolerance, T eps);
+
+template <typename T>
+void geqrf_err_res_check(T max_error, rocblas_int M, rocblas_int N,
+                         T forward_tolerance, T eps);
+
+template <typename T>
+void geqp3_err_res_check(T max_error, rocblas_int M, rocblas_int N,
+                         T forward_tolerance, T eps);
+
+template <typename T>
+void orgqr_err_res_check(T max_error, rocblas_int M, rocblas_int N,
+                         T forward_tolerance, T eps);
+
+template <typename T>
+void ormqr_err_res_check(T max_error, rocblas_int M, rocblas_int N,
+                         T forward_tolerance, T eps);
+
+template <typename T>
+void gels_err_res_check(T max_error, rocblas_int M, rocblas_int N,
+                        T forward_tolerance, T eps);
+
+template <typename T>
+void syev_err_res_check(T max_error, rocblas_int N, T forward_tolerance,
+                        T eps);
+
+template <typename T>
+void gesvd_err_res_check(T max_error, rocblas_int M, rocblas_int N,
+                         T forward_tolerance, T eps);
+
+template <typename T>
+void gbtrf_err_res_check(T max_error, rocblas_int M, rocblas_int N,
+                         T forward_tolerance, T eps);
+
+template <typename T>
+void gbtrs_err_res_check(T max_error, rocblas_int N, rocblas_int nhrs,
+                         T forward_tolerance, T eps);
+
+template <typename T>
+void gtsv_err_res_check(T max_error, rocblas_int N, rocblas_int nhrs,
+                        T forward_tolerance, T eps);
+
+template <typename T>
+void gebltsv_err_res_check(T max_error, rocblas_int N, rocblas_int nhrs,
+                           T forward_tolerance, T eps);
+
+template <typename T>
+void gehrd_err_res_check(T max_error, rocblas_int N, T forward_tolerance,
+                         T eps);
+
+template <typename T>
+void geev_err_res_check(T max_error, rocblas_int N, T forward_tolerance,
+                        T eps);
+
 #endif
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "rocblas.h"
+#include "rocsolver.h"
 
 using namespace std;
 
@@ -288,6 +289,10 @@ rocblas_diagonal char2rocblas_diagonal(char value);
 
 rocblas_side char2rocblas_side(char value);
 
+rocsolver_evect char2rocsolver_evect(char value);
+
+rocsolver_svect char2rocsolver_svect(char value);
+
 #ifdef __cplusplus
 }
 #endif
@@ -306,6 +311,9 @@ public:
   rocblas_int N = 128;
   rocblas_int K = 128;
 
+  rocblas_int kl = 32;
+  rocblas_int ku = 32;
+
   rocblas_int lda = 128;
   rocblas_int ldb = 128;
   rocblas_int ldc = 128;
@@ -327,10 +335,22 @@ public:
   char side_option = 'L';
   char uplo_option = 'L';
   char diag_option = 'N';
+  char norm_option = 'O';
+  char evect_option = 'N';
+  char left_svect_option = 'N';
+  char right_svect_option = 'N';
 
   rocblas_int apiCallCount = 1;
   rocblas_int batch_count = 10;
 
+  rocblas_int oversample = 10;
+  rocblas_int power_iters = 2;
+
+  // band LU testers: 'N' makes the diagonal dominant, so that no rows are
+  // interchanged, 'Y' puts the dominant entries off the diagonal, so that rows
+  // are interchanged
+  char pivot_option = 'N';
+
   rocblas_int bsa =
       128 * 128; //  bsa > transA_option == 'N' ? lda * K : lda * M
   rocblas_int bsb =
@@ -348,6 +368,9 @@ public:
     N = rhs.N;
     K = rhs.K;
 
+    kl = rhs.kl;
+    ku = rhs.ku;
+
     lda = rhs.lda;
     ldb = rhs.ldb;
     ldc = rhs.ldc;
@@ -369,10 +392,18 @@ public:
     side_option = rhs.side_option;
     uplo_option = rhs.uplo_option;
     diag_option = rhs.diag_option;
+    evect_option = rhs.evect_option;
+    left_svect_option = rhs.left_svect_option;
+    right_svect_option = rhs.right_svect_option;
 
     apiCallCount = rhs.apiCallCount;
     batch_count = rhs.batch_count;
 
+    oversample = rhs.oversample;
+    power_iters = rhs.power_iters;
+
+    pivot_option = rhs.pivot_option;
+
     norm_check = rhs.norm_check;
     unit_check = rhs.unit_check;
     timing = rhs.timing;
@@ -95,6 +95,430 @@ ROCSOLVER_EXPORT rocsolver_status rocsolver_dpotf2(rocsolver_handle handle,
                                                    rocsolver_int n, double *A,
                                                    rocsolver_int lda);
 
+/*! \brief LAPACK API
+
+    \details
+    potf2 computes the Cholesky factorization of a complex Hermitian
+    positive definite matrix A.
+
+        A = U**H * U ,  if UPLO = 'U', or
+        A = L  * L**H,  if UPLO = 'L',
+    where U is an upper triangular matrix and L is lower triangular, both
+    with a real diagonal. The imaginary parts of the diagonal of A are
+    ignored.
+
+    This is the unblocked version of the algorithm, calling Level 2 BLAS.
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    uplo      rocsolver_fill.
+              specifies whether the upper or lower
+    @param[in]
+    n         the matrix dimensions
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocsolver_int
+              specifies the leading dimension of A.
+
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status rocsolver_cpotf2(rocsolver_handle handle,
+                                                   rocsolver_fill uplo,
+                                                   rocsolver_int n,
+                                                   rocsolver_float_complex *A,
+                                                   rocsolver_int lda);
+
+/*! \brief LAPACK API
+
+    \details
+    potf2 computes the Cholesky factorization of a complex Hermitian
+    positive definite matrix A.
+
+        A = U**H * U ,  if UPLO = 'U', or
+        A = L  * L**H,  if UPLO = 'L',
+    where U is an upper triangular matrix and L is lower triangular, both
+    with a real diagonal. The imaginary parts of the diagonal of A are
+    ignored.
+
+    This is the unblocked version of the algorithm, calling Level 2 BLAS.
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    uplo      rocsolver_fill.
+              specifies whether the upper or lower
+    @param[in]
+    n         the matrix dimensions
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocsolver_int
+              specifies the leading dimension of A.
+
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status rocsolver_zpotf2(rocsolver_handle handle,
+                                                   rocsolver_fill uplo,
+                                                   rocsolver_int n,
+                                                   rocsolver_double_complex *A,
+                                                   rocsolver_int lda);
+
+/*! \brief LAPACK API
+
+    \details
+    potrf computes the Cholesky factorization of a real symmetric
+    positive definite matrix A.
+
+        A = U' * U ,  if UPLO = 'U', or
+        A = L  * L',  if UPLO = 'L',
+    where U is an upper triangular matrix and L is lower triangular.
+
+    This is the tiled Level 3 BLAS version of the algorithm: the
+    factorization is split into POTRF, TRSM, SYRK and GEMM tasks on
+    square tiles which are executed out of order, as soon as their
+    inputs are ready, on several internal streams. Work submitted to
+    the handle's stream before and after the call stays ordered with it.
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    uplo      rocsolver_fill.
+              specifies whether the upper or lower
+    @param[in]
+    n         the matrix dimensions
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocsolver_int
+              specifies the leading dimension of A.
+
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status rocsolver_spotrf(rocsolver_handle handle,
+                                                   rocsolver_fill uplo,
+                                                   rocsolver_int n, float *A,
+                                                   rocsolver_int lda);
+
+/*! \brief LAPACK API
+
+    \details
+    potrf computes the Cholesky factorization of a real symmetric
+    positive definite matrix A.
+
+        A = U' * U ,  if UPLO = 'U', or
+        A = L  * L',  if UPLO = 'L',
+    where U is an upper triangular matrix and L is lower triangular.
+
+    This is the tiled Level 3 BLAS version of the algorithm: the
+    factorization is split into POTRF, TRSM, SYRK and GEMM tasks on
+    square tiles which are executed out of order, as soon as their
+    inputs are ready, on several internal streams. Work submitted to
+    the handle's stream before and after the call stays ordered with it.
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    uplo      rocsolver_fill.
+              specifies whether the upper or lower
+    @param[in]
+    n         the matrix dimensions
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocsolver_int
+              specifies the leading dimension of A.
+
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dpotrf(rocsolver_handle handle,
+                                                   rocsolver_fill uplo,
+                                                   rocsolver_int n, double *A,
+                                                   rocsolver_int lda);
+
+/*! \brief LAPACK API
+
+    \details
+    potupdate modifies the Cholesky factorization of a real symmetric
+    positive definite matrix M, as computed by potf2 or potrf, by a
+    rank-k term:
+
+        M + X * X'
+
+    where X is an n-by-k matrix. The factor is updated with blocked
+    Givens rotations in O(k*n^2) operations, instead of refactoring
+    the modified matrix in O(n^3).
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    uplo      rocsolver_fill.
+              specifies whether the upper (U' * U) or lower (L * L')
+              factor is stored in A.
+    @param[in]
+    n         rocsolver_int
+              the order of the matrix. n >= 0.
+    @param[in]
+    k         rocsolver_int
+              the number of columns of X. k >= 0.
+    @param[inout]
+    A         pointer storing the factor on the GPU. On exit, the factor of
+              the modified matrix. The other triangle is not referenced.
+    @param[in]
+    lda       rocsolver_int
+              specifies the leading dimension of A. lda >= max(1,n).
+    @param[inout]
+    X         pointer storing the n-by-k matrix X on the GPU. X is
+              overwritten.
+    @param[in]
+    ldx       rocsolver_int
+              specifies the leading dimension of X. ldx >= max(1,n).
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_spotupdate(rocsolver_handle handle, rocsolver_fill uplo,
+                     rocsolver_int n, rocsolver_int k, float *A,
+                     rocsolver_int lda, float *X, rocsolver_int ldx);
+
+/*! \brief LAPACK API
+
+    \details
+    potupdate modifies the Cholesky factorization of a real symmetric
+    positive definite matrix M, as computed by potf2 or potrf, by a
+    rank-k term:
+
+        M + X * X'
+
+    where X is an n-by-k matrix. The factor is updated with blocked
+    Givens rotations in O(k*n^2) operations, instead of refactoring
+    the modified matrix in O(n^3).
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    uplo      rocsolver_fill.
+              specifies whether the upper (U' * U) or lower (L * L')
+              factor is stored in A.
+    @param[in]
+    n         rocsolver_int
+              the order of the matrix. n >= 0.
+    @param[in]
+    k         rocsolver_int
+              the number of columns of X. k >= 0.
+    @param[inout]
+    A         pointer storing the factor on the GPU. On exit, the factor of
+              the modified matrix. The other triangle is not referenced.
+    @param[in]
+    lda       rocsolver_int
+              specifies the leading dimension of A. lda >= max(1,n).
+    @param[inout]
+    X         pointer storing the n-by-k matrix X on the GPU. X is
+              overwritten.
+    @param[in]
+    ldx       rocsolver_int
+              specifies the leading dimension of X. ldx >= max(1,n).
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dpotupdate(rocsolver_handle handle, rocsolver_fill uplo,
+                     rocsolver_int n, rocsolver_int k, double *A,
+                     rocsolver_int lda, double *X, rocsolver_int ldx);
+
+/*! \brief LAPACK API
+
+    \details
+    potdowndate modifies the Cholesky factorization of a real symmetric
+    positive definite matrix M, as computed by potf2 or potrf, by a
+    rank-k term:
+
+        M - X * X'
+
+    where X is an n-by-k matrix. The factor is downdated with blocked
+    hyperbolic rotations in O(k*n^2) operations, instead of refactoring
+    the modified matrix in O(n^3).
+
+    The downdated matrix must remain positive definite; otherwise an error
+    is returned and the factor is not valid.
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    uplo      rocsolver_fill.
+              specifies whether the upper (U' * U) or lower (L * L')
+              factor is stored in A.
+    @param[in]
+    n         rocsolver_int
+              the order of the matrix. n >= 0.
+    @param[in]
+    k         rocsolver_int
+              the number of columns of X. k >= 0.
+    @param[inout]
+    A         pointer storing the factor on the GPU. On exit, the factor of
+              the modified matrix. The other triangle is not referenced.
+    @param[in]
+    lda       rocsolver_int
+              specifies the leading dimension of A. lda >= max(1,n).
+    @param[inout]
+    X         pointer storing the n-by-k matrix X on the GPU. X is
+              overwritten.
+    @param[in]
+    ldx       rocsolver_int
+              specifies the leading dimension of X. ldx >= max(1,n).
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_spotdowndate(rocsolver_handle handle, rocsolver_fill uplo,
+                       rocsolver_int n, rocsolver_int k, float *A,
+                       rocsolver_int lda, float *X, rocsolver_int ldx);
+
+/*! \brief LAPACK API
+
+    \details
+    potdowndate modifies the Cholesky factorization of a real symmetric
+    positive definite matrix M, as computed by potf2 or potrf, by a
+    rank-k term:
+
+        M - X * X'
+
+    where X is an n-by-k matrix. The factor is downdated with blocked
+    hyperbolic rotations in O(k*n^2) operations, instead of refactoring
+    the modified matrix in O(n^3).
+
+    The downdated matrix must remain positive definite; otherwise an error
+    is returned and the factor is not valid.
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    uplo      rocsolver_fill.
+              specifies whether the upper (U' * U) or lower (L * L')
+              factor is stored in A.
+    @param[in]
+    n         rocsolver_int
+              the order of the matrix. n >= 0.
+    @param[in]
+    k         rocsolver_int
+              the number of columns of X. k >= 0.
+    @param[inout]
+    A         pointer storing the factor on the GPU. On exit, the factor of
+              the modified matrix. The other triangle is not referenced.
+    @param[in]
+    lda       rocsolver_int
+              specifies the leading dimension of A. lda >= max(1,n).
+    @param[inout]
+    X         pointer storing the n-by-k matrix X on the GPU. X is
+              overwritten.
+    @param[in]
+    ldx       rocsolver_int
+              specifies the leading dimension of X. ldx >= max(1,n).
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dpotdowndate(rocsolver_handle handle, rocsolver_fill uplo,
+                       rocsolver_int n, rocsolver_int k, double *A,
+                       rocsolver_int lda, double *X, rocsolver_int ldx);
+
+/*! \brief LAPACK API
+
+  \details
+  pocon estimates the reciprocal of the condition number, in the 1-norm,
+  of a symmetric positive definite matrix A from its Cholesky
+  factorization computed by potf2 or potrf:
+     rcond = 1 / (norm(A) * norm(inv(A)))
+  The norm of inv(A) is estimated on the GPU with triangular solves; the
+  result is left in device memory without synchronizing with the host.
+
+  @param[in]
+  uplo
+           specifies whether the factor is stored in the upper or lower
+           triangular part of A.
+
+  @param[in]
+  n
+           the order of the matrix A. n >= 0.
+
+  @param[in]
+  A
+           pointer storing the Cholesky factor from potf2/potrf on the GPU.
+
+  @param[in]
+  lda
+           specifies the leading dimension of A. lda >= max(1,n).
+
+  @param[in]
+  anorm
+           pointer to the 1-norm of the original matrix A on the GPU.
+
+  @param[out]
+  rcond
+           pointer to the reciprocal condition number on the GPU.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_spocon(rocsolver_handle handle, rocsolver_fill uplo,
+                 rocsolver_int n, const float *A, rocsolver_int lda,
+                 const float *anorm, float *rcond);
+
+/*! \brief LAPACK API
+
+  \details
+  pocon estimates the reciprocal of the condition number, in the 1-norm,
+  of a symmetric positive definite matrix A from its Cholesky
+  factorization computed by potf2 or potrf:
+     rcond = 1 / (norm(A) * norm(inv(A)))
+  The norm of inv(A) is estimated on the GPU with triangular solves; the
+  result is left in device memory without synchronizing with the host.
+
+  @param[in]
+  uplo
+           specifies whether the factor is stored in the upper or lower
+           triangular part of A.
+
+  @param[in]
+  n
+           the order of the matrix A. n >= 0.
+
+  @param[in]
+  A
+           pointer storing the Cholesky factor from potf2/potrf on the GPU.
+
+  @param[in]
+  lda
+           specifies the leading dimension of A. lda >= max(1,n).
+
+  @param[in]
+  anorm
+           pointer to the 1-norm of the original matrix A on the GPU.
+
+  @param[out]
+  rcond
+           pointer to the reciprocal condition number on the GPU.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dpocon(rocsolver_handle handle, rocsolver_fill uplo,
+                 rocsolver_int n, const double *A, rocsolver_int lda,
+                 const double *anorm, double *rcond);
+
 /*! \brief LAPACK API
 
     \details
@@ -182,7 +606,7 @@ ROCSOLVER_EXPORT rocsolver_status rocsolver_dgetf2(rocsolver_handle handle,
 /*! \brief LAPACK API
 
     \details
-    getrf computes an LU factorization of a general m-by-n matrix A
+    getf2 computes an LU factorization of a general complex m-by-n matrix A
     using partial pivoting with row interchanges.
 
     The factorization has the form
@@ -191,7 +615,96 @@ ROCSOLVER_EXPORT rocsolver_status rocsolver_dgetf2(rocsolver_handle handle,
     diagonal elements (lower trapezoidal if m > n), and U is upper
     triangular (upper trapezoidal if m < n).
 
-    This is the right-looking Level 3 BLAS version of the algorithm.
+    This is the right-looking Level 2 BLAS version of the algorithm.
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    m         rocsolver_int
+              the number of rows of the matrix A. m >= 0.
+    @param[in]
+    n         rocsolver_int
+              the number of colums of the matrix A. n >= 0.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocsolver_int
+              specifies the leading dimension of A. lda >= max(1,m).
+    @param[out]
+    ipiv      pointer storing pivots on the GPU. Dimension (min(m,n)).
+
+    This implementation will even upon encountering a singularity continue
+    and only in the end return an error code.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status rocsolver_cgetf2(rocsolver_handle handle,
+                                                   rocsolver_int m,
+                                                   rocsolver_int n,
+                                                   rocsolver_float_complex *A,
+                                                   rocsolver_int lda,
+                                                   rocsolver_int *ipiv);
+
+/*! \brief LAPACK API
+
+    \details
+    getf2 computes an LU factorization of a general complex m-by-n matrix A
+    using partial pivoting with row interchanges.
+
+    The factorization has the form
+       A = P * L * U
+    where P is a permutation matrix, L is lower triangular with unit
+    diagonal elements (lower trapezoidal if m > n), and U is upper
+    triangular (upper trapezoidal if m < n).
+
+    This is the right-looking Level 2 BLAS version of the algorithm.
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    m         rocsolver_int
+              the number of rows of the matrix A. m >= 0.
+    @param[in]
+    n         rocsolver_int
+              the number of colums of the matrix A. n >= 0.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocsolver_int
+              specifies the leading dimension of A. lda >= max(1,m).
+    @param[out]
+    ipiv      pointer storing pivots on the GPU. Dimension (min(m,n)).
+
+    This implementation will even upon encountering a singularity continue
+    and only in the end return an error code.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status rocsolver_zgetf2(rocsolver_handle handle,
+                                                   rocsolver_int m,
+                                                   rocsolver_int n,
+                                                   rocsolver_double_complex *A,
+                                                   rocsolver_int lda,
+                                                   rocsolver_int *ipiv);
+
+/*! \brief LAPACK API
+
+    \details
+    getrf computes an LU factorization of a general m-by-n matrix A
+    using partial pivoting with row interchanges.
+
+    The factorization has the form
+       A = P * L * U
+    where P is a permutation matrix, L is lower triangular with unit
+    diagonal elements (lower trapezoidal if m > n), and U is upper
+    triangular (upper trapezoidal if m < n).
+
+    This is the right-looking Level 3 BLAS version of the algorithm. For
+    large matrices it is executed as a graph of tile tasks on several
+    internal streams, so that panel factorizations overlap with the
+    trailing updates.
 
     @param[in]
     handle    rocsolver_handle.
@@ -233,7 +746,10 @@ ROCSOLVER_EXPORT rocsolver_status rocsolver_sgetrf(rocsolver_handle handle,
     diagonal elements (lower trapezoidal if m > n), and U is upper
     triangular (upper trapezoidal if m < n).
 
-    This is the right-looking Level 3 BLAS version of the algorithm.
+    This is the right-looking Level 3 BLAS version of the algorithm. For
+    large matrices it is executed as a graph of tile tasks on several
+    internal streams, so that panel factorizations overlap with the
+    trailing updates.
 
     @param[in]
     handle    rocsolver_handle.
@@ -263,6 +779,98 @@ ROCSOLVER_EXPORT rocsolver_status rocsolver_dgetrf(rocsolver_handle handle,
                                                    rocsolver_int lda,
                                                    rocsolver_int *ipiv);
 
+/*! \brief LAPACK API
+
+    \details
+    getrf computes an LU factorization of a general complex m-by-n matrix A
+    using partial pivoting with row interchanges.
+
+    The factorization has the form
+       A = P * L * U
+    where P is a permutation matrix, L is lower triangular with unit
+    diagonal elements (lower trapezoidal if m > n), and U is upper
+    triangular (upper trapezoidal if m < n).
+
+    This is the right-looking Level 3 BLAS version of the algorithm. For
+    large matrices it is executed as a graph of tile tasks on several
+    internal streams, so that panel factorizations overlap with the
+    trailing updates.
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    m         rocsolver_int
+              the number of rows of the matrix A. m >= 0.
+    @param[in]
+    n         rocsolver_int
+              the number of colums of the matrix A. n >= 0.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocsolver_int
+              specifies the leading dimension of A. lda >= max(1,m).
+    @param[out]
+    ipiv      pointer storing pivots on the GPU. Dimension (min(m,n)).
+
+    This implementation will even upon encountering a singularity continue
+    and only in the end return an error code.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status rocsolver_cgetrf(rocsolver_handle handle,
+                                                   rocsolver_int m,
+                                                   rocsolver_int n,
+                                                   rocsolver_float_complex *A,
+                                                   rocsolver_int lda,
+                                                   rocsolver_int *ipiv);
+
+/*! \brief LAPACK API
+
+    \details
+    getrf computes an LU factorization of a general complex m-by-n matrix A
+    using partial pivoting with row interchanges.
+
+    The factorization has the form
+       A = P * L * U
+    where P is a permutation matrix, L is lower triangular with unit
+    diagonal elements (lower trapezoidal if m > n), and U is upper
+    triangular (upper trapezoidal if m < n).
+
+    This is the right-looking Level 3 BLAS version of the algorithm. For
+    large matrices it is executed as a graph of tile tasks on several
+    internal streams, so that panel factorizations overlap with the
+    trailing updates.
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    m         rocsolver_int
+              the number of rows of the matrix A. m >= 0.
+    @param[in]
+    n         rocsolver_int
+              the number of colums of the matrix A. n >= 0.
+    @param[inout]
+    A         pointer storing matrix A on the GPU.
+    @param[in]
+    lda       rocsolver_int
+              specifies the leading dimension of A. lda >= max(1,m).
+    @param[out]
+    ipiv      pointer storing pivots on the GPU. Dimension (min(m,n)).
+
+    This implementation will even upon encountering a singularity continue
+    and only in the end return an error code.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status rocsolver_zgetrf(rocsolver_handle handle,
+                                                   rocsolver_int m,
+                                                   rocsolver_int n,
+                                                   rocsolver_double_complex *A,
+                                                   rocsolver_int lda,
+                                                   rocsolver_int *ipiv);
+
 /*! \brief LAPACK API
 
   \details
@@ -368,6 +976,4833 @@ ROCSOLVER_EXPORT rocsolver_status rocsolver_dgetrs(
     rocsolver_handle handle, rocsolver_operation trans, rocsolver_int n,
     rocsolver_int nrhs, const double *A, rocsolver_int lda,
     const rocsolver_int *ipiv, double *B, rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  getrs solves a system of linear equations
+     A * X = B,  A**T * X = B,  or  A**H * X = B
+  with a general complex N-by-N matrix A using the LU factorization computed
+  by getrf.
+
+  @param[in]
+  trans
+           Specifies the form of the system of equations:
+           = 'N':  A * X = B     (No transpose)
+           = 'T':  A**T * X = B  (Transpose)
+           = 'C':  A**H * X = B  (Conjugate transpose)
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in]
+  A
+           pointer storing matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  ipiv
+           The pivot indices from getrf; for 1<=i<=n, row i of the
+           matrix was interchanged with row ipiv(i). Assumes one-based indices!
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU., dimension (ldb,nrhs)
+           On entry, the right hand side matrix B.
+           On exit, the solution matrix X.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_cgetrs(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int n,
+    rocsolver_int nrhs, const rocsolver_float_complex *A, rocsolver_int lda,
+    const rocsolver_int *ipiv, rocsolver_float_complex *B, rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  getrs solves a system of linear equations
+     A * X = B,  A**T * X = B,  or  A**H * X = B
+  with a general complex N-by-N matrix A using the LU factorization computed
+  by getrf.
+
+  @param[in]
+  trans
+           Specifies the form of the system of equations:
+           = 'N':  A * X = B     (No transpose)
+           = 'T':  A**T * X = B  (Transpose)
+           = 'C':  A**H * X = B  (Conjugate transpose)
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in]
+  A
+           pointer storing matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  ipiv
+           The pivot indices from getrf; for 1<=i<=n, row i of the
+           matrix was interchanged with row ipiv(i). Assumes one-based indices!
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU., dimension (ldb,nrhs)
+           On entry, the right hand side matrix B.
+           On exit, the solution matrix X.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_zgetrs(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int n,
+    rocsolver_int nrhs, const rocsolver_double_complex *A, rocsolver_int lda,
+    const rocsolver_int *ipiv, rocsolver_double_complex *B, rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  getrs_invdiag_size returns the number of elements of the array invD
+  needed by getrs_invdiag and getrs_with_invdiag for a matrix of order n.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[out]
+  size
+           pointer to an integer on the host where the size is stored.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_getrs_invdiag_size(rocsolver_int n, rocsolver_int *size);
+
+/*! \brief LAPACK API
+
+  \details
+  getrs_invdiag inverts the diagonal blocks of the triangular factors L
+  and U computed by getrf, once, so that every later solve with
+  getrs_with_invdiag is done with matrix-matrix products only.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the factors L and U from getrf on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  invD
+           pointer to an array on the GPU of the size given by
+           getrs_invdiag_size. On exit, the inverted diagonal blocks.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sgetrs_invdiag(rocsolver_handle handle, rocsolver_int n,
+                         const float *A, rocsolver_int lda, float *invD);
+
+/*! \brief LAPACK API
+
+  \details
+  getrs_invdiag inverts the diagonal blocks of the triangular factors L
+  and U computed by getrf, once, so that every later solve with
+  getrs_with_invdiag is done with matrix-matrix products only.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the factors L and U from getrf on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  invD
+           pointer to an array on the GPU of the size given by
+           getrs_invdiag_size. On exit, the inverted diagonal blocks.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dgetrs_invdiag(rocsolver_handle handle, rocsolver_int n,
+                         const double *A, rocsolver_int lda, double *invD);
+
+/*! \brief LAPACK API
+
+  \details
+  getrs_with_invdiag solves a system of linear equations
+     A * X = B  or  A**T * X = B
+  with a general N-by-N matrix A as getrs does, using the LU factorization
+  computed by getrf and the inverted diagonal blocks computed by
+  getrs_invdiag. It pays off when many systems are solved with the same
+  factors.
+
+  @param[in]
+  trans
+           Specifies the form of the system of equations:
+           = 'N':  A * X = B     (No transpose)
+           = 'T':  A**T * X = B  (Transpose)
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in]
+  A
+           pointer storing matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  ipiv
+           The pivot indices from getrf; for 1<=i<=n, row i of the
+           matrix was interchanged with row ipiv(i). Assumes one-based indices!
+
+  @param[in]
+  invD
+           pointer storing the inverted diagonal blocks from getrs_invdiag
+           on the GPU.
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU., dimension (ldb,nrhs)
+           On entry, the right hand side matrix B.
+           On exit, the solution matrix X.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_sgetrs_with_invdiag(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int n,
+    rocsolver_int nrhs, const float *A, rocsolver_int lda,
+    const rocsolver_int *ipiv, const float *invD, float *B, rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  getrs_with_invdiag solves a system of linear equations
+     A * X = B  or  A**T * X = B
+  with a general N-by-N matrix A as getrs does, using the LU factorization
+  computed by getrf and the inverted diagonal blocks computed by
+  getrs_invdiag. It pays off when many systems are solved with the same
+  factors.
+
+  @param[in]
+  trans
+           Specifies the form of the system of equations:
+           = 'N':  A * X = B     (No transpose)
+           = 'T':  A**T * X = B  (Transpose)
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in]
+  A
+           pointer storing matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  ipiv
+           The pivot indices from getrf; for 1<=i<=n, row i of the
+           matrix was interchanged with row ipiv(i). Assumes one-based indices!
+
+  @param[in]
+  invD
+           pointer storing the inverted diagonal blocks from getrs_invdiag
+           on the GPU.
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU., dimension (ldb,nrhs)
+           On entry, the right hand side matrix B.
+           On exit, the solution matrix X.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dgetrs_with_invdiag(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int n,
+    rocsolver_int nrhs, const double *A, rocsolver_int lda,
+    const rocsolver_int *ipiv, const double *invD, double *B,
+    rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  lu_plan_create allocates a plan for the repeated solution of systems of
+  linear equations with one general N-by-N matrix: the plan owns the LU
+  factors, the pivots, the workspace and the constants on the GPU, so
+  that lu_plan_solve neither allocates nor synchronizes.
+
+  @param[in]
+  precision
+           rocblas_precision_single or rocblas_precision_double.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides per solve the workspace is
+           sized for. nrhs >= 0.
+
+  @param[out]
+  plan
+           pointer to the new plan on the host.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_lu_plan_create(rocsolver_handle handle,
+                         rocsolver_precision precision, rocsolver_int n,
+                         rocsolver_int nrhs, rocsolver_lu_plan *plan);
+
+/*! \brief LAPACK API
+
+  \details
+  lu_plan_destroy frees a plan created by lu_plan_create.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_lu_plan_destroy(rocsolver_lu_plan plan);
+
+/*! \brief LAPACK API
+
+  \details
+  lu_plan_factor computes the LU factorization of a general N-by-N
+  matrix A, as getrf does, into the plan. A itself is not modified. The
+  pivots and the inverted diagonal blocks of the factors are prepared for
+  all later calls to lu_plan_solve.
+
+  @param[in]
+  plan
+           plan created by lu_plan_create for this precision.
+
+  @param[in]
+  A
+           pointer storing matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_slu_plan_factor(
+    rocsolver_lu_plan plan, const float *A, rocsolver_int lda);
+
+/*! \brief LAPACK API
+
+  \details
+  lu_plan_factor computes the LU factorization of a general N-by-N
+  matrix A, as getrf does, into the plan. A itself is not modified. The
+  pivots and the inverted diagonal blocks of the factors are prepared for
+  all later calls to lu_plan_solve.
+
+  @param[in]
+  plan
+           plan created by lu_plan_create for this precision.
+
+  @param[in]
+  A
+           pointer storing matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dlu_plan_factor(
+    rocsolver_lu_plan plan, const double *A, rocsolver_int lda);
+
+/*! \brief LAPACK API
+
+  \details
+  lu_plan_factor_equilibrated computes the LU factorization of the
+  equilibrated matrix diag(r) * A * diag(c), with A a general N-by-N matrix,
+  into the plan. The scaling is applied while A is copied into the plan, so
+  it takes no extra pass over the matrix. Later calls to lu_plan_solve
+  return the solution of the system with the original matrix A.
+  r and c are typically computed by geequ.
+
+  @param[in]
+  plan
+           plan created by lu_plan_create for this precision.
+
+  @param[in]
+  A
+           pointer storing matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  r
+           pointer to the N row scale factors on the GPU, or NULL to leave
+           the rows unscaled.
+
+  @param[in]
+  c
+           pointer to the N column scale factors on the GPU, or NULL to
+           leave the columns unscaled.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_slu_plan_factor_equilibrated(
+    rocsolver_lu_plan plan, const float *A, rocsolver_int lda, const float *r,
+    const float *c);
+
+/*! \brief LAPACK API
+
+  \details
+  lu_plan_factor_equilibrated computes the LU factorization of the
+  equilibrated matrix diag(r) * A * diag(c), with A a general N-by-N matrix,
+  into the plan. The scaling is applied while A is copied into the plan, so
+  it takes no extra pass over the matrix. Later calls to lu_plan_solve
+  return the solution of the system with the original matrix A.
+  r and c are typically computed by geequ.
+
+  @param[in]
+  plan
+           plan created by lu_plan_create for this precision.
+
+  @param[in]
+  A
+           pointer storing matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  r
+           pointer to the N row scale factors on the GPU, or NULL to leave
+           the rows unscaled.
+
+  @param[in]
+  c
+           pointer to the N column scale factors on the GPU, or NULL to
+           leave the columns unscaled.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dlu_plan_factor_equilibrated(
+    rocsolver_lu_plan plan, const double *A, rocsolver_int lda, const double *r,
+    const double *c);
+
+/*! \brief LAPACK API
+
+  \details
+  lu_plan_solve solves a system of linear equations
+     A * X = B  or  A**T * X = B
+  with the factorization held by the plan. The arguments are not
+  validated against the matrix again and no memory is allocated unless
+  nrhs exceeds the number given to lu_plan_create.
+
+  @param[in]
+  plan
+           plan factored by lu_plan_factor.
+
+  @param[in]
+  trans
+           Specifies the form of the system of equations:
+           = 'N':  A * X = B     (No transpose)
+           = 'T':  A**T * X = B  (Transpose)
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU., dimension (ldb,nrhs)
+           On entry, the right hand side matrix B.
+           On exit, the solution matrix X.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_slu_plan_solve(rocsolver_lu_plan plan, rocsolver_operation trans,
+                         rocsolver_int nrhs, float *B, rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  lu_plan_solve solves a system of linear equations
+     A * X = B  or  A**T * X = B
+  with the factorization held by the plan. The arguments are not
+  validated against the matrix again and no memory is allocated unless
+  nrhs exceeds the number given to lu_plan_create.
+
+  @param[in]
+  plan
+           plan factored by lu_plan_factor.
+
+  @param[in]
+  trans
+           Specifies the form of the system of equations:
+           = 'N':  A * X = B     (No transpose)
+           = 'T':  A**T * X = B  (Transpose)
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU., dimension (ldb,nrhs)
+           On entry, the right hand side matrix B.
+           On exit, the solution matrix X.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dlu_plan_solve(rocsolver_lu_plan plan, rocsolver_operation trans,
+                         rocsolver_int nrhs, double *B, rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  gesv computes the solution to a system of linear equations
+     A * X = B
+  with a general N-by-N matrix A. The LU factorization of A is computed
+  as in getrf and then used to solve the system as in getrs.
+
+  Factorization and solve are enqueued on the handle's stream without
+  intermediate host synchronizations and share one small device buffer.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[inout]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the matrix A. On exit, the factors L and U from the
+           factorization A = P*L*U; the unit diagonal elements of L are not
+           stored.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  ipiv
+           pointer storing pivots on the GPU. Dimension n.
+           The pivot indices; for 1<=i<=n, row i of the matrix was
+           interchanged with row ipiv(i). One-based indices!
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU., dimension (ldb,nrhs)
+           On entry, the right hand side matrix B.
+           On exit, the solution matrix X. Not meaningful if A is singular.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_sgesv(
+    rocsolver_handle handle, rocsolver_int n, rocsolver_int nrhs, float *A,
+    rocsolver_int lda, rocsolver_int *ipiv, float *B, rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  gesv computes the solution to a system of linear equations
+     A * X = B
+  with a general N-by-N matrix A. The LU factorization of A is computed
+  as in getrf and then used to solve the system as in getrs.
+
+  Factorization and solve are enqueued on the handle's stream without
+  intermediate host synchronizations and share one small device buffer.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[inout]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the matrix A. On exit, the factors L and U from the
+           factorization A = P*L*U; the unit diagonal elements of L are not
+           stored.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  ipiv
+           pointer storing pivots on the GPU. Dimension n.
+           The pivot indices; for 1<=i<=n, row i of the matrix was
+           interchanged with row ipiv(i). One-based indices!
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU., dimension (ldb,nrhs)
+           On entry, the right hand side matrix B.
+           On exit, the solution matrix X. Not meaningful if A is singular.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dgesv(
+    rocsolver_handle handle, rocsolver_int n, rocsolver_int nrhs, double *A,
+    rocsolver_int lda, rocsolver_int *ipiv, double *B, rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  getri computes the inverse of a matrix using the LU factorization
+  computed by getrf.
+
+  This method inverts U and then computes inv(A) by solving the system
+  inv(A)*L = inv(U) for inv(A). Both steps are blocked and done with
+  trsm, gemm and batched trtri; the column interchanges are applied on the
+  device.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[inout]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the factors L and U from the factorization
+           A = P*L*U as computed by getrf.
+           On exit, the inverse of the original matrix A.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  ipiv
+           The pivot indices from getrf; for 1<=i<=n, row i of the
+           matrix was interchanged with row ipiv(i). Assumes one-based indices!
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_sgetri(rocsolver_handle handle,
+                                                   rocsolver_int n, float *A,
+                                                   rocsolver_int lda,
+                                                   const rocsolver_int *ipiv);
+
+/*! \brief LAPACK API
+
+  \details
+  getri computes the inverse of a matrix using the LU factorization
+  computed by getrf.
+
+  This method inverts U and then computes inv(A) by solving the system
+  inv(A)*L = inv(U) for inv(A). Both steps are blocked and done with
+  trsm, gemm and batched trtri; the column interchanges are applied on the
+  device.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[inout]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the factors L and U from the factorization
+           A = P*L*U as computed by getrf.
+           On exit, the inverse of the original matrix A.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  ipiv
+           The pivot indices from getrf; for 1<=i<=n, row i of the
+           matrix was interchanged with row ipiv(i). Assumes one-based indices!
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dgetri(rocsolver_handle handle,
+                                                   rocsolver_int n, double *A,
+                                                   rocsolver_int lda,
+                                                   const rocsolver_int *ipiv);
+
+/*! \brief LAPACK API
+
+  \details
+  gecon estimates the reciprocal of the condition number of a general
+  N-by-N matrix A, in the 1-norm or the infinity-norm, from its LU
+  factorization computed by getrf:
+     rcond = 1 / (norm(A) * norm(inv(A)))
+  The norm of inv(A) is estimated on the GPU with triangular solves; the
+  result is left in device memory without synchronizing with the host.
+
+  @param[in]
+  norm
+           rocsolver_norm_one or rocsolver_norm_inf.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the factors L and U from getrf on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  anorm
+           pointer to the norm of the original matrix A on the GPU, in
+           the norm given by norm.
+
+  @param[out]
+  rcond
+           pointer to the reciprocal condition number on the GPU.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sgecon(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_int n, const float *A, rocsolver_int lda,
+                 const float *anorm, float *rcond);
+
+/*! \brief LAPACK API
+
+  \details
+  gecon estimates the reciprocal of the condition number of a general
+  N-by-N matrix A, in the 1-norm or the infinity-norm, from its LU
+  factorization computed by getrf:
+     rcond = 1 / (norm(A) * norm(inv(A)))
+  The norm of inv(A) is estimated on the GPU with triangular solves; the
+  result is left in device memory without synchronizing with the host.
+
+  @param[in]
+  norm
+           rocsolver_norm_one or rocsolver_norm_inf.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the factors L and U from getrf on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  anorm
+           pointer to the norm of the original matrix A on the GPU, in
+           the norm given by norm.
+
+  @param[out]
+  rcond
+           pointer to the reciprocal condition number on the GPU.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dgecon(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_int n, const double *A, rocsolver_int lda,
+                 const double *anorm, double *rcond);
+
+/*! \brief LAPACK API
+
+  \details
+  gerfs improves the computed solution X of a system of linear equations
+     A * X = B  or  A**T * X = B
+  with a general N-by-N matrix A and its LU factorization computed by
+  getrf, by iterative refinement, and gives error bounds for it.
+  The residuals are computed with gemm (gemv for a single right hand side)
+  and the corrections solved with the existing factors, for all right hand
+  sides together; each of them stops being refined on the GPU once its
+  backward error stops decreasing. Everything is computed in device memory
+  without synchronizing with the host.
+
+  @param[in]
+  trans
+           Specifies the form of the system of equations:
+           = 'N':  A * X = B     (No transpose)
+           = 'T':  A**T * X = B  (Transpose)
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrices B and X.  nrhs >= 0.
+
+  @param[in]
+  A
+           pointer storing the original matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  AF
+           pointer storing the factors L and U from getrf on the GPU.
+
+  @param[in]
+  ldaf
+           The leading dimension of the array AF.  ldaf >= max(1,n).
+
+  @param[in]
+  ipiv
+           The pivot indices from getrf. Assumes one-based indices!
+
+  @param[in]
+  B
+           pointer storing the right hand side matrix B on the GPU.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,n).
+
+  @param[in,out]
+  X
+           pointer storing matrix X on the GPU, dimension (ldx,nrhs)
+           On entry, the solution matrix X, as computed by getrs.
+           On exit, the improved solution matrix X.
+
+  @param[in]
+  ldx
+           The leading dimension of the array X.  ldx >= max(1,n).
+
+  @param[out]
+  ferr
+           pointer to the nrhs estimated forward error bounds on the GPU:
+           a bound on the largest element of the error of each solution
+           vector relative to its largest element.
+
+  @param[out]
+  berr
+           pointer to the nrhs componentwise relative backward errors on
+           the GPU: the smallest relative change in any element of A or B
+           that makes each solution vector an exact solution.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_sgerfs(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int n,
+    rocsolver_int nrhs, const float *A, rocsolver_int lda, const float *AF,
+    rocsolver_int ldaf, const rocsolver_int *ipiv, const float *B,
+    rocsolver_int ldb, float *X, rocsolver_int ldx, float *ferr, float *berr);
+
+/*! \brief LAPACK API
+
+  \details
+  gerfs improves the computed solution X of a system of linear equations
+     A * X = B  or  A**T * X = B
+  with a general N-by-N matrix A and its LU factorization computed by
+  getrf, by iterative refinement, and gives error bounds for it.
+  The residuals are computed with gemm (gemv for a single right hand side)
+  and the corrections solved with the existing factors, for all right hand
+  sides together; each of them stops being refined on the GPU once its
+  backward error stops decreasing. Everything is computed in device memory
+  without synchronizing with the host.
+
+  @param[in]
+  trans
+           Specifies the form of the system of equations:
+           = 'N':  A * X = B     (No transpose)
+           = 'T':  A**T * X = B  (Transpose)
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrices B and X.  nrhs >= 0.
+
+  @param[in]
+  A
+           pointer storing the original matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  AF
+           pointer storing the factors L and U from getrf on the GPU.
+
+  @param[in]
+  ldaf
+           The leading dimension of the array AF.  ldaf >= max(1,n).
+
+  @param[in]
+  ipiv
+           The pivot indices from getrf. Assumes one-based indices!
+
+  @param[in]
+  B
+           pointer storing the right hand side matrix B on the GPU.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,n).
+
+  @param[in,out]
+  X
+           pointer storing matrix X on the GPU, dimension (ldx,nrhs)
+           On entry, the solution matrix X, as computed by getrs.
+           On exit, the improved solution matrix X.
+
+  @param[in]
+  ldx
+           The leading dimension of the array X.  ldx >= max(1,n).
+
+  @param[out]
+  ferr
+           pointer to the nrhs estimated forward error bounds on the GPU:
+           a bound on the largest element of the error of each solution
+           vector relative to its largest element.
+
+  @param[out]
+  berr
+           pointer to the nrhs componentwise relative backward errors on
+           the GPU: the smallest relative change in any element of A or B
+           that makes each solution vector an exact solution.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dgerfs(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int n,
+    rocsolver_int nrhs, const double *A, rocsolver_int lda, const double *AF,
+    rocsolver_int ldaf, const rocsolver_int *ipiv, const double *B,
+    rocsolver_int ldb, double *X, rocsolver_int ldx, double *ferr,
+    double *berr);
+
+/*! \brief LAPACK API
+
+  \details
+  lange computes the 1-norm, the infinity-norm, the largest absolute
+  value of an element or the Frobenius norm of a general M-by-N matrix A.
+  The result is computed on the GPU by a reduction over the columns (or
+  the rows for the infinity-norm) followed by a reduction of the partial
+  results, and is left in device memory.
+
+  @param[in]
+  norm
+           rocsolver_norm_one (maximum column sum), rocsolver_norm_inf
+           (maximum row sum), rocsolver_norm_max (largest absolute value)
+           or rocsolver_norm_frobenius.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  M >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[out]
+  result
+           pointer to the norm on the GPU.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_slange(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_int m, rocsolver_int n, const float *A,
+                 rocsolver_int lda, float *result);
+
+/*! \brief LAPACK API
+
+  \details
+  lange_strided_batched computes the 1-norm, the infinity-norm, the largest
+  absolute value of an element or the Frobenius norm of a general M-by-N
+  matrix A. This is done for each matrix A_b = A + b*strideA of a batch of
+  batch_count matrices, with one norm per matrix.
+  The result is computed on the GPU by a reduction over the columns (or
+  the rows for the infinity-norm) followed by a reduction of the partial
+  results, and is left in device memory.
+
+  @param[in]
+  norm
+           rocsolver_norm_one (maximum column sum), rocsolver_norm_inf
+           (maximum row sum), rocsolver_norm_max (largest absolute value)
+           or rocsolver_norm_frobenius.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  M >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrices A_b on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[in]
+  strideA
+           stride from the start of one matrix A to the next one.
+
+  @param[out]
+  result
+           pointer to the batch_count norms on the GPU.
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_slange_strided_batched(rocsolver_handle handle,
+                                 rocsolver_norm_type norm, rocsolver_int m,
+                                 rocsolver_int n, const float *A,
+                                 rocsolver_int lda, rocsolver_int strideA,
+                                 float *result, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  lange computes the 1-norm, the infinity-norm, the largest absolute
+  value of an element or the Frobenius norm of a general M-by-N matrix A.
+  The result is computed on the GPU by a reduction over the columns (or
+  the rows for the infinity-norm) followed by a reduction of the partial
+  results, and is left in device memory.
+
+  @param[in]
+  norm
+           rocsolver_norm_one (maximum column sum), rocsolver_norm_inf
+           (maximum row sum), rocsolver_norm_max (largest absolute value)
+           or rocsolver_norm_frobenius.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  M >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[out]
+  result
+           pointer to the norm on the GPU.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dlange(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_int m, rocsolver_int n, const double *A,
+                 rocsolver_int lda, double *result);
+
+/*! \brief LAPACK API
+
+  \details
+  lange_strided_batched computes the 1-norm, the infinity-norm, the largest
+  absolute value of an element or the Frobenius norm of a general M-by-N
+  matrix A. This is done for each matrix A_b = A + b*strideA of a batch of
+  batch_count matrices, with one norm per matrix.
+  The result is computed on the GPU by a reduction over the columns (or
+  the rows for the infinity-norm) followed by a reduction of the partial
+  results, and is left in device memory.
+
+  @param[in]
+  norm
+           rocsolver_norm_one (maximum column sum), rocsolver_norm_inf
+           (maximum row sum), rocsolver_norm_max (largest absolute value)
+           or rocsolver_norm_frobenius.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  M >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrices A_b on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[in]
+  strideA
+           stride from the start of one matrix A to the next one.
+
+  @param[out]
+  result
+           pointer to the batch_count norms on the GPU.
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dlange_strided_batched(rocsolver_handle handle,
+                                 rocsolver_norm_type norm, rocsolver_int m,
+                                 rocsolver_int n, const double *A,
+                                 rocsolver_int lda, rocsolver_int strideA,
+                                 double *result, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  lansy computes the 1-norm, the infinity-norm, the largest absolute
+  value of an element or the Frobenius norm of a symmetric N-by-N matrix A,
+  of which only the triangle uplo is referenced. The 1-norm and the
+  infinity-norm of a symmetric matrix are the same.
+  The result is computed on the GPU by a reduction over the columns (or
+  the rows for the infinity-norm) followed by a reduction of the partial
+  results, and is left in device memory.
+
+  @param[in]
+  norm
+           rocsolver_norm_one (maximum column sum), rocsolver_norm_inf
+           (maximum row sum), rocsolver_norm_max (largest absolute value)
+           or rocsolver_norm_frobenius.
+
+  @param[in]
+  uplo
+           rocsolver_fill_upper or rocsolver_fill_lower: the triangle of A
+           that is stored.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  result
+           pointer to the norm on the GPU.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_slansy(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_fill uplo, rocsolver_int n, const float *A,
+                 rocsolver_int lda, float *result);
+
+/*! \brief LAPACK API
+
+  \details
+  lansy_strided_batched computes the 1-norm, the infinity-norm, the largest
+  absolute value of an element or the Frobenius norm of a symmetric N-by-N
+  matrix A, of which only the triangle uplo is referenced. The 1-norm and
+  the infinity-norm of a symmetric matrix are the same. This is done for
+  each matrix A_b = A + b*strideA of a batch of batch_count matrices, with
+  one norm per matrix.
+  The result is computed on the GPU by a reduction over the columns (or
+  the rows for the infinity-norm) followed by a reduction of the partial
+  results, and is left in device memory.
+
+  @param[in]
+  norm
+           rocsolver_norm_one (maximum column sum), rocsolver_norm_inf
+           (maximum row sum), rocsolver_norm_max (largest absolute value)
+           or rocsolver_norm_frobenius.
+
+  @param[in]
+  uplo
+           rocsolver_fill_upper or rocsolver_fill_lower: the triangle of A
+           that is stored.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrices A_b on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  strideA
+           stride from the start of one matrix A to the next one.
+
+  @param[out]
+  result
+           pointer to the batch_count norms on the GPU.
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_slansy_strided_batched(rocsolver_handle handle,
+                                 rocsolver_norm_type norm, rocsolver_fill uplo,
+                                 rocsolver_int n, const float *A,
+                                 rocsolver_int lda, rocsolver_int strideA,
+                                 float *result, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  lansy computes the 1-norm, the infinity-norm, the largest absolute
+  value of an element or the Frobenius norm of a symmetric N-by-N matrix A,
+  of which only the triangle uplo is referenced. The 1-norm and the
+  infinity-norm of a symmetric matrix are the same.
+  The result is computed on the GPU by a reduction over the columns (or
+  the rows for the infinity-norm) followed by a reduction of the partial
+  results, and is left in device memory.
+
+  @param[in]
+  norm
+           rocsolver_norm_one (maximum column sum), rocsolver_norm_inf
+           (maximum row sum), rocsolver_norm_max (largest absolute value)
+           or rocsolver_norm_frobenius.
+
+  @param[in]
+  uplo
+           rocsolver_fill_upper or rocsolver_fill_lower: the triangle of A
+           that is stored.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  result
+           pointer to the norm on the GPU.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dlansy(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_fill uplo, rocsolver_int n, const double *A,
+                 rocsolver_int lda, double *result);
+
+/*! \brief LAPACK API
+
+  \details
+  lansy_strided_batched computes the 1-norm, the infinity-norm, the largest
+  absolute value of an element or the Frobenius norm of a symmetric N-by-N
+  matrix A, of which only the triangle uplo is referenced. The 1-norm and
+  the infinity-norm of a symmetric matrix are the same. This is done for
+  each matrix A_b = A + b*strideA of a batch of batch_count matrices, with
+  one norm per matrix.
+  The result is computed on the GPU by a reduction over the columns (or
+  the rows for the infinity-norm) followed by a reduction of the partial
+  results, and is left in device memory.
+
+  @param[in]
+  norm
+           rocsolver_norm_one (maximum column sum), rocsolver_norm_inf
+           (maximum row sum), rocsolver_norm_max (largest absolute value)
+           or rocsolver_norm_frobenius.
+
+  @param[in]
+  uplo
+           rocsolver_fill_upper or rocsolver_fill_lower: the triangle of A
+           that is stored.
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrices A_b on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[in]
+  strideA
+           stride from the start of one matrix A to the next one.
+
+  @param[out]
+  result
+           pointer to the batch_count norms on the GPU.
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dlansy_strided_batched(rocsolver_handle handle,
+                                 rocsolver_norm_type norm, rocsolver_fill uplo,
+                                 rocsolver_int n, const double *A,
+                                 rocsolver_int lda, rocsolver_int strideA,
+                                 double *result, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  lantr computes the 1-norm, the infinity-norm, the largest absolute
+  value of an element or the Frobenius norm of an upper or lower
+  trapezoidal M-by-N matrix A, such as the triangular factors of getrf or
+  potrf.
+  The result is computed on the GPU by a reduction over the columns (or
+  the rows for the infinity-norm) followed by a reduction of the partial
+  results, and is left in device memory.
+
+  @param[in]
+  norm
+           rocsolver_norm_one (maximum column sum), rocsolver_norm_inf
+           (maximum row sum), rocsolver_norm_max (largest absolute value)
+           or rocsolver_norm_frobenius.
+
+  @param[in]
+  uplo
+           rocsolver_fill_upper or rocsolver_fill_lower: A is upper or
+           lower trapezoidal.
+
+  @param[in]
+  diag
+           rocsolver_diagonal_unit if A has a unit diagonal that is not
+           stored, rocsolver_diagonal_non_unit otherwise.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  M >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[out]
+  result
+           pointer to the norm on the GPU.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_slantr(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_fill uplo, rocsolver_diagonal diag, rocsolver_int m,
+                 rocsolver_int n, const float *A, rocsolver_int lda,
+                 float *result);
+
+/*! \brief LAPACK API
+
+  \details
+  lantr_strided_batched computes the 1-norm, the infinity-norm, the largest
+  absolute value of an element or the Frobenius norm of an upper or lower
+  trapezoidal M-by-N matrix A, such as the triangular factors of getrf or
+  potrf. This is done for each matrix A_b = A + b*strideA of a batch of
+  batch_count matrices, with one norm per matrix.
+  The result is computed on the GPU by a reduction over the columns (or
+  the rows for the infinity-norm) followed by a reduction of the partial
+  results, and is left in device memory.
+
+  @param[in]
+  norm
+           rocsolver_norm_one (maximum column sum), rocsolver_norm_inf
+           (maximum row sum), rocsolver_norm_max (largest absolute value)
+           or rocsolver_norm_frobenius.
+
+  @param[in]
+  uplo
+           rocsolver_fill_upper or rocsolver_fill_lower: A is upper or
+           lower trapezoidal.
+
+  @param[in]
+  diag
+           rocsolver_diagonal_unit if A has a unit diagonal that is not
+           stored, rocsolver_diagonal_non_unit otherwise.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  M >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrices A_b on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[in]
+  strideA
+           stride from the start of one matrix A to the next one.
+
+  @param[out]
+  result
+           pointer to the batch_count norms on the GPU.
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_slantr_strided_batched(rocsolver_handle handle,
+                                 rocsolver_norm_type norm, rocsolver_fill uplo,
+                                 rocsolver_diagonal diag, rocsolver_int m,
+                                 rocsolver_int n, const float *A,
+                                 rocsolver_int lda, rocsolver_int strideA,
+                                 float *result, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  lantr computes the 1-norm, the infinity-norm, the largest absolute
+  value of an element or the Frobenius norm of an upper or lower
+  trapezoidal M-by-N matrix A, such as the triangular factors of getrf or
+  potrf.
+  The result is computed on the GPU by a reduction over the columns (or
+  the rows for the infinity-norm) followed by a reduction of the partial
+  results, and is left in device memory.
+
+  @param[in]
+  norm
+           rocsolver_norm_one (maximum column sum), rocsolver_norm_inf
+           (maximum row sum), rocsolver_norm_max (largest absolute value)
+           or rocsolver_norm_frobenius.
+
+  @param[in]
+  uplo
+           rocsolver_fill_upper or rocsolver_fill_lower: A is upper or
+           lower trapezoidal.
+
+  @param[in]
+  diag
+           rocsolver_diagonal_unit if A has a unit diagonal that is not
+           stored, rocsolver_diagonal_non_unit otherwise.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  M >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[out]
+  result
+           pointer to the norm on the GPU.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dlantr(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_fill uplo, rocsolver_diagonal diag, rocsolver_int m,
+                 rocsolver_int n, const double *A, rocsolver_int lda,
+                 double *result);
+
+/*! \brief LAPACK API
+
+  \details
+  lantr_strided_batched computes the 1-norm, the infinity-norm, the largest
+  absolute value of an element or the Frobenius norm of an upper or lower
+  trapezoidal M-by-N matrix A, such as the triangular factors of getrf or
+  potrf. This is done for each matrix A_b = A + b*strideA of a batch of
+  batch_count matrices, with one norm per matrix.
+  The result is computed on the GPU by a reduction over the columns (or
+  the rows for the infinity-norm) followed by a reduction of the partial
+  results, and is left in device memory.
+
+  @param[in]
+  norm
+           rocsolver_norm_one (maximum column sum), rocsolver_norm_inf
+           (maximum row sum), rocsolver_norm_max (largest absolute value)
+           or rocsolver_norm_frobenius.
+
+  @param[in]
+  uplo
+           rocsolver_fill_upper or rocsolver_fill_lower: A is upper or
+           lower trapezoidal.
+
+  @param[in]
+  diag
+           rocsolver_diagonal_unit if A has a unit diagonal that is not
+           stored, rocsolver_diagonal_non_unit otherwise.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  M >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrices A_b on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[in]
+  strideA
+           stride from the start of one matrix A to the next one.
+
+  @param[out]
+  result
+           pointer to the batch_count norms on the GPU.
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dlantr_strided_batched(rocsolver_handle handle,
+                                 rocsolver_norm_type norm, rocsolver_fill uplo,
+                                 rocsolver_diagonal diag, rocsolver_int m,
+                                 rocsolver_int n, const double *A,
+                                 rocsolver_int lda, rocsolver_int strideA,
+                                 double *result, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  geequ computes row and column scalings intended to equilibrate a
+  general M-by-N matrix A and reduce its condition number. r(i) is the
+  reciprocal of the largest absolute element of row i of A, and c(j) that
+  of column j of diag(r) * A, so that the largest element of every row and
+  column of diag(r) * A * diag(c) is one. The factors are restricted to
+  the range of safely representable numbers.
+  Everything is computed on the GPU and left in device memory. A row or
+  column of A that is exactly zero gets the scale factor one and makes
+  rowcnd or colcnd zero.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  M >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[out]
+  r
+           pointer to the M row scale factors on the GPU.
+
+  @param[out]
+  c
+           pointer to the N column scale factors on the GPU.
+
+  @param[out]
+  rowcnd
+           pointer on the GPU to the ratio of the smallest r(i) to the
+           largest r(i). If rowcnd >= 0.1 and amax is neither too large nor
+           too small, scaling by r is not worth it.
+
+  @param[out]
+  colcnd
+           pointer on the GPU to the ratio of the smallest c(j) to the
+           largest c(j). If colcnd >= 0.1, scaling by c is not worth it.
+
+  @param[out]
+  amax
+           pointer on the GPU to the largest absolute element of A.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sgeequ(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 const float *A, rocsolver_int lda, float *r, float *c,
+                 float *rowcnd, float *colcnd, float *amax);
+
+/*! \brief LAPACK API
+
+  \details
+  geequ computes row and column scalings intended to equilibrate a
+  general M-by-N matrix A and reduce its condition number. r(i) is the
+  reciprocal of the largest absolute element of row i of A, and c(j) that
+  of column j of diag(r) * A, so that the largest element of every row and
+  column of diag(r) * A * diag(c) is one. The factors are restricted to
+  the range of safely representable numbers.
+  Everything is computed on the GPU and left in device memory. A row or
+  column of A that is exactly zero gets the scale factor one and makes
+  rowcnd or colcnd zero.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  M >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  N >= 0.
+
+  @param[in]
+  A
+           pointer storing the matrix A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[out]
+  r
+           pointer to the M row scale factors on the GPU.
+
+  @param[out]
+  c
+           pointer to the N column scale factors on the GPU.
+
+  @param[out]
+  rowcnd
+           pointer on the GPU to the ratio of the smallest r(i) to the
+           largest r(i). If rowcnd >= 0.1 and amax is neither too large nor
+           too small, scaling by r is not worth it.
+
+  @param[out]
+  colcnd
+           pointer on the GPU to the ratio of the smallest c(j) to the
+           largest c(j). If colcnd >= 0.1, scaling by c is not worth it.
+
+  @param[out]
+  amax
+           pointer on the GPU to the largest absolute element of A.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dgeequ(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 const double *A, rocsolver_int lda, double *r, double *c,
+                 double *rowcnd, double *colcnd, double *amax);
+
+/*! \brief LAPACK API
+
+  \details
+  laqge equilibrates a general M-by-N matrix A with the row and column
+  scale factors r and c computed by geequ. Rows are scaled unless
+  rowcnd >= 0.1 and amax is neither too large nor too small, and columns
+  unless colcnd >= 0.1. The decision is taken on the GPU and returned in
+  equed.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  M >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  N >= 0.
+
+  @param[inout]
+  A
+           pointer storing the matrix A on the GPU. On exit, the
+           equilibrated matrix as given by equed.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[in]
+  r
+           pointer to the M row scale factors on the GPU.
+
+  @param[in]
+  c
+           pointer to the N column scale factors on the GPU.
+
+  @param[in]
+  rowcnd
+           pointer to the ratio of the row scale factors on the GPU.
+
+  @param[in]
+  colcnd
+           pointer to the ratio of the column scale factors on the GPU.
+
+  @param[in]
+  amax
+           pointer to the largest absolute element of A on the GPU.
+
+  @param[out]
+  equed
+           pointer on the GPU to the scaling applied: rocsolver_equed_none,
+           rocsolver_equed_row (diag(r) * A), rocsolver_equed_column
+           (A * diag(c)) or rocsolver_equed_both (diag(r) * A * diag(c)).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_slaqge(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 float *A, rocsolver_int lda, const float *r, const float *c,
+                 const float *rowcnd, const float *colcnd, const float *amax,
+                 rocsolver_equed *equed);
+
+/*! \brief LAPACK API
+
+  \details
+  laqge equilibrates a general M-by-N matrix A with the row and column
+  scale factors r and c computed by geequ. Rows are scaled unless
+  rowcnd >= 0.1 and amax is neither too large nor too small, and columns
+  unless colcnd >= 0.1. The decision is taken on the GPU and returned in
+  equed.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  M >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  N >= 0.
+
+  @param[inout]
+  A
+           pointer storing the matrix A on the GPU. On exit, the
+           equilibrated matrix as given by equed.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[in]
+  r
+           pointer to the M row scale factors on the GPU.
+
+  @param[in]
+  c
+           pointer to the N column scale factors on the GPU.
+
+  @param[in]
+  rowcnd
+           pointer to the ratio of the row scale factors on the GPU.
+
+  @param[in]
+  colcnd
+           pointer to the ratio of the column scale factors on the GPU.
+
+  @param[in]
+  amax
+           pointer to the largest absolute element of A on the GPU.
+
+  @param[out]
+  equed
+           pointer on the GPU to the scaling applied: rocsolver_equed_none,
+           rocsolver_equed_row (diag(r) * A), rocsolver_equed_column
+           (A * diag(c)) or rocsolver_equed_both (diag(r) * A * diag(c)).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dlaqge(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 double *A, rocsolver_int lda, const double *r, const double *c,
+                 const double *rowcnd, const double *colcnd, const double *amax,
+                 rocsolver_equed *equed);
+
+/*! \brief LAPACK API
+
+    \details
+    gbtrf computes an LU factorization of a general m-by-n band matrix A
+    with kl subdiagonals and ku superdiagonals, using partial pivoting with
+    row interchanges.
+
+    The factorization has the form
+       A = P * L * U
+    where P is a permutation matrix, L is lower triangular with unit
+    diagonal elements and at most kl elements below the diagonal in each
+    column, and U is upper triangular with kl+ku superdiagonals.
+
+    A is given in LAPACK band storage, so memory and work scale with the
+    bandwidth instead of with n.
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    m         rocsolver_int
+              the number of rows of the matrix A. m >= 0.
+    @param[in]
+    n         rocsolver_int
+              the number of colums of the matrix A. n >= 0.
+    @param[in]
+    kl        rocsolver_int
+              the number of subdiagonals within the band of A. kl >= 0.
+    @param[in]
+    ku        rocsolver_int
+              the number of superdiagonals within the band of A. ku >= 0.
+    @param[inout]
+    AB        pointer storing the band matrix on the GPU, dimension (ldab,n).
+              On entry, A(i,j) is stored in AB(kl+ku+1+i-j,j) for
+              max(1,j-ku)<=i<=min(m,j+kl); the first kl rows need not be
+              set. On exit, U is stored as an upper band matrix with kl+ku
+              superdiagonals in the first kl+ku+1 rows, and the multipliers
+              of L in the rows below.
+    @param[in]
+    ldab      rocsolver_int
+              specifies the leading dimension of AB. ldab >= 2*kl+ku+1.
+    @param[out]
+    ipiv      pointer storing pivots on the GPU. Dimension (min(m,n)).
+
+    This implementation will even upon encountering a singularity continue
+    and only in the end return an error code.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sgbtrf(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 rocsolver_int kl, rocsolver_int ku, float *AB,
+                 rocsolver_int ldab, rocsolver_int *ipiv);
+
+/*! \brief LAPACK API
+
+    \details
+    gbtrf computes an LU factorization of a general m-by-n band matrix A
+    with kl subdiagonals and ku superdiagonals, using partial pivoting with
+    row interchanges.
+
+    The factorization has the form
+       A = P * L * U
+    where P is a permutation matrix, L is lower triangular with unit
+    diagonal elements and at most kl elements below the diagonal in each
+    column, and U is upper triangular with kl+ku superdiagonals.
+
+    A is given in LAPACK band storage, so memory and work scale with the
+    bandwidth instead of with n.
+
+    @param[in]
+    handle    rocsolver_handle.
+              handle to the rocsolver library context queue.
+    @param[in]
+    m         rocsolver_int
+              the number of rows of the matrix A. m >= 0.
+    @param[in]
+    n         rocsolver_int
+              the number of colums of the matrix A. n >= 0.
+    @param[in]
+    kl        rocsolver_int
+              the number of subdiagonals within the band of A. kl >= 0.
+    @param[in]
+    ku        rocsolver_int
+              the number of superdiagonals within the band of A. ku >= 0.
+    @param[inout]
+    AB        pointer storing the band matrix on the GPU, dimension (ldab,n).
+              On entry, A(i,j) is stored in AB(kl+ku+1+i-j,j) for
+              max(1,j-ku)<=i<=min(m,j+kl); the first kl rows need not be
+              set. On exit, U is stored as an upper band matrix with kl+ku
+              superdiagonals in the first kl+ku+1 rows, and the multipliers
+              of L in the rows below.
+    @param[in]
+    ldab      rocsolver_int
+              specifies the leading dimension of AB. ldab >= 2*kl+ku+1.
+    @param[out]
+    ipiv      pointer storing pivots on the GPU. Dimension (min(m,n)).
+
+    This implementation will even upon encountering a singularity continue
+    and only in the end return an error code.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dgbtrf(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 rocsolver_int kl, rocsolver_int ku, double *AB,
+                 rocsolver_int ldab, rocsolver_int *ipiv);
+
+/*! \brief LAPACK API
+
+  \details
+  gbtrs solves a system of linear equations
+     A * X = B,  A**T * X = B,  or  A**H * X = B
+  with a general N-by-N band matrix A using the LU factorization computed
+  by gbtrf.
+
+  @param[in]
+  trans
+           Specifies the form of the system of equations:
+           = 'N':  A * X = B     (No transpose)
+           = 'T':  A**T * X = B  (Transpose)
+           = 'C':  A**H * X = B  (Conjugate transpose)
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  kl
+           The number of subdiagonals within the band of A.  kl >= 0.
+
+  @param[in]
+  ku
+           The number of superdiagonals within the band of A.  ku >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in]
+  AB
+           pointer storing the factors from gbtrf on the GPU.
+
+  @param[in]
+  ldab
+           The leading dimension of the array AB.  ldab >= 2*kl+ku+1.
+
+  @param[in]
+  ipiv
+           The pivot indices from gbtrf; for 1<=i<=n, row i of the
+           matrix was interchanged with row ipiv(i). Assumes one-based indices!
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU., dimension (ldb,nrhs)
+           On entry, the right hand side matrix B.
+           On exit, the solution matrix X.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_sgbtrs(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int n,
+    rocsolver_int kl, rocsolver_int ku, rocsolver_int nrhs, const float *AB,
+    rocsolver_int ldab, const rocsolver_int *ipiv, float *B, rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  gbtrs solves a system of linear equations
+     A * X = B,  A**T * X = B,  or  A**H * X = B
+  with a general N-by-N band matrix A using the LU factorization computed
+  by gbtrf.
+
+  @param[in]
+  trans
+           Specifies the form of the system of equations:
+           = 'N':  A * X = B     (No transpose)
+           = 'T':  A**T * X = B  (Transpose)
+           = 'C':  A**H * X = B  (Conjugate transpose)
+
+  @param[in]
+  n
+           The order of the matrix A.  N >= 0.
+
+  @param[in]
+  kl
+           The number of subdiagonals within the band of A.  kl >= 0.
+
+  @param[in]
+  ku
+           The number of superdiagonals within the band of A.  ku >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in]
+  AB
+           pointer storing the factors from gbtrf on the GPU.
+
+  @param[in]
+  ldab
+           The leading dimension of the array AB.  ldab >= 2*kl+ku+1.
+
+  @param[in]
+  ipiv
+           The pivot indices from gbtrf; for 1<=i<=n, row i of the
+           matrix was interchanged with row ipiv(i). Assumes one-based indices!
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU., dimension (ldb,nrhs)
+           On entry, the right hand side matrix B.
+           On exit, the solution matrix X.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dgbtrs(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int n,
+    rocsolver_int kl, rocsolver_int ku, rocsolver_int nrhs, const double *AB,
+    rocsolver_int ldab, const rocsolver_int *ipiv, double *B, rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  geqr2 computes a QR factorization of a general m-by-n matrix A:
+     A = Q * R
+  where Q is orthogonal and R is upper triangular (upper trapezoidal if
+  m < n). Q is represented as the product of min(m,n) elementary reflectors
+     Q = H(1) * H(2) * ... * H(k),  H(i) = I - tau(i) * v * v**T
+  with v(1:i-1) = 0 and v(i) = 1; v(i+1:m) is stored in A(i+1:m,i).
+
+  This is the unblocked Level 2 BLAS version of the algorithm.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the m-by-n matrix to be factored.
+           On exit, R on and above the diagonal and the reflectors below.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[out]
+  tau
+           pointer to the scalar factors of the reflectors on the GPU.
+           Dimension (min(m,n)).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sgeqr2(rocsolver_handle handle, rocsolver_int m,
+                 rocsolver_int n, float *A, rocsolver_int lda, float *tau);
+
+/*! \brief LAPACK API
+
+  \details
+  geqr2 computes a QR factorization of a general m-by-n matrix A:
+     A = Q * R
+  where Q is orthogonal and R is upper triangular (upper trapezoidal if
+  m < n). Q is represented as the product of min(m,n) elementary reflectors
+     Q = H(1) * H(2) * ... * H(k),  H(i) = I - tau(i) * v * v**T
+  with v(1:i-1) = 0 and v(i) = 1; v(i+1:m) is stored in A(i+1:m,i).
+
+  This is the unblocked Level 2 BLAS version of the algorithm.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the m-by-n matrix to be factored.
+           On exit, R on and above the diagonal and the reflectors below.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[out]
+  tau
+           pointer to the scalar factors of the reflectors on the GPU.
+           Dimension (min(m,n)).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dgeqr2(rocsolver_handle handle, rocsolver_int m,
+                 rocsolver_int n, double *A, rocsolver_int lda, double *tau);
+
+/*! \brief LAPACK API
+
+  \details
+  geqrf computes a QR factorization of a general m-by-n matrix A:
+     A = Q * R
+  where Q is orthogonal and R is upper triangular (upper trapezoidal if
+  m < n). Q is represented as the product of min(m,n) elementary reflectors
+     Q = H(1) * H(2) * ... * H(k),  H(i) = I - tau(i) * v * v**T
+  with v(1:i-1) = 0 and v(i) = 1; v(i+1:m) is stored in A(i+1:m,i).
+
+  This is the blocked version of the algorithm: every panel is factored
+  by geqr2 and its reflectors are applied to the trailing matrix at once
+  in compact WY form, with Level 3 BLAS.
+
+  Tall and skinny matrices (m at least 64 times n, n <= 256) are factored
+  instead by TSQR: row blocks are factored independently and their R
+  factors are merged along a reduction tree, so that the whole matrix is
+  read once. The reflectors above are then rebuilt from the resulting Q,
+  so the output is the same in either case.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the m-by-n matrix to be factored.
+           On exit, R on and above the diagonal and the reflectors below.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[out]
+  tau
+           pointer to the scalar factors of the reflectors on the GPU.
+           Dimension (min(m,n)).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sgeqrf(rocsolver_handle handle, rocsolver_int m,
+                 rocsolver_int n, float *A, rocsolver_int lda, float *tau);
+
+/*! \brief LAPACK API
+
+  \details
+  geqrf computes a QR factorization of a general m-by-n matrix A:
+     A = Q * R
+  where Q is orthogonal and R is upper triangular (upper trapezoidal if
+  m < n). Q is represented as the product of min(m,n) elementary reflectors
+     Q = H(1) * H(2) * ... * H(k),  H(i) = I - tau(i) * v * v**T
+  with v(1:i-1) = 0 and v(i) = 1; v(i+1:m) is stored in A(i+1:m,i).
+
+  This is the blocked version of the algorithm: every panel is factored
+  by geqr2 and its reflectors are applied to the trailing matrix at once
+  in compact WY form, with Level 3 BLAS.
+
+  Tall and skinny matrices (m at least 64 times n, n <= 256) are factored
+  instead by TSQR: row blocks are factored independently and their R
+  factors are merged along a reduction tree, so that the whole matrix is
+  read once. The reflectors above are then rebuilt from the resulting Q,
+  so the output is the same in either case.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the m-by-n matrix to be factored.
+           On exit, R on and above the diagonal and the reflectors below.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[out]
+  tau
+           pointer to the scalar factors of the reflectors on the GPU.
+           Dimension (min(m,n)).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dgeqrf(rocsolver_handle handle, rocsolver_int m,
+                 rocsolver_int n, double *A, rocsolver_int lda, double *tau);
+
+/*! \brief LAPACK API
+
+  \details
+  geqp3 computes a QR factorization with column pivoting of a general
+  m-by-n matrix A:
+     A * P = Q * R
+  where P is a permutation matrix, Q is orthogonal and R is upper
+  triangular (upper trapezoidal if m < n), with the magnitudes of its
+  diagonal entries in non-increasing order. Q is represented as in geqrf.
+  The number of diagonal entries of R above a tolerance relative to
+  |R(1,1)| is the numerical rank of A.
+
+  At step i, the column of largest norm in what is left of A to factor is
+  moved to column i. The column norms are downdated on the GPU as the
+  factorization proceeds and only recomputed where cancellation makes the
+  downdate inaccurate; the updates of a block of columns are applied to the
+  rest of the matrix with Level 3 BLAS, as in the LAPACK xlaqps.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the m-by-n matrix to be factored.
+           On exit, R on and above the diagonal and the reflectors below.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[out]
+  jpvt
+           pointer to the permutation on the GPU.  Dimension (n).
+           Column i of A * P is column jpvt(i) of A (one-based). All the
+           columns are free to be pivoted: jpvt is not read on entry.
+
+  @param[out]
+  tau
+           pointer to the scalar factors of the reflectors on the GPU.
+           Dimension (min(m,n)).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sgeqp3(rocsolver_handle handle, rocsolver_int m,
+                 rocsolver_int n, float *A, rocsolver_int lda,
+                 rocsolver_int *jpvt, float *tau);
+
+/*! \brief LAPACK API
+
+  \details
+  geqp3 computes a QR factorization with column pivoting of a general
+  m-by-n matrix A:
+     A * P = Q * R
+  where P is a permutation matrix, Q is orthogonal and R is upper
+  triangular (upper trapezoidal if m < n), with the magnitudes of its
+  diagonal entries in non-increasing order. Q is represented as in geqrf.
+  The number of diagonal entries of R above a tolerance relative to
+  |R(1,1)| is the numerical rank of A.
+
+  At step i, the column of largest norm in what is left of A to factor is
+  moved to column i. The column norms are downdated on the GPU as the
+  factorization proceeds and only recomputed where cancellation makes the
+  downdate inaccurate; the updates of a block of columns are applied to the
+  rest of the matrix with Level 3 BLAS, as in the LAPACK xlaqps.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the m-by-n matrix to be factored.
+           On exit, R on and above the diagonal and the reflectors below.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[out]
+  jpvt
+           pointer to the permutation on the GPU.  Dimension (n).
+           Column i of A * P is column jpvt(i) of A (one-based). All the
+           columns are free to be pivoted: jpvt is not read on entry.
+
+  @param[out]
+  tau
+           pointer to the scalar factors of the reflectors on the GPU.
+           Dimension (min(m,n)).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dgeqp3(rocsolver_handle handle, rocsolver_int m,
+                 rocsolver_int n, double *A, rocsolver_int lda,
+                 rocsolver_int *jpvt, double *tau);
+
+/*! \brief LAPACK API
+
+  \details
+  orgqr generates the m-by-n matrix Q with orthonormal columns, the first
+  n columns of the product of k elementary reflectors
+     Q = H(1) * H(2) * ... * H(k)
+  as returned by geqrf. The reflectors are applied in blocks with Level 3
+  BLAS.
+
+  @param[in]
+  m
+           The number of rows of the matrix Q.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix Q.  m >= n >= 0.
+
+  @param[in]
+  k
+           The number of elementary reflectors.  n >= k >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the reflectors from geqrf in its first k columns.
+           On exit, the m-by-n matrix Q.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[in]
+  tau
+           pointer to the scalar factors of the reflectors from geqrf on
+           the GPU.  Dimension (k).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sorgqr(rocsolver_handle handle, rocsolver_int m,
+                 rocsolver_int n, rocsolver_int k, float *A,
+                 rocsolver_int lda, const float *tau);
+
+/*! \brief LAPACK API
+
+  \details
+  orgqr generates the m-by-n matrix Q with orthonormal columns, the first
+  n columns of the product of k elementary reflectors
+     Q = H(1) * H(2) * ... * H(k)
+  as returned by geqrf. The reflectors are applied in blocks with Level 3
+  BLAS.
+
+  @param[in]
+  m
+           The number of rows of the matrix Q.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix Q.  m >= n >= 0.
+
+  @param[in]
+  k
+           The number of elementary reflectors.  n >= k >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the reflectors from geqrf in its first k columns.
+           On exit, the m-by-n matrix Q.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[in]
+  tau
+           pointer to the scalar factors of the reflectors from geqrf on
+           the GPU.  Dimension (k).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dorgqr(rocsolver_handle handle, rocsolver_int m,
+                 rocsolver_int n, rocsolver_int k, double *A,
+                 rocsolver_int lda, const double *tau);
+
+/*! \brief LAPACK API
+
+  \details
+  ormqr overwrites the general m-by-n matrix C with
+     Q * C,  Q**T * C,  C * Q  or  C * Q**T
+  where Q is the product of k elementary reflectors
+     Q = H(1) * H(2) * ... * H(k)
+  as returned by geqrf, without forming Q. The reflectors are applied in
+  blocks with Level 3 BLAS.
+
+  @param[in]
+  side
+           rocsolver_side_left: apply Q or Q**T from the left;
+           rocsolver_side_right: apply Q or Q**T from the right.
+
+  @param[in]
+  trans
+           rocsolver_operation_none: apply Q;
+           rocsolver_operation_transpose: apply Q**T.
+
+  @param[in]
+  m
+           The number of rows of the matrix C.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix C.  n >= 0.
+
+  @param[in]
+  k
+           The number of elementary reflectors.  If side is left,
+           m >= k >= 0; if side is right, n >= k >= 0.
+
+  @param[in]
+  A
+           pointer storing the reflectors from geqrf in the first k
+           columns of A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  If side is left,
+           lda >= max(1,m); if side is right, lda >= max(1,n).
+
+  @param[in]
+  tau
+           pointer to the scalar factors of the reflectors from geqrf on
+           the GPU.  Dimension (k).
+
+  @param[in,out]
+  C
+           pointer storing matrix C on the GPU.
+           On exit, C is overwritten by the product.
+
+  @param[in]
+  ldc
+           The leading dimension of the array C.  ldc >= max(1,m).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sormqr(rocsolver_handle handle, rocsolver_side side,
+                 rocsolver_operation trans, rocsolver_int m,
+                 rocsolver_int n, rocsolver_int k, const float *A,
+                 rocsolver_int lda, const float *tau, float *C,
+                 rocsolver_int ldc);
+
+/*! \brief LAPACK API
+
+  \details
+  ormqr overwrites the general m-by-n matrix C with
+     Q * C,  Q**T * C,  C * Q  or  C * Q**T
+  where Q is the product of k elementary reflectors
+     Q = H(1) * H(2) * ... * H(k)
+  as returned by geqrf, without forming Q. The reflectors are applied in
+  blocks with Level 3 BLAS.
+
+  @param[in]
+  side
+           rocsolver_side_left: apply Q or Q**T from the left;
+           rocsolver_side_right: apply Q or Q**T from the right.
+
+  @param[in]
+  trans
+           rocsolver_operation_none: apply Q;
+           rocsolver_operation_transpose: apply Q**T.
+
+  @param[in]
+  m
+           The number of rows of the matrix C.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix C.  n >= 0.
+
+  @param[in]
+  k
+           The number of elementary reflectors.  If side is left,
+           m >= k >= 0; if side is right, n >= k >= 0.
+
+  @param[in]
+  A
+           pointer storing the reflectors from geqrf in the first k
+           columns of A on the GPU.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  If side is left,
+           lda >= max(1,m); if side is right, lda >= max(1,n).
+
+  @param[in]
+  tau
+           pointer to the scalar factors of the reflectors from geqrf on
+           the GPU.  Dimension (k).
+
+  @param[in,out]
+  C
+           pointer storing matrix C on the GPU.
+           On exit, C is overwritten by the product.
+
+  @param[in]
+  ldc
+           The leading dimension of the array C.  ldc >= max(1,m).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dormqr(rocsolver_handle handle, rocsolver_side side,
+                 rocsolver_operation trans, rocsolver_int m,
+                 rocsolver_int n, rocsolver_int k, const double *A,
+                 rocsolver_int lda, const double *tau, double *C,
+                 rocsolver_int ldc);
+/*! \brief LAPACK API
+
+  \details
+  gels solves the overdetermined or underdetermined real linear system
+     op(A) * X = B,
+  where A is a general m-by-n matrix of full rank, using the QR or the LQ
+  factorization of A:
+  - with op(A) = A and m >= n, or op(A) = A**T and m < n, the least
+    squares solution that minimizes || B - op(A) * X ||;
+  - with op(A) = A and m < n, or op(A) = A**T and m >= n, the minimum
+    norm solution of the underdetermined system.
+  Problems with at most 1024 rows and 64 columns (after transposing A if
+  m < n) are solved by a single kernel; larger ones go through geqrf, ormqr
+  and trsm. The rank of A is not checked.
+
+  @param[in]
+  trans
+           rocsolver_operation_none: solve A * X = B;
+           rocsolver_operation_transpose: solve A**T * X = B.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  n >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On exit, A is overwritten by the factorization of geqrf if
+           m >= n, or of gelqf if m < n.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU, with max(m,n) rows.
+           On entry, the first m rows (n if trans is transpose) hold the
+           right hand sides. On exit, the first n rows (m if trans is
+           transpose) hold the solutions X.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,m,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sgels(rocsolver_handle handle, rocsolver_operation trans,
+                rocsolver_int m, rocsolver_int n, rocsolver_int nrhs,
+                float *A, rocsolver_int lda, float *B, rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  gels_strided_batched solves the overdetermined or underdetermined real
+  linear systems
+     op(A_b) * X_b = B_b,
+  where every A_b is a general m-by-n matrix of full rank, using the QR or
+  the LQ factorization of A_b:
+  - with op(A) = A and m >= n, or op(A) = A**T and m < n, the least
+    squares solutions that minimize || B_b - op(A_b) * X_b ||;
+  - with op(A) = A and m < n, or op(A) = A**T and m >= n, the minimum
+    norm solutions of the underdetermined systems.
+  Batches of problems with at most 1024 rows and 64 columns (after
+  transposing A if m < n) are solved by a single kernel with one workgroup
+  per problem; larger ones are solved one at a time through geqrf, ormqr
+  and trsm. The rank of A_b is not checked.
+
+  @param[in]
+  trans
+           rocsolver_operation_none: solve A * X = B;
+           rocsolver_operation_transpose: solve A**T * X = B.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  n >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in,out]
+  A
+           pointer storing the matrices A_b on the GPU.
+           On exit, the A_b are overwritten by the factorization of geqrf if
+           m >= n, or of gelqf if m < n.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[in]
+  strideA
+           stride from the start of one matrix A_b to the next one.
+
+  @param[in,out]
+  B
+           pointer storing the matrices B_b on the GPU, with max(m,n) rows.
+           On entry, the first m rows (n if trans is transpose) hold the
+           right hand sides. On exit, the first n rows (m if trans is
+           transpose) hold the solutions X_b.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,m,n).
+
+  @param[in]
+  strideB
+           stride from the start of one matrix B_b to the next one.
+
+  @param[in]
+  batch_count
+           number of problems in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_sgels_strided_batched(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int m,
+    rocsolver_int n, rocsolver_int nrhs, float *A, rocsolver_int lda,
+    rocsolver_int strideA, float *B, rocsolver_int ldb, rocsolver_int strideB,
+    rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  gels solves the overdetermined or underdetermined real linear system
+     op(A) * X = B,
+  where A is a general m-by-n matrix of full rank, using the QR or the LQ
+  factorization of A:
+  - with op(A) = A and m >= n, or op(A) = A**T and m < n, the least
+    squares solution that minimizes || B - op(A) * X ||;
+  - with op(A) = A and m < n, or op(A) = A**T and m >= n, the minimum
+    norm solution of the underdetermined system.
+  Problems with at most 1024 rows and 64 columns (after transposing A if
+  m < n) are solved by a single kernel; larger ones go through geqrf, ormqr
+  and trsm. The rank of A is not checked.
+
+  @param[in]
+  trans
+           rocsolver_operation_none: solve A * X = B;
+           rocsolver_operation_transpose: solve A**T * X = B.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  n >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On exit, A is overwritten by the factorization of geqrf if
+           m >= n, or of gelqf if m < n.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU, with max(m,n) rows.
+           On entry, the first m rows (n if trans is transpose) hold the
+           right hand sides. On exit, the first n rows (m if trans is
+           transpose) hold the solutions X.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,m,n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dgels(rocsolver_handle handle, rocsolver_operation trans,
+                rocsolver_int m, rocsolver_int n, rocsolver_int nrhs,
+                double *A, rocsolver_int lda, double *B, rocsolver_int ldb);
+
+/*! \brief LAPACK API
+
+  \details
+  gels_strided_batched solves the overdetermined or underdetermined real
+  linear systems
+     op(A_b) * X_b = B_b,
+  where every A_b is a general m-by-n matrix of full rank, using the QR or
+  the LQ factorization of A_b:
+  - with op(A) = A and m >= n, or op(A) = A**T and m < n, the least
+    squares solutions that minimize || B_b - op(A_b) * X_b ||;
+  - with op(A) = A and m < n, or op(A) = A**T and m >= n, the minimum
+    norm solutions of the underdetermined systems.
+  Batches of problems with at most 1024 rows and 64 columns (after
+  transposing A if m < n) are solved by a single kernel with one workgroup
+  per problem; larger ones are solved one at a time through geqrf, ormqr
+  and trsm. The rank of A_b is not checked.
+
+  @param[in]
+  trans
+           rocsolver_operation_none: solve A * X = B;
+           rocsolver_operation_transpose: solve A**T * X = B.
+
+  @param[in]
+  m
+           The number of rows of the matrix A.  m >= 0.
+
+  @param[in]
+  n
+           The number of columns of the matrix A.  n >= 0.
+
+  @param[in]
+  nrhs
+           The number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in,out]
+  A
+           pointer storing the matrices A_b on the GPU.
+           On exit, the A_b are overwritten by the factorization of geqrf if
+           m >= n, or of gelqf if m < n.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,m).
+
+  @param[in]
+  strideA
+           stride from the start of one matrix A_b to the next one.
+
+  @param[in,out]
+  B
+           pointer storing the matrices B_b on the GPU, with max(m,n) rows.
+           On entry, the first m rows (n if trans is transpose) hold the
+           right hand sides. On exit, the first n rows (m if trans is
+           transpose) hold the solutions X_b.
+
+  @param[in]
+  ldb
+           The leading dimension of the array B.  ldb >= max(1,m,n).
+
+  @param[in]
+  strideB
+           stride from the start of one matrix B_b to the next one.
+
+  @param[in]
+  batch_count
+           number of problems in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dgels_strided_batched(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int m,
+    rocsolver_int n, rocsolver_int nrhs, double *A, rocsolver_int lda,
+    rocsolver_int strideA, double *B, rocsolver_int ldb, rocsolver_int strideB,
+    rocsolver_int batch_count);
+/*! \brief LAPACK API
+
+  \details
+  syev computes the eigenvalues and, optionally, the eigenvectors of a
+  real symmetric n-by-n matrix A:
+     A = V * diag(W) * V**T
+  with V orthogonal. A is first reduced to a symmetric tridiagonal matrix
+  T = Q**T * A * Q in two stages: to band form with Level 3 BLAS (gemm),
+  then from band to tridiagonal form on the GPU. The eigenvalues alone are
+  found by bisection; the eigenvectors of T are computed by the implicit QL
+  iteration and multiplied by Q. The QL iteration runs in one workgroup and
+  is only meant for small n: for n > 256 the eigenvectors of T are computed
+  by divide and conquer, as in syevd.
+
+  @param[in]
+  evect
+           rocsolver_evect_none: compute the eigenvalues only;
+           rocsolver_evect_original: compute the eigenvectors too.
+
+  @param[in]
+  uplo
+           specifies whether the upper or lower triangular part of A is
+           given.
+
+  @param[in]
+  n
+           The order of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the symmetric matrix A; only the triangle given by uplo
+           is read. On exit, the orthonormal eigenvectors in the columns of
+           A if evect is rocsolver_evect_original (column i for W(i)),
+           otherwise A is destroyed.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  W
+           pointer to the eigenvalues on the GPU, in ascending order.
+           Dimension (n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_ssyev(rocsolver_handle handle, rocsolver_evect evect,
+                rocsolver_fill uplo, rocsolver_int n, float *A,
+                rocsolver_int lda, float *W);
+
+/*! \brief LAPACK API
+
+  \details
+  syev computes the eigenvalues and, optionally, the eigenvectors of a
+  real symmetric n-by-n matrix A:
+     A = V * diag(W) * V**T
+  with V orthogonal. A is first reduced to a symmetric tridiagonal matrix
+  T = Q**T * A * Q in two stages: to band form with Level 3 BLAS (gemm),
+  then from band to tridiagonal form on the GPU. The eigenvalues alone are
+  found by bisection; the eigenvectors of T are computed by the implicit QL
+  iteration and multiplied by Q. The QL iteration runs in one workgroup and
+  is only meant for small n: for n > 256 the eigenvectors of T are computed
+  by divide and conquer, as in syevd.
+
+  @param[in]
+  evect
+           rocsolver_evect_none: compute the eigenvalues only;
+           rocsolver_evect_original: compute the eigenvectors too.
+
+  @param[in]
+  uplo
+           specifies whether the upper or lower triangular part of A is
+           given.
+
+  @param[in]
+  n
+           The order of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the symmetric matrix A; only the triangle given by uplo
+           is read. On exit, the orthonormal eigenvectors in the columns of
+           A if evect is rocsolver_evect_original (column i for W(i)),
+           otherwise A is destroyed.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  W
+           pointer to the eigenvalues on the GPU, in ascending order.
+           Dimension (n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dsyev(rocsolver_handle handle, rocsolver_evect evect,
+                rocsolver_fill uplo, rocsolver_int n, double *A,
+                rocsolver_int lda, double *W);
+
+/*! \brief LAPACK API
+
+  \details
+  syevd computes the eigenvalues and, optionally, the eigenvectors of a
+  real symmetric n-by-n matrix A:
+     A = V * diag(W) * V**T
+  with V orthogonal. A is first reduced to a symmetric tridiagonal matrix
+  T = Q**T * A * Q in two stages: to band form with Level 3 BLAS (gemm),
+  then from band to tridiagonal form on the GPU. The eigenvalues alone are
+  found by bisection; the eigenvectors of T are computed by divide and
+  conquer, with the eigenvectors of the merged halves updated by gemm, and
+  multiplied by Q.
+
+  @param[in]
+  evect
+           rocsolver_evect_none: compute the eigenvalues only;
+           rocsolver_evect_original: compute the eigenvectors too.
+
+  @param[in]
+  uplo
+           specifies whether the upper or lower triangular part of A is
+           given.
+
+  @param[in]
+  n
+           The order of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the symmetric matrix A; only the triangle given by uplo
+           is read. On exit, the orthonormal eigenvectors in the columns of
+           A if evect is rocsolver_evect_original (column i for W(i)),
+           otherwise A is destroyed.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  W
+           pointer to the eigenvalues on the GPU, in ascending order.
+           Dimension (n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_ssyevd(rocsolver_handle handle, rocsolver_evect evect,
+                 rocsolver_fill uplo, rocsolver_int n, float *A,
+                 rocsolver_int lda, float *W);
+
+/*! \brief LAPACK API
+
+  \details
+  syevd computes the eigenvalues and, optionally, the eigenvectors of a
+  real symmetric n-by-n matrix A:
+     A = V * diag(W) * V**T
+  with V orthogonal. A is first reduced to a symmetric tridiagonal matrix
+  T = Q**T * A * Q in two stages: to band form with Level 3 BLAS (gemm),
+  then from band to tridiagonal form on the GPU. The eigenvalues alone are
+  found by bisection; the eigenvectors of T are computed by divide and
+  conquer, with the eigenvectors of the merged halves updated by gemm, and
+  multiplied by Q.
+
+  @param[in]
+  evect
+           rocsolver_evect_none: compute the eigenvalues only;
+           rocsolver_evect_original: compute the eigenvectors too.
+
+  @param[in]
+  uplo
+           specifies whether the upper or lower triangular part of A is
+           given.
+
+  @param[in]
+  n
+           The order of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the symmetric matrix A; only the triangle given by uplo
+           is read. On exit, the orthonormal eigenvectors in the columns of
+           A if evect is rocsolver_evect_original (column i for W(i)),
+           otherwise A is destroyed.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  W
+           pointer to the eigenvalues on the GPU, in ascending order.
+           Dimension (n).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dsyevd(rocsolver_handle handle, rocsolver_evect evect,
+                 rocsolver_fill uplo, rocsolver_int n, double *A,
+                 rocsolver_int lda, double *W);
+
+/*! \brief LAPACK API
+
+  \details
+  syevj_batched computes the eigenvalues and, optionally, the
+  eigenvectors of a batch of real symmetric n-by-n matrices A_b:
+     A_b = V_b * diag(W_b) * V_b**T
+  with V_b orthogonal, by the cyclic Jacobi method. Every sweep applies
+  n - 1 rounds of n / 2 plane rotations that touch disjoint pairs of rows
+  and columns, in the round-robin (parallel) ordering; the sweeps stop once
+  the off-diagonal Frobenius norm of A_b is at most tol times its Frobenius
+  norm. Matrices of order up to 32 are kept in LDS, one workgroup per
+  matrix, and the whole batch is solved by a single kernel launch. Larger
+  ones are solved one at a time by syevd.
+
+  @param[in]
+  evect
+           rocsolver_evect_none: compute the eigenvalues only;
+           rocsolver_evect_original: compute the eigenvectors too.
+
+  @param[in]
+  uplo
+           specifies whether the upper or lower triangular part of the A_b
+           is given.
+
+  @param[in]
+  n
+           The order of the matrices A_b.  n >= 0.
+
+  @param[in,out]
+  A
+           array of pointers on the GPU to the matrices A_b.
+           On entry, the symmetric matrices A_b; only the triangle given by
+           uplo is read. On exit, the orthonormal eigenvectors in the
+           columns of A_b if evect is rocsolver_evect_original (column i for
+           W_b(i)), otherwise the A_b are destroyed.
+
+  @param[in]
+  lda
+           The leading dimension of the A_b.  lda >= max(1,n).
+
+  @param[in]
+  tol
+           relative tolerance of the off-diagonal norm. tol <= 0 takes
+           n times the machine epsilon.
+
+  @param[in]
+  max_sweeps
+           the largest number of sweeps.  max_sweeps >= 0.
+
+  @param[out]
+  W
+           pointer to the eigenvalues on the GPU, in ascending order.
+           Dimension (n) per matrix.
+
+  @param[in]
+  strideW
+           stride from the start of one vector W_b to the next one.
+
+  @param[out]
+  info
+           pointer to an array of batch_count integers on the GPU.
+           info[b] = 0 if the sweeps on A_b converged, 1 if max_sweeps were
+           done without convergence (W_b and V_b are then approximations).
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_ssyevj_batched(
+    rocsolver_handle handle, rocsolver_evect evect, rocsolver_fill uplo,
+    rocsolver_int n, float *const A[], rocsolver_int lda, float tol,
+    rocsolver_int max_sweeps, float *W, rocsolver_int strideW,
+    rocsolver_int *info, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  syevj_strided_batched computes the eigenvalues and, optionally, the
+  eigenvectors of a batch of real symmetric n-by-n matrices A_b:
+     A_b = V_b * diag(W_b) * V_b**T
+  with V_b orthogonal, by the cyclic Jacobi method. Every sweep applies
+  n - 1 rounds of n / 2 plane rotations that touch disjoint pairs of rows
+  and columns, in the round-robin (parallel) ordering; the sweeps stop once
+  the off-diagonal Frobenius norm of A_b is at most tol times its Frobenius
+  norm. Matrices of order up to 32 are kept in LDS, one workgroup per
+  matrix, and the whole batch is solved by a single kernel launch. Larger
+  ones are solved one at a time by syevd.
+
+  @param[in]
+  evect
+           rocsolver_evect_none: compute the eigenvalues only;
+           rocsolver_evect_original: compute the eigenvectors too.
+
+  @param[in]
+  uplo
+           specifies whether the upper or lower triangular part of the A_b
+           is given.
+
+  @param[in]
+  n
+           The order of the matrices A_b.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing the matrices A_b on the GPU.
+           On entry, the symmetric matrices A_b; only the triangle given by
+           uplo is read. On exit, the orthonormal eigenvectors in the
+           columns of A_b if evect is rocsolver_evect_original (column i for
+           W_b(i)), otherwise the A_b are destroyed.
+
+  @param[in]
+  lda
+           The leading dimension of the A_b.  lda >= max(1,n).
+
+  @param[in]
+  strideA
+           stride from the start of one matrix A_b to the next one.
+
+  @param[in]
+  tol
+           relative tolerance of the off-diagonal norm. tol <= 0 takes
+           n times the machine epsilon.
+
+  @param[in]
+  max_sweeps
+           the largest number of sweeps.  max_sweeps >= 0.
+
+  @param[out]
+  W
+           pointer to the eigenvalues on the GPU, in ascending order.
+           Dimension (n) per matrix.
+
+  @param[in]
+  strideW
+           stride from the start of one vector W_b to the next one.
+
+  @param[out]
+  info
+           pointer to an array of batch_count integers on the GPU.
+           info[b] = 0 if the sweeps on A_b converged, 1 if max_sweeps were
+           done without convergence (W_b and V_b are then approximations).
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_ssyevj_strided_batched(
+    rocsolver_handle handle, rocsolver_evect evect, rocsolver_fill uplo,
+    rocsolver_int n, float *A, rocsolver_int lda, rocsolver_int strideA,
+    float tol, rocsolver_int max_sweeps, float *W, rocsolver_int strideW,
+    rocsolver_int *info, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  syevj_batched computes the eigenvalues and, optionally, the
+  eigenvectors of a batch of real symmetric n-by-n matrices A_b:
+     A_b = V_b * diag(W_b) * V_b**T
+  with V_b orthogonal, by the cyclic Jacobi method. Every sweep applies
+  n - 1 rounds of n / 2 plane rotations that touch disjoint pairs of rows
+  and columns, in the round-robin (parallel) ordering; the sweeps stop once
+  the off-diagonal Frobenius norm of A_b is at most tol times its Frobenius
+  norm. Matrices of order up to 32 are kept in LDS, one workgroup per
+  matrix, and the whole batch is solved by a single kernel launch. Larger
+  ones are solved one at a time by syevd.
+
+  @param[in]
+  evect
+           rocsolver_evect_none: compute the eigenvalues only;
+           rocsolver_evect_original: compute the eigenvectors too.
+
+  @param[in]
+  uplo
+           specifies whether the upper or lower triangular part of the A_b
+           is given.
+
+  @param[in]
+  n
+           The order of the matrices A_b.  n >= 0.
+
+  @param[in,out]
+  A
+           array of pointers on the GPU to the matrices A_b.
+           On entry, the symmetric matrices A_b; only the triangle given by
+           uplo is read. On exit, the orthonormal eigenvectors in the
+           columns of A_b if evect is rocsolver_evect_original (column i for
+           W_b(i)), otherwise the A_b are destroyed.
+
+  @param[in]
+  lda
+           The leading dimension of the A_b.  lda >= max(1,n).
+
+  @param[in]
+  tol
+           relative tolerance of the off-diagonal norm. tol <= 0 takes
+           n times the machine epsilon.
+
+  @param[in]
+  max_sweeps
+           the largest number of sweeps.  max_sweeps >= 0.
+
+  @param[out]
+  W
+           pointer to the eigenvalues on the GPU, in ascending order.
+           Dimension (n) per matrix.
+
+  @param[in]
+  strideW
+           stride from the start of one vector W_b to the next one.
+
+  @param[out]
+  info
+           pointer to an array of batch_count integers on the GPU.
+           info[b] = 0 if the sweeps on A_b converged, 1 if max_sweeps were
+           done without convergence (W_b and V_b are then approximations).
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dsyevj_batched(
+    rocsolver_handle handle, rocsolver_evect evect, rocsolver_fill uplo,
+    rocsolver_int n, double *const A[], rocsolver_int lda, double tol,
+    rocsolver_int max_sweeps, double *W, rocsolver_int strideW,
+    rocsolver_int *info, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  syevj_strided_batched computes the eigenvalues and, optionally, the
+  eigenvectors of a batch of real symmetric n-by-n matrices A_b:
+     A_b = V_b * diag(W_b) * V_b**T
+  with V_b orthogonal, by the cyclic Jacobi method. Every sweep applies
+  n - 1 rounds of n / 2 plane rotations that touch disjoint pairs of rows
+  and columns, in the round-robin (parallel) ordering; the sweeps stop once
+  the off-diagonal Frobenius norm of A_b is at most tol times its Frobenius
+  norm. Matrices of order up to 32 are kept in LDS, one workgroup per
+  matrix, and the whole batch is solved by a single kernel launch. Larger
+  ones are solved one at a time by syevd.
+
+  @param[in]
+  evect
+           rocsolver_evect_none: compute the eigenvalues only;
+           rocsolver_evect_original: compute the eigenvectors too.
+
+  @param[in]
+  uplo
+           specifies whether the upper or lower triangular part of the A_b
+           is given.
+
+  @param[in]
+  n
+           The order of the matrices A_b.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing the matrices A_b on the GPU.
+           On entry, the symmetric matrices A_b; only the triangle given by
+           uplo is read. On exit, the orthonormal eigenvectors in the
+           columns of A_b if evect is rocsolver_evect_original (column i for
+           W_b(i)), otherwise the A_b are destroyed.
+
+  @param[in]
+  lda
+           The leading dimension of the A_b.  lda >= max(1,n).
+
+  @param[in]
+  strideA
+           stride from the start of one matrix A_b to the next one.
+
+  @param[in]
+  tol
+           relative tolerance of the off-diagonal norm. tol <= 0 takes
+           n times the machine epsilon.
+
+  @param[in]
+  max_sweeps
+           the largest number of sweeps.  max_sweeps >= 0.
+
+  @param[out]
+  W
+           pointer to the eigenvalues on the GPU, in ascending order.
+           Dimension (n) per matrix.
+
+  @param[in]
+  strideW
+           stride from the start of one vector W_b to the next one.
+
+  @param[out]
+  info
+           pointer to an array of batch_count integers on the GPU.
+           info[b] = 0 if the sweeps on A_b converged, 1 if max_sweeps were
+           done without convergence (W_b and V_b are then approximations).
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dsyevj_strided_batched(
+    rocsolver_handle handle, rocsolver_evect evect, rocsolver_fill uplo,
+    rocsolver_int n, double *A, rocsolver_int lda, rocsolver_int strideA,
+    double tol, rocsolver_int max_sweeps, double *W, rocsolver_int strideW,
+    rocsolver_int *info, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  gesvd computes the singular values and, optionally, the singular vectors
+  of a general m-by-n matrix A:
+     A = U * diag(S) * V**T
+  with U (m-by-m) and V (n-by-n) orthogonal. A is reduced to upper
+  bidiagonal form B = Q**T * A * P by Householder transformations, in panels
+  whose updates to the rest of the matrix are applied with Level 3 BLAS
+  (gemm); the singular values of B and, when wanted, the rotations that
+  produce them are found by the bidiagonal QR iteration with Wilkinson
+  shifts (a zero on the diagonal is chased out by rotations instead), and U
+  and V**T are then multiplied by Q and P**T. When m is at least twice n, A is
+  first factored as Q * R and only R is bidiagonalized; when m < n, A**T is
+  decomposed instead. The QR iteration runs in one workgroup; for
+  min(m,n) > 256 it only logs its rotations, and they are applied to U and
+  V**T by all workgroups, a batch of sweeps at a time.
+
+  @param[in]
+  left_svect
+           rocsolver_svect_all: all m columns of U are computed;
+           rocsolver_svect_singular: only the first min(m,n) columns of U;
+           rocsolver_svect_none: U is not referenced.
+
+  @param[in]
+  right_svect
+           rocsolver_svect_all: all n rows of V**T are computed;
+           rocsolver_svect_singular: only the first min(m,n) rows of V**T;
+           rocsolver_svect_none: V is not referenced.
+
+  @param[in]
+  m
+           the number of rows of matrix A.  m >= 0.
+
+  @param[in]
+  n
+           the number of columns of matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the matrix A. On exit, A is destroyed.
+
+  @param[in]
+  lda
+           the leading dimension of A.  lda >= max(1,m).
+
+  @param[out]
+  S
+           pointer to the singular values on the GPU, in descending order.
+           Dimension (min(m,n)).
+
+  @param[out]
+  U
+           pointer to the left singular vectors on the GPU, in columns.
+           Dimension (ldu, m) for rocsolver_svect_all, (ldu, min(m,n)) for
+           rocsolver_svect_singular.
+
+  @param[in]
+  ldu
+           the leading dimension of U.  ldu >= max(1,m) if left_svect is not
+           rocsolver_svect_none, ldu >= 1 otherwise.
+
+  @param[out]
+  V
+           pointer to the right singular vectors on the GPU, in the rows of
+           V**T, which is what V gets. Dimension (ldv, n).
+
+  @param[in]
+  ldv
+           the leading dimension of V.  ldv >= max(1,n) for
+           rocsolver_svect_all, ldv >= max(1,min(m,n)) for
+           rocsolver_svect_singular, ldv >= 1 otherwise.
+
+  @param[out]
+  info
+           pointer to an integer on the GPU. info = 0 on success; info = i
+           > 0 if the QR iteration did not converge, i superdiagonal
+           entries of the bidiagonal form not having reached zero (S is
+           then not exact).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sgesvd(rocsolver_handle handle, rocsolver_svect left_svect,
+                 rocsolver_svect right_svect, rocsolver_int m,
+                 rocsolver_int n, float *A, rocsolver_int lda, float *S,
+                 float *U, rocsolver_int ldu, float *V, rocsolver_int ldv,
+                 rocsolver_int *info);
+
+/*! \brief LAPACK API
+
+  \details
+  gesvd computes the singular values and, optionally, the singular vectors
+  of a general m-by-n matrix A:
+     A = U * diag(S) * V**T
+  with U (m-by-m) and V (n-by-n) orthogonal. A is reduced to upper
+  bidiagonal form B = Q**T * A * P by Householder transformations, in panels
+  whose updates to the rest of the matrix are applied with Level 3 BLAS
+  (gemm); the singular values of B and, when wanted, the rotations that
+  produce them are found by the bidiagonal QR iteration with Wilkinson
+  shifts (a zero on the diagonal is chased out by rotations instead), and U
+  and V**T are then multiplied by Q and P**T. When m is at least twice n, A is
+  first factored as Q * R and only R is bidiagonalized; when m < n, A**T is
+  decomposed instead. The QR iteration runs in one workgroup; for
+  min(m,n) > 256 it only logs its rotations, and they are applied to U and
+  V**T by all workgroups, a batch of sweeps at a time.
+
+  @param[in]
+  left_svect
+           rocsolver_svect_all: all m columns of U are computed;
+           rocsolver_svect_singular: only the first min(m,n) columns of U;
+           rocsolver_svect_none: U is not referenced.
+
+  @param[in]
+  right_svect
+           rocsolver_svect_all: all n rows of V**T are computed;
+           rocsolver_svect_singular: only the first min(m,n) rows of V**T;
+           rocsolver_svect_none: V is not referenced.
+
+  @param[in]
+  m
+           the number of rows of matrix A.  m >= 0.
+
+  @param[in]
+  n
+           the number of columns of matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the matrix A. On exit, A is destroyed.
+
+  @param[in]
+  lda
+           the leading dimension of A.  lda >= max(1,m).
+
+  @param[out]
+  S
+           pointer to the singular values on the GPU, in descending order.
+           Dimension (min(m,n)).
+
+  @param[out]
+  U
+           pointer to the left singular vectors on the GPU, in columns.
+           Dimension (ldu, m) for rocsolver_svect_all, (ldu, min(m,n)) for
+           rocsolver_svect_singular.
+
+  @param[in]
+  ldu
+           the leading dimension of U.  ldu >= max(1,m) if left_svect is not
+           rocsolver_svect_none, ldu >= 1 otherwise.
+
+  @param[out]
+  V
+           pointer to the right singular vectors on the GPU, in the rows of
+           V**T, which is what V gets. Dimension (ldv, n).
+
+  @param[in]
+  ldv
+           the leading dimension of V.  ldv >= max(1,n) for
+           rocsolver_svect_all, ldv >= max(1,min(m,n)) for
+           rocsolver_svect_singular, ldv >= 1 otherwise.
+
+  @param[out]
+  info
+           pointer to an integer on the GPU. info = 0 on success; info = i
+           > 0 if the QR iteration did not converge, i superdiagonal
+           entries of the bidiagonal form not having reached zero (S is
+           then not exact).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dgesvd(rocsolver_handle handle, rocsolver_svect left_svect,
+                 rocsolver_svect right_svect, rocsolver_int m,
+                 rocsolver_int n, double *A, rocsolver_int lda, double *S,
+                 double *U, rocsolver_int ldu, double *V, rocsolver_int ldv,
+                 rocsolver_int *info);
+
+/*! \brief LAPACK API
+
+  \details
+  gesvdj_batched computes the singular values and, optionally,
+  the singular vectors of a batch of general m-by-n matrices A_b:
+     A_b = U_b * diag(S_b) * V_b**T
+  with U_b (m-by-m) and V_b (n-by-n) orthogonal, by the one-sided Jacobi
+  method. Plane rotations from the right make the columns of A_b (of A_b**T
+  when m < n) mutually orthogonal; every sweep applies the rounds of the
+  round-robin (parallel) ordering, whose rotations touch disjoint pairs of
+  columns. A pair is rotated while the cosine of the angle between its
+  columns exceeds tol, and the sweeps stop after one without any rotation.
+  Matrices with m and n up to 64 are kept in LDS, one workgroup per
+  matrix, and the whole batch is solved by a single kernel launch. Larger
+  ones are solved one at a time by gesvd.
+
+  @param[in]
+  left_svect
+           rocsolver_svect_all: all m columns of the U_b are computed;
+           rocsolver_svect_singular: only the first min(m,n) columns;
+           rocsolver_svect_none: U is not referenced.
+
+  @param[in]
+  right_svect
+           rocsolver_svect_all: all n rows of the V_b**T are computed;
+           rocsolver_svect_singular: only the first min(m,n) rows;
+           rocsolver_svect_none: V is not referenced.
+
+  @param[in]
+  m
+           the number of rows of the matrices A_b.  m >= 0.
+
+  @param[in]
+  n
+           the number of columns of the matrices A_b.  n >= 0.
+
+  @param[in,out]
+  A
+           array of pointers on the GPU to the matrices A_b.
+           On entry, the matrices A_b. On exit, the A_b are destroyed.
+
+  @param[in]
+  lda
+           the leading dimension of the A_b.  lda >= max(1,m).
+
+  @param[in]
+  tol
+           tolerance of the cosine between two columns. tol <= 0 takes
+           max(m,n) times the machine epsilon.
+
+  @param[in]
+  max_sweeps
+           the largest number of sweeps.  max_sweeps >= 0.
+
+  @param[out]
+  S
+           pointer to the singular values on the GPU, in descending order.
+           Dimension (min(m,n)) per matrix.
+
+  @param[in]
+  strideS
+           stride from the start of one vector S_b to the next one.
+
+  @param[out]
+  U
+           pointer to the left singular vectors on the GPU, in columns.
+           Dimension (ldu, m) per matrix for rocsolver_svect_all, (ldu,
+           min(m,n)) for rocsolver_svect_singular.
+
+  @param[in]
+  ldu
+           the leading dimension of the U_b.  ldu >= max(1,m) if left_svect
+           is not rocsolver_svect_none, ldu >= 1 otherwise.
+
+  @param[in]
+  strideU
+           stride from the start of one matrix U_b to the next one.
+
+  @param[out]
+  V
+           pointer to the right singular vectors on the GPU, in the rows of
+           V_b**T, which is what V gets. Dimension (ldv, n) per matrix.
+
+  @param[in]
+  ldv
+           the leading dimension of the V_b.  ldv >= max(1,n) for
+           rocsolver_svect_all, ldv >= max(1,min(m,n)) for
+           rocsolver_svect_singular, ldv >= 1 otherwise.
+
+  @param[in]
+  strideV
+           stride from the start of one matrix V_b to the next one.
+
+  @param[out]
+  info
+           pointer to an array of batch_count integers on the GPU.
+           info[b] = 0 if the sweeps on A_b converged, 1 if max_sweeps were
+           done without convergence (S_b, U_b and V_b are then
+           approximations). Matrices solved by gesvd get its info.
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_sgesvdj_batched(
+    rocsolver_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocsolver_int m, rocsolver_int n,
+    float *const A[], rocsolver_int lda, float tol, rocsolver_int max_sweeps,
+    float *S, rocsolver_int strideS, float *U, rocsolver_int ldu,
+    rocsolver_int strideU, float *V, rocsolver_int ldv, rocsolver_int strideV,
+    rocsolver_int *info, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  gesvdj_strided_batched computes the singular values and, optionally,
+  the singular vectors of a batch of general m-by-n matrices A_b:
+     A_b = U_b * diag(S_b) * V_b**T
+  with U_b (m-by-m) and V_b (n-by-n) orthogonal, by the one-sided Jacobi
+  method. Plane rotations from the right make the columns of A_b (of A_b**T
+  when m < n) mutually orthogonal; every sweep applies the rounds of the
+  round-robin (parallel) ordering, whose rotations touch disjoint pairs of
+  columns. A pair is rotated while the cosine of the angle between its
+  columns exceeds tol, and the sweeps stop after one without any rotation.
+  Matrices with m and n up to 64 are kept in LDS, one workgroup per
+  matrix, and the whole batch is solved by a single kernel launch. Larger
+  ones are solved one at a time by gesvd.
+
+  @param[in]
+  left_svect
+           rocsolver_svect_all: all m columns of the U_b are computed;
+           rocsolver_svect_singular: only the first min(m,n) columns;
+           rocsolver_svect_none: U is not referenced.
+
+  @param[in]
+  right_svect
+           rocsolver_svect_all: all n rows of the V_b**T are computed;
+           rocsolver_svect_singular: only the first min(m,n) rows;
+           rocsolver_svect_none: V is not referenced.
+
+  @param[in]
+  m
+           the number of rows of the matrices A_b.  m >= 0.
+
+  @param[in]
+  n
+           the number of columns of the matrices A_b.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing the matrices A_b on the GPU.
+           On entry, the matrices A_b. On exit, the A_b are destroyed.
+
+  @param[in]
+  lda
+           the leading dimension of the A_b.  lda >= max(1,m).
+
+  @param[in]
+  strideA
+           stride from the start of one matrix A_b to the next one.
+
+  @param[in]
+  tol
+           tolerance of the cosine between two columns. tol <= 0 takes
+           max(m,n) times the machine epsilon.
+
+  @param[in]
+  max_sweeps
+           the largest number of sweeps.  max_sweeps >= 0.
+
+  @param[out]
+  S
+           pointer to the singular values on the GPU, in descending order.
+           Dimension (min(m,n)) per matrix.
+
+  @param[in]
+  strideS
+           stride from the start of one vector S_b to the next one.
+
+  @param[out]
+  U
+           pointer to the left singular vectors on the GPU, in columns.
+           Dimension (ldu, m) per matrix for rocsolver_svect_all, (ldu,
+           min(m,n)) for rocsolver_svect_singular.
+
+  @param[in]
+  ldu
+           the leading dimension of the U_b.  ldu >= max(1,m) if left_svect
+           is not rocsolver_svect_none, ldu >= 1 otherwise.
+
+  @param[in]
+  strideU
+           stride from the start of one matrix U_b to the next one.
+
+  @param[out]
+  V
+           pointer to the right singular vectors on the GPU, in the rows of
+           V_b**T, which is what V gets. Dimension (ldv, n) per matrix.
+
+  @param[in]
+  ldv
+           the leading dimension of the V_b.  ldv >= max(1,n) for
+           rocsolver_svect_all, ldv >= max(1,min(m,n)) for
+           rocsolver_svect_singular, ldv >= 1 otherwise.
+
+  @param[in]
+  strideV
+           stride from the start of one matrix V_b to the next one.
+
+  @param[out]
+  info
+           pointer to an array of batch_count integers on the GPU.
+           info[b] = 0 if the sweeps on A_b converged, 1 if max_sweeps were
+           done without convergence (S_b, U_b and V_b are then
+           approximations). Matrices solved by gesvd get its info.
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_sgesvdj_strided_batched(
+    rocsolver_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocsolver_int m, rocsolver_int n, float *A,
+    rocsolver_int lda, rocsolver_int strideA, float tol,
+    rocsolver_int max_sweeps, float *S, rocsolver_int strideS, float *U,
+    rocsolver_int ldu, rocsolver_int strideU, float *V, rocsolver_int ldv,
+    rocsolver_int strideV, rocsolver_int *info, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  gesvdj_batched computes the singular values and, optionally,
+  the singular vectors of a batch of general m-by-n matrices A_b:
+     A_b = U_b * diag(S_b) * V_b**T
+  with U_b (m-by-m) and V_b (n-by-n) orthogonal, by the one-sided Jacobi
+  method. Plane rotations from the right make the columns of A_b (of A_b**T
+  when m < n) mutually orthogonal; every sweep applies the rounds of the
+  round-robin (parallel) ordering, whose rotations touch disjoint pairs of
+  columns. A pair is rotated while the cosine of the angle between its
+  columns exceeds tol, and the sweeps stop after one without any rotation.
+  Matrices with m and n up to 64 are kept in LDS, one workgroup per
+  matrix, and the whole batch is solved by a single kernel launch. Larger
+  ones are solved one at a time by gesvd.
+
+  @param[in]
+  left_svect
+           rocsolver_svect_all: all m columns of the U_b are computed;
+           rocsolver_svect_singular: only the first min(m,n) columns;
+           rocsolver_svect_none: U is not referenced.
+
+  @param[in]
+  right_svect
+           rocsolver_svect_all: all n rows of the V_b**T are computed;
+           rocsolver_svect_singular: only the first min(m,n) rows;
+           rocsolver_svect_none: V is not referenced.
+
+  @param[in]
+  m
+           the number of rows of the matrices A_b.  m >= 0.
+
+  @param[in]
+  n
+           the number of columns of the matrices A_b.  n >= 0.
+
+  @param[in,out]
+  A
+           array of pointers on the GPU to the matrices A_b.
+           On entry, the matrices A_b. On exit, the A_b are destroyed.
+
+  @param[in]
+  lda
+           the leading dimension of the A_b.  lda >= max(1,m).
+
+  @param[in]
+  tol
+           tolerance of the cosine between two columns. tol <= 0 takes
+           max(m,n) times the machine epsilon.
+
+  @param[in]
+  max_sweeps
+           the largest number of sweeps.  max_sweeps >= 0.
+
+  @param[out]
+  S
+           pointer to the singular values on the GPU, in descending order.
+           Dimension (min(m,n)) per matrix.
+
+  @param[in]
+  strideS
+           stride from the start of one vector S_b to the next one.
+
+  @param[out]
+  U
+           pointer to the left singular vectors on the GPU, in columns.
+           Dimension (ldu, m) per matrix for rocsolver_svect_all, (ldu,
+           min(m,n)) for rocsolver_svect_singular.
+
+  @param[in]
+  ldu
+           the leading dimension of the U_b.  ldu >= max(1,m) if left_svect
+           is not rocsolver_svect_none, ldu >= 1 otherwise.
+
+  @param[in]
+  strideU
+           stride from the start of one matrix U_b to the next one.
+
+  @param[out]
+  V
+           pointer to the right singular vectors on the GPU, in the rows of
+           V_b**T, which is what V gets. Dimension (ldv, n) per matrix.
+
+  @param[in]
+  ldv
+           the leading dimension of the V_b.  ldv >= max(1,n) for
+           rocsolver_svect_all, ldv >= max(1,min(m,n)) for
+           rocsolver_svect_singular, ldv >= 1 otherwise.
+
+  @param[in]
+  strideV
+           stride from the start of one matrix V_b to the next one.
+
+  @param[out]
+  info
+           pointer to an array of batch_count integers on the GPU.
+           info[b] = 0 if the sweeps on A_b converged, 1 if max_sweeps were
+           done without convergence (S_b, U_b and V_b are then
+           approximations). Matrices solved by gesvd get its info.
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dgesvdj_batched(
+    rocsolver_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocsolver_int m, rocsolver_int n,
+    double *const A[], rocsolver_int lda, double tol, rocsolver_int max_sweeps,
+    double *S, rocsolver_int strideS, double *U, rocsolver_int ldu,
+    rocsolver_int strideU, double *V, rocsolver_int ldv, rocsolver_int strideV,
+    rocsolver_int *info, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  gesvdj_strided_batched computes the singular values and, optionally,
+  the singular vectors of a batch of general m-by-n matrices A_b:
+     A_b = U_b * diag(S_b) * V_b**T
+  with U_b (m-by-m) and V_b (n-by-n) orthogonal, by the one-sided Jacobi
+  method. Plane rotations from the right make the columns of A_b (of A_b**T
+  when m < n) mutually orthogonal; every sweep applies the rounds of the
+  round-robin (parallel) ordering, whose rotations touch disjoint pairs of
+  columns. A pair is rotated while the cosine of the angle between its
+  columns exceeds tol, and the sweeps stop after one without any rotation.
+  Matrices with m and n up to 64 are kept in LDS, one workgroup per
+  matrix, and the whole batch is solved by a single kernel launch. Larger
+  ones are solved one at a time by gesvd.
+
+  @param[in]
+  left_svect
+           rocsolver_svect_all: all m columns of the U_b are computed;
+           rocsolver_svect_singular: only the first min(m,n) columns;
+           rocsolver_svect_none: U is not referenced.
+
+  @param[in]
+  right_svect
+           rocsolver_svect_all: all n rows of the V_b**T are computed;
+           rocsolver_svect_singular: only the first min(m,n) rows;
+           rocsolver_svect_none: V is not referenced.
+
+  @param[in]
+  m
+           the number of rows of the matrices A_b.  m >= 0.
+
+  @param[in]
+  n
+           the number of columns of the matrices A_b.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing the matrices A_b on the GPU.
+           On entry, the matrices A_b. On exit, the A_b are destroyed.
+
+  @param[in]
+  lda
+           the leading dimension of the A_b.  lda >= max(1,m).
+
+  @param[in]
+  strideA
+           stride from the start of one matrix A_b to the next one.
+
+  @param[in]
+  tol
+           tolerance of the cosine between two columns. tol <= 0 takes
+           max(m,n) times the machine epsilon.
+
+  @param[in]
+  max_sweeps
+           the largest number of sweeps.  max_sweeps >= 0.
+
+  @param[out]
+  S
+           pointer to the singular values on the GPU, in descending order.
+           Dimension (min(m,n)) per matrix.
+
+  @param[in]
+  strideS
+           stride from the start of one vector S_b to the next one.
+
+  @param[out]
+  U
+           pointer to the left singular vectors on the GPU, in columns.
+           Dimension (ldu, m) per matrix for rocsolver_svect_all, (ldu,
+           min(m,n)) for rocsolver_svect_singular.
+
+  @param[in]
+  ldu
+           the leading dimension of the U_b.  ldu >= max(1,m) if left_svect
+           is not rocsolver_svect_none, ldu >= 1 otherwise.
+
+  @param[in]
+  strideU
+           stride from the start of one matrix U_b to the next one.
+
+  @param[out]
+  V
+           pointer to the right singular vectors on the GPU, in the rows of
+           V_b**T, which is what V gets. Dimension (ldv, n) per matrix.
+
+  @param[in]
+  ldv
+           the leading dimension of the V_b.  ldv >= max(1,n) for
+           rocsolver_svect_all, ldv >= max(1,min(m,n)) for
+           rocsolver_svect_singular, ldv >= 1 otherwise.
+
+  @param[in]
+  strideV
+           stride from the start of one matrix V_b to the next one.
+
+  @param[out]
+  info
+           pointer to an array of batch_count integers on the GPU.
+           info[b] = 0 if the sweeps on A_b converged, 1 if max_sweeps were
+           done without convergence (S_b, U_b and V_b are then
+           approximations). Matrices solved by gesvd get its info.
+
+  @param[in]
+  batch_count
+           number of matrices in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dgesvdj_strided_batched(
+    rocsolver_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocsolver_int m, rocsolver_int n, double *A,
+    rocsolver_int lda, rocsolver_int strideA, double tol,
+    rocsolver_int max_sweeps, double *S, rocsolver_int strideS, double *U,
+    rocsolver_int ldu, rocsolver_int strideU, double *V, rocsolver_int ldv,
+    rocsolver_int strideV, rocsolver_int *info, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  gesvdr computes approximations of the rank largest singular values and,
+  optionally, of the corresponding singular vectors of a general m-by-n
+  matrix A:
+     A ~ U * diag(S) * V**T
+  with U (m-by-rank) and V**T (rank-by-n) having orthonormal columns and
+  rows, by a randomized range finder. With l = min(rank + oversample,
+  min(m,n)), the columns of A * Omega, for an n-by-l matrix Omega with
+  Gaussian entries, are made orthonormal by a QR factorization to Q; each
+  of the power_iters power iterations then replaces Q by an orthonormal
+  basis of A * A**T * Q, again through QR factorizations. The singular
+  value decomposition of the small l-by-n matrix Q**T * A gives the result.
+  All the products with A are gemm calls, so the cost is about
+  (2 * power_iters + 2) * m * n * l flops instead of the O(m * n * min(m,n))
+  of gesvd. The results are exact for a matrix of rank at most l, and
+  otherwise approach the leading singular triplets as the oversampling and
+  the power iterations grow (they damp the singular values beyond the
+  first l). Omega comes from a fixed seed, so the results are
+  reproducible.
+
+  @param[in]
+  left_svect
+           rocsolver_svect_singular: the rank leading left singular vectors
+           are computed; rocsolver_svect_none: U is not referenced.
+
+  @param[in]
+  right_svect
+           rocsolver_svect_singular: the rank leading right singular
+           vectors are computed; rocsolver_svect_none: V is not referenced.
+
+  @param[in]
+  m
+           the number of rows of matrix A.  m >= 0.
+
+  @param[in]
+  n
+           the number of columns of matrix A.  n >= 0.
+
+  @param[in]
+  A
+           pointer storing matrix A on the GPU. It is not modified.
+
+  @param[in]
+  lda
+           the leading dimension of A.  lda >= max(1,m).
+
+  @param[in]
+  rank
+           the number of singular triplets wanted.  0 <= rank <= min(m,n).
+
+  @param[in]
+  oversample
+           the number of columns of Omega beyond rank.  oversample >= 0.
+
+  @param[in]
+  power_iters
+           the number of power iterations.  power_iters >= 0.
+
+  @param[out]
+  S
+           pointer to the singular values on the GPU, in descending order.
+           Dimension (rank).
+
+  @param[out]
+  U
+           pointer to the left singular vectors on the GPU, in columns.
+           Dimension (ldu, rank).
+
+  @param[in]
+  ldu
+           the leading dimension of U.  ldu >= max(1,m) if left_svect is
+           rocsolver_svect_singular, ldu >= 1 otherwise.
+
+  @param[out]
+  V
+           pointer to the right singular vectors on the GPU, in the rows of
+           V**T, which is what V gets. Dimension (ldv, n).
+
+  @param[in]
+  ldv
+           the leading dimension of V.  ldv >= max(1,rank) if right_svect is
+           rocsolver_svect_singular, ldv >= 1 otherwise.
+
+  @param[out]
+  info
+           pointer to an integer on the GPU. info = 0 on success; info = i
+           > 0 if the QR iteration of the small decomposition did not
+           converge, as in gesvd.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_sgesvdr(
+    rocsolver_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocsolver_int m, rocsolver_int n, float *A,
+    rocsolver_int lda, rocsolver_int rank, rocsolver_int oversample,
+    rocsolver_int power_iters, float *S, float *U, rocsolver_int ldu, float *V,
+    rocsolver_int ldv, rocsolver_int *info);
+
+/*! \brief LAPACK API
+
+  \details
+  gesvdr computes approximations of the rank largest singular values and,
+  optionally, of the corresponding singular vectors of a general m-by-n
+  matrix A:
+     A ~ U * diag(S) * V**T
+  with U (m-by-rank) and V**T (rank-by-n) having orthonormal columns and
+  rows, by a randomized range finder. With l = min(rank + oversample,
+  min(m,n)), the columns of A * Omega, for an n-by-l matrix Omega with
+  Gaussian entries, are made orthonormal by a QR factorization to Q; each
+  of the power_iters power iterations then replaces Q by an orthonormal
+  basis of A * A**T * Q, again through QR factorizations. The singular
+  value decomposition of the small l-by-n matrix Q**T * A gives the result.
+  All the products with A are gemm calls, so the cost is about
+  (2 * power_iters + 2) * m * n * l flops instead of the O(m * n * min(m,n))
+  of gesvd. The results are exact for a matrix of rank at most l, and
+  otherwise approach the leading singular triplets as the oversampling and
+  the power iterations grow (they damp the singular values beyond the
+  first l). Omega comes from a fixed seed, so the results are
+  reproducible.
+
+  @param[in]
+  left_svect
+           rocsolver_svect_singular: the rank leading left singular vectors
+           are computed; rocsolver_svect_none: U is not referenced.
+
+  @param[in]
+  right_svect
+           rocsolver_svect_singular: the rank leading right singular
+           vectors are computed; rocsolver_svect_none: V is not referenced.
+
+  @param[in]
+  m
+           the number of rows of matrix A.  m >= 0.
+
+  @param[in]
+  n
+           the number of columns of matrix A.  n >= 0.
+
+  @param[in]
+  A
+           pointer storing matrix A on the GPU. It is not modified.
+
+  @param[in]
+  lda
+           the leading dimension of A.  lda >= max(1,m).
+
+  @param[in]
+  rank
+           the number of singular triplets wanted.  0 <= rank <= min(m,n).
+
+  @param[in]
+  oversample
+           the number of columns of Omega beyond rank.  oversample >= 0.
+
+  @param[in]
+  power_iters
+           the number of power iterations.  power_iters >= 0.
+
+  @param[out]
+  S
+           pointer to the singular values on the GPU, in descending order.
+           Dimension (rank).
+
+  @param[out]
+  U
+           pointer to the left singular vectors on the GPU, in columns.
+           Dimension (ldu, rank).
+
+  @param[in]
+  ldu
+           the leading dimension of U.  ldu >= max(1,m) if left_svect is
+           rocsolver_svect_singular, ldu >= 1 otherwise.
+
+  @param[out]
+  V
+           pointer to the right singular vectors on the GPU, in the rows of
+           V**T, which is what V gets. Dimension (ldv, n).
+
+  @param[in]
+  ldv
+           the leading dimension of V.  ldv >= max(1,rank) if right_svect is
+           rocsolver_svect_singular, ldv >= 1 otherwise.
+
+  @param[out]
+  info
+           pointer to an integer on the GPU. info = 0 on success; info = i
+           > 0 if the QR iteration of the small decomposition did not
+           converge, as in gesvd.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dgesvdr(
+    rocsolver_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocsolver_int m, rocsolver_int n, double *A,
+    rocsolver_int lda, rocsolver_int rank, rocsolver_int oversample,
+    rocsolver_int power_iters, double *S, double *U, rocsolver_int ldu,
+    double *V, rocsolver_int ldv, rocsolver_int *info);
+
+/*! \brief LAPACK API
+
+  \details
+  gtsv solves a system of linear equations
+     A * X = B
+  with an n-by-n tridiagonal matrix A, given by its subdiagonal dl,
+  diagonal d and superdiagonal du, in O(n) work per right hand side. No
+  pivoting is done, so A should be diagonally dominant (or otherwise safe
+  for Gaussian elimination without row interchanges), as the matrices of
+  ADI schemes and spline interpolation are. Systems with n up to 1024 are
+  solved by cyclic reduction in LDS, one workgroup per right hand side.
+  Larger ones are cut into blocks of 32 rows: the interiors of all the
+  blocks are solved at once, one thread per block, and the system of the
+  rows separating them, 32 times smaller, is solved in the same way.
+
+  @param[in]
+  n
+           the order of the matrix A.  n >= 0.
+
+  @param[in]
+  nrhs
+           the number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in]
+  dl
+           pointer to the subdiagonal of A on the GPU, dimension (n-1).
+           It is not modified.
+
+  @param[in]
+  d
+           pointer to the diagonal of A on the GPU, dimension (n).
+           It is not modified.
+
+  @param[in]
+  du
+           pointer to the superdiagonal of A on the GPU, dimension (n-1).
+           It is not modified.
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU, dimension (ldb,nrhs).
+           On entry, the right hand side matrix B.
+           On exit, the solution matrix X.
+
+  @param[in]
+  ldb
+           the leading dimension of the array B.  ldb >= max(1,n).
+
+  @param[out]
+  info
+           pointer to an integer on the GPU. info = 0 on success; info = i
+           > 0 if a zero pivot was met in row i, X is then not valid.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sgtsv(rocsolver_handle handle, rocsolver_int n, rocsolver_int nrhs,
+                const float *dl, const float *d, const float *du, float *B,
+                rocsolver_int ldb, rocsolver_int *info);
+
+/*! \brief LAPACK API
+
+  \details
+  gtsv solves a system of linear equations
+     A * X = B
+  with an n-by-n tridiagonal matrix A, given by its subdiagonal dl,
+  diagonal d and superdiagonal du, in O(n) work per right hand side. No
+  pivoting is done, so A should be diagonally dominant (or otherwise safe
+  for Gaussian elimination without row interchanges), as the matrices of
+  ADI schemes and spline interpolation are. Systems with n up to 1024 are
+  solved by cyclic reduction in LDS, one workgroup per right hand side.
+  Larger ones are cut into blocks of 32 rows: the interiors of all the
+  blocks are solved at once, one thread per block, and the system of the
+  rows separating them, 32 times smaller, is solved in the same way.
+
+  @param[in]
+  n
+           the order of the matrix A.  n >= 0.
+
+  @param[in]
+  nrhs
+           the number of right hand sides, i.e., the number of columns
+           of the matrix B.  nrhs >= 0.
+
+  @param[in]
+  dl
+           pointer to the subdiagonal of A on the GPU, dimension (n-1).
+           It is not modified.
+
+  @param[in]
+  d
+           pointer to the diagonal of A on the GPU, dimension (n).
+           It is not modified.
+
+  @param[in]
+  du
+           pointer to the superdiagonal of A on the GPU, dimension (n-1).
+           It is not modified.
+
+  @param[in,out]
+  B
+           pointer storing matrix B on the GPU, dimension (ldb,nrhs).
+           On entry, the right hand side matrix B.
+           On exit, the solution matrix X.
+
+  @param[in]
+  ldb
+           the leading dimension of the array B.  ldb >= max(1,n).
+
+  @param[out]
+  info
+           pointer to an integer on the GPU. info = 0 on success; info = i
+           > 0 if a zero pivot was met in row i, X is then not valid.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dgtsv(rocsolver_handle handle, rocsolver_int n, rocsolver_int nrhs,
+                const double *dl, const double *d, const double *du, double *B,
+                rocsolver_int ldb, rocsolver_int *info);
+
+/*! \brief LAPACK API
+
+  \details
+  gtsv_strided_batched solves a batch of systems of linear equations
+     A_b * X_b = B_b
+  with n-by-n tridiagonal matrices A_b, given by their subdiagonals dl_b,
+  diagonals d_b and superdiagonals du_b, as gtsv does. The whole batch is
+  solved by the same kernel launches, one workgroup per system and right
+  hand side for n up to 1024, so that many small systems keep the device
+  busy.
+
+  @param[in]
+  n
+           the order of the matrices A_b.  n >= 0.
+
+  @param[in]
+  nrhs
+           the number of right hand sides, i.e., the number of columns
+           of the matrices B_b.  nrhs >= 0.
+
+  @param[in]
+  dl
+           pointer to the subdiagonals of the A_b on the GPU, dimension
+           (n-1) per system. It is not modified.
+
+  @param[in]
+  d
+           pointer to the diagonals of the A_b on the GPU, dimension (n)
+           per system. It is not modified.
+
+  @param[in]
+  du
+           pointer to the superdiagonals of the A_b on the GPU, dimension
+           (n-1) per system. It is not modified.
+
+  @param[in]
+  strideD
+           stride from the start of one diagonal to the next one, the same
+           for dl, d and du.  strideD >= n.
+
+  @param[in,out]
+  B
+           pointer storing the matrices B_b on the GPU.
+           On entry, the right hand side matrices B_b.
+           On exit, the solution matrices X_b.
+
+  @param[in]
+  ldb
+           the leading dimension of the B_b.  ldb >= max(1,n).
+
+  @param[in]
+  strideB
+           stride from the start of one matrix B_b to the next one.
+
+  @param[out]
+  info
+           pointer to an array of batch_count integers on the GPU.
+           info[b] = 0 on success; info[b] = i > 0 if a zero pivot was met
+           in row i of A_b, X_b is then not valid.
+
+  @param[in]
+  batch_count
+           number of systems in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_sgtsv_strided_batched(
+    rocsolver_handle handle, rocsolver_int n, rocsolver_int nrhs,
+    const float *dl, const float *d, const float *du, rocsolver_int strideD,
+    float *B, rocsolver_int ldb, rocsolver_int strideB, rocsolver_int *info,
+    rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  gtsv_strided_batched solves a batch of systems of linear equations
+     A_b * X_b = B_b
+  with n-by-n tridiagonal matrices A_b, given by their subdiagonals dl_b,
+  diagonals d_b and superdiagonals du_b, as gtsv does. The whole batch is
+  solved by the same kernel launches, one workgroup per system and right
+  hand side for n up to 1024, so that many small systems keep the device
+  busy.
+
+  @param[in]
+  n
+           the order of the matrices A_b.  n >= 0.
+
+  @param[in]
+  nrhs
+           the number of right hand sides, i.e., the number of columns
+           of the matrices B_b.  nrhs >= 0.
+
+  @param[in]
+  dl
+           pointer to the subdiagonals of the A_b on the GPU, dimension
+           (n-1) per system. It is not modified.
+
+  @param[in]
+  d
+           pointer to the diagonals of the A_b on the GPU, dimension (n)
+           per system. It is not modified.
+
+  @param[in]
+  du
+           pointer to the superdiagonals of the A_b on the GPU, dimension
+           (n-1) per system. It is not modified.
+
+  @param[in]
+  strideD
+           stride from the start of one diagonal to the next one, the same
+           for dl, d and du.  strideD >= n.
+
+  @param[in,out]
+  B
+           pointer storing the matrices B_b on the GPU.
+           On entry, the right hand side matrices B_b.
+           On exit, the solution matrices X_b.
+
+  @param[in]
+  ldb
+           the leading dimension of the B_b.  ldb >= max(1,n).
+
+  @param[in]
+  strideB
+           stride from the start of one matrix B_b to the next one.
+
+  @param[out]
+  info
+           pointer to an array of batch_count integers on the GPU.
+           info[b] = 0 on success; info[b] = i > 0 if a zero pivot was met
+           in row i of A_b, X_b is then not valid.
+
+  @param[in]
+  batch_count
+           number of systems in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dgtsv_strided_batched(
+    rocsolver_handle handle, rocsolver_int n, rocsolver_int nrhs,
+    const double *dl, const double *d, const double *du, rocsolver_int strideD,
+    double *B, rocsolver_int ldb, rocsolver_int strideB, rocsolver_int *info,
+    rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  gebltsv_strided_batched solves a batch of block-tridiagonal systems of
+  linear equations
+     M_b * X_b = F_b
+  whose block row k, for 0 <= k < nblocks, reads
+     A_k * x_(k-1) + B_k * x_k + C_k * x_(k+1) = f_k
+  with nb-by-nb blocks A_k, B_k and C_k (A_0 and C_(nblocks-1) are not
+  referenced), without storing the matrices M_b as dense or band matrices.
+  The systems are solved by block cyclic reduction: at every level, the
+  diagonal blocks of every other block row are factorized by LU
+  decomposition with partial pivoting (in LDS, one workgroup per block
+  row), and the rows are eliminated by small matrix products, for all the
+  block rows of all the systems of the batch at once. There is no pivoting
+  between block rows, so the M_b should be block diagonally dominant (or
+  otherwise safe for block elimination). The number of kernel launches
+  grows as log2(nblocks); no host synchronization is needed.
+
+  @param[in]
+  nb
+           the order of the blocks.  0 <= nb <= 32.
+
+  @param[in]
+  nblocks
+           the number of block rows of the systems.  nblocks >= 0.
+
+  @param[in]
+  nrhs
+           the number of right hand sides, i.e., the number of columns
+           of the matrices F_b.  nrhs >= 0.
+
+  @param[in,out]
+  A
+           pointer to the subdiagonal blocks on the GPU, dimension (lda,
+           nb*nblocks) per system, with block A_k in columns k*nb to
+           k*nb+nb-1. On exit, destroyed.
+
+  @param[in,out]
+  B
+           pointer to the diagonal blocks on the GPU, stored as A.
+           On exit, destroyed.
+
+  @param[in,out]
+  C
+           pointer to the superdiagonal blocks on the GPU, stored as A.
+           On exit, destroyed.
+
+  @param[in]
+  lda
+           the leading dimension of A, B and C.  lda >= max(1,nb).
+
+  @param[in]
+  strideA
+           stride from the start of the blocks of one system to the next
+           one, the same for A, B and C.
+
+  @param[in,out]
+  X
+           pointer storing the matrices F_b on the GPU, dimension (ldx,
+           nrhs) per system, with f_k in rows k*nb to k*nb+nb-1.
+           On entry, the right hand sides F_b.
+           On exit, the solutions X_b.
+
+  @param[in]
+  ldx
+           the leading dimension of the X_b.  ldx >= max(1,nb*nblocks).
+
+  @param[in]
+  strideX
+           stride from the start of one matrix X_b to the next one.
+
+  @param[out]
+  info
+           pointer to an array of batch_count integers on the GPU.
+           info[b] = 0 on success; info[b] = i > 0 if a zero pivot was met
+           in row i of the reduced system b, X_b is then not valid.
+
+  @param[in]
+  batch_count
+           number of systems in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_sgebltsv_strided_batched(
+    rocsolver_handle handle, rocsolver_int nb, rocsolver_int nblocks,
+    rocsolver_int nrhs, float *A, float *B, float *C, rocsolver_int lda,
+    rocsolver_int strideA, float *X, rocsolver_int ldx, rocsolver_int strideX,
+    rocsolver_int *info, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  gebltsv_strided_batched solves a batch of block-tridiagonal systems of
+  linear equations
+     M_b * X_b = F_b
+  whose block row k, for 0 <= k < nblocks, reads
+     A_k * x_(k-1) + B_k * x_k + C_k * x_(k+1) = f_k
+  with nb-by-nb blocks A_k, B_k and C_k (A_0 and C_(nblocks-1) are not
+  referenced), without storing the matrices M_b as dense or band matrices.
+  The systems are solved by block cyclic reduction: at every level, the
+  diagonal blocks of every other block row are factorized by LU
+  decomposition with partial pivoting (in LDS, one workgroup per block
+  row), and the rows are eliminated by small matrix products, for all the
+  block rows of all the systems of the batch at once. There is no pivoting
+  between block rows, so the M_b should be block diagonally dominant (or
+  otherwise safe for block elimination). The number of kernel launches
+  grows as log2(nblocks); no host synchronization is needed.
+
+  @param[in]
+  nb
+           the order of the blocks.  0 <= nb <= 32.
+
+  @param[in]
+  nblocks
+           the number of block rows of the systems.  nblocks >= 0.
+
+  @param[in]
+  nrhs
+           the number of right hand sides, i.e., the number of columns
+           of the matrices F_b.  nrhs >= 0.
+
+  @param[in,out]
+  A
+           pointer to the subdiagonal blocks on the GPU, dimension (lda,
+           nb*nblocks) per system, with block A_k in columns k*nb to
+           k*nb+nb-1. On exit, destroyed.
+
+  @param[in,out]
+  B
+           pointer to the diagonal blocks on the GPU, stored as A.
+           On exit, destroyed.
+
+  @param[in,out]
+  C
+           pointer to the superdiagonal blocks on the GPU, stored as A.
+           On exit, destroyed.
+
+  @param[in]
+  lda
+           the leading dimension of A, B and C.  lda >= max(1,nb).
+
+  @param[in]
+  strideA
+           stride from the start of the blocks of one system to the next
+           one, the same for A, B and C.
+
+  @param[in,out]
+  X
+           pointer storing the matrices F_b on the GPU, dimension (ldx,
+           nrhs) per system, with f_k in rows k*nb to k*nb+nb-1.
+           On entry, the right hand sides F_b.
+           On exit, the solutions X_b.
+
+  @param[in]
+  ldx
+           the leading dimension of the X_b.  ldx >= max(1,nb*nblocks).
+
+  @param[in]
+  strideX
+           stride from the start of one matrix X_b to the next one.
+
+  @param[out]
+  info
+           pointer to an array of batch_count integers on the GPU.
+           info[b] = 0 on success; info[b] = i > 0 if a zero pivot was met
+           in row i of the reduced system b, X_b is then not valid.
+
+  @param[in]
+  batch_count
+           number of systems in the batch.  batch_count >= 0.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dgebltsv_strided_batched(
+    rocsolver_handle handle, rocsolver_int nb, rocsolver_int nblocks,
+    rocsolver_int nrhs, double *A, double *B, double *C, rocsolver_int lda,
+    rocsolver_int strideA, double *X, rocsolver_int ldx, rocsolver_int strideX,
+    rocsolver_int *info, rocsolver_int batch_count);
+
+/*! \brief LAPACK API
+
+  \details
+  gehrd reduces a general n-by-n matrix A to upper Hessenberg form H by an
+  orthogonal similarity transformation:
+     Q**T * A * Q = H
+  Q is the product of n-1 Householder reflectors
+     Q = H(1) * H(2) * ... * H(n-1),  H(i) = I - tau(i) * v(i) * v(i)**T
+  with v(i)(1:i) = 0 and v(i)(i+1) = 1. Panels of columns are reduced in
+  turn and the rest of the matrix is updated by Level 3 BLAS (gemm).
+
+  @param[in]
+  n
+           The order of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the matrix A. On exit, H in the upper triangle and the
+           first subdiagonal, and the vectors v(i)(i+2:n) below the first
+           subdiagonal.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  tau
+           pointer to the Householder scalars on the GPU, tau(n-1) = 0.
+           Dimension (n-1).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_sgehrd(rocsolver_handle handle,
+                                                   rocsolver_int n, float *A,
+                                                   rocsolver_int lda,
+                                                   float *tau);
+
+/*! \brief LAPACK API
+
+  \details
+  gehrd reduces a general n-by-n matrix A to upper Hessenberg form H by an
+  orthogonal similarity transformation:
+     Q**T * A * Q = H
+  Q is the product of n-1 Householder reflectors
+     Q = H(1) * H(2) * ... * H(n-1),  H(i) = I - tau(i) * v(i) * v(i)**T
+  with v(i)(1:i) = 0 and v(i)(i+1) = 1. Panels of columns are reduced in
+  turn and the rest of the matrix is updated by Level 3 BLAS (gemm).
+
+  @param[in]
+  n
+           The order of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the matrix A. On exit, H in the upper triangle and the
+           first subdiagonal, and the vectors v(i)(i+2:n) below the first
+           subdiagonal.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  tau
+           pointer to the Householder scalars on the GPU, tau(n-1) = 0.
+           Dimension (n-1).
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status rocsolver_dgehrd(rocsolver_handle handle,
+                                                   rocsolver_int n, double *A,
+                                                   rocsolver_int lda,
+                                                   double *tau);
+
+/*! \brief LAPACK API
+
+  \details
+  geev computes the eigenvalues and, optionally, the right eigenvectors of
+  a real general n-by-n matrix A:
+     A * v(j) = lambda(j) * v(j)
+  A is balanced by a diagonal similarity, reduced to upper Hessenberg form
+  (see gehrd) and then to real Schur form T = Z**T * A * Z by the QR
+  iteration. For n < 75 it is the double shift one, in one workgroup;
+  from n = 75 on it is the multishift one with aggressive early deflation,
+  whose sweeps chase chains of small bulges one window per workgroup and
+  update the rest of the matrix with gemms. The latter waits for the
+  device once per iteration. The eigenvectors of T are found by back
+  substitution, one workgroup each, and multiplied by Z with one gemm.
+
+  @param[in]
+  evect
+           rocsolver_evect_none: compute the eigenvalues only;
+           rocsolver_evect_original: compute the right eigenvectors too.
+
+  @param[in]
+  n
+           The order of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the matrix A. On exit, destroyed.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  WR
+           pointer to the real parts of the eigenvalues on the GPU.
+           Dimension (n).
+
+  @param[out]
+  WI
+           pointer to the imaginary parts of the eigenvalues on the GPU.
+           Dimension (n). Complex conjugate pairs are consecutive, the one
+           with positive imaginary part first.
+
+  @param[out]
+  V
+           pointer to the eigenvectors on the GPU if evect is
+           rocsolver_evect_original, otherwise not referenced. v(j) is
+           column j of V for a real eigenvalue; for a complex pair j, j+1,
+           v(j) = V(:,j) + i*V(:,j+1) and v(j+1) = V(:,j) - i*V(:,j+1).
+           Each vector has Euclidean norm 1 and its largest component
+           real.
+
+  @param[in]
+  ldv
+           The leading dimension of the array V.  ldv >= 1, and
+           ldv >= n if evect is rocsolver_evect_original.
+
+  @param[out]
+  info
+           pointer to an integer on the GPU. info = 0 on success;
+           info = i > 0 if the QR iteration failed to converge: the
+           eigenvalues i+1:n are then in WR and WI, and V is not valid.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_sgeev(rocsolver_handle handle, rocsolver_evect evect,
+                rocsolver_int n, float *A, rocsolver_int lda, float *WR,
+                float *WI, float *V, rocsolver_int ldv, rocsolver_int *info);
+
+/*! \brief LAPACK API
+
+  \details
+  geev computes the eigenvalues and, optionally, the right eigenvectors of
+  a real general n-by-n matrix A:
+     A * v(j) = lambda(j) * v(j)
+  A is balanced by a diagonal similarity, reduced to upper Hessenberg form
+  (see gehrd) and then to real Schur form T = Z**T * A * Z by the QR
+  iteration. For n < 75 it is the double shift one, in one workgroup;
+  from n = 75 on it is the multishift one with aggressive early deflation,
+  whose sweeps chase chains of small bulges one window per workgroup and
+  update the rest of the matrix with gemms. The latter waits for the
+  device once per iteration. The eigenvectors of T are found by back
+  substitution, one workgroup each, and multiplied by Z with one gemm.
+
+  @param[in]
+  evect
+           rocsolver_evect_none: compute the eigenvalues only;
+           rocsolver_evect_original: compute the right eigenvectors too.
+
+  @param[in]
+  n
+           The order of the matrix A.  n >= 0.
+
+  @param[in,out]
+  A
+           pointer storing matrix A on the GPU.
+           On entry, the matrix A. On exit, destroyed.
+
+  @param[in]
+  lda
+           The leading dimension of the array A.  lda >= max(1,n).
+
+  @param[out]
+  WR
+           pointer to the real parts of the eigenvalues on the GPU.
+           Dimension (n).
+
+  @param[out]
+  WI
+           pointer to the imaginary parts of the eigenvalues on the GPU.
+           Dimension (n). Complex conjugate pairs are consecutive, the one
+           with positive imaginary part first.
+
+  @param[out]
+  V
+           pointer to the eigenvectors on the GPU if evect is
+           rocsolver_evect_original, otherwise not referenced. v(j) is
+           column j of V for a real eigenvalue; for a complex pair j, j+1,
+           v(j) = V(:,j) + i*V(:,j+1) and v(j+1) = V(:,j) - i*V(:,j+1).
+           Each vector has Euclidean norm 1 and its largest component
+           real.
+
+  @param[in]
+  ldv
+           The leading dimension of the array V.  ldv >= 1, and
+           ldv >= n if evect is rocsolver_evect_original.
+
+  @param[out]
+  info
+           pointer to an integer on the GPU. info = 0 on success;
+           info = i > 0 if the QR iteration failed to converge: the
+           eigenvalues i+1:n are then in WR and WI, and V is not valid.
+
+   ********************************************************************/
+ROCSOLVER_EXPORT rocsolver_status
+rocsolver_dgeev(rocsolver_handle handle, rocsolver_evect evect,
+                rocsolver_int n, double *A, rocsolver_int lda, double *WR,
+                double *WI, double *V, rocsolver_int ldv, rocsolver_int *info);
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,4 +25,43 @@ typedef rocblas_status rocsolver_status;
 typedef rocblas_precision rocsolver_precision;
 typedef rocblas_layer_mode rocsolver_layer_mode;
 
+/*! \brief Used to specify the matrix norm.
+ */
+typedef enum rocsolver_norm_type_ {
+  rocsolver_norm_one = 211, /**< maximum column sum */
+  rocsolver_norm_inf = 212, /**< maximum row sum */
+  rocsolver_norm_max = 213, /**< largest absolute value of an element */
+  rocsolver_norm_frobenius = 214, /**< square root of the sum of squares */
+} rocsolver_norm_type;
+
+/*! \brief Used to report the equilibration applied to a matrix.
+ */
+typedef enum rocsolver_equed_ {
+  rocsolver_equed_none = 221,   /**< not scaled */
+  rocsolver_equed_row = 222,    /**< rows scaled: diag(r) * A */
+  rocsolver_equed_column = 223, /**< columns scaled: A * diag(c) */
+  rocsolver_equed_both = 224,   /**< both: diag(r) * A * diag(c) */
+} rocsolver_equed;
+
+/*! \brief Used to specify whether eigenvectors are computed.
+ */
+typedef enum rocsolver_evect_ {
+  rocsolver_evect_none = 231,     /**< eigenvalues only */
+  rocsolver_evect_original = 232, /**< eigenvectors of the original matrix */
+} rocsolver_evect;
+
+/*! \brief Used to specify how many singular vectors are computed.
+ */
+typedef enum rocsolver_svect_ {
+  rocsolver_svect_all = 241,      /**< all the singular vectors */
+  rocsolver_svect_singular = 242, /**< the min(m,n) leading vectors only */
+  rocsolver_svect_none = 243,     /**< no singular vectors */
+} rocsolver_svect;
+
+/*! \brief rocsolver_lu_plan holds an LU factorization and everything needed
+ * to solve with it repeatedly. It is created by rocsolver_lu_plan_create()
+ * and must be released with rocsolver_lu_plan_destroy().
+ */
+typedef struct _rocsolver_lu_plan *rocsolver_lu_plan;
+
 #endif
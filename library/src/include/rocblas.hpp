@@ -41,6 +41,12 @@ rocblas_status rocblas_dot(rocblas_handle handle, rocblas_int n, const T *x,
                            rocblas_int incx, const T *y, rocblas_int incy,
                            T *result);
 
+// x**H * y; the plain dot for the real types
+template <typename T>
+rocblas_status rocblas_dotc(rocblas_handle handle, rocblas_int n, const T *x,
+                            rocblas_int incx, const T *y, rocblas_int incy,
+                            T *result);
+
 template <typename T1, typename T2>
 rocblas_status rocblas_asum(rocblas_handle handle, rocblas_int n, const T1 *x,
                             rocblas_int incx, T2 *result);
@@ -4,7 +4,10 @@
 #ifndef HELPERS_H
 #define HELPERS_H
 
+#include <cmath>
 #include <cstring>
+#include <hip/hip_runtime.h>
+#include <rocblas.h>
 
 inline size_t idx2D(const size_t i, const size_t j, const size_t lda) {
   return j * lda + i;
@@ -14,4 +17,124 @@ template <typename T> T machine_precision() {
   return static_cast<T>(1.19e-07); // the single precision value
 }
 
+/*
+ * Scalar arithmetic for the kernels that are instantiated for the complex
+ * types too. rocblas_float_complex and rocblas_double_complex are hip vector
+ * types, whose operators act componentwise (and whose conversion from a
+ * scalar fills both components), so constants, products, quotients and
+ * conjugates go through these overloads; sums and differences may use the
+ * operators directly.
+ */
+template <typename T> __host__ __device__ inline T scalar_const(double r) {
+  return static_cast<T>(r);
+}
+
+template <>
+__host__ __device__ inline rocblas_float_complex scalar_const(double r) {
+  rocblas_float_complex z;
+  z.x = static_cast<float>(r);
+  z.y = 0;
+  return z;
+}
+
+template <>
+__host__ __device__ inline rocblas_double_complex scalar_const(double r) {
+  rocblas_double_complex z;
+  z.x = r;
+  z.y = 0;
+  return z;
+}
+
+__host__ __device__ inline float scalar_real(float a) { return a; }
+__host__ __device__ inline double scalar_real(double a) { return a; }
+__host__ __device__ inline float scalar_real(rocblas_float_complex a) {
+  return a.x;
+}
+__host__ __device__ inline double scalar_real(rocblas_double_complex a) {
+  return a.x;
+}
+
+// whether T is one of the complex types, for the steps (as the conjugations
+// of the Hermitian routines) that the real types skip
+template <typename T> struct is_complex { static const bool value = false; };
+template <> struct is_complex<rocblas_float_complex> {
+  static const bool value = true;
+};
+template <> struct is_complex<rocblas_double_complex> {
+  static const bool value = true;
+};
+
+__host__ __device__ inline bool scalar_is_zero(float a) { return a == 0; }
+__host__ __device__ inline bool scalar_is_zero(double a) { return a == 0; }
+__host__ __device__ inline bool scalar_is_zero(rocblas_float_complex a) {
+  return a.x == 0 && a.y == 0;
+}
+__host__ __device__ inline bool scalar_is_zero(rocblas_double_complex a) {
+  return a.x == 0 && a.y == 0;
+}
+
+__host__ __device__ inline float scalar_conj(float a) { return a; }
+__host__ __device__ inline double scalar_conj(double a) { return a; }
+__host__ __device__ inline rocblas_float_complex
+scalar_conj(rocblas_float_complex a) {
+  a.y = -a.y;
+  return a;
+}
+__host__ __device__ inline rocblas_double_complex
+scalar_conj(rocblas_double_complex a) {
+  a.y = -a.y;
+  return a;
+}
+
+__host__ __device__ inline float scalar_mul(float a, float b) { return a * b; }
+__host__ __device__ inline double scalar_mul(double a, double b) {
+  return a * b;
+}
+
+template <typename C> __host__ __device__ inline C complex_mul(C a, C b) {
+  C z;
+  z.x = a.x * b.x - a.y * b.y;
+  z.y = a.x * b.y + a.y * b.x;
+  return z;
+}
+__host__ __device__ inline rocblas_float_complex
+scalar_mul(rocblas_float_complex a, rocblas_float_complex b) {
+  return complex_mul(a, b);
+}
+__host__ __device__ inline rocblas_double_complex
+scalar_mul(rocblas_double_complex a, rocblas_double_complex b) {
+  return complex_mul(a, b);
+}
+
+__host__ __device__ inline float scalar_div(float a, float b) { return a / b; }
+__host__ __device__ inline double scalar_div(double a, double b) {
+  return a / b;
+}
+
+// Smith's algorithm: scaling by the larger component of b avoids the
+// overflow of |b|**2
+template <typename C> __host__ __device__ inline C complex_div(C a, C b) {
+  C z;
+  if (fabs(b.x) >= fabs(b.y)) {
+    const auto r = b.y / b.x;
+    const auto d = b.x + r * b.y;
+    z.x = (a.x + a.y * r) / d;
+    z.y = (a.y - a.x * r) / d;
+  } else {
+    const auto r = b.x / b.y;
+    const auto d = b.y + r * b.x;
+    z.x = (a.x * r + a.y) / d;
+    z.y = (a.y * r - a.x) / d;
+  }
+  return z;
+}
+__host__ __device__ inline rocblas_float_complex
+scalar_div(rocblas_float_complex a, rocblas_float_complex b) {
+  return complex_div(a, b);
+}
+__host__ __device__ inline rocblas_double_complex
+scalar_div(rocblas_double_complex a, rocblas_double_complex b) {
+  return complex_div(a, b);
+}
+
 #endif /* HELPERS_H */
@@ -3,7 +3,148 @@
 
 #define LASWP_BLOCKSIZE 256
 #define GETF2_BLOCKSIZE 256
+#define POTF2_BLOCKSIZE 256
 
 #define GETRF_GETF2_SWITCHSIZE 16
 
+// tiled (task graph) factorizations
+#define TILE_DAG_NSTREAMS 4
+#define POTRF_TILESIZE 256
+#define POTRF_SYRK_BLOCKSIZE 16
+#define GETRF_TILESIZE 256
+#define GETRF_TILED_SWITCHSIZE 2048
+
+// band factorization and solve (one workgroup per matrix / right hand side),
+// and columns per panel of the blocked band factorization, taken when the
+// band has at least as many subdiagonals
+#define GBTRF_BLOCKSIZE 256
+#define GBTRS_BLOCKSIZE 256
+#define GBTRF_NB 32
+
+// Cholesky update/downdate: panel width and rows per trailing workgroup
+#define POTUPDATE_BLOCKSIZE 32
+#define POTUPDATE_APPLY_BLOCKSIZE 256
+
+// getrs with few right hand sides: single fused kernel up to this order
+#define GETRS_FUSED_BLOCKSIZE 256
+#define GETRS_FUSED_MAXRHS 8
+#define GETRS_FUSED_SWITCHSIZE 2048
+
+// getrs with inverted diagonal blocks: order of the blocks
+#define GETRS_INVDIAG_BLOCKSIZE 64
+
+// LU plan: rows per workgroup of the copy and permutation kernels
+#define LU_PLAN_BLOCKSIZE 256
+
+// triangular inverse (diagonal block size) and getri (block column width)
+#define TRTRI_BLOCKSIZE 64
+#define GETRI_BLOCKSIZE 64
+#define GETRI_ROWS_BLOCKSIZE 256
+
+// condition estimation: threads of the workgroup of each estimate
+#define LACN2_BLOCKSIZE 256
+
+// iterative refinement: rows per workgroup of the elementwise kernels
+#define GERFS_BLOCKSIZE 256
+
+// matrix norms: threads per column (one, max and Frobenius norms) or rows per
+// workgroup (infinity norm) of the first pass, and of the final reduction
+#define LANGE_BLOCKSIZE 256
+
+// equilibration: rows per workgroup of the scaling kernel of laqge (geequ
+// takes the reductions of the norms)
+#define LAQGE_BLOCKSIZE 256
+
+// Householder QR: columns per block of reflectors (geqrf, orgqr, ormqr), the
+// order below which geqrf is unblocked, threads of the larfg reduction and
+// rows per workgroup of the elementwise kernels
+#define GEQRF_BLOCKSIZE 32
+#define GEQRF_GEQR2_SWITCHSIZE 128
+#define LARFG_BLOCKSIZE 256
+#define LARFT_BLOCKSIZE 256
+
+// tall-skinny QR: geqrf goes through TSQR for at least GEQRF_TSQR_RATIO rows
+// per column and up to GEQRF_TSQR_MAXCOLS columns; rows of the leaf blocks,
+// children per node of the reduction tree and rows per workgroup of the
+// products with the small factors of the tree (its workgroups have
+// LARFG_BLOCKSIZE threads)
+#define GEQRF_TSQR_RATIO 64
+#define GEQRF_TSQR_MAXCOLS 256
+#define TSQR_LEAF_ROWS 512
+#define TSQR_ARITY 4
+#define TSQR_ROWMUL_ROWS 8
+
+// least squares: problems of up to GELS_SMALL_MAXROWS x GELS_SMALL_MAXCOLS
+// (either way round) are solved by one workgroup each, the whole batch in
+// one kernel; threads of the elementwise kernels
+#define GELS_SMALL_MAXROWS 1024
+#define GELS_SMALL_MAXCOLS 64
+#define GELS_BLOCKSIZE 256
+
+// QR with column pivoting: columns per block of gathered updates (the
+// reductions of its kernels have LARFG_BLOCKSIZE threads)
+#define GEQP3_BLOCKSIZE 32
+
+// symmetric eigensolver: bandwidth of the first stage of the tridiagonal
+// reduction (the second stage runs in workgroups of LARFG_BLOCKSIZE
+// threads), order of the leaves of divide and conquer, threads of the
+// elementwise and per-eigenvalue kernels, and largest order whose
+// eigenvectors syev finds by the QL iteration (in one workgroup) rather than
+// by divide and conquer
+#define SYTRD_BANDWIDTH 32
+#define STEDC_LEAFSIZE 32
+#define STEDC_BLOCKSIZE 256
+#define SYEV_STEQR_MAXSIZE 256
+
+// batched Jacobi eigensolver: largest order kept in LDS, solved by one
+// workgroup of up to SYEVJ_BLOCKSIZE threads per matrix
+#define SYEVJ_MAX_SIZE 32
+#define SYEVJ_BLOCKSIZE 256
+
+// singular value decomposition: columns per panel of the bidiagonal
+// reduction, threads of the bidiagonal QR iteration, largest order whose
+// singular vectors it updates in its one workgroup (beyond it, the rotations
+// are logged and applied by all workgroups, in BDSQR_ROUNDS rounds), and the
+// aspect ratio m / n from which A is first reduced to triangular form by
+// geqrf
+#define GEBRD_BLOCKSIZE 32
+#define BDSQR_BLOCKSIZE 256
+#define BDSQR_VECTORS_MAXSIZE 256
+#define BDSQR_ROUNDS 32
+#define GESVD_QR_RATIO 2
+
+// batched one-sided Jacobi SVD: largest m and n kept in LDS, solved by one
+// workgroup of GESVDJ_BLOCKSIZE threads (a power of two) per matrix
+#define GESVDJ_MAX_SIZE 64
+#define GESVDJ_BLOCKSIZE 256
+
+// tridiagonal systems: largest order solved by cyclic reduction in LDS, by a
+// workgroup of up to GTSV_BLOCKSIZE threads per system and right hand side;
+// rows per block of the partitioned algorithm for larger orders (one thread
+// per block), which leaves a system of its separators GTSV_PARTITION_ROWS
+// times smaller
+#define GTSV_MAX_SIZE 1024
+#define GTSV_BLOCKSIZE 256
+#define GTSV_PARTITION_ROWS 32
+
+// block-tridiagonal systems: largest order of the blocks, kept in LDS, and
+// threads per workgroup, one workgroup per block row of every system
+#define GEBLTSV_MAX_BLOCK 32
+#define GEBLTSV_BLOCKSIZE 256
+
+// nonsymmetric eigensolver: columns per panel of the Hessenberg reduction,
+// threads of the balancing and of the kernels of the QR iteration (one
+// workgroup each, a power of two), and of the per-eigenvector kernels
+#define GEHRD_BLOCKSIZE 32
+#define GEBAL_BLOCKSIZE 256
+#define HSEQR_BLOCKSIZE 256
+#define GEEV_BLOCKSIZE 256
+
+// the QR iteration is the double-shift one in one workgroup below
+// HSEQR_MULTISHIFT_MINSIZE (LAPACK's nmin), and the multishift one with
+// aggressive early deflation from it on; there a sweep is skipped when the
+// deflation took more than HSEQR_NIBBLE percent of the window
+#define HSEQR_MULTISHIFT_MINSIZE 75
+#define HSEQR_NIBBLE 14
+
 #endif /* IDEAL_SIZES_HPP */
@@ -38,6 +38,20 @@ rocblas_status rocblas_dot(rocblas_handle handle, rocblas_int n,
   return rocblas_ddot(handle, n, x, incx, y, incy, result);
 }
 
+template <>
+rocblas_status rocblas_dotc(rocblas_handle handle, rocblas_int n,
+                            const float *x, rocblas_int incx, const float *y,
+                            rocblas_int incy, float *result) {
+  return rocblas_sdot(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+rocblas_status rocblas_dotc(rocblas_handle handle, rocblas_int n,
+                            const double *x, rocblas_int incx, const double *y,
+                            rocblas_int incy, double *result) {
+  return rocblas_ddot(handle, n, x, incx, y, incy, result);
+}
+
 template <>
 rocblas_status rocblas_iamax(rocblas_handle handle, rocblas_int n,
                              const float *x, rocblas_int incx,
@@ -128,4 +142,221 @@ rocblas_status rocblas_trsm(rocblas_handle handle, rocblas_side side,
                             double *B, rocblas_int ldb) {
   return rocblas_dtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B,
                        ldb);
-}
\ No newline at end of file
+}
+
+template <>
+rocblas_status rocblas_trtri(rocblas_handle handle, rocblas_fill uplo,
+                             rocblas_diagonal diag, rocblas_int n, float *A,
+                             rocblas_int lda, float *invA, rocblas_int ldinvA) {
+  return rocblas_strtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
+}
+
+template <>
+rocblas_status rocblas_trtri(rocblas_handle handle, rocblas_fill uplo,
+                             rocblas_diagonal diag, rocblas_int n, double *A,
+                             rocblas_int lda, double *invA,
+                             rocblas_int ldinvA) {
+  return rocblas_dtrtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
+}
+
+template <>
+rocblas_status rocblas_trtri_batched(rocblas_handle handle, rocblas_fill uplo,
+                                     rocblas_diagonal diag, rocblas_int n,
+                                     float *A, rocblas_int lda,
+                                     rocblas_int bsa, float *invA,
+                                     rocblas_int ldinvA, rocblas_int bsinvA,
+                                     rocblas_int batch_count) {
+  return rocblas_strtri_batched(handle, uplo, diag, n, A, lda, bsa, invA,
+                                ldinvA, bsinvA, batch_count);
+}
+
+template <>
+rocblas_status rocblas_trtri_batched(rocblas_handle handle, rocblas_fill uplo,
+                                     rocblas_diagonal diag, rocblas_int n,
+                                     double *A, rocblas_int lda,
+                                     rocblas_int bsa, double *invA,
+                                     rocblas_int ldinvA, rocblas_int bsinvA,
+                                     rocblas_int batch_count) {
+  return rocblas_dtrtri_batched(handle, uplo, diag, n, A, lda, bsa, invA,
+                                ldinvA, bsinvA, batch_count);
+}
+
+// complex wrappers, for the LU factorization and solve; ger is the
+// unconjugated rank-1 update, as in LAPACK's cgetf2 and zgetf2
+
+template <>
+rocblas_status rocblas_iamax(rocblas_handle handle, rocblas_int n,
+                             const rocblas_float_complex *x, rocblas_int incx,
+                             rocblas_int *result) {
+  return rocblas_icamax(handle, n, x, incx, result);
+}
+
+template <>
+rocblas_status rocblas_iamax(rocblas_handle handle, rocblas_int n,
+                             const rocblas_double_complex *x, rocblas_int incx,
+                             rocblas_int *result) {
+  return rocblas_izamax(handle, n, x, incx, result);
+}
+
+template <>
+rocblas_status rocblas_ger(rocblas_handle handle, rocblas_int m, rocblas_int n,
+                           const rocblas_float_complex *alpha,
+                           const rocblas_float_complex *x, rocblas_int incx,
+                           const rocblas_float_complex *y, rocblas_int incy,
+                           rocblas_float_complex *A, rocblas_int lda) {
+  return rocblas_cgeru(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+rocblas_status rocblas_ger(rocblas_handle handle, rocblas_int m, rocblas_int n,
+                           const rocblas_double_complex *alpha,
+                           const rocblas_double_complex *x, rocblas_int incx,
+                           const rocblas_double_complex *y, rocblas_int incy,
+                           rocblas_double_complex *A, rocblas_int lda) {
+  return rocblas_zgeru(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+rocblas_status
+rocblas_gemm(rocblas_handle handle, rocblas_operation transA,
+             rocblas_operation transB, rocblas_int m, rocblas_int n,
+             rocblas_int k, const rocblas_float_complex *alpha,
+             const rocblas_float_complex *A, rocblas_int lda,
+             const rocblas_float_complex *B, rocblas_int ldb,
+             const rocblas_float_complex *beta, rocblas_float_complex *C,
+             rocblas_int ldc) {
+  return rocblas_cgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb,
+                       beta, C, ldc);
+}
+
+template <>
+rocblas_status
+rocblas_gemm(rocblas_handle handle, rocblas_operation transA,
+             rocblas_operation transB, rocblas_int m, rocblas_int n,
+             rocblas_int k, const rocblas_double_complex *alpha,
+             const rocblas_double_complex *A, rocblas_int lda,
+             const rocblas_double_complex *B, rocblas_int ldb,
+             const rocblas_double_complex *beta, rocblas_double_complex *C,
+             rocblas_int ldc) {
+  return rocblas_zgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb,
+                       beta, C, ldc);
+}
+
+template <>
+rocblas_status rocblas_trsm(rocblas_handle handle, rocblas_side side,
+                            rocblas_fill uplo, rocblas_operation transA,
+                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+                            const rocblas_float_complex *alpha,
+                            rocblas_float_complex *A, rocblas_int lda,
+                            rocblas_float_complex *B, rocblas_int ldb) {
+  return rocblas_ctrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B,
+                       ldb);
+}
+
+template <>
+rocblas_status rocblas_trsm(rocblas_handle handle, rocblas_side side,
+                            rocblas_fill uplo, rocblas_operation transA,
+                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
+                            const rocblas_double_complex *alpha,
+                            rocblas_double_complex *A, rocblas_int lda,
+                            rocblas_double_complex *B, rocblas_int ldb) {
+  return rocblas_ztrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B,
+                       ldb);
+}
+
+template <>
+rocblas_status rocblas_trtri(rocblas_handle handle, rocblas_fill uplo,
+                             rocblas_diagonal diag, rocblas_int n,
+                             rocblas_float_complex *A, rocblas_int lda,
+                             rocblas_float_complex *invA, rocblas_int ldinvA) {
+  return rocblas_ctrtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
+}
+
+template <>
+rocblas_status rocblas_trtri(rocblas_handle handle, rocblas_fill uplo,
+                             rocblas_diagonal diag, rocblas_int n,
+                             rocblas_double_complex *A, rocblas_int lda,
+                             rocblas_double_complex *invA, rocblas_int ldinvA) {
+  return rocblas_ztrtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
+}
+
+template <>
+rocblas_status rocblas_trtri_batched(rocblas_handle handle, rocblas_fill uplo,
+                                     rocblas_diagonal diag, rocblas_int n,
+                                     rocblas_float_complex *A, rocblas_int lda,
+                                     rocblas_int bsa,
+                                     rocblas_float_complex *invA,
+                                     rocblas_int ldinvA, rocblas_int bsinvA,
+                                     rocblas_int batch_count) {
+  return rocblas_ctrtri_batched(handle, uplo, diag, n, A, lda, bsa, invA,
+                                ldinvA, bsinvA, batch_count);
+}
+
+template <>
+rocblas_status rocblas_trtri_batched(rocblas_handle handle, rocblas_fill uplo,
+                                     rocblas_diagonal diag, rocblas_int n,
+                                     rocblas_double_complex *A,
+                                     rocblas_int lda, rocblas_int bsa,
+                                     rocblas_double_complex *invA,
+                                     rocblas_int ldinvA, rocblas_int bsinvA,
+                                     rocblas_int batch_count) {
+  return rocblas_ztrtri_batched(handle, uplo, diag, n, A, lda, bsa, invA,
+                                ldinvA, bsinvA, batch_count);
+}
+
+// complex wrappers for the Hermitian Cholesky factorization: the conjugated
+// dot, gemv and scal, as in LAPACK's cpotf2 and zpotf2
+
+template <>
+rocblas_status rocblas_dotc(rocblas_handle handle, rocblas_int n,
+                            const rocblas_float_complex *x, rocblas_int incx,
+                            const rocblas_float_complex *y, rocblas_int incy,
+                            rocblas_float_complex *result) {
+  return rocblas_cdotc(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+rocblas_status rocblas_dotc(rocblas_handle handle, rocblas_int n,
+                            const rocblas_double_complex *x, rocblas_int incx,
+                            const rocblas_double_complex *y, rocblas_int incy,
+                            rocblas_double_complex *result) {
+  return rocblas_zdotc(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+rocblas_status
+rocblas_gemv(rocblas_handle handle, rocblas_operation transA, rocblas_int m,
+             rocblas_int n, const rocblas_float_complex *alpha,
+             const rocblas_float_complex *A, rocblas_int lda,
+             const rocblas_float_complex *x, rocblas_int incx,
+             const rocblas_float_complex *beta, rocblas_float_complex *y,
+             rocblas_int incy) {
+  return rocblas_cgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y,
+                       incy);
+}
+
+template <>
+rocblas_status
+rocblas_gemv(rocblas_handle handle, rocblas_operation transA, rocblas_int m,
+             rocblas_int n, const rocblas_double_complex *alpha,
+             const rocblas_double_complex *A, rocblas_int lda,
+             const rocblas_double_complex *x, rocblas_int incx,
+             const rocblas_double_complex *beta, rocblas_double_complex *y,
+             rocblas_int incy) {
+  return rocblas_zgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y,
+                       incy);
+}
+
+template <>
+rocblas_status rocblas_scal(rocblas_handle handle, rocblas_int n,
+                            const rocblas_float_complex *alpha,
+                            rocblas_float_complex *x, rocblas_int incx) {
+  return rocblas_cscal(handle, n, alpha, x, incx);
+}
+
+template <>
+rocblas_status rocblas_scal(rocblas_handle handle, rocblas_int n,
+                            const rocblas_double_complex *alpha,
+                            rocblas_double_complex *x, rocblas_int incx) {
+  return rocblas_zscal(handle, n, alpha, x, incx);
+}
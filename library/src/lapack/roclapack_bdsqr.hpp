@@ -0,0 +1,508 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_BDSQR_HPP
+#define ROCLAPACK_BDSQR_HPP
+
+#include <cmath>
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+/*
+ * The rotations of a sweep are recorded as (a, b, c, s), to be applied to
+ * the pair of vectors a and b as a := c * a - s * b, b := s * a + c * b;
+ * those from the left go to the columns of U and those from the right to
+ * the rows of V**T. Up to BDSQR_VECTORS_MAXSIZE, one workgroup applies them
+ * after each step; beyond it, the iteration only logs them, cap at a time,
+ * and all workgroups apply the log (see bdsqr_chase and bdsqr_rotate).
+ */
+
+// entries of each log of rotations: the iteration needs 6 * n**2 inner
+// steps at most, and a round ends with less than n + 2 * n free entries, so
+// that BDSQR_ROUNDS rounds are always enough
+inline size_t bdsqr_log_size(rocblas_int n) {
+  if (n <= BDSQR_VECTORS_MAXSIZE)
+    return n;
+  return 6 * size_t(n) * n / (BDSQR_ROUNDS - 2) + 3 * size_t(n);
+}
+
+// elements of the workspace and of the integer workspace: the two logs,
+// then the largest entry of B and the state of the iteration
+inline size_t bdsqr_work_size(rocblas_int n) {
+  return 4 * bdsqr_log_size(n) + 1;
+}
+
+inline size_t bdsqr_iwork_size(rocblas_int n) {
+  return 4 * bdsqr_log_size(n) + 4;
+}
+
+// c and s with c * f - s * g = r and s * f + c * g = 0
+template <typename T> __device__ void bdsqr_rot(T f, T g, T &c, T &s, T &r) {
+  r = hypot(f, g);
+  if (r == 0) {
+    c = 1;
+    s = 0;
+  } else {
+    c = f / r;
+    s = -g / r;
+  }
+}
+
+/*
+ * One implicit Golub-Kahan step on the block lo:hi+1 of the upper bidiagonal
+ * (d, e), with the Wilkinson shift of the trailing 2 x 2 block of B**T * B.
+ * The bulge is chased down by pairs of rotations, one from the right on
+ * columns k, k+1 and one from the left on rows k, k+1.
+ */
+template <typename T>
+__device__ void bdsqr_step(rocblas_int lo, rocblas_int hi, T *d, T *e,
+                           T *lc, T *ls, rocblas_int *la, rocblas_int &nl,
+                           T *rc, T *rs, rocblas_int *ra, rocblas_int &nr) {
+  const T dm = d[hi - 1];
+  const T dn = d[hi];
+  const T em = e[hi - 1];
+  const T el = (hi - 1 > lo) ? e[hi - 2] : 0;
+  const T t11 = dm * dm + el * el;
+  const T t12 = dm * em;
+  const T t22 = dn * dn + em * em;
+  const T delta = (t11 - t22) / 2;
+  T mu = t22;
+  if (t12 != 0) {
+    const T h = hypot(delta, t12);
+    mu -= t12 * t12 / (delta + ((delta < 0) ? -h : h));
+  }
+
+  T y = d[lo] * d[lo] - mu;
+  T z = d[lo] * e[lo];
+  T c, s, r;
+  for (rocblas_int k = lo; k < hi; ++k) {
+    // from the right on columns k, k+1
+    bdsqr_rot(y, z, c, s, r);
+    if (k > lo)
+      e[k - 1] = r;
+    const T dk = d[k];
+    const T ek = e[k];
+    d[k] = c * dk - s * ek;
+    e[k] = s * dk + c * ek;
+    const T bulge = -s * d[k + 1];
+    d[k + 1] *= c;
+    rc[nr] = c;
+    rs[nr] = s;
+    ra[nr++] = k;
+
+    // from the left on rows k, k+1
+    bdsqr_rot(d[k], bulge, c, s, r);
+    d[k] = r;
+    const T ek2 = e[k];
+    const T dk1 = d[k + 1];
+    e[k] = c * ek2 - s * dk1;
+    d[k + 1] = s * ek2 + c * dk1;
+    if (k + 1 < hi) {
+      z = -s * e[k + 1];
+      e[k + 1] *= c;
+      y = e[k];
+    }
+    lc[nl] = c;
+    ls[nl] = s;
+    la[nl++] = k;
+  }
+}
+
+/*
+ * The next step of the QR iteration on the upper bidiagonal (d, e) of order
+ * n, by one thread: an e(i) small relative to its neighbours in d splits
+ * the matrix, a zero on the diagonal of the last block not yet split off is
+ * chased out of it by rotations, and otherwise a shifted Golub-Kahan step is
+ * taken. The rotations are appended to the logs, from entry nl of the left
+ * one and nr of the right one. Returns whether the iteration is over: every
+ * e(i) is zero or more than maxit inner steps were taken.
+ */
+template <typename T>
+__device__ bool bdsqr_next(rocblas_int n, T *d, T *e, T *lc, T *ls,
+                           rocblas_int *la, rocblas_int *lb, rocblas_int &nl,
+                           T *rc, T *rs, rocblas_int *ra, rocblas_int *rb,
+                           rocblas_int &nr, rocblas_int &iter,
+                           rocblas_int maxit, T smax, T eps, T sfmin) {
+  for (rocblas_int i = 0; i < n - 1; ++i)
+    if (fabs(e[i]) <= eps * (fabs(d[i]) + fabs(d[i + 1])) ||
+        fabs(e[i]) <= sfmin)
+      e[i] = 0;
+  for (rocblas_int i = 0; i < n; ++i)
+    if (fabs(d[i]) <= eps * smax)
+      d[i] = 0;
+
+  // the last block not yet split off, lo:hi+1
+  rocblas_int hi = n - 1;
+  while (hi > 0 && e[hi - 1] == 0)
+    --hi;
+  if (hi == 0 || iter > maxit)
+    return true;
+  rocblas_int lo = hi - 1;
+  while (lo > 0 && e[lo - 1] != 0)
+    --lo;
+  rocblas_int z = hi + 1;
+  for (rocblas_int i = lo; i <= hi && z > hi; ++i)
+    if (d[i] == 0)
+      z = i;
+
+  const rocblas_int nl0 = nl, nr0 = nr;
+  if (z < hi) {
+    // d(z) = 0: row z is chased right by rotations with rows z+1:hi+1
+    T x = e[z];
+    e[z] = 0;
+    for (rocblas_int j = z + 1; j <= hi; ++j) {
+      const T r = hypot(d[j], x);
+      const T c = d[j] / r;
+      const T s = x / r;
+      d[j] = r;
+      if (j < hi) {
+        x = -s * e[j];
+        e[j] *= c;
+      }
+      lc[nl] = c;
+      ls[nl] = s;
+      la[nl] = z;
+      lb[nl++] = j;
+    }
+  } else if (z == hi) {
+    // d(hi) = 0: column hi is chased up by rotations with columns hi-1 down
+    // to lo
+    T x = e[hi - 1];
+    e[hi - 1] = 0;
+    for (rocblas_int j = hi - 1; j >= lo; --j) {
+      const T r = hypot(d[j], x);
+      const T c = d[j] / r;
+      const T s = x / r;
+      d[j] = r;
+      if (j > lo) {
+        x = -s * e[j - 1];
+        e[j - 1] *= c;
+      }
+      rc[nr] = c;
+      rs[nr] = s;
+      ra[nr] = hi;
+      rb[nr++] = j;
+    }
+  } else {
+    bdsqr_step<T>(lo, hi, d, e, lc, ls, la, nl, rc, rs, ra, nr);
+    for (rocblas_int t = nl0; t < nl; ++t)
+      lb[t] = la[t] + 1;
+    for (rocblas_int t = nr0; t < nr; ++t)
+      rb[t] = ra[t] + 1;
+  }
+  iter += max(nl - nl0, nr - nr0);
+  return false;
+}
+
+// the number of entries of e that did not converge, as info
+template <typename T>
+__device__ rocblas_int bdsqr_nonconv(rocblas_int n, const T *e) {
+  rocblas_int nonconv = 0;
+  for (rocblas_int i = 0; i < n - 1; ++i)
+    if (e[i] != 0)
+      ++nonconv;
+  return nonconv;
+}
+
+/*
+ * The singular values (into d, descending) of the upper bidiagonal (d, e)
+ * of order n by the QR iteration, one workgroup. The left rotations are
+ * applied to the first n columns of U (nru rows) and the right ones to the
+ * first n rows of V**T (ncvt columns), by all threads after each step of
+ * thread 0 (see bdsqr_next). info gets the number of entries of e that did
+ * not converge in 6 * n**2 inner steps, as in LAPACK.
+ */
+template <typename T>
+__global__ void bdsqr_kernel(rocblas_int n, T *d, T *e, T *U, rocblas_int ldu,
+                             rocblas_int nru, T *V, rocblas_int ldv,
+                             rocblas_int ncvt, T *work, rocblas_int *iwork,
+                             rocblas_int *info, T eps, T sfmin) {
+  __shared__ rocblas_int snl, snr, sdone;
+  const int tid = hipThreadIdx_x;
+  T *lc = work;
+  T *ls = lc + n;
+  T *rc = ls + n;
+  T *rs = rc + n;
+  rocblas_int *la = iwork;
+  rocblas_int *lb = la + n;
+  rocblas_int *ra = lb + n;
+  rocblas_int *rb = ra + n;
+
+  // the state of the iteration, in thread 0
+  rocblas_int iter = 0;
+  const rocblas_int maxit = 6 * n * n;
+  T smax = 0;
+  if (tid == 0) {
+    for (rocblas_int i = 0; i < n; ++i)
+      smax = max(smax, fabs(d[i]));
+    for (rocblas_int i = 0; i < n - 1; ++i)
+      smax = max(smax, fabs(e[i]));
+  }
+
+  while (true) {
+    if (tid == 0) {
+      rocblas_int nl = 0, nr = 0;
+      sdone = bdsqr_next<T>(n, d, e, lc, ls, la, lb, nl, rc, rs, ra, rb, nr,
+                            iter, maxit, smax, eps, sfmin);
+      snl = nl;
+      snr = nr;
+    }
+    __syncthreads();
+    if (sdone)
+      break;
+
+    const rocblas_int nl = snl, nr = snr;
+    for (rocblas_int r = tid; r < nru; r += hipBlockDim_x) {
+      for (rocblas_int t = 0; t < nl; ++t) {
+        const T x = U[idx2D(r, la[t], ldu)];
+        const T y = U[idx2D(r, lb[t], ldu)];
+        U[idx2D(r, la[t], ldu)] = lc[t] * x - ls[t] * y;
+        U[idx2D(r, lb[t], ldu)] = ls[t] * x + lc[t] * y;
+      }
+    }
+    for (rocblas_int j = tid; j < ncvt; j += hipBlockDim_x) {
+      for (rocblas_int t = 0; t < nr; ++t) {
+        const T x = V[idx2D(ra[t], j, ldv)];
+        const T y = V[idx2D(rb[t], j, ldv)];
+        V[idx2D(ra[t], j, ldv)] = rc[t] * x - rs[t] * y;
+        V[idx2D(rb[t], j, ldv)] = rs[t] * x + rc[t] * y;
+      }
+    }
+    __syncthreads();
+  }
+
+  if (tid == 0)
+    *info = bdsqr_nonconv<T>(n, e);
+
+  // nonnegative singular values, the rows of V**T along
+  for (rocblas_int j = tid; j < ncvt; j += hipBlockDim_x)
+    for (rocblas_int i = 0; i < n; ++i)
+      if (d[i] < 0)
+        V[idx2D(i, j, ldv)] = -V[idx2D(i, j, ldv)];
+  __syncthreads();
+  if (tid == 0)
+    for (rocblas_int i = 0; i < n; ++i)
+      d[i] = fabs(d[i]);
+  __syncthreads();
+
+  // descending order, the columns of U and rows of V**T along
+  for (rocblas_int i = 0; i < n - 1; ++i) {
+    if (tid == 0) {
+      rocblas_int k = i;
+      for (rocblas_int j = i + 1; j < n; ++j)
+        if (d[j] > d[k])
+          k = j;
+      if (k != i) {
+        const T t = d[i];
+        d[i] = d[k];
+        d[k] = t;
+      }
+      snl = k;
+    }
+    __syncthreads();
+    const rocblas_int k = snl;
+    if (k != i) {
+      for (rocblas_int r = tid; r < nru; r += hipBlockDim_x) {
+        const T t = U[idx2D(r, i, ldu)];
+        U[idx2D(r, i, ldu)] = U[idx2D(r, k, ldu)];
+        U[idx2D(r, k, ldu)] = t;
+      }
+      for (rocblas_int j = tid; j < ncvt; j += hipBlockDim_x) {
+        const T t = V[idx2D(i, j, ldv)];
+        V[idx2D(i, j, ldv)] = V[idx2D(k, j, ldv)];
+        V[idx2D(k, j, ldv)] = t;
+      }
+    }
+    __syncthreads();
+  }
+}
+
+/*
+ * A round of the QR iteration beyond BDSQR_VECTORS_MAXSIZE, by one thread:
+ * steps are taken (see bdsqr_next) while both logs of cap entries have room
+ * for one more, and bdsqr_rotate applies them next. Once the iteration is
+ * over, info is set, and the sign changes and swaps that make the singular
+ * values nonnegative and descending are logged as rotations too: c = -1 on
+ * (i, i) changes the sign of row i of V**T, and c = 0, s = 1 on (i, k) swaps
+ * column or row i with k up to a sign, the same on both sides. The state in
+ * iwork (the lengths of the logs, the inner steps taken, and whether the
+ * iteration is running, over or finished) carries over to the next round,
+ * and a round past the last one logs nothing.
+ */
+template <typename T>
+__global__ void bdsqr_chase(rocblas_int n, T *d, T *e, rocblas_int cap,
+                            T *work, rocblas_int *iwork, rocblas_int *info,
+                            T eps, T sfmin) {
+  T *lc = work;
+  T *ls = lc + cap;
+  T *rc = ls + cap;
+  T *rs = rc + cap;
+  T *smax = rs + cap;
+  rocblas_int *la = iwork;
+  rocblas_int *lb = la + cap;
+  rocblas_int *ra = lb + cap;
+  rocblas_int *rb = ra + cap;
+  rocblas_int *state = rb + cap;
+
+  rocblas_int nl = 0, nr = 0;
+  rocblas_int iter = state[2];
+  rocblas_int stage = state[3];
+  const rocblas_int maxit = 6 * n * n;
+  if (stage == 0 && iter == 0) {
+    *smax = 0;
+    for (rocblas_int i = 0; i < n; ++i)
+      *smax = max(*smax, fabs(d[i]));
+    for (rocblas_int i = 0; i < n - 1; ++i)
+      *smax = max(*smax, fabs(e[i]));
+  }
+
+  while (stage == 0 && nl + n <= cap && nr + n <= cap)
+    if (bdsqr_next<T>(n, d, e, lc, ls, la, lb, nl, rc, rs, ra, rb, nr, iter,
+                      maxit, *smax, eps, sfmin))
+      stage = 1;
+
+  if (stage == 1 && nl + n <= cap && nr + 2 * n <= cap) {
+    *info = bdsqr_nonconv<T>(n, e);
+    for (rocblas_int i = 0; i < n; ++i) {
+      if (d[i] < 0) {
+        d[i] = -d[i];
+        rc[nr] = -1;
+        rs[nr] = 0;
+        ra[nr] = i;
+        rb[nr++] = i;
+      }
+    }
+    for (rocblas_int i = 0; i < n - 1; ++i) {
+      rocblas_int k = i;
+      for (rocblas_int j = i + 1; j < n; ++j)
+        if (d[j] > d[k])
+          k = j;
+      if (k != i) {
+        const T t = d[i];
+        d[i] = d[k];
+        d[k] = t;
+        lc[nl] = 0;
+        ls[nl] = 1;
+        la[nl] = i;
+        lb[nl++] = k;
+        rc[nr] = 0;
+        rs[nr] = 1;
+        ra[nr] = i;
+        rb[nr++] = k;
+      }
+    }
+    stage = 2;
+  }
+
+  state[0] = nl;
+  state[1] = nr;
+  state[2] = iter;
+  state[3] = stage;
+}
+
+/*
+ * The logs of the last round of bdsqr_chase, in order: the left one on the
+ * nru rows of U and the right one on the ncvt columns of V**T, one row or
+ * column per thread (the first blocks of the grid for U, the rest for V).
+ * The entries are staged in LDS, BDSQR_BLOCKSIZE at a time.
+ */
+template <typename T>
+__global__ void bdsqr_rotate(rocblas_int cap, T *U, rocblas_int ldu,
+                             rocblas_int nru, T *V, rocblas_int ldv,
+                             rocblas_int ncvt, T *work, rocblas_int *iwork) {
+  __shared__ T sc[BDSQR_BLOCKSIZE];
+  __shared__ T ss[BDSQR_BLOCKSIZE];
+  __shared__ rocblas_int sa[BDSQR_BLOCKSIZE];
+  __shared__ rocblas_int sb[BDSQR_BLOCKSIZE];
+  const int tid = hipThreadIdx_x;
+  const rocblas_int ublocks = (nru > 0) ? (nru - 1) / BDSQR_BLOCKSIZE + 1 : 0;
+  const bool left = (hipBlockIdx_x < ublocks);
+  const rocblas_int b = left ? hipBlockIdx_x : hipBlockIdx_x - ublocks;
+  const rocblas_int r = b * BDSQR_BLOCKSIZE + tid;
+  const rocblas_int *state = iwork + 4 * size_t(cap);
+  const rocblas_int count = left ? state[0] : state[1];
+  const T *c = left ? work : work + 2 * size_t(cap);
+  const T *s = c + cap;
+  const rocblas_int *a = left ? iwork : iwork + 2 * size_t(cap);
+  const rocblas_int *bb = a + cap;
+  const bool valid = left ? (r < nru) : (r < ncvt);
+
+  for (rocblas_int t0 = 0; t0 < count; t0 += BDSQR_BLOCKSIZE) {
+    const rocblas_int nt = min(count - t0, (rocblas_int)BDSQR_BLOCKSIZE);
+    __syncthreads();
+    if (tid < nt) {
+      sc[tid] = c[t0 + tid];
+      ss[tid] = s[t0 + tid];
+      sa[tid] = a[t0 + tid];
+      sb[tid] = bb[t0 + tid];
+    }
+    __syncthreads();
+    if (valid) {
+      for (rocblas_int t = 0; t < nt; ++t) {
+        T *px = left ? &U[idx2D(r, sa[t], ldu)] : &V[idx2D(sa[t], r, ldv)];
+        T *py = left ? &U[idx2D(r, sb[t], ldu)] : &V[idx2D(sb[t], r, ldv)];
+        const T x = *px;
+        const T y = *py;
+        *px = sc[t] * x - ss[t] * y;
+        *py = ss[t] * x + sc[t] * y;
+      }
+    }
+  }
+}
+
+/*
+ * Enqueue the singular values (into D, descending) of the upper bidiagonal
+ * (D, E) of order n, with U (nru x n) := U * Q and V**T (n x ncvt) := P**T
+ * * V**T for B = Q * diag(D) * P**T; nru or ncvt is 0 when the vectors are
+ * not wanted. work and iwork have bdsqr_work_size(n) and
+ * bdsqr_iwork_size(n) elements, and info is a device pointer. Beyond
+ * BDSQR_VECTORS_MAXSIZE, with vectors, the iteration runs in BDSQR_ROUNDS
+ * rounds of bdsqr_chase, each followed by bdsqr_rotate on all of U and V**T.
+ */
+template <typename T>
+void rocsolver_bdsqr_async_template(rocblas_handle handle, rocblas_int n,
+                                    T *D, T *E, T *U, rocblas_int ldu,
+                                    rocblas_int nru, T *V, rocblas_int ldv,
+                                    rocblas_int ncvt, T *work,
+                                    rocblas_int *iwork, rocblas_int *info) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  if (n <= BDSQR_VECTORS_MAXSIZE || (nru == 0 && ncvt == 0)) {
+    hipLaunchKernelGGL(bdsqr_kernel<T>, dim3(1), dim3(BDSQR_BLOCKSIZE), 0,
+                       stream, n, D, E, U, ldu, nru, V, ldv, ncvt, work,
+                       iwork, info, numeric_limits<T>::epsilon(),
+                       numeric_limits<T>::min());
+    return;
+  }
+
+  const rocblas_int cap = bdsqr_log_size(n);
+  const rocblas_int blocks = (nru > 0 ? (nru - 1) / BDSQR_BLOCKSIZE + 1 : 0) +
+                             (ncvt > 0 ? (ncvt - 1) / BDSQR_BLOCKSIZE + 1 : 0);
+  hipMemsetAsync(iwork + 4 * size_t(cap), 0, 4 * sizeof(rocblas_int), stream);
+  for (rocblas_int round = 0; round < BDSQR_ROUNDS; ++round) {
+    hipLaunchKernelGGL(bdsqr_chase<T>, dim3(1), dim3(1), 0, stream, n, D, E,
+                       cap, work, iwork, info, numeric_limits<T>::epsilon(),
+                       numeric_limits<T>::min());
+    hipLaunchKernelGGL(bdsqr_rotate<T>, dim3(blocks), dim3(BDSQR_BLOCKSIZE),
+                       0, stream, cap, U, ldu, nru, V, ldv, ncvt, work,
+                       iwork);
+  }
+}
+
+#endif /* ROCLAPACK_BDSQR_HPP */
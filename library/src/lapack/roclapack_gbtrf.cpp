@@ -0,0 +1,30 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gbtrf.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgbtrf(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 rocsolver_int kl, rocsolver_int ku, float *AB,
+                 rocsolver_int ldab, rocsolver_int *ipiv) {
+  return rocsolver_gbtrf_template<float>(handle, m, n, kl, ku, AB, ldab, ipiv);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgbtrf(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 rocsolver_int kl, rocsolver_int ku, double *AB,
+                 rocsolver_int ldab, rocsolver_int *ipiv) {
+  return rocsolver_gbtrf_template<double>(handle, m, n, kl, ku, AB, ldab,
+                                          ipiv);
+}
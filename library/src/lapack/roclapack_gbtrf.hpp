@@ -0,0 +1,501 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GBTRF_HPP
+#define ROCLAPACK_GBTRF_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+// the singularity flag, then the constants and the workspace of the blocked
+// factorization
+#define GBTRF_RESSING 0
+#define GBTRF_INPONE 1
+#define GBTRF_INPMINONE 2
+#define GBTRF_WORK 3
+
+/*
+ * LU factorization of a band matrix in LAPACK band storage: A(i,j) is held in
+ * AB(kl+ku+i-j, j), the top kl rows of AB receive the fill-in created by the
+ * row interchanges.
+ *
+ * Every step of the elimination only touches a (kl+1) x (kl+ku+1) window of
+ * the band, so for narrow bands (kl < GBTRF_NB) the whole factorization runs
+ * in one workgroup: per column, the threads cooperate on the pivot search,
+ * on the interchange of the window columns and on the rank-1 update of the
+ * window, and a launch per column is avoided. Wider bands are factored in
+ * panels, see gbtrf_blocked.
+ */
+template <typename T>
+__global__ void gbtrf_kernel(rocblas_int m, rocblas_int n, rocblas_int kl,
+                             rocblas_int ku, T *AB, rocblas_int ldab,
+                             rocblas_int *ipiv, T *inpsResGPU) {
+
+  const int tid = hipThreadIdx_x;
+  const int nthreads = hipBlockDim_x;
+  const rocblas_int kv = ku + kl;
+
+  __shared__ T sval[GBTRF_BLOCKSIZE];
+  __shared__ rocblas_int sidx[GBTRF_BLOCKSIZE];
+  // pivot offset of the current column (-1 if it is zero), and last column
+  // reached by the interchanges so far
+  __shared__ rocblas_int jp;
+  __shared__ rocblas_int ju;
+
+  // zero the fill-in elements of the columns the first window overlaps
+  for (rocblas_int j = ku + 1; j < min(kv, n); ++j)
+    for (rocblas_int i = kv - j + tid; i < kl; i += nthreads)
+      AB[i + j * ldab] = 0;
+  if (tid == 0)
+    ju = 0;
+  __syncthreads();
+
+  for (rocblas_int j = 0; j < min(m, n); ++j) {
+    const rocblas_int km = min(kl, m - 1 - j);
+    // colj[p] is A(j+p, j)
+    T *colj = AB + j * ldab + kv;
+
+    // the column that enters the window gets its fill-in elements cleared
+    if (j + kv < n)
+      for (rocblas_int i = tid; i < kl; i += nthreads)
+        AB[i + (j + kv) * ldab] = 0;
+
+    // find the pivot; ties go to the smallest row like iamax
+    T best = -1;
+    rocblas_int bestIdx = 0;
+    for (rocblas_int p = tid; p <= km; p += nthreads) {
+      const T v = fabs(colj[p]);
+      if (v > best) {
+        best = v;
+        bestIdx = p;
+      }
+    }
+    sval[tid] = best;
+    sidx[tid] = bestIdx;
+    __syncthreads();
+    for (int s = nthreads / 2; s > 0; s >>= 1) {
+      if (tid < s && (sval[tid + s] > sval[tid] ||
+                      (sval[tid + s] == sval[tid] && sidx[tid + s] < sidx[tid]))) {
+        sval[tid] = sval[tid + s];
+        sidx[tid] = sidx[tid + s];
+      }
+      __syncthreads();
+    }
+
+    if (tid == 0) {
+      jp = sidx[0];
+      ipiv[j] = j + jp + 1; // one-based, as in LAPACK
+      if (colj[jp] == 0) {
+        inpsResGPU[GBTRF_RESSING] = -static_cast<T>(j);
+        jp = -1;
+      } else {
+        ju = max(ju, min(j + ku + jp, n - 1));
+      }
+    }
+    __syncthreads();
+
+    // a zero column is left as is, like in LAPACK
+    if (jp >= 0) {
+      // interchange rows j and j+jp in columns j to ju
+      if (jp != 0) {
+        for (rocblas_int c = j + tid; c <= ju; c += nthreads) {
+          T *a = AB + c * ldab + kv + j - c;
+          const T orig = a[0];
+          a[0] = a[jp];
+          a[jp] = orig;
+        }
+      }
+      __syncthreads();
+
+      // compute the multipliers
+      const T piv = colj[0];
+      for (rocblas_int p = tid; p < km; p += nthreads)
+        colj[1 + p] /= piv;
+      __syncthreads();
+
+      // rank-1 update of the window A(j+1:j+km, j+1:ju)
+      const rocblas_int w = ju - j;
+      for (rocblas_int e = tid; e < km * w; e += nthreads) {
+        const rocblas_int p = e % km;
+        const rocblas_int c = j + 1 + e / km;
+        T *a = AB + c * ldab + kv + j - c; // a[0] is A(j, c)
+        a[1 + p] -= colj[1 + p] * a[0];
+      }
+      __syncthreads();
+    }
+  }
+}
+
+/*
+ * The blocked factorization, as the LAPACK xgbtrf, for kl >= nb = GBTRF_NB.
+ * Inside the band, A(i,j) = AB(kv+i-j, j) is the dense matrix at AB + kv
+ * with leading dimension ldab - 1 (kv = kl + ku), so that the blocks of the
+ * update window of a panel of nb columns are passed to trsm and gemm as
+ * they are. The blocks that stick out of the band storage are held in two
+ * nb x nb work arrays: W31, the rows kl to kl + nb - 1 below the panel, and
+ * W13, the columns kv to kv + nb - 1 right of it.
+ *
+ * The panel is factored by one workgroup with the interchanges applied to
+ * all its columns, so that L11, L21 and L31 come out as getrf leaves them
+ * for the update; the interchanges are then undone on the columns left of
+ * each pivot, which leaves the factors as the unblocked factorization does.
+ * The window right of the panel reaches column j + nb - 1 + kv, the last
+ * one the interchanges of the panel can reach.
+ */
+
+// A(i,j) of the band matrix, inside the band
+#define GBTRF_A(i, j) Ad[(i) + size_t(j) * (ldab - 1)]
+
+// the fill-in elements of the columns ku + 1 to min(m,n) + kv - 1 are zero
+template <typename T>
+__global__ void gbtrf_zero_fillin(rocblas_int kl, rocblas_int ku, T *AB,
+                                  rocblas_int ldab) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = ku + 1 + hipBlockIdx_y;
+
+  if (i < kl && i >= ku + kl - j)
+    AB[i + size_t(j) * ldab] = 0;
+}
+
+/*
+ * Panel of columns j to j + jb - 1, one workgroup: per column the pivot
+ * search, the interchange of the rows of the panel (with W31 for the part
+ * of a row below kl rows under the panel that is not stored), the
+ * multipliers and the rank-1 update of the rest of the panel. The rows kl
+ * to kl + i3 - 1 below the panel are then copied to W31, where the update
+ * takes them from.
+ */
+template <typename T>
+__global__ void gbtrf_panel(rocblas_int m, rocblas_int kl, rocblas_int ku,
+                            rocblas_int j, rocblas_int jb, T *AB,
+                            rocblas_int ldab, rocblas_int *ipiv, T *W31,
+                            rocblas_int ldw, T *inpsResGPU) {
+
+  const int tid = hipThreadIdx_x;
+  const int nthreads = hipBlockDim_x;
+  const rocblas_int i3 = min(jb, m - j - kl);
+  T *Ad = AB + ku + kl;
+
+  __shared__ T sval[GBTRF_BLOCKSIZE];
+  __shared__ rocblas_int sidx[GBTRF_BLOCKSIZE];
+  __shared__ rocblas_int jp;
+
+  for (rocblas_int e = tid; e < jb * jb; e += nthreads)
+    W31[e % jb + (e / jb) * ldw] = 0;
+
+  for (rocblas_int jj = j; jj < j + jb; ++jj) {
+    const rocblas_int km = min(kl, m - 1 - jj);
+
+    // find the pivot; ties go to the smallest row like iamax
+    T best = -1;
+    rocblas_int bestIdx = 0;
+    for (rocblas_int p = tid; p <= km; p += nthreads) {
+      const T v = fabs(GBTRF_A(jj + p, jj));
+      if (v > best) {
+        best = v;
+        bestIdx = p;
+      }
+    }
+    sval[tid] = best;
+    sidx[tid] = bestIdx;
+    __syncthreads();
+    for (int s = nthreads / 2; s > 0; s >>= 1) {
+      if (tid < s && (sval[tid + s] > sval[tid] ||
+                      (sval[tid + s] == sval[tid] && sidx[tid + s] < sidx[tid]))) {
+        sval[tid] = sval[tid + s];
+        sidx[tid] = sidx[tid + s];
+      }
+      __syncthreads();
+    }
+
+    if (tid == 0) {
+      jp = sidx[0];
+      ipiv[jj] = jj + jp + 1; // one-based, as in LAPACK
+      if (GBTRF_A(jj + jp, jj) == 0) {
+        inpsResGPU[GBTRF_RESSING] = -static_cast<T>(jj);
+        jp = -1;
+      }
+    }
+    __syncthreads();
+
+    if (jp >= 0) {
+      // interchange rows jj and r in the columns of the panel; left of jj,
+      // row r is in W31 if it is not stored
+      const rocblas_int r = jj + jp;
+      if (jp != 0) {
+        for (rocblas_int c = j + tid; c < j + jb; c += nthreads) {
+          T *b = (r >= j + kl && c < jj) ? &W31[r - j - kl + (c - j) * ldw]
+                                         : &GBTRF_A(r, c);
+          const T orig = GBTRF_A(jj, c);
+          GBTRF_A(jj, c) = *b;
+          *b = orig;
+        }
+      }
+      __syncthreads();
+
+      // compute the multipliers
+      const T piv = GBTRF_A(jj, jj);
+      for (rocblas_int p = tid; p < km; p += nthreads)
+        GBTRF_A(jj + 1 + p, jj) /= piv;
+      __syncthreads();
+
+      // rank-1 update of the rest of the panel
+      const rocblas_int w = j + jb - 1 - jj;
+      for (rocblas_int e = tid; e < km * w; e += nthreads) {
+        const rocblas_int p = e % km;
+        const rocblas_int c = jj + 1 + e / km;
+        GBTRF_A(jj + 1 + p, c) -= GBTRF_A(jj + 1 + p, jj) * GBTRF_A(jj, c);
+      }
+      __syncthreads();
+    }
+
+    // the stored part of the column in the rows of W31
+    for (rocblas_int i = tid; i < min(jj - j + 1, i3); i += nthreads)
+      W31[i + (jj - j) * ldw] = GBTRF_A(j + kl + i, jj);
+    __syncthreads();
+  }
+}
+
+// the interchanges of the panel j to j + jb - 1 on the columns c0 to
+// c0 + nc - 1 right of it, one thread per column; rows above the band of
+// a column are zero and are not stored
+template <typename T>
+__global__ void gbtrf_swap_cols(rocblas_int kl, rocblas_int ku,
+                                rocblas_int j, rocblas_int jb, rocblas_int c0,
+                                rocblas_int nc, T *AB, rocblas_int ldab,
+                                const rocblas_int *ipiv) {
+  const rocblas_int c = c0 + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  T *Ad = AB + ku + kl;
+
+  if (c < c0 + nc) {
+    for (rocblas_int ii = max(j, c - ku - kl); ii < j + jb; ++ii) {
+      const rocblas_int ip = ipiv[ii] - 1;
+      if (ip != ii) {
+        const T orig = GBTRF_A(ii, c);
+        GBTRF_A(ii, c) = GBTRF_A(ip, c);
+        GBTRF_A(ip, c) = orig;
+      }
+    }
+  }
+}
+
+// the jb x j3 block A13 = A(j:j+jb, j+kv:j+kv+j3) to W13 (zeros above the
+// band) or, back, its stored part from W13
+template <typename T>
+__global__ void gbtrf_copy_a13(rocblas_int kl, rocblas_int ku, rocblas_int j,
+                               rocblas_int jb, T *AB, rocblas_int ldab,
+                               T *W13, rocblas_int ldw, bool back) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int c = hipBlockIdx_y;
+  T *Ad = AB + ku + kl;
+
+  if (i < jb) {
+    T &a = GBTRF_A(j + i, j + ku + kl + c);
+    if (back) {
+      if (i >= c)
+        a = W13[i + c * ldw];
+    } else {
+      W13[i + c * ldw] = (i >= c) ? a : 0;
+    }
+  }
+}
+
+// the interchanges of the panel undone on the columns left of every pivot,
+// and the rows of W31 back to the band, one thread per column of the panel
+template <typename T>
+__global__ void gbtrf_undo(rocblas_int m, rocblas_int kl, rocblas_int ku,
+                           rocblas_int j, rocblas_int jb, T *AB,
+                           rocblas_int ldab, const rocblas_int *ipiv, T *W31,
+                           rocblas_int ldw) {
+  const rocblas_int c = j + hipThreadIdx_x;
+  const rocblas_int i3 = min(jb, m - j - kl);
+  T *Ad = AB + ku + kl;
+  T *w = W31 + (c - j) * ldw;
+
+  if (c < j + jb) {
+    for (rocblas_int jj = j + jb - 1; jj > c; --jj) {
+      const rocblas_int r = ipiv[jj] - 1;
+      if (r != jj) {
+        T *b = (r >= j + kl) ? &w[r - j - kl] : &GBTRF_A(r, c);
+        const T orig = GBTRF_A(jj, c);
+        GBTRF_A(jj, c) = *b;
+        *b = orig;
+      }
+    }
+    for (rocblas_int i = 0; i < min(i3, c - j + 1); ++i)
+      GBTRF_A(j + kl + i, c) = w[i];
+  }
+}
+
+template <typename T>
+void gbtrf_blocked(rocblas_handle handle, rocblas_int m, rocblas_int n,
+                   rocblas_int kl, rocblas_int ku, T *AB, rocblas_int ldab,
+                   rocblas_int *ipiv, T *inpsResGPU) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const rocblas_int nb = GBTRF_NB;
+  const rocblas_int kv = ku + kl;
+  const rocblas_int lda1 = ldab - 1;
+  const rocblas_int mn = min(m, n);
+  const T *one = &inpsResGPU[GBTRF_INPONE];
+  const T *minone = &inpsResGPU[GBTRF_INPMINONE];
+  T *W31 = &inpsResGPU[GBTRF_WORK];
+  T *W13 = W31 + nb * nb;
+  T *Ad = AB + kv;
+
+  const rocblas_int nfill = min(n, mn + kv) - ku - 1;
+  if (nfill > 0)
+    hipLaunchKernelGGL(gbtrf_zero_fillin<T>,
+                       dim3((kl - 1) / GBTRF_BLOCKSIZE + 1, nfill),
+                       dim3(GBTRF_BLOCKSIZE), 0, stream, kl, ku, AB, ldab);
+
+  for (rocblas_int j = 0; j < mn; j += nb) {
+    const rocblas_int jb = min(nb, mn - j);
+    // rows of the window below the panel: A21 inside the band, A31 (in
+    // W31) below it
+    const rocblas_int i2 = min(kl - jb, m - j - jb);
+    const rocblas_int i3 = min(jb, m - j - kl);
+
+    hipLaunchKernelGGL(gbtrf_panel<T>, dim3(1), dim3(GBTRF_BLOCKSIZE), 0,
+                       stream, m, kl, ku, j, jb, AB, ldab, ipiv, W31, nb,
+                       inpsResGPU);
+
+    if (j + jb < n) {
+      // columns of the window right of the panel: A12 inside the band
+      // storage, A13 (in W13) past it
+      const rocblas_int ju = min(j + jb - 1 + kv, n - 1);
+      const rocblas_int j2 = min(ju - j + 1, kv) - jb;
+      const rocblas_int j3 = max(0, ju - j - kv + 1);
+
+      hipLaunchKernelGGL(gbtrf_swap_cols<T>,
+                         dim3((j2 + j3 - 1) / GBTRF_BLOCKSIZE + 1),
+                         dim3(GBTRF_BLOCKSIZE), 0, stream, kl, ku, j, jb,
+                         j + jb, j2 + j3, AB, ldab, ipiv);
+
+      if (j2 > 0) {
+        rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower,
+                        rocblas_operation_none, rocblas_diagonal_unit, jb, j2,
+                        one, &GBTRF_A(j, j), lda1, &GBTRF_A(j, j + jb), lda1);
+        if (i2 > 0)
+          rocblas_gemm<T>(handle, rocblas_operation_none,
+                          rocblas_operation_none, i2, j2, jb, minone,
+                          &GBTRF_A(j + jb, j), lda1, &GBTRF_A(j, j + jb), lda1,
+                          one, &GBTRF_A(j + jb, j + jb), lda1);
+        if (i3 > 0)
+          rocblas_gemm<T>(handle, rocblas_operation_none,
+                          rocblas_operation_none, i3, j2, jb, minone, W31, nb,
+                          &GBTRF_A(j, j + jb), lda1, one,
+                          &GBTRF_A(j + kl, j + jb), lda1);
+      }
+
+      if (j3 > 0) {
+        hipLaunchKernelGGL(gbtrf_copy_a13<T>,
+                           dim3((jb - 1) / GBTRF_BLOCKSIZE + 1, j3),
+                           dim3(GBTRF_BLOCKSIZE), 0, stream, kl, ku, j, jb,
+                           AB, ldab, W13, nb, false);
+        rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower,
+                        rocblas_operation_none, rocblas_diagonal_unit, jb, j3,
+                        one, &GBTRF_A(j, j), lda1, W13, nb);
+        if (i2 > 0)
+          rocblas_gemm<T>(handle, rocblas_operation_none,
+                          rocblas_operation_none, i2, j3, jb, minone,
+                          &GBTRF_A(j + jb, j), lda1, W13, nb, one,
+                          &GBTRF_A(j + jb, j + kv), lda1);
+        if (i3 > 0)
+          rocblas_gemm<T>(handle, rocblas_operation_none,
+                          rocblas_operation_none, i3, j3, jb, minone, W31, nb,
+                          W13, nb, one, &GBTRF_A(j + kl, j + kv), lda1);
+        hipLaunchKernelGGL(gbtrf_copy_a13<T>,
+                           dim3((jb - 1) / GBTRF_BLOCKSIZE + 1, j3),
+                           dim3(GBTRF_BLOCKSIZE), 0, stream, kl, ku, j, jb,
+                           AB, ldab, W13, nb, true);
+      }
+    }
+
+    hipLaunchKernelGGL(gbtrf_undo<T>, dim3(1), dim3(nb), 0, stream, m, kl, ku,
+                       j, jb, AB, ldab, ipiv, W31, nb);
+  }
+}
+
+#undef GBTRF_A
+
+template <typename T>
+rocblas_status rocsolver_gbtrf_template(rocblas_handle handle, rocblas_int m,
+                                        rocblas_int n, rocblas_int kl,
+                                        rocblas_int ku, T *AB,
+                                        rocblas_int ldab, rocblas_int *ipiv) {
+
+  if (m < 0 || n < 0 || kl < 0 || ku < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (ldab < 2 * kl + ku + 1) {
+    // band storage needs room for the fill-in
+    return rocblas_status_invalid_size;
+  } else if (m == 0 || n == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  // narrow bands are factored by one workgroup, as the LAPACK xgbtrf does
+  // with xgbtf2
+  const bool blocked = (kl >= GBTRF_NB);
+
+  T inpsResHost[3];
+  inpsResHost[GBTRF_RESSING] = static_cast<T>(42);
+  inpsResHost[GBTRF_INPONE] = static_cast<T>(1);
+  inpsResHost[GBTRF_INPMINONE] = static_cast<T>(-1);
+
+  // allocate the flag, the constants and workspace on device to avoid going
+  // onto CPU and needing to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU,
+            sizeof(T) * (blocked ? GBTRF_WORK + 2 * GBTRF_NB * GBTRF_NB : 1));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], sizeof(T) * (blocked ? 3 : 1),
+            hipMemcpyHostToDevice);
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  if (blocked)
+    gbtrf_blocked<T>(handle, m, n, kl, ku, AB, ldab, ipiv, inpsResGPU);
+  else
+    hipLaunchKernelGGL(gbtrf_kernel<T>, dim3(1), dim3(GBTRF_BLOCKSIZE), 0,
+                       stream, m, n, kl, ku, AB, ldab, ipiv, inpsResGPU);
+
+  // let's see if we encountered any singularity
+  hipMemcpy(&inpsResHost[GBTRF_RESSING], &inpsResGPU[GBTRF_RESSING], sizeof(T),
+            hipMemcpyDeviceToHost);
+  hipFree(inpsResGPU);
+
+  if (inpsResHost[GBTRF_RESSING] <= 0.0) {
+    const size_t elem = static_cast<size_t>(fabs(inpsResHost[GBTRF_RESSING]));
+    cerr << "ERROR: Input matrix has singularity/-ies. Last "
+            "occurrence of this in element "
+         << elem << endl;
+    return rocblas_status_internal_error;
+  }
+
+  return rocblas_status_success;
+}
+
+#undef GBTRF_RESSING
+#undef GBTRF_INPONE
+#undef GBTRF_INPMINONE
+#undef GBTRF_WORK
+
+#endif /* ROCLAPACK_GBTRF_HPP */
@@ -0,0 +1,33 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gbtrs.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgbtrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                 rocblas_int kl, rocblas_int ku, rocblas_int nrhs,
+                 const float *AB, rocblas_int ldab, const rocblas_int *ipiv,
+                 float *B, rocblas_int ldb) {
+  return rocsolver_gbtrs_template<float>(handle, trans, n, kl, ku, nrhs, AB,
+                                         ldab, ipiv, B, ldb);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgbtrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                 rocblas_int kl, rocblas_int ku, rocblas_int nrhs,
+                 const double *AB, rocblas_int ldab, const rocblas_int *ipiv,
+                 double *B, rocblas_int ldb) {
+  return rocsolver_gbtrs_template<double>(handle, trans, n, kl, ku, nrhs, AB,
+                                          ldab, ipiv, B, ldb);
+}
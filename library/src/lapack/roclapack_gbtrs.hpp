@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GBTRS_HPP
+#define ROCLAPACK_GBTRS_HPP
+
+#include "rocsolver-export.h"
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+/*
+ * Solves with the band LU factors of gbtrf. Every workgroup handles one right
+ * hand side and walks down (up) the diagonal; per step the threads share the
+ * at most kl (kl+ku) entries of the band column.
+ */
+template <typename T>
+__global__ void gbtrs_kernel(rocblas_operation trans, rocblas_int n,
+                             rocblas_int kl, rocblas_int ku, const T *AB,
+                             rocblas_int ldab, const rocblas_int *ipiv, T *B,
+                             rocblas_int ldb) {
+
+  const int tid = hipThreadIdx_x;
+  const int nthreads = hipBlockDim_x;
+  const rocblas_int kv = ku + kl;
+  T *b = B + hipBlockIdx_x * ldb;
+
+  __shared__ T ssum[GBTRS_BLOCKSIZE];
+
+  if (trans == rocblas_operation_none) {
+
+    // solve L*X = B, applying the row interchanges on the way
+    for (rocblas_int j = 0; j < n - 1 && kl > 0; ++j) {
+      const rocblas_int lm = min(kl, n - 1 - j);
+      if (tid == 0) {
+        const rocblas_int l = ipiv[j] - 1;
+        if (l != j) {
+          const T orig = b[j];
+          b[j] = b[l];
+          b[l] = orig;
+        }
+      }
+      __syncthreads();
+
+      const T bj = b[j];
+      const T *lj = AB + j * ldab + kv + 1;
+      for (rocblas_int p = tid; p < lm; p += nthreads)
+        b[j + 1 + p] -= lj[p] * bj;
+      __syncthreads();
+    }
+
+    // solve U*X = B, U has kl+ku superdiagonals
+    for (rocblas_int j = n - 1; j >= 0; --j) {
+      if (tid == 0)
+        b[j] /= AB[kv + j * ldab];
+      __syncthreads();
+
+      const T bj = b[j];
+      for (rocblas_int i = max(0, j - kv) + tid; i < j; i += nthreads)
+        b[i] -= AB[kv + i - j + j * ldab] * bj;
+      __syncthreads();
+    }
+  } else {
+
+    // solve U**T*X = B
+    for (rocblas_int j = 0; j < n; ++j) {
+      if (tid == 0)
+        b[j] /= AB[kv + j * ldab];
+      __syncthreads();
+
+      const T bj = b[j];
+      for (rocblas_int c = j + 1 + tid; c <= min(n - 1, j + kv);
+           c += nthreads)
+        b[c] -= AB[kv + j - c + c * ldab] * bj;
+      __syncthreads();
+    }
+
+    // solve L**T*X = B, applying the row interchanges on the way
+    for (rocblas_int j = n - 2; j >= 0 && kl > 0; --j) {
+      const rocblas_int lm = min(kl, n - 1 - j);
+      const T *lj = AB + j * ldab + kv + 1;
+
+      T s = 0;
+      for (rocblas_int p = tid; p < lm; p += nthreads)
+        s += lj[p] * b[j + 1 + p];
+      ssum[tid] = s;
+      __syncthreads();
+      for (int st = nthreads / 2; st > 0; st >>= 1) {
+        if (tid < st)
+          ssum[tid] += ssum[tid + st];
+        __syncthreads();
+      }
+
+      if (tid == 0) {
+        b[j] -= ssum[0];
+        const rocblas_int l = ipiv[j] - 1;
+        if (l != j) {
+          const T orig = b[j];
+          b[j] = b[l];
+          b[l] = orig;
+        }
+      }
+      __syncthreads();
+    }
+  }
+}
+
+template <typename T>
+rocblas_status
+rocsolver_gbtrs_template(rocblas_handle handle, rocblas_operation trans,
+                         rocblas_int n, rocblas_int kl, rocblas_int ku,
+                         rocblas_int nrhs, const T *AB, rocblas_int ldab,
+                         const rocblas_int *ipiv, T *B, rocblas_int ldb) {
+
+  // check for possible input problems
+  if (n < 0 || kl < 0 || ku < 0 || nrhs < 0 || ldab < 2 * kl + ku + 1 ||
+      ldb < max(1, n)) {
+    cout << "Invalid size " << n << " " << kl << " " << ku << " " << nrhs
+         << " " << ldab << " " << ldb << endl;
+    return rocblas_status_invalid_size;
+  }
+
+  // quick return
+  if (n == 0 || nrhs == 0) {
+    return rocblas_status_success;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  hipLaunchKernelGGL(gbtrs_kernel<T>, dim3(nrhs), dim3(GBTRS_BLOCKSIZE), 0,
+                     stream, trans, n, kl, ku, AB, ldab, ipiv, B, ldb);
+
+  return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GBTRS_HPP */
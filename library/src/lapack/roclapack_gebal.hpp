@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GEBAL_HPP
+#define ROCLAPACK_GEBAL_HPP
+
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+// (s, q) := the scaled sum of squares of (s, q) and (s2, q2): the 2-norm of
+// the entries summed is s * sqrt(q), with s their largest absolute value
+template <typename T>
+__device__ void gebal_ssq(T &s, T &q, const T s2, const T q2) {
+  if (s2 > s) {
+    q = q2 + q * (s / s2) * (s / s2);
+    s = s2;
+  } else if (s2 > 0) {
+    q += q2 * (s2 / s) * (s2 / s);
+  }
+}
+
+/*
+ * Balancing of the n x n matrix A by a diagonal similarity A := D**-1 * A *
+ * D, D = diag(scale) with powers of 2, in one workgroup of GEBAL_BLOCKSIZE
+ * threads (a power of two). Column and row i are scaled in turn so that
+ * their 2-norms get close, and sweeps are repeated until none changes by
+ * more than 5%. The norms and largest entries of the row and the column are
+ * reduced together in one pass. The permutations of LAPACK's gebal, which
+ * isolate eigenvalues that are already exposed, are not done.
+ */
+template <typename T>
+__global__ void gebal_kernel(rocblas_int n, T *A, rocblas_int lda, T *scale,
+                             T sfmin1) {
+  __shared__ T sred[4 * GEBAL_BLOCKSIZE];
+  __shared__ T sf;
+  __shared__ rocblas_int snoconv;
+  const int tid = hipThreadIdx_x;
+  const T sclfac = 2;
+  const T factor = 0.95;
+  const T sfmax1 = 1 / sfmin1;
+  const T sfmin2 = sfmin1 * sclfac;
+  const T sfmax2 = 1 / sfmin2;
+
+  for (rocblas_int i = tid; i < n; i += hipBlockDim_x)
+    scale[i] = 1;
+  if (tid == 0)
+    snoconv = 1;
+  __syncthreads();
+
+  while (snoconv) {
+    __syncthreads();
+    if (tid == 0)
+      snoconv = 0;
+
+    for (rocblas_int i = 0; i < n; ++i) {
+      // the norms of column and row i, scaled by their largest entries
+      T cs = 0, cq = 0, rs = 0, rq = 0;
+      for (rocblas_int r = tid; r < n; r += hipBlockDim_x) {
+        gebal_ssq(cs, cq, T(fabs(A[idx2D(r, i, lda)])), T(1));
+        gebal_ssq(rs, rq, T(fabs(A[idx2D(i, r, lda)])), T(1));
+      }
+      sred[tid] = cs;
+      sred[tid + GEBAL_BLOCKSIZE] = cq;
+      sred[tid + 2 * GEBAL_BLOCKSIZE] = rs;
+      sred[tid + 3 * GEBAL_BLOCKSIZE] = rq;
+      __syncthreads();
+      for (int st = GEBAL_BLOCKSIZE / 2; st > 0; st >>= 1) {
+        if (tid < st) {
+          gebal_ssq(sred[tid], sred[tid + GEBAL_BLOCKSIZE], sred[tid + st],
+                    sred[tid + st + GEBAL_BLOCKSIZE]);
+          gebal_ssq(sred[tid + 2 * GEBAL_BLOCKSIZE],
+                    sred[tid + 3 * GEBAL_BLOCKSIZE],
+                    sred[tid + st + 2 * GEBAL_BLOCKSIZE],
+                    sred[tid + st + 3 * GEBAL_BLOCKSIZE]);
+        }
+        __syncthreads();
+      }
+
+      if (tid == 0) {
+        T ca = sred[0];
+        T c = ca * sqrt(sred[GEBAL_BLOCKSIZE]);
+        T ra = sred[2 * GEBAL_BLOCKSIZE];
+        T r = ra * sqrt(sred[3 * GEBAL_BLOCKSIZE]);
+        T f = 1;
+        if (c != 0 && r != 0) {
+          T g = r / sclfac;
+          const T s = c + r;
+          while (c < g && max(f, max(c, ca)) < sfmax2 &&
+                 min(r, min(g, ra)) > sfmin2) {
+            f *= sclfac;
+            c *= sclfac;
+            ca *= sclfac;
+            r /= sclfac;
+            g /= sclfac;
+            ra /= sclfac;
+          }
+          g = c / sclfac;
+          while (g >= r && max(r, ra) < sfmax2 &&
+                 min(min(f, c), min(g, ca)) > sfmin2) {
+            f /= sclfac;
+            c /= sclfac;
+            g /= sclfac;
+            ca /= sclfac;
+            r *= sclfac;
+            ra *= sclfac;
+          }
+          if ((c + r) >= factor * s ||
+              (f < 1 && scale[i] < 1 && f * scale[i] <= sfmin1) ||
+              (f > 1 && scale[i] > 1 && scale[i] >= sfmax1 / f))
+            f = 1;
+        }
+        if (f != 1) {
+          scale[i] *= f;
+          snoconv = 1;
+        }
+        sf = f;
+      }
+      __syncthreads();
+
+      // row i := row i / f, column i := column i * f
+      const T f = sf;
+      if (f != 1) {
+        for (rocblas_int r = tid; r < n; r += hipBlockDim_x)
+          A[idx2D(i, r, lda)] /= f;
+        __syncthreads();
+        for (rocblas_int r = tid; r < n; r += hipBlockDim_x)
+          A[idx2D(r, i, lda)] *= f;
+      }
+      __syncthreads();
+    }
+  }
+}
+
+/*
+ * Enqueue the balancing of the n x n matrix A (see gebal_kernel); scale
+ * (n) gets the diagonal of D, so that an eigenvector x of the balanced
+ * matrix gives D * x for A.
+ */
+template <typename T>
+void rocsolver_gebal_async_template(rocblas_handle handle, rocblas_int n,
+                                    T *A, rocblas_int lda, T *scale) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  hipLaunchKernelGGL(gebal_kernel<T>, dim3(1), dim3(GEBAL_BLOCKSIZE), 0,
+                     stream, n, A, lda, scale,
+                     numeric_limits<T>::min() / numeric_limits<T>::epsilon());
+}
+
+#endif /* ROCLAPACK_GEBAL_HPP */
@@ -0,0 +1,31 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gebltsv.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_sgebltsv_strided_batched(
+    rocblas_handle handle, rocblas_int nb, rocblas_int nblocks,
+    rocblas_int nrhs, float *A, float *B, float *C, rocblas_int lda,
+    rocblas_int strideA, float *X, rocblas_int ldx, rocblas_int strideX,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_gebltsv_template<float>(handle, nb, nblocks, nrhs, A, B, C,
+                                           lda, strideA, X, ldx, strideX, info,
+                                           batch_count);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_dgebltsv_strided_batched(
+    rocblas_handle handle, rocblas_int nb, rocblas_int nblocks,
+    rocblas_int nrhs, double *A, double *B, double *C, rocblas_int lda,
+    rocblas_int strideA, double *X, rocblas_int ldx, rocblas_int strideX,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_gebltsv_template<double>(handle, nb, nblocks, nrhs, A, B,
+                                            C, lda, strideA, X, ldx, strideX,
+                                            info, batch_count);
+}
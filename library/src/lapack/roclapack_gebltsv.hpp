@@ -0,0 +1,305 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GEBLTSV_HPP
+#define ROCLAPACK_GEBLTSV_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+/*
+ * Block cyclic reduction. Block row k of a system of nblocks block rows
+ * reads A_k x_(k-1) + B_k x_k + C_k x_(k+1) = X_k with nb x nb blocks; the
+ * blocks are stored one after the other in the columns of A, B and C (block
+ * k at column k * nb) and the right hand sides in the rows of X (block k at
+ * row k * nb). At stride s the rows j = s-1, 3s-1, 5s-1, ... are solved
+ * for in terms of their neighbours j - s and j + s, A_j := B_j^-1 A_j,
+ * C_j := B_j^-1 C_j and X_j := B_j^-1 X_j through the LU factorization with
+ * partial pivoting of B_j (gebltsv_factor), and substituted into the rows
+ * i = 2s-1, 4s-1, ... (gebltsv_update), which then couple to i - 2s and
+ * i + 2s only. Once a single row is left it is solved, and the rows of
+ * every stride, from the largest, get x_j = X_j - A_j x_(j-s) - C_j x_(j+s)
+ * (gebltsv_backsub). Every step covers all the rows of the stride in all
+ * the systems of the batch with one kernel launch, one workgroup per block
+ * row, so there are O(log(nblocks)) launches in all; everything is done in
+ * place.
+ */
+
+// rows of the batch with index j = first + t * step < n, t = 0, 1, ...
+inline rocblas_int gebltsv_rows(rocblas_int n, rocblas_int first,
+                                rocblas_int step) {
+  return (n > first) ? (n - first - 1) / step + 1 : 0;
+}
+
+// the block row j = s-1 + hipBlockIdx_y * 2s of system hipBlockIdx_x: the
+// LU factorization of B_j in LDS, then A_j, C_j and X_j are solved for in
+// place, as far as they couple to existing rows; a zero pivot is reported
+// in info as the row of the whole system it was met in
+template <typename T>
+__global__ void gebltsv_factor(rocblas_int nb, rocblas_int nblocks,
+                               rocblas_int nrhs, rocblas_int s, T *AA, T *BB,
+                               T *CC, rocblas_int lda, rocblas_int strideA,
+                               T *XX, rocblas_int ldx, rocblas_int strideX,
+                               rocblas_int *info) {
+  __shared__ T sB[GEBLTSV_MAX_BLOCK * GEBLTSV_MAX_BLOCK];
+  __shared__ rocblas_int sipiv[GEBLTSV_MAX_BLOCK];
+  __shared__ rocblas_int szero;
+
+  const int tid = hipThreadIdx_x;
+  const int nt = hipBlockDim_x;
+  const rocblas_int b = hipBlockIdx_x;
+  const rocblas_int j = s - 1 + hipBlockIdx_y * 2 * s;
+  const size_t off = size_t(b) * strideA + size_t(j) * nb * lda;
+  T *A = AA + off;
+  T *B = BB + off;
+  T *C = CC + off;
+  T *X = XX + size_t(b) * strideX + size_t(j) * nb;
+
+  for (rocblas_int e = tid; e < nb * nb; e += nt)
+    sB[e] = B[idx2D(e % nb, e / nb, lda)];
+  if (tid == 0)
+    szero = nb;
+  __syncthreads();
+
+  // LU factorization with partial pivoting
+  for (rocblas_int k = 0; k < nb; ++k) {
+    if (tid == 0) {
+      rocblas_int p = k;
+      for (rocblas_int r = k + 1; r < nb; ++r)
+        if (fabs(sB[r + k * nb]) > fabs(sB[p + k * nb]))
+          p = r;
+      sipiv[k] = p;
+      if (p != k) {
+        for (rocblas_int c = 0; c < nb; ++c) {
+          const T t = sB[k + c * nb];
+          sB[k + c * nb] = sB[p + c * nb];
+          sB[p + c * nb] = t;
+        }
+      }
+      if (sB[k + k * nb] == 0 && szero == nb)
+        szero = k;
+    }
+    __syncthreads();
+    const T piv = sB[k + k * nb];
+    const rocblas_int r0 = nb - k - 1;
+    if (piv != 0) {
+      for (rocblas_int e = tid; e < r0 * r0; e += nt) {
+        const rocblas_int r = k + 1 + e % r0;
+        const rocblas_int c = k + 1 + e / r0;
+        sB[r + c * nb] -= sB[r + k * nb] / piv * sB[k + c * nb];
+      }
+    }
+    __syncthreads();
+    if (piv != 0)
+      for (rocblas_int r = k + 1 + tid; r < nb; r += nt)
+        sB[r + k * nb] /= piv;
+    __syncthreads();
+  }
+
+  if (tid == 0 && szero < nb)
+    atomicCAS(info + b, 0, j * nb + szero + 1);
+
+  // the right hand sides, a column per thread: those of A_j if row j - s
+  // exists, of C_j if row j + s exists, then those of X_j
+  const rocblas_int na = (j >= s) ? nb : 0;
+  const rocblas_int nc = (j + s < nblocks) ? nb : 0;
+  for (rocblas_int col = tid; col < na + nc + nrhs; col += nt) {
+    T *v;
+    if (col < na)
+      v = A + size_t(col) * lda;
+    else if (col < na + nc)
+      v = C + size_t(col - na) * lda;
+    else
+      v = X + size_t(col - na - nc) * ldx;
+
+    for (rocblas_int k = 0; k < nb; ++k) {
+      const rocblas_int p = sipiv[k];
+      if (p != k) {
+        const T t = v[k];
+        v[k] = v[p];
+        v[p] = t;
+      }
+    }
+    for (rocblas_int k = 0; k < nb; ++k)
+      for (rocblas_int r = k + 1; r < nb; ++r)
+        v[r] -= sB[r + k * nb] * v[k];
+    for (rocblas_int k = nb - 1; k >= 0; --k) {
+      v[k] /= sB[k + k * nb];
+      for (rocblas_int r = 0; r < k; ++r)
+        v[r] -= sB[r + k * nb] * v[k];
+    }
+  }
+}
+
+// the block row i = 2s-1 + hipBlockIdx_y * 2s of system hipBlockIdx_x,
+// with its neighbours l = i - s and r = i + s solved for by gebltsv_factor:
+// B_i -= A_i C_l + C_i A_r, X_i -= A_i X_l + C_i X_r, A_i := -A_i A_l and
+// C_i := -C_i C_r
+template <typename T>
+__global__ void gebltsv_update(rocblas_int nb, rocblas_int nblocks,
+                               rocblas_int nrhs, rocblas_int s, T *AA, T *BB,
+                               T *CC, rocblas_int lda, rocblas_int strideA,
+                               T *XX, rocblas_int ldx, rocblas_int strideX) {
+  __shared__ T sA[GEBLTSV_MAX_BLOCK * GEBLTSV_MAX_BLOCK];
+  __shared__ T sC[GEBLTSV_MAX_BLOCK * GEBLTSV_MAX_BLOCK];
+
+  const int tid = hipThreadIdx_x;
+  const int nt = hipBlockDim_x;
+  const rocblas_int b = hipBlockIdx_x;
+  const rocblas_int i = 2 * s - 1 + hipBlockIdx_y * 2 * s;
+  const rocblas_int l = i - s;
+  const rocblas_int r = i + s;
+  const bool right = r < nblocks;
+  const size_t bl = size_t(nb) * lda;
+  T *A = AA + size_t(b) * strideA;
+  T *B = BB + size_t(b) * strideA;
+  T *C = CC + size_t(b) * strideA;
+  T *X = XX + size_t(b) * strideX;
+
+  for (rocblas_int e = tid; e < nb * nb; e += nt) {
+    sA[e] = A[i * bl + idx2D(e % nb, e / nb, lda)];
+    sC[e] = right ? C[i * bl + idx2D(e % nb, e / nb, lda)] : 0;
+  }
+  __syncthreads();
+
+  for (rocblas_int e = tid; e < nb * nb; e += nt) {
+    const rocblas_int row = e % nb;
+    const rocblas_int col = e / nb;
+    T t = B[i * bl + idx2D(row, col, lda)];
+    for (rocblas_int k = 0; k < nb; ++k)
+      t -= sA[row + k * nb] * C[l * bl + idx2D(k, col, lda)];
+    if (right)
+      for (rocblas_int k = 0; k < nb; ++k)
+        t -= sC[row + k * nb] * A[r * bl + idx2D(k, col, lda)];
+    B[i * bl + idx2D(row, col, lda)] = t;
+
+    if (l >= s) {
+      t = 0;
+      for (rocblas_int k = 0; k < nb; ++k)
+        t -= sA[row + k * nb] * A[l * bl + idx2D(k, col, lda)];
+      A[i * bl + idx2D(row, col, lda)] = t;
+    }
+    if (r + s < nblocks) {
+      t = 0;
+      for (rocblas_int k = 0; k < nb; ++k)
+        t -= sC[row + k * nb] * C[r * bl + idx2D(k, col, lda)];
+      C[i * bl + idx2D(row, col, lda)] = t;
+    }
+  }
+
+  for (rocblas_int e = tid; e < nb * nrhs; e += nt) {
+    const rocblas_int row = e % nb;
+    const rocblas_int col = e / nb;
+    T t = X[idx2D(i * nb + row, col, ldx)];
+    for (rocblas_int k = 0; k < nb; ++k)
+      t -= sA[row + k * nb] * X[idx2D(l * nb + k, col, ldx)];
+    if (right)
+      for (rocblas_int k = 0; k < nb; ++k)
+        t -= sC[row + k * nb] * X[idx2D(r * nb + k, col, ldx)];
+    X[idx2D(i * nb + row, col, ldx)] = t;
+  }
+}
+
+// the block row j = s-1 + hipBlockIdx_y * 2s of system hipBlockIdx_x, with
+// x_(j-s) and x_(j+s) known: x_j = X_j - A_j x_(j-s) - C_j x_(j+s)
+template <typename T>
+__global__ void gebltsv_backsub(rocblas_int nb, rocblas_int nblocks,
+                                rocblas_int nrhs, rocblas_int s, const T *AA,
+                                const T *CC, rocblas_int lda,
+                                rocblas_int strideA, T *XX, rocblas_int ldx,
+                                rocblas_int strideX) {
+  const int tid = hipThreadIdx_x;
+  const int nt = hipBlockDim_x;
+  const rocblas_int b = hipBlockIdx_x;
+  const rocblas_int j = s - 1 + hipBlockIdx_y * 2 * s;
+  const size_t off = size_t(b) * strideA + size_t(j) * nb * lda;
+  const T *A = AA + off;
+  const T *C = CC + off;
+  T *X = XX + size_t(b) * strideX;
+
+  for (rocblas_int e = tid; e < nb * nrhs; e += nt) {
+    const rocblas_int row = e % nb;
+    const rocblas_int col = e / nb;
+    T t = X[idx2D(j * nb + row, col, ldx)];
+    if (j >= s)
+      for (rocblas_int k = 0; k < nb; ++k)
+        t -= A[idx2D(row, k, lda)] * X[idx2D((j - s) * nb + k, col, ldx)];
+    if (j + s < nblocks)
+      for (rocblas_int k = 0; k < nb; ++k)
+        t -= C[idx2D(row, k, lda)] * X[idx2D((j + s) * nb + k, col, ldx)];
+    X[idx2D(j * nb + row, col, ldx)] = t;
+  }
+}
+
+template <typename T>
+rocblas_status
+rocsolver_gebltsv_template(rocblas_handle handle, rocblas_int nb,
+                           rocblas_int nblocks, rocblas_int nrhs, T *A, T *B,
+                           T *C, rocblas_int lda, rocblas_int strideA, T *X,
+                           rocblas_int ldx, rocblas_int strideX,
+                           rocblas_int *info, rocblas_int batch_count) {
+
+  if (nb < 0 || nblocks < 0 || nrhs < 0 || batch_count < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, nb) || ldx < max(1, nb * nblocks)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (nb > GEBLTSV_MAX_BLOCK) {
+    // the blocks are factorized in LDS
+    return rocblas_status_not_implemented;
+  } else if (batch_count == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  hipMemsetAsync(info, 0, sizeof(rocblas_int) * batch_count, stream);
+  if (nb == 0 || nblocks == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  // a wavefront per 64 entries of a block, up to GEBLTSV_BLOCKSIZE
+  const rocblas_int threads =
+      min(GEBLTSV_BLOCKSIZE, ((nb * nb - 1) / 64 + 1) * 64);
+
+  // the reduction, down to the single row s - 1, which is then solved
+  rocblas_int s = 1;
+  for (; 2 * s - 1 < nblocks; s *= 2) {
+    hipLaunchKernelGGL(gebltsv_factor<T>,
+                       dim3(batch_count, gebltsv_rows(nblocks, s - 1, 2 * s)),
+                       dim3(threads), 0, stream, nb, nblocks, nrhs, s, A, B,
+                       C, lda, strideA, X, ldx, strideX, info);
+    hipLaunchKernelGGL(
+        gebltsv_update<T>,
+        dim3(batch_count, gebltsv_rows(nblocks, 2 * s - 1, 2 * s)),
+        dim3(threads), 0, stream, nb, nblocks, nrhs, s, A, B, C, lda, strideA,
+        X, ldx, strideX);
+  }
+  hipLaunchKernelGGL(gebltsv_factor<T>, dim3(batch_count, 1), dim3(threads), 0,
+                     stream, nb, nblocks, nrhs, s, A, B, C, lda, strideA, X,
+                     ldx, strideX, info);
+
+  // the solution, from the largest stride
+  for (s /= 2; s >= 1; s /= 2)
+    hipLaunchKernelGGL(gebltsv_backsub<T>,
+                       dim3(batch_count, gebltsv_rows(nblocks, s - 1, 2 * s)),
+                       dim3(threads), 0, stream, nb, nblocks, nrhs, s, A, C,
+                       lda, strideA, X, ldx, strideX);
+
+  return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GEBLTSV_HPP */
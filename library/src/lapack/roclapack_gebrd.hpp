@@ -0,0 +1,184 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GEBRD_HPP
+#define ROCLAPACK_GEBRD_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_larfg.hpp"
+
+using namespace std;
+
+// elements of the workspace: the m x nb matrix X and the n x nb matrix Y of
+// the pending updates of a panel
+inline size_t gebrd_work_size(rocblas_int m, rocblas_int n) {
+  return size_t(GEBRD_BLOCKSIZE) * (size_t(m) + n);
+}
+
+// d := a, and a := 1 for the reflector it starts
+template <typename T> __global__ void gebrd_set_unit(T *a, T *d) {
+  if (hipBlockIdx_x == 0 && hipThreadIdx_x == 0) {
+    *d = *a;
+    *a = 1;
+  }
+}
+
+/*
+ * labrd: the first nb columns and rows of the m x n matrix A (m >= n) are
+ * reduced to upper bidiagonal form, H(i) from the left annihilating
+ * A(i+1:m,i) and G(i) from the right annihilating A(i,i+2:n). The rest of A
+ * is not updated; the updates are gathered in X (m x nb) and Y (n x nb)
+ * instead, so that A(nb:m,nb:n) - A(nb:m,0:nb) * Y(nb:n,0:nb)**T -
+ * X(nb:m,0:nb) * A(0:nb,nb:n) is what remains to be reduced. The vectors
+ * of the reflectors are stored as in LAPACK, with their unit entries on the
+ * diagonal and superdiagonal.
+ */
+template <typename T>
+void gebrd_labrd(rocblas_handle handle, rocblas_int m, rocblas_int n,
+                 rocblas_int nb, T *A, rocblas_int lda, T *D, T *E, T *tauq,
+                 T *taup, T *X, rocblas_int ldx, T *Y, rocblas_int ldy,
+                 const T *one, const T *zero, const T *minone) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  for (rocblas_int i = 0; i < nb; ++i) {
+    // the pending updates on A(i:m,i), and H(i)
+    if (i > 0) {
+      rocblas_gemv<T>(handle, rocblas_operation_none, m - i, i, minone,
+                      &A[idx2D(i, 0, lda)], lda, &Y[idx2D(i, 0, ldy)], ldy,
+                      one, &A[idx2D(i, i, lda)], 1);
+      rocblas_gemv<T>(handle, rocblas_operation_none, m - i, i, minone,
+                      &X[idx2D(i, 0, ldx)], ldx, &A[idx2D(0, i, lda)], 1, one,
+                      &A[idx2D(i, i, lda)], 1);
+    }
+    roclapack_larfg_template<T>(handle, m - i, &A[idx2D(i, i, lda)],
+                                &A[idx2D(min(i + 1, m - 1), i, lda)], 1,
+                                &tauq[i]);
+    hipLaunchKernelGGL(gebrd_set_unit<T>, dim3(1), dim3(1), 0, stream,
+                       &A[idx2D(i, i, lda)], &D[i]);
+
+    if (i == n - 1)
+      break;
+
+    // Y(i+1:n,i) := tauq * (A(i:m,i+1:n) - pending updates)**T * v
+    rocblas_gemv<T>(handle, rocblas_operation_transpose, m - i, n - i - 1,
+                    one, &A[idx2D(i, i + 1, lda)], lda, &A[idx2D(i, i, lda)],
+                    1, zero, &Y[idx2D(i + 1, i, ldy)], 1);
+    if (i > 0) {
+      rocblas_gemv<T>(handle, rocblas_operation_transpose, m - i, i, one,
+                      &A[idx2D(i, 0, lda)], lda, &A[idx2D(i, i, lda)], 1,
+                      zero, &Y[idx2D(0, i, ldy)], 1);
+      rocblas_gemv<T>(handle, rocblas_operation_none, n - i - 1, i, minone,
+                      &Y[idx2D(i + 1, 0, ldy)], ldy, &Y[idx2D(0, i, ldy)], 1,
+                      one, &Y[idx2D(i + 1, i, ldy)], 1);
+      rocblas_gemv<T>(handle, rocblas_operation_transpose, m - i, i, one,
+                      &X[idx2D(i, 0, ldx)], ldx, &A[idx2D(i, i, lda)], 1,
+                      zero, &Y[idx2D(0, i, ldy)], 1);
+      rocblas_gemv<T>(handle, rocblas_operation_transpose, i, n - i - 1,
+                      minone, &A[idx2D(0, i + 1, lda)], lda,
+                      &Y[idx2D(0, i, ldy)], 1, one, &Y[idx2D(i + 1, i, ldy)],
+                      1);
+    }
+    rocblas_scal<T>(handle, n - i - 1, &tauq[i], &Y[idx2D(i + 1, i, ldy)], 1);
+
+    // the pending updates on A(i,i+1:n), and G(i)
+    rocblas_gemv<T>(handle, rocblas_operation_none, n - i - 1, i + 1, minone,
+                    &Y[idx2D(i + 1, 0, ldy)], ldy, &A[idx2D(i, 0, lda)], lda,
+                    one, &A[idx2D(i, i + 1, lda)], lda);
+    if (i > 0)
+      rocblas_gemv<T>(handle, rocblas_operation_transpose, i, n - i - 1,
+                      minone, &A[idx2D(0, i + 1, lda)], lda,
+                      &X[idx2D(i, 0, ldx)], ldx, one,
+                      &A[idx2D(i, i + 1, lda)], lda);
+    roclapack_larfg_template<T>(handle, n - i - 1, &A[idx2D(i, i + 1, lda)],
+                                &A[idx2D(i, min(i + 2, n - 1), lda)], lda,
+                                &taup[i]);
+    hipLaunchKernelGGL(gebrd_set_unit<T>, dim3(1), dim3(1), 0, stream,
+                       &A[idx2D(i, i + 1, lda)], &E[i]);
+
+    // X(i+1:m,i) := taup * (A(i+1:m,i+1:n) - pending updates) * u
+    rocblas_gemv<T>(handle, rocblas_operation_none, m - i - 1, n - i - 1, one,
+                    &A[idx2D(i + 1, i + 1, lda)], lda,
+                    &A[idx2D(i, i + 1, lda)], lda, zero,
+                    &X[idx2D(i + 1, i, ldx)], 1);
+    rocblas_gemv<T>(handle, rocblas_operation_transpose, n - i - 1, i + 1, one,
+                    &Y[idx2D(i + 1, 0, ldy)], ldy, &A[idx2D(i, i + 1, lda)],
+                    lda, zero, &X[idx2D(0, i, ldx)], 1);
+    rocblas_gemv<T>(handle, rocblas_operation_none, m - i - 1, i + 1, minone,
+                    &A[idx2D(i + 1, 0, lda)], lda, &X[idx2D(0, i, ldx)], 1,
+                    one, &X[idx2D(i + 1, i, ldx)], 1);
+    if (i > 0) {
+      rocblas_gemv<T>(handle, rocblas_operation_none, i, n - i - 1, one,
+                      &A[idx2D(0, i + 1, lda)], lda, &A[idx2D(i, i + 1, lda)],
+                      lda, zero, &X[idx2D(0, i, ldx)], 1);
+      rocblas_gemv<T>(handle, rocblas_operation_none, m - i - 1, i, minone,
+                      &X[idx2D(i + 1, 0, ldx)], ldx, &X[idx2D(0, i, ldx)], 1,
+                      one, &X[idx2D(i + 1, i, ldx)], 1);
+    }
+    rocblas_scal<T>(handle, m - i - 1, &taup[i], &X[idx2D(i + 1, i, ldx)], 1);
+  }
+}
+
+/*
+ * Enqueue the reduction of the m x n matrix A (m >= n) to upper bidiagonal
+ * form Q**T * A * P = B, B with diagonal D (n) and superdiagonal E (n - 1).
+ * Q = H(0) * ... * H(n-1) is left below the diagonal of A as by geqrf (the
+ * tau are in tauq), so ormqr applies it; P = G(0) * ... * G(n-2) is left
+ * right of the superdiagonal, G(i) acting on columns i+1:n with tau in
+ * taup(i). The diagonal and superdiagonal of A are overwritten. Panels of
+ * GEBRD_BLOCKSIZE columns and rows are reduced by labrd, and the trailing
+ * matrix is updated by two gemm per panel. one, zero and minone are device
+ * constants and work has gebrd_work_size(m, n) elements.
+ */
+template <typename T>
+void rocsolver_gebrd_async_template(rocblas_handle handle, rocblas_int m,
+                                    rocblas_int n, T *A, rocblas_int lda, T *D,
+                                    T *E, T *tauq, T *taup, const T *one,
+                                    const T *zero, const T *minone, T *work) {
+
+  const rocblas_int nb = GEBRD_BLOCKSIZE;
+  T *X = work;
+  T *Y = X + size_t(nb) * m;
+  const rocblas_int ldx = m;
+  const rocblas_int ldy = n;
+
+  rocblas_int k = 0;
+  for (; n - k > nb; k += nb) {
+    gebrd_labrd<T>(handle, m - k, n - k, nb, &A[idx2D(k, k, lda)], lda, &D[k],
+                   &E[k], &tauq[k], &taup[k], X, ldx, Y, ldy, one, zero,
+                   minone);
+
+    // A(k+nb:m,k+nb:n) -= A(k+nb:m,k:k+nb) * Y(nb:,0:nb)**T +
+    // X(nb:,0:nb) * A(k:k+nb,k+nb:n)
+    rocblas_gemm<T>(handle, rocblas_operation_none,
+                    rocblas_operation_transpose, m - k - nb, n - k - nb, nb,
+                    minone, &A[idx2D(k + nb, k, lda)], lda,
+                    &Y[idx2D(nb, 0, ldy)], ldy, one,
+                    &A[idx2D(k + nb, k + nb, lda)], lda);
+    rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none,
+                    m - k - nb, n - k - nb, nb, minone, &X[idx2D(nb, 0, ldx)],
+                    ldx, &A[idx2D(k, k + nb, lda)], lda, one,
+                    &A[idx2D(k + nb, k + nb, lda)], lda);
+  }
+
+  // the last columns in one panel, with nothing left to update
+  if (k < n)
+    gebrd_labrd<T>(handle, m - k, n - k, n - k, &A[idx2D(k, k, lda)], lda,
+                   &D[k], &E[k], &tauq[k], &taup[k], X, ldx, Y, ldy, one,
+                   zero, minone);
+}
+
+#endif /* ROCLAPACK_GEBRD_HPP */
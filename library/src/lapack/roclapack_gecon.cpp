@@ -0,0 +1,31 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gecon.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgecon(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_int n, const float *A, rocsolver_int lda,
+                 const float *anorm, float *rcond) {
+  return rocsolver_gecon_template<float>(handle, norm, n, A, lda, anorm,
+                                         rcond);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgecon(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_int n, const double *A, rocsolver_int lda,
+                 const double *anorm, double *rcond) {
+  return rocsolver_gecon_template<double>(handle, norm, n, A, lda, anorm,
+                                          rcond);
+}
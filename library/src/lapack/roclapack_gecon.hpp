@@ -0,0 +1,98 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GECON_HPP
+#define ROCLAPACK_GECON_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_lacn2.hpp"
+
+using namespace std;
+
+#define GECON_INPONE 0
+#define GECON_WORK 1
+
+/*
+ * Reciprocal condition number of A in the 1-norm or the infinity-norm from
+ * its LU factors (getrf) and the norm anorm of the original matrix, as in the
+ * reference LAPACK: the norm of inv(A) is estimated by lacn2 with two
+ * triangular solves per product. The permutation does not change either
+ * norm, so ipiv is not needed. anorm and rcond are in device memory and
+ * nothing is copied back to the host.
+ */
+template <typename T>
+rocblas_status rocsolver_gecon_template(rocblas_handle handle,
+                                        rocsolver_norm_type norm, rocblas_int n,
+                                        const T *A, rocblas_int lda,
+                                        const T *anorm, T *rcond) {
+
+  if (n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (norm != rocsolver_norm_one && norm != rocsolver_norm_inf) {
+    return rocblas_status_not_implemented;
+  }
+
+  // the constant one, then the work vectors of the estimator
+  T one = static_cast<T>(1);
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, (GECON_WORK + 4 * n) * sizeof(T));
+  hipMemcpy(&inpsResGPU[GECON_INPONE], &one, sizeof(T), hipMemcpyHostToDevice);
+
+  lacn2_state<T> *state;
+  hipMalloc(&state, sizeof(lacn2_state<T>));
+
+  T *Ad = const_cast<T *>(A);
+  T *oneGPU = &inpsResGPU[GECON_INPONE];
+
+  // for the infinity-norm estimate the norm of inv(A)**T instead
+  const rocblas_int kaseInvA = (norm == rocsolver_norm_one) ? 1 : 2;
+
+  auto solve = [&](rocblas_int kase, T *x) {
+    if (kase == kaseInvA) {
+      // x := inv(U)*inv(L)*x
+      rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower,
+                      rocblas_operation_none, rocblas_diagonal_unit, n, 1,
+                      oneGPU, Ad, lda, x, n);
+      rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper,
+                      rocblas_operation_none, rocblas_diagonal_non_unit, n, 1,
+                      oneGPU, Ad, lda, x, n);
+    } else {
+      // x := inv(L**T)*inv(U**T)*x
+      rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper,
+                      rocblas_operation_transpose, rocblas_diagonal_non_unit,
+                      n, 1, oneGPU, Ad, lda, x, n);
+      rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower,
+                      rocblas_operation_transpose, rocblas_diagonal_unit, n, 1,
+                      oneGPU, Ad, lda, x, n);
+    }
+  };
+
+  roclapack_lacn2_rcond_template<T>(handle, n, solve, anorm, rcond,
+                                    &inpsResGPU[GECON_WORK], state);
+
+  hipFree(state);
+  hipFree(inpsResGPU);
+
+  return rocblas_status_success;
+}
+
+#undef GECON_INPONE
+#undef GECON_WORK
+
+#endif /* ROCLAPACK_GECON_HPP */
@@ -0,0 +1,31 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_geequ.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgeequ(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 const float *A, rocsolver_int lda, float *r, float *c,
+                 float *rowcnd, float *colcnd, float *amax) {
+  return rocsolver_geequ_template<float>(handle, m, n, A, lda, r, c, rowcnd,
+                                         colcnd, amax);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgeequ(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 const double *A, rocsolver_int lda, double *r, double *c,
+                 double *rowcnd, double *colcnd, double *amax) {
+  return rocsolver_geequ_template<double>(handle, m, n, A, lda, r, c, rowcnd,
+                                          colcnd, amax);
+}
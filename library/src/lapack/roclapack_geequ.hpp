@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GEEQU_HPP
+#define ROCLAPACK_GEEQU_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include <limits>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_lange.hpp"
+
+using namespace std;
+
+/*
+ * Largest absolute element of every row, one thread per row; neighbouring
+ * threads read neighbouring elements of each column.
+ */
+template <typename T>
+__global__ void geequ_rows(rocblas_int m, rocblas_int n, const T *A,
+                           rocblas_int lda, T *r) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  if (i < m) {
+    T v = 0;
+    for (rocblas_int j = 0; j < n; ++j)
+      v = max(v, fabs(A[i + j * lda]));
+    r[i] = v;
+  }
+}
+
+/*
+ * Largest absolute element of every column of diag(r)*A, one workgroup per
+ * column.
+ */
+template <typename T>
+__global__ void geequ_columns(rocblas_int m, const T *A, rocblas_int lda,
+                              const T *r, T *c) {
+  const int tid = hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_x;
+
+  __shared__ T sred[LANGE_BLOCKSIZE];
+
+  T v = 0;
+  for (rocblas_int i = tid; i < m; i += LANGE_BLOCKSIZE)
+    v = max(v, fabs(A[i + j * lda]) * r[i]);
+  v = lange_reduce<T, true>(v, sred);
+
+  if (tid == 0)
+    c[j] = v;
+}
+
+/*
+ * Turn the len maxima in s into scale factors, by a single workgroup: the
+ * reciprocals of the maxima clamped to [smlnum, 1/smlnum], and the ratio of
+ * the smallest to the largest maximum in cnd; the largest one goes to amax if
+ * given. A zero maximum gets the factor one and makes cnd zero. Without any
+ * maxima (len = 0) cnd is one and amax zero.
+ */
+template <typename T>
+__global__ void geequ_finish(rocblas_int len, T *s, T smlnum, T *cnd,
+                             T *amax) {
+  const int tid = hipThreadIdx_x;
+  const T bignum = 1 / smlnum;
+
+  __shared__ T sred[LANGE_BLOCKSIZE];
+
+  T vmax = 0;
+  T vmin = bignum;
+  for (rocblas_int k = tid; k < len; k += LANGE_BLOCKSIZE) {
+    vmax = max(vmax, s[k]);
+    vmin = min(vmin, s[k]);
+  }
+  vmax = lange_reduce<T, true>(vmax, sred);
+  vmin = -lange_reduce<T, true>(-vmin, sred);
+
+  for (rocblas_int k = tid; k < len; k += LANGE_BLOCKSIZE)
+    s[k] = (s[k] == 0) ? 1 : 1 / min(max(s[k], smlnum), bignum);
+
+  if (tid == 0) {
+    if (len == 0)
+      *cnd = 1;
+    else if (vmin == 0)
+      *cnd = 0;
+    else
+      *cnd = max(vmin, smlnum) / min(vmax, bignum);
+    if (amax)
+      *amax = vmax;
+  }
+}
+
+/*
+ * Row and column scale factors r and c that equilibrate A, as in the
+ * reference LAPACK: r(i) is the reciprocal of the largest element of row i,
+ * c(j) that of column j of diag(r)*A, so every row and column of
+ * diag(r)*A*diag(c) has largest element one. Two max reductions and two
+ * single-workgroup passes; all results stay on the device. An exactly zero
+ * row or column makes rowcnd or colcnd zero instead of returning its index.
+ */
+template <typename T>
+rocblas_status rocsolver_geequ_template(rocblas_handle handle, rocblas_int m,
+                                        rocblas_int n, const T *A,
+                                        rocblas_int lda, T *r, T *c,
+                                        T *rowcnd, T *colcnd, T *amax) {
+
+  if (m < 0 || n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, m)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const T smlnum = numeric_limits<T>::min();
+  const dim3 threads(LANGE_BLOCKSIZE, 1, 1);
+
+  // quick return with unit ratios
+  const rocblas_int mq = (n == 0) ? 0 : m;
+  const rocblas_int nq = (m == 0) ? 0 : n;
+
+  if (mq > 0) {
+    const rocblas_int blocks = (mq - 1) / LANGE_BLOCKSIZE + 1;
+    hipLaunchKernelGGL(geequ_rows<T>, dim3(blocks), threads, 0, stream, mq, nq,
+                       A, lda, r);
+  }
+  hipLaunchKernelGGL(geequ_finish<T>, dim3(1), threads, 0, stream, mq, r,
+                     smlnum, rowcnd, amax);
+
+  if (nq > 0) {
+    hipLaunchKernelGGL(geequ_columns<T>, dim3(nq), threads, 0, stream, mq, A,
+                       lda, r, c);
+  }
+  hipLaunchKernelGGL(geequ_finish<T>, dim3(1), threads, 0, stream, nq, c,
+                     smlnum, colcnd, (T *)nullptr);
+
+  return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GEEQU_HPP */
@@ -0,0 +1,27 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_geev.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgeev(rocblas_handle handle, rocsolver_evect evect, rocblas_int n,
+                float *A, rocblas_int lda, float *WR, float *WI, float *V,
+                rocblas_int ldv, rocblas_int *info) {
+  return rocsolver_geev_template<float>(handle, evect, n, A, lda, WR, WI, V,
+                                        ldv, info);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgeev(rocblas_handle handle, rocsolver_evect evect, rocblas_int n,
+                double *A, rocblas_int lda, double *WR, double *WI, double *V,
+                rocblas_int ldv, rocblas_int *info) {
+  return rocsolver_geev_template<double>(handle, evect, n, A, lda, WR, WI, V,
+                                         ldv, info);
+}
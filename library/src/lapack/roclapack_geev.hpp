@@ -0,0 +1,498 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GEEV_HPP
+#define ROCLAPACK_GEEV_HPP
+
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_gebal.hpp"
+#include "roclapack_gehrd.hpp"
+#include "roclapack_gesvd.hpp"
+#include "roclapack_hseqr.hpp"
+#include "roclapack_ormqr.hpp"
+
+using namespace std;
+
+/*
+ * A is balanced (gebal) and reduced to Hessenberg form H = Q**T * A * Q
+ * (gehrd), and the QR iteration (hseqr, multishift for large n) takes H to
+ * the real Schur form T = Z**T * H * Z. The eigenvectors X of T are found by back substitution
+ * (trevc), one workgroup per eigenvalue, and those of A are D * Q * Z * X,
+ * D the balancing: Q * Z is accumulated in V, and V * X is one gemm.
+ */
+
+// the constants, then the scaling D of the balancing and the tau of gehrd,
+// then the workspace
+#define GEEV_INPONE 0
+#define GEEV_INPZERO 1
+#define GEEV_INPMINONE 2
+#define GEEV_WORK 3
+
+// elements of the workspace after the constants: scale and tau, then what
+// gehrd, the ormqr that forms Q, hseqr, and the column norms of T and X need
+// one after the other
+inline size_t geev_work_size(rocsolver_evect evect, rocblas_int n) {
+  size_t size = max(gehrd_work_size(n), hseqr_work_size(n));
+  if (evect == rocsolver_evect_original)
+    size = max(size, max(ormqr_work_size(rocblas_side_left, n - 1, n - 1),
+                         size_t(n) + size_t(n) * n));
+  return 2 * size_t(n) + size;
+}
+
+// cnorm(j) := the 1-norm of T(0:j,j), the strictly upper part of column j
+template <typename T>
+__global__ void geev_column_norms(rocblas_int n, const T *Tm, rocblas_int ldt,
+                                  T *cnorm) {
+  const rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  if (j < n) {
+    T s = 0;
+    for (rocblas_int r = 0; r < j; ++r)
+      s += fabs(Tm[idx2D(r, j, ldt)]);
+    cnorm[j] = s;
+  }
+}
+
+// (cr, ci) := (ar + i * ai) / (br + i * bi), without undue overflow
+template <typename T>
+__device__ void geev_cdiv(T ar, T ai, T br, T bi, T &cr, T &ci) {
+  if (fabs(bi) <= fabs(br)) {
+    const T e = bi / br;
+    const T f = br + bi * e;
+    cr = (ar + ai * e) / f;
+    ci = (ai - ar * e) / f;
+  } else {
+    const T e = br / bi;
+    const T f = bi + br * e;
+    cr = (ar * e + ai) / f;
+    ci = (ai * e - ar) / f;
+  }
+}
+
+/*
+ * The right eigenvectors of the n x n matrix T in real Schur form, the
+ * workgroup ki for the eigenvalue in row ki; a complex conjugate pair at
+ * rows ki-1:ki+1 is taken by workgroup ki, for the eigenvalue wr + i * wi
+ * with wi > 0: its vector is X(:,ki-1) + i * X(:,ki). (T - w) * x = 0 is
+ * solved by back substitution column by column, thread 0 solving for the 1
+ * x 1 or 2 x 2 diagonal block of the step and all threads updating the
+ * right-hand side. As in LAPACK's trevc, pivots smaller than smin are
+ * perturbed to smin, and x is scaled down whenever an entry would make the
+ * update overflow (cnorm are the 1-norms of the strictly upper columns of
+ * T). Each vector is scaled at the end so that its largest entry (|re| +
+ * |im|) is 1. X is quasi upper triangular, with zeros below.
+ */
+template <typename T>
+__global__ void geev_trevc(rocblas_int n, const T *Tm, rocblas_int ldt,
+                           const T *cnorm, T *X, rocblas_int ldx, T smlnum,
+                           T ulp) {
+  __shared__ T sxr[2], sxi[2], ss;
+  __shared__ T sred[GEEV_BLOCKSIZE];
+  const int tid = hipThreadIdx_x;
+  const rocblas_int ki = hipBlockIdx_x;
+  const T bignum = (1 - ulp) / smlnum;
+
+  // the first of a pair is done by the workgroup of the second
+  if (ki + 1 < n && Tm[idx2D(ki + 1, ki, ldt)] != 0)
+    return;
+  const bool cplx = (ki > 0 && Tm[idx2D(ki, ki - 1, ldt)] != 0);
+  const rocblas_int top = cplx ? ki - 1 : ki;
+  T *xr = X + idx2D(0, top, ldx);
+  T *xi = X + idx2D(0, ki, ldx);
+
+  // x(top:ki+1) and the right-hand side -T(0:top,top:ki+1) * x(top:ki+1)
+  T wr, wi;
+  if (cplx) {
+    const T b = Tm[idx2D(top, ki, ldt)];
+    const T c = Tm[idx2D(ki, top, ldt)];
+    wr = Tm[idx2D(top, top, ldt)];
+    wi = sqrt(fabs(b)) * sqrt(fabs(c));
+    const T x0 = (fabs(b) >= fabs(c)) ? 1 : -wi / c;
+    const T x1 = (fabs(b) >= fabs(c)) ? wi / b : 1;
+    for (rocblas_int r = tid; r < n; r += hipBlockDim_x) {
+      xr[r] = (r < top) ? -x0 * Tm[idx2D(r, top, ldt)] : (r == top) ? x0 : 0;
+      xi[r] = (r < top) ? -x1 * Tm[idx2D(r, ki, ldt)] : (r == ki) ? x1 : 0;
+    }
+  } else {
+    wr = Tm[idx2D(ki, ki, ldt)];
+    wi = 0;
+    for (rocblas_int r = tid; r < n; r += hipBlockDim_x)
+      xr[r] = (r < ki) ? -Tm[idx2D(r, ki, ldt)] : (r == ki) ? 1 : 0;
+  }
+  const T smin = max(ulp * (fabs(wr) + fabs(wi)), smlnum);
+  __syncthreads();
+
+  rocblas_int j = top - 1;
+  while (j >= 0) {
+    const bool two = (j > 0 && Tm[idx2D(j, j - 1, ldt)] != 0);
+    if (tid == 0) {
+      T scale = 1;
+      if (!two) {
+        // (T(j,j) - w) * x(j) = b(j)
+        T dr = Tm[idx2D(j, j, ldt)] - wr;
+        T di = -wi;
+        if (fabs(dr) + fabs(di) < smin) {
+          dr = smin;
+          di = 0;
+        }
+        const T br = xr[j];
+        const T bi = cplx ? xi[j] : 0;
+        const T bnorm = fabs(br) + fabs(bi);
+        const T dnorm = fabs(dr) + fabs(di);
+        if (dnorm < 1 && bnorm > 1 && bnorm > bignum * dnorm)
+          scale = 1 / bnorm;
+        T x0r, x0i;
+        geev_cdiv(br * scale, bi * scale, dr, di, x0r, x0i);
+        const T xnorm = fabs(x0r) + fabs(x0i);
+        if (xnorm > 1 && cnorm[j] > bignum / xnorm) {
+          x0r /= xnorm;
+          x0i /= xnorm;
+          scale /= xnorm;
+        }
+        sxr[1] = x0r;
+        sxi[1] = x0i;
+      } else {
+        // the 2 x 2 block at rows j-1:j+1, by elimination with partial
+        // pivoting
+        const T m11r = Tm[idx2D(j - 1, j - 1, ldt)] - wr;
+        const T m12 = Tm[idx2D(j - 1, j, ldt)];
+        const T m21 = Tm[idx2D(j, j - 1, ldt)];
+        const T m22r = Tm[idx2D(j, j, ldt)] - wr;
+        const T b1r = xr[j - 1], b1i = cplx ? xi[j - 1] : 0;
+        const T b2r = xr[j], b2i = cplx ? xi[j] : 0;
+        const bool swap = fabs(m21) > fabs(m11r) + fabs(wi);
+        // pivot row (pr + i * pi, q | bp) and the other one (u + i * ui,
+        // wr2 + i * wi2 | bo)
+        T pr = swap ? m21 : m11r, pi = swap ? 0 : -wi;
+        const T q = swap ? m22r : m12, qi = swap ? -wi : 0;
+        const T ur = swap ? m11r : m21, ui = swap ? -wi : 0;
+        T w2r = swap ? m12 : m22r, w2i = swap ? 0 : -wi;
+        const T bpr = swap ? b2r : b1r, bpi = swap ? b2i : b1i;
+        T bor = swap ? b1r : b2r, boi = swap ? b1i : b2i;
+        if (fabs(pr) + fabs(pi) < smin) {
+          pr = smin;
+          pi = 0;
+        }
+        T lr, li;
+        geev_cdiv(ur, ui, pr, pi, lr, li);
+        w2r -= lr * q - li * qi;
+        w2i -= lr * qi + li * q;
+        bor -= lr * bpr - li * bpi;
+        boi -= lr * bpi + li * bpr;
+        if (fabs(w2r) + fabs(w2i) < smin) {
+          w2r = smin;
+          w2i = 0;
+        }
+        T x2r, x2i, x1r, x1i;
+        geev_cdiv(bor, boi, w2r, w2i, x2r, x2i);
+        geev_cdiv(bpr - (q * x2r - qi * x2i), bpi - (q * x2i + qi * x2r), pr,
+                  pi, x1r, x1i);
+        const T xnorm =
+            max(fabs(x1r) + fabs(x1i), fabs(x2r) + fabs(x2i));
+        if (xnorm > 1 && max(cnorm[j - 1], cnorm[j]) > bignum / xnorm) {
+          x1r /= xnorm;
+          x1i /= xnorm;
+          x2r /= xnorm;
+          x2i /= xnorm;
+          scale /= xnorm;
+        }
+        sxr[0] = x1r;
+        sxi[0] = x1i;
+        sxr[1] = x2r;
+        sxi[1] = x2i;
+      }
+      ss = scale;
+    }
+    __syncthreads();
+
+    // b(0:jlo) := scale * b(0:jlo) - T(0:jlo,jlo:j+1) * x(jlo:j+1), and
+    // the solved part x(j+1:ki+1) scaled along (xi(ki) too, for a pair)
+    const T s = ss;
+    const rocblas_int jlo = two ? j - 1 : j;
+    for (rocblas_int r = tid; r <= ki; r += hipBlockDim_x) {
+      if (r < jlo) {
+        T vr = s * xr[r] - Tm[idx2D(r, j, ldt)] * sxr[1];
+        if (two)
+          vr -= Tm[idx2D(r, j - 1, ldt)] * sxr[0];
+        xr[r] = vr;
+        if (cplx) {
+          T vi = s * xi[r] - Tm[idx2D(r, j, ldt)] * sxi[1];
+          if (two)
+            vi -= Tm[idx2D(r, j - 1, ldt)] * sxi[0];
+          xi[r] = vi;
+        }
+      } else if (r == j || r == jlo) {
+        xr[r] = (r == j) ? sxr[1] : sxr[0];
+        if (cplx)
+          xi[r] = (r == j) ? sxi[1] : sxi[0];
+      } else if (s != 1) {
+        xr[r] *= s;
+        if (cplx)
+          xi[r] *= s;
+      }
+    }
+    __syncthreads();
+    j = jlo - 1;
+  }
+
+  // the largest entry of x gets 1
+  T emax = 0;
+  for (rocblas_int r = tid; r <= top; r += hipBlockDim_x)
+    emax = max(emax, fabs(xr[r]) + (cplx ? fabs(xi[r]) : 0));
+  if (cplx && tid == 0)
+    emax = max(emax, fabs(xi[ki]));
+  sred[tid] = emax;
+  __syncthreads();
+  for (int st = GEEV_BLOCKSIZE / 2; st > 0; st >>= 1) {
+    if (tid < st)
+      sred[tid] = max(sred[tid], sred[tid + st]);
+    __syncthreads();
+  }
+  const T rmax = 1 / sred[0];
+  for (rocblas_int r = tid; r <= ki; r += hipBlockDim_x) {
+    xr[r] *= rmax;
+    if (cplx)
+      xi[r] *= rmax;
+  }
+}
+
+/*
+ * V(:,ki) := D * Y(:,ki) normalized to unit 2-norm, one workgroup per
+ * column. A complex pair (WI(ki) > 0) is done by workgroup ki for both its
+ * columns, as LAPACK's geev leaves them: the vector Y(:,ki) + i *
+ * Y(:,ki+1) is normalized and turned so that its largest entry is real.
+ */
+template <typename T>
+__global__ void geev_normalize(rocblas_int n, const T *Y, rocblas_int ldy,
+                               const T *scale, const T *WI, T *V,
+                               rocblas_int ldv) {
+  __shared__ T sred[GEEV_BLOCKSIZE];
+  __shared__ rocblas_int sidx[GEEV_BLOCKSIZE];
+  const int tid = hipThreadIdx_x;
+  const rocblas_int ki = hipBlockIdx_x;
+
+  if (WI[ki] < 0)
+    return;
+  const bool cplx = (WI[ki] > 0);
+  T *vr = V + idx2D(0, ki, ldv);
+  T *vi = V + idx2D(0, ki + (cplx ? 1 : 0), ldv);
+
+  T s = 0;
+  for (rocblas_int r = tid; r < n; r += hipBlockDim_x) {
+    const T x = Y[idx2D(r, ki, ldy)] * scale[r];
+    vr[r] = x;
+    s += x * x;
+    if (cplx) {
+      const T y = Y[idx2D(r, ki + 1, ldy)] * scale[r];
+      vi[r] = y;
+      s += y * y;
+    }
+  }
+  sred[tid] = s;
+  __syncthreads();
+  for (int st = GEEV_BLOCKSIZE / 2; st > 0; st >>= 1) {
+    if (tid < st)
+      sred[tid] += sred[tid + st];
+    __syncthreads();
+  }
+  const T rnrm = 1 / sqrt(sred[0]);
+  __syncthreads();
+
+  // and the largest entry of a complex vector, the first one on ties
+  T emax = -1;
+  rocblas_int imax = 0;
+  for (rocblas_int r = tid; r < n; r += hipBlockDim_x) {
+    vr[r] *= rnrm;
+    if (cplx) {
+      vi[r] *= rnrm;
+      const T e = vr[r] * vr[r] + vi[r] * vi[r];
+      if (e > emax) {
+        emax = e;
+        imax = r;
+      }
+    }
+  }
+  if (!cplx)
+    return;
+  sred[tid] = emax;
+  sidx[tid] = imax;
+  __syncthreads();
+  for (int st = GEEV_BLOCKSIZE / 2; st > 0; st >>= 1) {
+    if (tid < st && (sred[tid + st] > sred[tid] ||
+                     (sred[tid + st] == sred[tid] && sidx[tid + st] < sidx[tid]))) {
+      sred[tid] = sred[tid + st];
+      sidx[tid] = sidx[tid + st];
+    }
+    __syncthreads();
+  }
+  const rocblas_int k = sidx[0];
+  const T f = vr[k];
+  const T g = vi[k];
+  const T h = hypot(f, g);
+  const T cs = f / h;
+  const T sn = g / h;
+  __syncthreads();
+  for (rocblas_int r = tid; r < n; r += hipBlockDim_x) {
+    const T x = vr[r];
+    const T y = vi[r];
+    vr[r] = cs * x + sn * y;
+    vi[r] = (r == k) ? 0 : cs * y - sn * x;
+  }
+}
+
+/*
+ * Enqueue the balancing and the Hessenberg reduction of the n x n matrix A
+ * and, with evect original, V := Q. It only enqueues work on the handle's
+ * stream, with the constants and workspace laid out by the GEEV_* indices
+ * above.
+ */
+template <typename T>
+void rocsolver_geev_reduce_async_template(rocblas_handle handle,
+                                          rocsolver_evect evect,
+                                          rocblas_int n, T *A,
+                                          rocblas_int lda, T *V,
+                                          rocblas_int ldv, T *inpsResGPU) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const T *one = &inpsResGPU[GEEV_INPONE];
+  const T *zero = &inpsResGPU[GEEV_INPZERO];
+  const T *minone = &inpsResGPU[GEEV_INPMINONE];
+  T *scale = &inpsResGPU[GEEV_WORK];
+  T *tau = scale + n;
+  T *w = tau + n;
+  const rocblas_int bs = LARFG_BLOCKSIZE;
+
+  rocsolver_gebal_async_template<T>(handle, n, A, lda, scale);
+  rocsolver_gehrd_async_template<T>(handle, n, A, lda, tau, one, zero, minone,
+                                    w);
+
+  // V := Q, whose reflectors act on rows 1:n
+  if (evect == rocsolver_evect_original) {
+    hipLaunchKernelGGL(gesvd_identity<T>, dim3((n - 1) / bs + 1, n), dim3(bs),
+                       0, stream, n, n, 0, V, ldv);
+    if (n > 2)
+      rocsolver_ormqr_async_template<T>(
+          handle, rocblas_side_left, rocblas_operation_none, n - 1, n - 1,
+          n - 2, &A[idx2D(1, 0, lda)], lda, tau, &V[idx2D(1, 1, ldv)], ldv,
+          one, zero, minone, w);
+  }
+}
+
+/*
+ * Enqueue the right eigenvectors of A, given the real Schur form T of its
+ * Hessenberg form in A and the Schur vectors (Q * Z) in V; T is destroyed.
+ * Same layout as rocsolver_geev_reduce_async_template.
+ */
+template <typename T>
+void rocsolver_geev_vectors_async_template(rocblas_handle handle,
+                                           rocblas_int n, T *A,
+                                           rocblas_int lda, T *WI, T *V,
+                                           rocblas_int ldv, T *inpsResGPU) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const T *one = &inpsResGPU[GEEV_INPONE];
+  const T *zero = &inpsResGPU[GEEV_INPZERO];
+  T *scale = &inpsResGPU[GEEV_WORK];
+  T *cnorm = scale + 2 * n;
+  T *X = cnorm + n;
+  const rocblas_int bs = LARFG_BLOCKSIZE;
+
+  // the eigenvectors of T, then V * X (into A) normalized into V
+  hipLaunchKernelGGL(geev_column_norms<T>, dim3((n - 1) / bs + 1), dim3(bs),
+                     0, stream, n, A, lda, cnorm);
+  hipLaunchKernelGGL(geev_trevc<T>, dim3(n), dim3(GEEV_BLOCKSIZE), 0, stream,
+                     n, A, lda, cnorm, X, n,
+                     numeric_limits<T>::min() *
+                         (T(n) / numeric_limits<T>::epsilon()),
+                     numeric_limits<T>::epsilon());
+  rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none, n, n,
+                  n, one, V, ldv, X, n, zero, A, lda);
+  hipLaunchKernelGGL(geev_normalize<T>, dim3(n), dim3(GEEV_BLOCKSIZE), 0,
+                     stream, n, A, lda, scale, WI, V, ldv);
+}
+
+template <typename T>
+rocblas_status rocsolver_geev_template(rocblas_handle handle,
+                                       rocsolver_evect evect, rocblas_int n,
+                                       T *A, rocblas_int lda, T *WR, T *WI,
+                                       T *V, rocblas_int ldv,
+                                       rocblas_int *info) {
+
+  if (evect != rocsolver_evect_none && evect != rocsolver_evect_original) {
+    return rocblas_status_not_implemented;
+  } else if (n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (ldv < 1 ||
+             (evect == rocsolver_evect_original && ldv < max(1, n))) {
+    return rocblas_status_invalid_size;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  hipMemsetAsync(info, 0, sizeof(rocblas_int), stream);
+  if (n == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  T inpsResHost[3];
+  inpsResHost[GEEV_INPONE] = static_cast<T>(1);
+  inpsResHost[GEEV_INPZERO] = static_cast<T>(0);
+  inpsResHost[GEEV_INPMINONE] = static_cast<T>(-1);
+
+  // allocate the constants and workspace on device to avoid going onto CPU
+  // and needing to synchronize.
+  T *inpsResGPU;
+  rocblas_int *iwork;
+  hipMalloc(&inpsResGPU,
+            sizeof(T) * (GEEV_WORK + geev_work_size(evect, n)));
+  hipMalloc(&iwork, sizeof(rocblas_int) * hseqr_iwork_size(n));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T),
+            hipMemcpyHostToDevice);
+
+  // the QR iteration sits between the two async parts, as for large n it
+  // reads its state back from the device
+  const bool vectors = (evect == rocsolver_evect_original);
+  rocsolver_geev_reduce_async_template<T>(handle, evect, n, A, lda, V, ldv,
+                                          inpsResGPU);
+  rocsolver_hseqr_template<T>(handle, n, A, lda, WR, WI, vectors, V, ldv,
+                              vectors, info, &inpsResGPU[GEEV_INPONE],
+                              &inpsResGPU[GEEV_INPZERO],
+                              &inpsResGPU[GEEV_WORK + 2 * n], iwork);
+  if (vectors)
+    rocsolver_geev_vectors_async_template<T>(handle, n, A, lda, WI, V, ldv,
+                                             inpsResGPU);
+
+  hipFree(inpsResGPU);
+  hipFree(iwork);
+
+  return rocblas_status_success;
+}
+
+#undef GEEV_INPONE
+#undef GEEV_INPZERO
+#undef GEEV_INPMINONE
+#undef GEEV_WORK
+
+#endif /* ROCLAPACK_GEEV_HPP */
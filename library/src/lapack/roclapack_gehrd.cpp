@@ -0,0 +1,23 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gehrd.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgehrd(rocblas_handle handle, rocblas_int n, float *A,
+                 rocblas_int lda, float *tau) {
+  return rocsolver_gehrd_template<float>(handle, n, A, lda, tau);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgehrd(rocblas_handle handle, rocblas_int n, double *A,
+                 rocblas_int lda, double *tau) {
+  return rocsolver_gehrd_template<double>(handle, n, A, lda, tau);
+}
@@ -0,0 +1,232 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GEHRD_HPP
+#define ROCLAPACK_GEHRD_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_larfb.hpp"
+#include "roclapack_larfg.hpp"
+
+using namespace std;
+
+// the constants, then the workspace
+#define GEHRD_INPONE 0
+#define GEHRD_INPZERO 1
+#define GEHRD_INPMINONE 2
+#define GEHRD_WORK 3
+
+// elements of the workspace: the reflectors V and the pending updates Y of
+// a panel (n x nb each), its triangular factor T (nb x nb), two vectors of
+// nb and the two n x nb products of larfb
+inline size_t gehrd_work_size(rocblas_int n) {
+  const size_t nb = GEHRD_BLOCKSIZE;
+  return nb * (4 * size_t(n) + nb + 2);
+}
+
+// V(:,i) := the reflector of column i of the panel, from its entries x
+// below the subdiagonal (zeros above its unit entry), and T(i,i) := tau
+template <typename T>
+__global__ void gehrd_set_v(rocblas_int m, rocblas_int i, const T *x, T *V,
+                            rocblas_int ldv, const T *tau, T *Tm,
+                            rocblas_int ldt) {
+  const rocblas_int r = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  if (r < m)
+    V[idx2D(r, i, ldv)] = (r < i) ? 0 : (r == i) ? 1 : x[r];
+  if (r == 0)
+    Tm[idx2D(i, i, ldt)] = *tau;
+}
+
+/*
+ * lahr2: the ib columns k:k+ib of the n x n matrix A are reduced so that
+ * the entries below their subdiagonal are zero, by reflectors H(c) = I -
+ * tau(c) * v * v**T acting on rows and columns c+1:n. The rest of A is not
+ * updated: with Q = H(k) * ... * H(k+ib-1) = I - V * T * V**T on rows
+ * k+1:n, V (m x ib, m = n-k-1) is returned with its zeros and ones explicit
+ * so that every triangular product is a gemv or gemm, and Y = A * V * T (n x
+ * ib) so that A * Q = A - Y * V**T. Columns are updated with the pending
+ * products as they are reached, as in LAPACK; the first k+1 rows of Y are
+ * formed at the end by two gemm.
+ */
+template <typename T>
+void gehrd_lahr2(rocblas_handle handle, rocblas_int n, rocblas_int k,
+                 rocblas_int ib, T *A, rocblas_int lda, T *tau, T *V,
+                 rocblas_int ldv, T *Tm, rocblas_int ldt, T *Y,
+                 rocblas_int ldy, T *w, T *W, const T *one, const T *zero,
+                 const T *minone) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const rocblas_int m = n - k - 1;
+  const rocblas_int bs = LARFG_BLOCKSIZE;
+  T *w2 = w + GEHRD_BLOCKSIZE;
+
+  hipMemsetAsync(Tm, 0, sizeof(T) * ldt * ib, stream);
+
+  for (rocblas_int i = 0; i < ib; ++i) {
+    const rocblas_int c = k + i;
+    if (i > 0) {
+      // b = A(k+1:n,c) := b - Y * V(i-1,:)**T, then b := (I - V * T**T *
+      // V**T) * b
+      rocblas_gemv<T>(handle, rocblas_operation_none, m, i, minone,
+                      &Y[idx2D(k + 1, 0, ldy)], ldy, &V[idx2D(i - 1, 0, ldv)],
+                      ldv, one, &A[idx2D(k + 1, c, lda)], 1);
+      rocblas_gemv<T>(handle, rocblas_operation_transpose, m, i, one, V, ldv,
+                      &A[idx2D(k + 1, c, lda)], 1, zero, w, 1);
+      rocblas_gemv<T>(handle, rocblas_operation_transpose, i, i, one, Tm, ldt,
+                      w, 1, zero, w2, 1);
+      rocblas_gemv<T>(handle, rocblas_operation_none, m, i, minone, V, ldv,
+                      w2, 1, one, &A[idx2D(k + 1, c, lda)], 1);
+    }
+
+    roclapack_larfg_template<T>(handle, m - i, &A[idx2D(c + 1, c, lda)],
+                                &A[idx2D(min(c + 2, n - 1), c, lda)], 1,
+                                &tau[c]);
+    hipLaunchKernelGGL(gehrd_set_v<T>, dim3((m - 1) / bs + 1), dim3(bs), 0,
+                       stream, m, i, &A[idx2D(k + 1, c, lda)], V, ldv,
+                       &tau[c], Tm, ldt);
+
+    // Y(k+1:n,i) := tau * (A(k+1:n,c+1:n) * v - Y * (V**T * v)), and
+    // T(0:i,i) := -tau * T * (V**T * v)
+    rocblas_gemv<T>(handle, rocblas_operation_none, m, m - i, one,
+                    &A[idx2D(k + 1, c + 1, lda)], lda, &V[idx2D(i, i, ldv)],
+                    1, zero, &Y[idx2D(k + 1, i, ldy)], 1);
+    if (i > 0) {
+      rocblas_gemv<T>(handle, rocblas_operation_transpose, m, i, one, V, ldv,
+                      &V[idx2D(0, i, ldv)], 1, zero, w, 1);
+      rocblas_gemv<T>(handle, rocblas_operation_none, m, i, minone,
+                      &Y[idx2D(k + 1, 0, ldy)], ldy, w, 1, one,
+                      &Y[idx2D(k + 1, i, ldy)], 1);
+    }
+    rocblas_scal<T>(handle, m, &tau[c], &Y[idx2D(k + 1, i, ldy)], 1);
+    if (i > 0) {
+      rocblas_gemv<T>(handle, rocblas_operation_none, i, i, minone, Tm, ldt,
+                      w, 1, zero, &Tm[idx2D(0, i, ldt)], 1);
+      rocblas_scal<T>(handle, i, &tau[c], &Tm[idx2D(0, i, ldt)], 1);
+    }
+  }
+
+  // Y(0:k+1,:) := A(0:k+1,k+1:n) * V * T
+  rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none,
+                  k + 1, ib, m, one, &A[idx2D(0, k + 1, lda)], lda, V, ldv,
+                  zero, W, k + 1);
+  rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none,
+                  k + 1, ib, ib, one, W, k + 1, Tm, ldt, zero, Y, ldy);
+}
+
+/*
+ * Enqueue the reduction of the n x n matrix A to upper Hessenberg form
+ * Q**T * A * Q = H. Q = H(0) * ... * H(n-2) is left below the subdiagonal
+ * of A, H(c) acting on rows and columns c+1:n with its vector in
+ * A(c+2:n,c) (unit entry implicit) and tau(c), so that ormqr applies Q from
+ * A(1,0) with n-1 rows; tau(n-2) is 0. Panels of GEHRD_BLOCKSIZE columns
+ * are reduced by lahr2, and the rest of A is updated by three gemm from the
+ * right and larfb from the left per panel. one, zero and minone are device
+ * constants and work has gehrd_work_size(n) elements.
+ */
+template <typename T>
+void rocsolver_gehrd_async_template(rocblas_handle handle, rocblas_int n,
+                                    T *A, rocblas_int lda, T *tau,
+                                    const T *one, const T *zero,
+                                    const T *minone, T *work) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  if (n < 2)
+    return;
+
+  const rocblas_int nb = GEHRD_BLOCKSIZE;
+  T *V = work;
+  T *Y = V + size_t(nb) * n;
+  T *Tm = Y + size_t(nb) * n;
+  T *w = Tm + nb * nb;
+  T *W = w + 2 * nb;
+  T *W2 = W + size_t(nb) * n;
+  const rocblas_int ldv = n;
+  const rocblas_int ldy = n;
+
+  hipMemsetAsync(&tau[n - 2], 0, sizeof(T), stream);
+
+  for (rocblas_int k = 0; k < n - 2; k += nb) {
+    const rocblas_int ib = min(nb, n - 2 - k);
+    const rocblas_int m = n - k - 1;
+    gehrd_lahr2<T>(handle, n, k, ib, A, lda, tau, V, ldv, Tm, nb, Y, ldy, w,
+                   W, one, zero, minone);
+
+    // A := A * Q on the columns right of the panel, and on the first k+1
+    // rows of its own columns, the rest of which lahr2 has already reduced
+    rocblas_gemm<T>(handle, rocblas_operation_none,
+                    rocblas_operation_transpose, n, n - k - ib, ib, minone, Y,
+                    ldy, &V[idx2D(ib - 1, 0, ldv)], ldv, one,
+                    &A[idx2D(0, k + ib, lda)], lda);
+    if (ib > 1)
+      rocblas_gemm<T>(handle, rocblas_operation_none,
+                      rocblas_operation_transpose, k + 1, ib - 1, ib, minone,
+                      Y, ldy, V, ldv, one, &A[idx2D(0, k + 1, lda)], lda);
+
+    // A := Q**T * A on the columns right of the panel
+    roclapack_larfb_template<T>(handle, rocblas_side_left,
+                                rocblas_operation_transpose, m, n - k - ib,
+                                ib, V, ldv, Tm, nb,
+                                &A[idx2D(k + 1, k + ib, lda)], lda, W, W2,
+                                one, zero, minone);
+  }
+}
+
+template <typename T>
+rocblas_status rocsolver_gehrd_template(rocblas_handle handle, rocblas_int n,
+                                        T *A, rocblas_int lda, T *tau) {
+
+  if (n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (n < 2) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  T inpsResHost[3];
+  inpsResHost[GEHRD_INPONE] = static_cast<T>(1);
+  inpsResHost[GEHRD_INPZERO] = static_cast<T>(0);
+  inpsResHost[GEHRD_INPMINONE] = static_cast<T>(-1);
+
+  // allocate the constants and workspace on device to avoid going onto CPU
+  // and needing to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, sizeof(T) * (GEHRD_WORK + gehrd_work_size(n)));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T),
+            hipMemcpyHostToDevice);
+
+  rocsolver_gehrd_async_template<T>(
+      handle, n, A, lda, tau, &inpsResGPU[GEHRD_INPONE],
+      &inpsResGPU[GEHRD_INPZERO], &inpsResGPU[GEHRD_INPMINONE],
+      &inpsResGPU[GEHRD_WORK]);
+
+  hipFree(inpsResGPU);
+
+  return rocblas_status_success;
+}
+
+#undef GEHRD_INPONE
+#undef GEHRD_INPZERO
+#undef GEHRD_INPMINONE
+#undef GEHRD_WORK
+
+#endif /* ROCLAPACK_GEHRD_HPP */
@@ -0,0 +1,50 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gels.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgels(rocsolver_handle handle, rocsolver_operation trans,
+                rocsolver_int m, rocsolver_int n, rocsolver_int nrhs, float *A,
+                rocsolver_int lda, float *B, rocsolver_int ldb) {
+  return rocsolver_gels_template<float>(handle, trans, m, n, nrhs, A, lda, 0,
+                                        B, ldb, 0, 1);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_sgels_strided_batched(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int m,
+    rocsolver_int n, rocsolver_int nrhs, float *A, rocsolver_int lda,
+    rocsolver_int strideA, float *B, rocsolver_int ldb, rocsolver_int strideB,
+    rocsolver_int batch_count) {
+  return rocsolver_gels_template<float>(handle, trans, m, n, nrhs, A, lda,
+                                        strideA, B, ldb, strideB, batch_count);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgels(rocsolver_handle handle, rocsolver_operation trans,
+                rocsolver_int m, rocsolver_int n, rocsolver_int nrhs,
+                double *A, rocsolver_int lda, double *B, rocsolver_int ldb) {
+  return rocsolver_gels_template<double>(handle, trans, m, n, nrhs, A, lda, 0,
+                                         B, ldb, 0, 1);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_dgels_strided_batched(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int m,
+    rocsolver_int n, rocsolver_int nrhs, double *A, rocsolver_int lda,
+    rocsolver_int strideA, double *B, rocsolver_int ldb, rocsolver_int strideB,
+    rocsolver_int batch_count) {
+  return rocsolver_gels_template<double>(handle, trans, m, n, nrhs, A, lda,
+                                         strideA, B, ldb, strideB,
+                                         batch_count);
+}
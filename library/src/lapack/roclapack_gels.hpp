@@ -0,0 +1,297 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GELS_HPP
+#define ROCLAPACK_GELS_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_geqrf.hpp"
+#include "roclapack_larfg.hpp"
+#include "roclapack_ormqr.hpp"
+
+using namespace std;
+
+/*
+ * All cases are reduced to the QR factorization of an M x N matrix At with
+ * M >= N: At is A if m >= n, and A**T otherwise (so that its reflectors land
+ * in the rows of A, where gelqf puts those of the LQ factorization). With
+ * At = Q * R, either
+ *   - At * X = B is solved in the least squares sense: X = inv(R) * (Q**T *
+ *     B)(0:N), or
+ *   - At**T * X = B has the minimum norm solution X = Q * (inv(R**T) * B;
+ *     0).
+ * The first case is op(A) = A with m >= n, or op(A) = A**T with m < n.
+ */
+
+// the constants, then the workspace
+#define GELS_INPONE 0
+#define GELS_INPZERO 1
+#define GELS_INPMINONE 2
+#define GELS_WORK 3
+
+// B(r0:r1,0:nrhs) := 0 for every matrix of the batch
+template <typename T>
+__global__ void gels_zero_rows(rocblas_int r0, rocblas_int r1,
+                               rocblas_int nrhs, T *B, rocblas_int ldb,
+                               rocblas_int strideB) {
+  const rocblas_int k = hipBlockIdx_x * GELS_BLOCKSIZE + hipThreadIdx_x;
+  const rocblas_int rows = r1 - r0;
+  B += hipBlockIdx_y * strideB;
+  if (k < rows * nrhs)
+    B[idx2D(r0 + k % rows, k / rows, ldb)] = 0;
+}
+
+// B := A**T for the m x n matrix A
+template <typename T>
+__global__ void gels_transpose(rocblas_int m, rocblas_int n, const T *A,
+                               rocblas_int lda, T *B, rocblas_int ldb) {
+  const rocblas_int k = hipBlockIdx_x * GELS_BLOCKSIZE + hipThreadIdx_x;
+  if (k < m * n)
+    B[idx2D(k / m, k % m, ldb)] = A[idx2D(k % m, k / m, lda)];
+}
+
+/*
+ * The whole solve of a small problem by one workgroup, one problem of the
+ * batch per workgroup. At(i,j) is A[i*rs + j*cs]; the reflectors are applied
+ * to B as in geqr2, and R is solved for by substitution.
+ */
+template <typename T>
+__global__ void gels_small(bool notrans, rocblas_int M, rocblas_int N,
+                           rocblas_int nrhs, T *A, rocblas_int rs,
+                           rocblas_int cs, rocblas_int strideA, T *B,
+                           rocblas_int ldb, rocblas_int strideB) {
+  const int tid = hipThreadIdx_x;
+  __shared__ T sred[LARFG_BLOCKSIZE];
+  __shared__ T tau[GELS_SMALL_MAXCOLS];
+
+  A += hipBlockIdx_x * strideA;
+  B += hipBlockIdx_x * strideB;
+
+  // At = Q * R
+  for (rocblas_int j = 0; j < N; ++j) {
+    T *v = &A[j * (rs + cs)];
+    larfg_device<T>(M - j, v, &A[min(j + 1, M - 1) * rs + j * cs], rs,
+                    &tau[j], sred);
+    __syncthreads();
+    for (rocblas_int c = j + 1; c < N; ++c)
+      larf_device<T>(M - j, tau[j], v, rs, &A[j * rs + c * cs], rs, sred);
+    __syncthreads();
+  }
+
+  if (notrans) {
+    // B := Q**T * B, then R * X = B(0:N); larf_device reads entries of
+    // the column written by other threads in the previous step
+    for (rocblas_int j = 0; j < N; ++j) {
+      for (rocblas_int c = 0; c < nrhs; ++c)
+        larf_device<T>(M - j, tau[j], &A[j * (rs + cs)], rs,
+                       &B[idx2D(j, c, ldb)], 1, sred);
+      __syncthreads();
+    }
+
+    for (rocblas_int j = N - 1; j >= 0; --j) {
+      for (rocblas_int c = tid; c < nrhs; c += LARFG_BLOCKSIZE)
+        B[idx2D(j, c, ldb)] /= A[j * (rs + cs)];
+      __syncthreads();
+      for (rocblas_int k = tid; k < j * nrhs; k += LARFG_BLOCKSIZE)
+        B[idx2D(k % j, k / j, ldb)] -=
+            A[(k % j) * rs + j * cs] * B[idx2D(j, k / j, ldb)];
+      __syncthreads();
+    }
+  } else {
+    // R**T * Y = B(0:N), B(N:M) := 0, then B := Q * B
+    for (rocblas_int j = 0; j < N; ++j) {
+      for (rocblas_int c = tid; c < nrhs; c += LARFG_BLOCKSIZE)
+        B[idx2D(j, c, ldb)] /= A[j * (rs + cs)];
+      __syncthreads();
+      const rocblas_int rows = N - j - 1;
+      for (rocblas_int k = tid; k < rows * nrhs; k += LARFG_BLOCKSIZE)
+        B[idx2D(j + 1 + k % rows, k / rows, ldb)] -=
+            A[j * rs + (j + 1 + k % rows) * cs] * B[idx2D(j, k / rows, ldb)];
+      __syncthreads();
+    }
+    for (rocblas_int k = tid; k < (M - N) * nrhs; k += LARFG_BLOCKSIZE)
+      B[idx2D(N + k % (M - N), k / (M - N), ldb)] = 0;
+    __syncthreads();
+
+    for (rocblas_int j = N - 1; j >= 0; --j) {
+      for (rocblas_int c = 0; c < nrhs; ++c)
+        larf_device<T>(M - j, tau[j], &A[j * (rs + cs)], rs,
+                       &B[idx2D(j, c, ldb)], 1, sred);
+      __syncthreads();
+    }
+  }
+}
+
+// elements of the workspace after the constants for one problem of the
+// large path; the geqrf buffer comes last
+inline size_t gels_work_size(rocblas_int m, rocblas_int n, rocblas_int nrhs) {
+  const rocblas_int M = max(m, n);
+  const rocblas_int N = min(m, n);
+  return N + ((m < n) ? size_t(m) * n : 0) +
+         ormqr_work_size(rocblas_side_left, M, nrhs) + geqrf_buffer_size(M, N);
+}
+
+// the geqrf buffer at the end of the workspace of the large path
+template <typename T>
+T *gels_geqrf_buffer(T *inpsResGPU, rocblas_int m, rocblas_int n,
+                     rocblas_int nrhs) {
+  return &inpsResGPU[GELS_WORK] + gels_work_size(m, n, nrhs) -
+         geqrf_buffer_size(max(m, n), min(m, n));
+}
+
+/*
+ * Enqueue the solve of one problem through geqrf: Q**T or Q is applied to B
+ * in blocks of reflectors by ormqr, and R is solved for by trsm. work holds
+ * gels_work_size(m, n, nrhs) elements, with the constants of the geqrf
+ * buffer (see gels_geqrf_buffer) already in place.
+ */
+template <typename T>
+void rocsolver_gels_async_template(rocblas_handle handle,
+                                   rocblas_operation trans, rocblas_int m,
+                                   rocblas_int n, rocblas_int nrhs, T *A,
+                                   rocblas_int lda, T *B, rocblas_int ldb,
+                                   T *inpsResGPU) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const bool lq = (m < n);
+  const bool notrans = (trans == rocblas_operation_none) != lq;
+  const rocblas_int M = max(m, n);
+  const rocblas_int N = min(m, n);
+  const T *one = &inpsResGPU[GELS_INPONE];
+  const T *zero = &inpsResGPU[GELS_INPZERO];
+  const T *minone = &inpsResGPU[GELS_INPMINONE];
+
+  T *tau = &inpsResGPU[GELS_WORK];
+  T *At = lq ? tau + N : A;
+  T *work = tau + N + (lq ? size_t(m) * n : 0);
+  T *geqrfBuf = gels_geqrf_buffer(inpsResGPU, m, n, nrhs);
+  const rocblas_int ldat = lq ? n : lda;
+  const rocblas_int blocks = (m * n - 1) / GELS_BLOCKSIZE + 1;
+
+  if (lq)
+    hipLaunchKernelGGL(gels_transpose<T>, dim3(blocks), dim3(GELS_BLOCKSIZE),
+                       0, stream, m, n, A, lda, At, ldat);
+
+  rocsolver_geqrf_async_template<T>(handle, M, N, At, ldat, tau, geqrfBuf);
+
+  if (nrhs > 0) {
+    if (notrans) {
+      rocsolver_ormqr_async_template<T>(handle, rocblas_side_left,
+                                        rocblas_operation_transpose, M, nrhs,
+                                        N, At, ldat, tau, B, ldb, one, zero,
+                                        minone, work);
+      rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper,
+                      rocblas_operation_none, rocblas_diagonal_non_unit, N,
+                      nrhs, one, At, ldat, B, ldb);
+    } else {
+      rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper,
+                      rocblas_operation_transpose, rocblas_diagonal_non_unit,
+                      N, nrhs, one, At, ldat, B, ldb);
+      if (M > N)
+        hipLaunchKernelGGL(gels_zero_rows<T>,
+                           dim3(((M - N) * nrhs - 1) / GELS_BLOCKSIZE + 1, 1),
+                           dim3(GELS_BLOCKSIZE), 0, stream, N, M, nrhs, B, ldb,
+                           0);
+      rocsolver_ormqr_async_template<T>(handle, rocblas_side_left,
+                                        rocblas_operation_none, M, nrhs, N,
+                                        At, ldat, tau, B, ldb, one, zero,
+                                        minone, work);
+    }
+  }
+
+  if (lq)
+    hipLaunchKernelGGL(gels_transpose<T>, dim3(blocks), dim3(GELS_BLOCKSIZE),
+                       0, stream, n, m, At, ldat, A, lda);
+}
+
+template <typename T>
+rocblas_status
+rocsolver_gels_template(rocblas_handle handle, rocblas_operation trans,
+                        rocblas_int m, rocblas_int n, rocblas_int nrhs, T *A,
+                        rocblas_int lda, rocblas_int strideA, T *B,
+                        rocblas_int ldb, rocblas_int strideB,
+                        rocblas_int batch_count) {
+
+  if (trans != rocblas_operation_none &&
+      trans != rocblas_operation_transpose) {
+    // only real matrices
+    return rocblas_status_not_implemented;
+  } else if (m < 0 || n < 0 || nrhs < 0 || batch_count < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, m) || ldb < max(1, max(m, n))) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (nrhs == 0 || batch_count == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const rocblas_int M = max(m, n);
+  const rocblas_int N = min(m, n);
+
+  if (N == 0) {
+    // the solution of an empty system is zero
+    if (M > 0)
+      hipLaunchKernelGGL(gels_zero_rows<T>,
+                         dim3((M * nrhs - 1) / GELS_BLOCKSIZE + 1, batch_count),
+                         dim3(GELS_BLOCKSIZE), 0, stream, 0, M, nrhs, B, ldb,
+                         strideB);
+    return rocblas_status_success;
+  }
+
+  if (M <= GELS_SMALL_MAXROWS && N <= GELS_SMALL_MAXCOLS) {
+    const bool lq = (m < n);
+    hipLaunchKernelGGL(gels_small<T>, dim3(batch_count),
+                       dim3(LARFG_BLOCKSIZE), 0, stream,
+                       (trans == rocblas_operation_none) != lq, M, N, nrhs, A,
+                       lq ? lda : 1, lq ? 1 : lda, strideA, B, ldb, strideB);
+    return rocblas_status_success;
+  }
+
+  T inpsResHost[3];
+  inpsResHost[GELS_INPONE] = static_cast<T>(1);
+  inpsResHost[GELS_INPZERO] = static_cast<T>(0);
+  inpsResHost[GELS_INPMINONE] = static_cast<T>(-1);
+
+  // allocate the constants and workspace on device to avoid going onto CPU
+  // and needing to synchronize; the problems of the batch take turns with it
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, sizeof(T) * (GELS_WORK + gels_work_size(m, n, nrhs)));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T),
+            hipMemcpyHostToDevice);
+  geqrf_init_buffer<T>(gels_geqrf_buffer(inpsResGPU, m, n, nrhs));
+
+  for (rocblas_int b = 0; b < batch_count; ++b)
+    rocsolver_gels_async_template<T>(handle, trans, m, n, nrhs,
+                                     A + size_t(b) * strideA, lda,
+                                     B + size_t(b) * strideB, ldb, inpsResGPU);
+
+  hipFree(inpsResGPU);
+
+  return rocblas_status_success;
+}
+
+#undef GELS_INPONE
+#undef GELS_INPZERO
+#undef GELS_INPMINONE
+#undef GELS_WORK
+
+#endif /* ROCLAPACK_GELS_HPP */
@@ -0,0 +1,27 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_geqp3.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgeqp3(rocblas_handle handle, rocblas_int m, rocblas_int n, float *A,
+                 rocblas_int lda, rocblas_int *jpvt, float *tau) {
+  return rocsolver_geqp3_template<float>(handle, m, n, A, lda, jpvt, tau);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgeqp3(rocblas_handle handle, rocblas_int m, rocblas_int n,
+                 double *A, rocblas_int lda, rocblas_int *jpvt, double *tau) {
+  return rocsolver_geqp3_template<double>(handle, m, n, A, lda, jpvt, tau);
+}
@@ -0,0 +1,325 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GEQP3_HPP
+#define ROCLAPACK_GEQP3_HPP
+
+#include <cmath>
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_larfg.hpp"
+
+using namespace std;
+
+// the constants, the diagonal entry put aside while the reflector is
+// applied, -tau of the current reflector, then the partial and the reference
+// column norms (n each), a work vector of GEQP3_BLOCKSIZE elements and the
+// n x GEQP3_BLOCKSIZE matrix F of the pending updates
+#define GEQP3_INPONE 0
+#define GEQP3_INPZERO 1
+#define GEQP3_INPMINONE 2
+#define GEQP3_DIAG 3
+#define GEQP3_NEGTAU 4
+#define GEQP3_WORK 5
+
+// the norms of the columns of A, and the identity permutation
+template <typename T>
+__global__ void geqp3_init_norms(rocblas_int m, const T *A, rocblas_int lda,
+                                 T *vn1, T *vn2, rocblas_int *jpvt) {
+  const int tid = hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_x;
+  __shared__ T sred[LARFG_BLOCKSIZE];
+
+  T s = 0;
+  for (rocblas_int i = tid; i < m; i += LARFG_BLOCKSIZE)
+    s += A[idx2D(i, j, lda)] * A[idx2D(i, j, lda)];
+  s = sqrt(larfg_sum(s, sred));
+
+  if (tid == 0) {
+    vn1[j] = s;
+    vn2[j] = s;
+    jpvt[j] = j + 1;
+  }
+}
+
+/*
+ * Pivot column rk (the j-th of the block that starts at column k): the
+ * column of largest partial norm among rk:n is swapped with it, along with
+ * its row of F, its norms and its entry of jpvt. One workgroup.
+ */
+template <typename T>
+__global__ void geqp3_pivot(rocblas_int m, rocblas_int n, rocblas_int rk,
+                            rocblas_int j, T *A, rocblas_int lda, T *F,
+                            rocblas_int ldf, T *vn1, T *vn2,
+                            rocblas_int *jpvt) {
+  const int tid = hipThreadIdx_x;
+  __shared__ T sval[LARFG_BLOCKSIZE];
+  __shared__ rocblas_int sidx[LARFG_BLOCKSIZE];
+
+  // the first of the largest norms, as iamax
+  T v = -1;
+  rocblas_int p = rk;
+  for (rocblas_int i = rk + tid; i < n; i += LARFG_BLOCKSIZE) {
+    if (vn1[i] > v) {
+      v = vn1[i];
+      p = i;
+    }
+  }
+  sval[tid] = v;
+  sidx[tid] = p;
+  __syncthreads();
+  for (int st = LARFG_BLOCKSIZE / 2; st > 0; st >>= 1) {
+    if (tid < st &&
+        (sval[tid + st] > sval[tid] ||
+         (sval[tid + st] == sval[tid] && sidx[tid + st] < sidx[tid]))) {
+      sval[tid] = sval[tid + st];
+      sidx[tid] = sidx[tid + st];
+    }
+    __syncthreads();
+  }
+  const rocblas_int pvt = sidx[0];
+
+  if (pvt == rk)
+    return;
+
+  for (rocblas_int i = tid; i < m; i += LARFG_BLOCKSIZE) {
+    const T t = A[idx2D(i, rk, lda)];
+    A[idx2D(i, rk, lda)] = A[idx2D(i, pvt, lda)];
+    A[idx2D(i, pvt, lda)] = t;
+  }
+  for (rocblas_int l = tid; l < j; l += LARFG_BLOCKSIZE) {
+    const T t = F[idx2D(rk, l, ldf)];
+    F[idx2D(rk, l, ldf)] = F[idx2D(pvt, l, ldf)];
+    F[idx2D(pvt, l, ldf)] = t;
+  }
+  if (tid == 0) {
+    const rocblas_int t = jpvt[rk];
+    jpvt[rk] = jpvt[pvt];
+    jpvt[pvt] = t;
+    vn1[pvt] = vn1[rk];
+    vn2[pvt] = vn2[rk];
+  }
+}
+
+// v(0) := 1 in place of the diagonal entry, -tau for gemv, and F(k:rk+1,j)
+// := 0
+template <typename T>
+__global__ void geqp3_set_unit(rocblas_int k, rocblas_int rk, rocblas_int j,
+                               T *Ajj, const T *tau, T *F, rocblas_int ldf,
+                               T *inpsResGPU) {
+  if (hipBlockIdx_x == 0 && hipThreadIdx_x == 0) {
+    inpsResGPU[GEQP3_DIAG] = *Ajj;
+    inpsResGPU[GEQP3_NEGTAU] = -(*tau);
+    *Ajj = 1;
+    for (rocblas_int i = k; i <= rk; ++i)
+      F[idx2D(i, j, ldf)] = 0;
+  }
+}
+
+/*
+ * Downdate the partial norms of the columns rk+1:n after row rk, one
+ * workgroup per column. A norm that lost too much to cancellation is
+ * recomputed from the column as it will be after the pending updates of the
+ * block, A(rk+1:m,jj) - A(rk+1:m,k:rk+1) * F(jj,0:j+1)**T. Workgroup 0 also
+ * puts the diagonal entry back.
+ */
+template <typename T>
+__global__ void geqp3_norms(rocblas_int m, rocblas_int n, rocblas_int k,
+                            rocblas_int rk, rocblas_int j, T *A,
+                            rocblas_int lda, const T *F, rocblas_int ldf,
+                            T *vn1, T *vn2, T tol3z, const T *inpsResGPU) {
+  const int tid = hipThreadIdx_x;
+  const rocblas_int jj = rk + 1 + hipBlockIdx_x;
+  __shared__ T sred[LARFG_BLOCKSIZE];
+
+  if (hipBlockIdx_x == 0 && tid == 0)
+    A[idx2D(rk, rk, lda)] = inpsResGPU[GEQP3_DIAG];
+
+  if (rk >= m - 1 || jj >= n || vn1[jj] == 0)
+    return;
+
+  const T v1 = vn1[jj];
+  const T v2 = vn2[jj];
+  T temp = fabs(A[idx2D(rk, jj, lda)]) / v1;
+  temp = max(T(0), (1 + temp) * (1 - temp));
+  const T temp2 = temp * (v1 / v2) * (v1 / v2);
+  __syncthreads();
+
+  if (temp2 > tol3z) {
+    if (tid == 0)
+      vn1[jj] = v1 * sqrt(temp);
+    return;
+  }
+
+  T s = 0;
+  for (rocblas_int i = rk + 1 + tid; i < m; i += LARFG_BLOCKSIZE) {
+    T a = A[idx2D(i, jj, lda)];
+    for (rocblas_int l = 0; l <= j; ++l)
+      a -= A[idx2D(i, k + l, lda)] * F[idx2D(jj, l, ldf)];
+    s += a * a;
+  }
+  s = sqrt(larfg_sum(s, sred));
+
+  if (tid == 0) {
+    vn1[jj] = s;
+    vn2[jj] = s;
+  }
+}
+
+// elements of the workspace after the constants
+inline size_t geqp3_work_size(rocblas_int n) {
+  return 2 * size_t(n) + GEQP3_BLOCKSIZE + size_t(n) * GEQP3_BLOCKSIZE;
+}
+
+/*
+ * QR factorization with column pivoting, blocked as the LAPACK xlaqps: the
+ * pivot of every column is chosen from the partial norms, the column and
+ * the row of the pivot are brought up to date with gemv while the rest of
+ * the updates of the block are gathered in F, and the trailing matrix is
+ * updated by one gemm per block. Pivot search, swaps and norm downdates run
+ * on the device. It only enqueues work on the handle's stream, with the
+ * constants and workspace laid out by the GEQP3_* indices above.
+ */
+template <typename T>
+void rocsolver_geqp3_async_template(rocblas_handle handle, rocblas_int m,
+                                    rocblas_int n, T *A, rocblas_int lda,
+                                    rocblas_int *jpvt, T *tau,
+                                    T *inpsResGPU) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const T *one = &inpsResGPU[GEQP3_INPONE];
+  const T *zero = &inpsResGPU[GEQP3_INPZERO];
+  const T *minone = &inpsResGPU[GEQP3_INPMINONE];
+  const T *negtau = &inpsResGPU[GEQP3_NEGTAU];
+  T *vn1 = &inpsResGPU[GEQP3_WORK];
+  T *vn2 = vn1 + n;
+  T *auxv = vn2 + n;
+  T *F = auxv + GEQP3_BLOCKSIZE;
+  const rocblas_int ldf = n;
+  const T tol3z = sqrt(numeric_limits<T>::epsilon());
+
+  hipLaunchKernelGGL(geqp3_init_norms<T>, dim3(n), dim3(LARFG_BLOCKSIZE), 0,
+                     stream, m, A, lda, vn1, vn2, jpvt);
+
+  const rocblas_int kmax = min(m, n);
+  for (rocblas_int k = 0; k < kmax; k += GEQP3_BLOCKSIZE) {
+    const rocblas_int kb = min(GEQP3_BLOCKSIZE, kmax - k);
+
+    for (rocblas_int j = 0; j < kb; ++j) {
+      const rocblas_int rk = k + j;
+
+      hipLaunchKernelGGL(geqp3_pivot<T>, dim3(1), dim3(LARFG_BLOCKSIZE), 0,
+                         stream, m, n, rk, j, A, lda, F, ldf, vn1, vn2, jpvt);
+
+      // the pending updates of the block on the pivot column
+      if (j > 0)
+        rocblas_gemv<T>(handle, rocblas_operation_none, m - rk, j, minone,
+                        &A[idx2D(rk, k, lda)], lda, &F[idx2D(rk, 0, ldf)], ldf,
+                        one, &A[idx2D(rk, rk, lda)], 1);
+
+      // generate the reflector H(rk) that annihilates A(rk+1:m,rk)
+      roclapack_larfg_template<T>(handle, m - rk, &A[idx2D(rk, rk, lda)],
+                                  &A[idx2D(min(rk + 1, m - 1), rk, lda)], 1,
+                                  &tau[rk]);
+
+      hipLaunchKernelGGL(geqp3_set_unit<T>, dim3(1), dim3(1), 0, stream, k,
+                         rk, j, &A[idx2D(rk, rk, lda)], &tau[rk], F, ldf,
+                         inpsResGPU);
+
+      // F(rk+1:n,j) := tau * A(rk:m,rk+1:n)**T * v, and the correction
+      // F(k:n,j) -= tau * F(k:n,0:j) * (A(rk:m,k:rk)**T * v) for the
+      // reflectors before it
+      if (rk < n - 1)
+        rocblas_gemv<T>(handle, rocblas_operation_transpose, m - rk,
+                        n - rk - 1, &tau[rk], &A[idx2D(rk, rk + 1, lda)], lda,
+                        &A[idx2D(rk, rk, lda)], 1, zero,
+                        &F[idx2D(rk + 1, j, ldf)], 1);
+      if (j > 0) {
+        rocblas_gemv<T>(handle, rocblas_operation_transpose, m - rk, j, negtau,
+                        &A[idx2D(rk, k, lda)], lda, &A[idx2D(rk, rk, lda)], 1,
+                        zero, auxv, 1);
+        rocblas_gemv<T>(handle, rocblas_operation_none, n - k, j, one,
+                        &F[idx2D(k, 0, ldf)], ldf, auxv, 1, one,
+                        &F[idx2D(k, j, ldf)], 1);
+      }
+
+      // the pending updates of the block on the pivot row
+      if (rk < n - 1)
+        rocblas_gemv<T>(handle, rocblas_operation_none, n - rk - 1, j + 1,
+                        minone, &F[idx2D(rk + 1, 0, ldf)], ldf,
+                        &A[idx2D(rk, k, lda)], lda, one,
+                        &A[idx2D(rk, rk + 1, lda)], lda);
+
+      hipLaunchKernelGGL(geqp3_norms<T>, dim3(max(n - rk - 1, 1)),
+                         dim3(LARFG_BLOCKSIZE), 0, stream, m, n, k, rk, j, A,
+                         lda, F, ldf, vn1, vn2, tol3z, inpsResGPU);
+    }
+
+    // A(k+kb:m,k+kb:n) -= A(k+kb:m,k:k+kb) * F(k+kb:n,0:kb)**T
+    if (k + kb < min(m, n))
+      rocblas_gemm<T>(handle, rocblas_operation_none,
+                      rocblas_operation_transpose, m - k - kb, n - k - kb, kb,
+                      minone, &A[idx2D(k + kb, k, lda)], lda,
+                      &F[idx2D(k + kb, 0, ldf)], ldf, one,
+                      &A[idx2D(k + kb, k + kb, lda)], lda);
+  }
+}
+
+template <typename T>
+rocblas_status rocsolver_geqp3_template(rocblas_handle handle, rocblas_int m,
+                                        rocblas_int n, T *A, rocblas_int lda,
+                                        rocblas_int *jpvt, T *tau) {
+
+  if (m < 0 || n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, m)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (n == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  T inpsResHost[3];
+  inpsResHost[GEQP3_INPONE] = static_cast<T>(1);
+  inpsResHost[GEQP3_INPZERO] = static_cast<T>(0);
+  inpsResHost[GEQP3_INPMINONE] = static_cast<T>(-1);
+
+  // allocate the constants and workspace on device to avoid going onto CPU
+  // and needing to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, sizeof(T) * (GEQP3_WORK + geqp3_work_size(n)));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T),
+            hipMemcpyHostToDevice);
+
+  rocsolver_geqp3_async_template<T>(handle, m, n, A, lda, jpvt, tau,
+                                    inpsResGPU);
+
+  hipFree(inpsResGPU);
+
+  return rocblas_status_success;
+}
+
+#undef GEQP3_INPONE
+#undef GEQP3_INPZERO
+#undef GEQP3_INPMINONE
+#undef GEQP3_DIAG
+#undef GEQP3_NEGTAU
+#undef GEQP3_WORK
+
+#endif /* ROCLAPACK_GEQP3_HPP */
@@ -0,0 +1,27 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_geqr2.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgeqr2(rocblas_handle handle, rocblas_int m, rocblas_int n, float *A,
+                 rocblas_int lda, float *tau) {
+  return rocsolver_geqr2_template<float>(handle, m, n, A, lda, tau);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgeqr2(rocblas_handle handle, rocblas_int m, rocblas_int n, double *A,
+                 rocblas_int lda, double *tau) {
+  return rocsolver_geqr2_template<double>(handle, m, n, A, lda, tau);
+}
@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GEQR2_HPP
+#define ROCLAPACK_GEQR2_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_larfg.hpp"
+
+using namespace std;
+
+// the constants, the diagonal entry put aside while the reflector is
+// applied, -tau of the current reflector and a work vector of n elements
+#define GEQR2_INPONE 0
+#define GEQR2_INPZERO 1
+#define GEQR2_DIAG 2
+#define GEQR2_NEGTAU 3
+#define GEQR2_WORK 4
+
+// v(0) := 1 in place of the diagonal entry, and -tau for ger
+template <typename T>
+__global__ void geqr2_set_unit(T *Ajj, const T *tau, T *inpsResGPU) {
+  if (hipBlockIdx_x == 0 && hipThreadIdx_x == 0) {
+    inpsResGPU[GEQR2_DIAG] = *Ajj;
+    inpsResGPU[GEQR2_NEGTAU] = -(*tau);
+    *Ajj = 1;
+  }
+}
+
+template <typename T>
+__global__ void geqr2_restore_diag(T *Ajj, const T *inpsResGPU) {
+  if (hipBlockIdx_x == 0 && hipThreadIdx_x == 0)
+    *Ajj = inpsResGPU[GEQR2_DIAG];
+}
+
+/*
+ * Unblocked Householder QR of the m x n matrix A. It only enqueues work on
+ * the handle's stream: inpsResGPU holds the constants and scratch as laid
+ * out by the GEQR2_* indices above. Each reflector is generated by larfg and
+ * applied to the columns on its right with gemv and ger.
+ */
+template <typename T>
+void rocsolver_geqr2_async_template(rocblas_handle handle, rocblas_int m,
+                                    rocblas_int n, T *A, rocblas_int lda,
+                                    T *tau, T *inpsResGPU) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  T *w = &inpsResGPU[GEQR2_WORK];
+
+  for (rocblas_int j = 0; j < min(m, n); ++j) {
+    // generate the reflector H(j) that annihilates A(j+1:m,j)
+    roclapack_larfg_template<T>(handle, m - j, &A[idx2D(j, j, lda)],
+                                &A[idx2D(min(j + 1, m - 1), j, lda)], 1,
+                                &tau[j]);
+
+    if (j < n - 1) {
+      // apply H(j) to A(j:m,j+1:n) from the left
+      hipLaunchKernelGGL(geqr2_set_unit<T>, dim3(1), dim3(1), 0, stream,
+                         &A[idx2D(j, j, lda)], &tau[j], inpsResGPU);
+
+      rocblas_gemv<T>(handle, rocblas_operation_transpose, m - j, n - j - 1,
+                      &inpsResGPU[GEQR2_INPONE], &A[idx2D(j, j + 1, lda)],
+                      lda, &A[idx2D(j, j, lda)], 1,
+                      &inpsResGPU[GEQR2_INPZERO], w, 1);
+      rocblas_ger<T>(handle, m - j, n - j - 1, &inpsResGPU[GEQR2_NEGTAU],
+                     &A[idx2D(j, j, lda)], 1, w, 1, &A[idx2D(j, j + 1, lda)],
+                     lda);
+
+      hipLaunchKernelGGL(geqr2_restore_diag<T>, dim3(1), dim3(1), 0, stream,
+                         &A[idx2D(j, j, lda)], inpsResGPU);
+    }
+  }
+}
+
+template <typename T>
+rocblas_status rocsolver_geqr2_template(rocblas_handle handle, rocblas_int m,
+                                        rocblas_int n, T *A, rocblas_int lda,
+                                        T *tau) {
+
+  if (m < 0 || n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, m)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (m == 0 || n == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  T inpsResHost[2];
+  inpsResHost[GEQR2_INPONE] = static_cast<T>(1);
+  inpsResHost[GEQR2_INPZERO] = static_cast<T>(0);
+
+  // allocate a tiny bit of memory on device to avoid going onto CPU and needing
+  // to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, sizeof(T) * (GEQR2_WORK + n));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 2 * sizeof(T), hipMemcpyHostToDevice);
+
+  rocsolver_geqr2_async_template<T>(handle, m, n, A, lda, tau, inpsResGPU);
+
+  hipFree(inpsResGPU);
+
+  return rocblas_status_success;
+}
+
+#undef GEQR2_INPONE
+#undef GEQR2_INPZERO
+#undef GEQR2_DIAG
+#undef GEQR2_NEGTAU
+#undef GEQR2_WORK
+
+#endif /* ROCLAPACK_GEQR2_HPP */
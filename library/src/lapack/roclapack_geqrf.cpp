@@ -0,0 +1,27 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_geqrf.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgeqrf(rocblas_handle handle, rocblas_int m, rocblas_int n, float *A,
+                 rocblas_int lda, float *tau) {
+  return rocsolver_geqrf_template<float>(handle, m, n, A, lda, tau);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgeqrf(rocblas_handle handle, rocblas_int m, rocblas_int n, double *A,
+                 rocblas_int lda, double *tau) {
+  return rocsolver_geqrf_template<double>(handle, m, n, A, lda, tau);
+}
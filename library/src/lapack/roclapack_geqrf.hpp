@@ -0,0 +1,157 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GEQRF_HPP
+#define ROCLAPACK_GEQRF_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_geqr2.hpp"
+#include "roclapack_larfb.hpp"
+#include "roclapack_larft.hpp"
+#include "roclapack_tsqr.hpp"
+
+using namespace std;
+
+// geqr2 gets the buffer from GEQRF_INPONE on, which matches its own layout:
+// its two scalars and its work vector of n elements come right after the
+// constants, and the workspace of the block reflectors after those
+#define GEQRF_INPMINONE 0
+#define GEQRF_INPONE 1
+#define GEQRF_INPZERO 2
+#define GEQRF_WORK 5
+
+// whether an m x n matrix is tall and skinny enough for TSQR
+inline bool geqrf_use_tsqr(rocblas_int m, rocblas_int n) {
+  return n <= GEQRF_TSQR_MAXCOLS && m / GEQRF_TSQR_RATIO >= n &&
+         m >= 2 * tsqr_leaf_rows(n);
+}
+
+// elements of the buffer for an m x n matrix
+inline size_t geqrf_buffer_size(rocblas_int m, rocblas_int n) {
+  if (geqrf_use_tsqr(m, n))
+    return GEQRF_WORK + tsqr_work_size(m, n);
+  const size_t nb = GEQRF_BLOCKSIZE;
+  return GEQRF_WORK + n + nb * m + 2 * nb * nb + 2 * nb * n;
+}
+
+/*
+ * Blocked Householder QR, as in the reference LAPACK: every panel of
+ * GEQRF_BLOCKSIZE columns is factored by geqr2, and its reflectors are
+ * applied to the trailing matrix at once in compact WY form (larft, larfb),
+ * which is three gemm calls.
+ */
+template <typename T>
+void rocsolver_geqrf_blocked(rocblas_handle handle, rocblas_int m,
+                             rocblas_int n, T *A, rocblas_int lda, T *tau,
+                             T *inpsResGPU) {
+
+  const rocblas_int nb = GEQRF_BLOCKSIZE;
+  const T *one = &inpsResGPU[GEQRF_INPONE];
+  const T *zero = &inpsResGPU[GEQRF_INPZERO];
+  const T *minone = &inpsResGPU[GEQRF_INPMINONE];
+
+  T *V = &inpsResGPU[GEQRF_WORK + n];
+  T *Tm = V + nb * m;
+  T *G = Tm + nb * nb;
+  T *W = G + nb * nb;
+  T *W2 = W + nb * n;
+
+  for (rocblas_int j = 0; j < min(m, n); j += nb) {
+    const rocblas_int jb = min(min(m, n) - j, nb);
+
+    // factor the panel
+    rocsolver_geqr2_async_template<T>(handle, m - j, jb, &A[idx2D(j, j, lda)],
+                                      lda, &tau[j], &inpsResGPU[GEQRF_INPONE]);
+
+    if (j + jb < n) {
+      // apply H(j+jb-1)**T ... H(j)**T to the trailing matrix
+      roclapack_larft_template<T>(handle, m - j, jb, &A[idx2D(j, j, lda)],
+                                  lda, &tau[j], V, Tm, G, one, zero);
+      roclapack_larfb_template<T>(handle, rocblas_side_left,
+                                  rocblas_operation_transpose, m - j,
+                                  n - j - jb, jb, V, m - j, Tm, jb,
+                                  &A[idx2D(j, j + jb, lda)], lda, W, W2, one,
+                                  zero, minone);
+    }
+  }
+}
+
+/*
+ * Enqueue the QR factorization of A without any host synchronization; TSQR
+ * or the unblocked or blocked variant is picked by shape and size.
+ * inpsResGPU holds geqrf_buffer_size(m, n) elements, the constants as laid
+ * out by the GEQRF_* indices above.
+ */
+template <typename T>
+void rocsolver_geqrf_async_template(rocblas_handle handle, rocblas_int m,
+                                    rocblas_int n, T *A, rocblas_int lda,
+                                    T *tau, T *inpsResGPU) {
+
+  if (geqrf_use_tsqr(m, n))
+    rocsolver_tsqr_template<T>(handle, m, n, A, lda, tau,
+                               &inpsResGPU[GEQRF_INPONE],
+                               &inpsResGPU[GEQRF_WORK]);
+  else if (min(m, n) < GEQRF_GEQR2_SWITCHSIZE)
+    rocsolver_geqr2_async_template<T>(handle, m, n, A, lda, tau,
+                                      &inpsResGPU[GEQRF_INPONE]);
+  else
+    rocsolver_geqrf_blocked<T>(handle, m, n, A, lda, tau, inpsResGPU);
+}
+
+// the constants of a geqrf buffer
+template <typename T> void geqrf_init_buffer(T *inpsResGPU) {
+  T inpsResHost[3];
+  inpsResHost[GEQRF_INPMINONE] = static_cast<T>(-1);
+  inpsResHost[GEQRF_INPONE] = static_cast<T>(1);
+  inpsResHost[GEQRF_INPZERO] = static_cast<T>(0);
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T),
+            hipMemcpyHostToDevice);
+}
+
+template <typename T>
+rocblas_status rocsolver_geqrf_template(rocblas_handle handle, rocblas_int m,
+                                        rocblas_int n, T *A, rocblas_int lda,
+                                        T *tau) {
+
+  if (m < 0 || n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, m)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (m == 0 || n == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  // allocate the constants and workspace on device to avoid going onto CPU
+  // and needing to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, sizeof(T) * geqrf_buffer_size(m, n));
+  geqrf_init_buffer<T>(inpsResGPU);
+
+  rocsolver_geqrf_async_template<T>(handle, m, n, A, lda, tau, inpsResGPU);
+
+  hipFree(inpsResGPU);
+
+  return rocblas_status_success;
+}
+
+#undef GEQRF_INPMINONE
+#undef GEQRF_INPONE
+#undef GEQRF_INPZERO
+#undef GEQRF_WORK
+
+#endif /* ROCLAPACK_GEQRF_HPP */
@@ -0,0 +1,36 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gerfs.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_sgerfs(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int n,
+    rocsolver_int nrhs, const float *A, rocsolver_int lda, const float *AF,
+    rocsolver_int ldaf, const rocsolver_int *ipiv, const float *B,
+    rocsolver_int ldb, float *X, rocsolver_int ldx, float *ferr, float *berr) {
+  return rocsolver_gerfs_template<float>(handle, trans, n, nrhs, A, lda, AF,
+                                         ldaf, ipiv, B, ldb, X, ldx, ferr,
+                                         berr);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_dgerfs(
+    rocsolver_handle handle, rocsolver_operation trans, rocsolver_int n,
+    rocsolver_int nrhs, const double *A, rocsolver_int lda, const double *AF,
+    rocsolver_int ldaf, const rocsolver_int *ipiv, const double *B,
+    rocsolver_int ldb, double *X, rocsolver_int ldx, double *ferr,
+    double *berr) {
+  return rocsolver_gerfs_template<double>(handle, trans, n, nrhs, A, lda, AF,
+                                          ldaf, ipiv, B, ldb, X, ldx, ferr,
+                                          berr);
+}
@@ -0,0 +1,365 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GERFS_HPP
+#define ROCLAPACK_GERFS_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include <limits>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_getrs.hpp"
+#include "roclapack_lacn2.hpp"
+#include "roclapack_lange.hpp"
+
+using namespace std;
+
+// at most this many corrections per right hand side, as in the reference
+// LAPACK
+#define GERFS_ITMAX 5
+
+// the constants as getrs expects them, then the n x nrhs matrices of the
+// latest residuals, the residuals kept for the error bounds, the
+// denominators |B| + |op(A)|*|X| and the 4 vectors of the estimator
+#define GERFS_INPONE 0
+#define GERFS_INPMINONE 1
+#define GERFS_INPZERO 2
+#define GERFS_WORK 3
+#define GERFS_NWORK 7
+
+// progress of the refinement of one right hand side
+template <typename T> struct gerfs_state {
+  T lstres;
+  rocblas_int count;
+  rocblas_int iterating;
+};
+
+template <typename T>
+__global__ void gerfs_init(rocblas_int nrhs, gerfs_state<T> *state) {
+  const rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  if (j < nrhs) {
+    state[j].lstres = 3;
+    state[j].count = 1;
+    state[j].iterating = 1;
+  }
+}
+
+// Out := In for n x nrhs matrices, one thread per element
+template <typename T>
+__global__ void gerfs_copy(rocblas_int n, const T *In, rocblas_int ldi, T *Out,
+                           rocblas_int ldo) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < n)
+    Out[i + j * ldo] = In[i + j * ldi];
+}
+
+/*
+ * W(i,j) = |B(i,j)| + (|A|*|X|)(i,j) for the right hand sides still being
+ * refined, one thread per row; neighbouring threads read neighbouring
+ * elements of each column of A.
+ */
+template <typename T>
+__global__ void gerfs_denominators_none(rocblas_int n, const T *A,
+                                        rocblas_int lda, const T *B,
+                                        rocblas_int ldb, const T *X,
+                                        rocblas_int ldx, T *W,
+                                        const gerfs_state<T> *state) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < n && state[j].iterating) {
+    T v = fabs(B[i + j * ldb]);
+    for (rocblas_int k = 0; k < n; ++k)
+      v += fabs(A[i + k * lda]) * fabs(X[k + j * ldx]);
+    W[i + j * n] = v;
+  }
+}
+
+/*
+ * W(i,j) = |B(i,j)| + (|A**T|*|X|)(i,j) for the right hand sides still being
+ * refined, one workgroup per element, reducing over column i of A.
+ */
+template <typename T>
+__global__ void gerfs_denominators_trans(rocblas_int n, const T *A,
+                                         rocblas_int lda, const T *B,
+                                         rocblas_int ldb, const T *X,
+                                         rocblas_int ldx, T *W,
+                                         const gerfs_state<T> *state) {
+  const int tid = hipThreadIdx_x;
+  const rocblas_int i = hipBlockIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+
+  __shared__ T sred[LANGE_BLOCKSIZE];
+
+  if (!state[j].iterating)
+    return;
+
+  T v = 0;
+  for (rocblas_int k = tid; k < n; k += LANGE_BLOCKSIZE)
+    v += fabs(A[k + i * lda]) * fabs(X[k + j * ldx]);
+  v = lange_reduce<T, false>(v, sred);
+
+  if (tid == 0)
+    W[i + j * n] = fabs(B[i + j * ldb]) + v;
+}
+
+/*
+ * Componentwise backward error max(|R(i,j)| / W(i,j)) of every right hand
+ * side still being refined, one workgroup per right hand side, with the
+ * safeguards of the reference LAPACK against tiny denominators. The residual
+ * is kept in Rkeep for the error bound; a right hand side stops being refined
+ * when the error stops halving, reaches eps or after GERFS_ITMAX corrections.
+ */
+template <typename T>
+__global__ void gerfs_berr(rocblas_int n, const T *R, const T *W, T *Rkeep,
+                           T eps, T safe1, T safe2, T *berr,
+                           gerfs_state<T> *state) {
+  const int tid = hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_x;
+  R += j * n;
+  W += j * n;
+  Rkeep += j * n;
+
+  __shared__ T sred[LANGE_BLOCKSIZE];
+
+  if (!state[j].iterating)
+    return;
+
+  T s = 0;
+  for (rocblas_int i = tid; i < n; i += LANGE_BLOCKSIZE) {
+    const T r = fabs(R[i]);
+    s = lange_max(s, (W[i] > safe2) ? r / W[i] : (r + safe1) / (W[i] + safe1));
+    Rkeep[i] = R[i];
+  }
+  s = lange_reduce<T, true>(s, sred);
+
+  if (tid == 0) {
+    berr[j] = s;
+    gerfs_state<T> st = state[j];
+    if (s > eps && 2 * s <= st.lstres && st.count <= GERFS_ITMAX) {
+      st.lstres = s;
+      st.count++;
+    } else {
+      st.iterating = 0;
+    }
+    state[j] = st;
+  }
+}
+
+// X := X + D for the right hand sides still being refined
+template <typename T>
+__global__ void gerfs_update(rocblas_int n, const T *D, T *X, rocblas_int ldx,
+                             const gerfs_state<T> *state) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < n && state[j].iterating)
+    X[i + j * ldx] += D[i + j * n];
+}
+
+/*
+ * Weights |R| + nz*eps*W of the forward error bound, as in the reference
+ * LAPACK (nz = n + 1), overwriting W.
+ */
+template <typename T>
+__global__ void gerfs_weights(rocblas_int n, const T *R, T *W, T eps, T safe1,
+                              T safe2) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < n) {
+    const rocblas_int k = i + j * n;
+    const T w = fabs(R[k]) + (n + 1) * eps * W[k];
+    W[k] = (W[k] > safe2) ? w : w + safe1;
+  }
+}
+
+// x := W .* x elementwise for n x nrhs matrices
+template <typename T>
+__global__ void gerfs_scale(rocblas_int n, const T *W, T *x) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < n)
+    x[i + j * n] *= W[i + j * n];
+}
+
+/*
+ * Forward error bound of every right hand side: the estimated norm of
+ * inv(op(A))*diag(W) relative to the largest element of the solution, one
+ * workgroup per right hand side.
+ */
+template <typename T>
+__global__ void gerfs_ferr(rocblas_int n, const T *X, rocblas_int ldx,
+                           const lacn2_state<T> *est, T *ferr) {
+  const int tid = hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_x;
+  X += j * ldx;
+
+  __shared__ T sred[LANGE_BLOCKSIZE];
+
+  T v = 0;
+  for (rocblas_int i = tid; i < n; i += LANGE_BLOCKSIZE)
+    v = lange_max(v, fabs(X[i]));
+  v = lange_reduce<T, true>(v, sred);
+
+  if (tid == 0)
+    ferr[j] = (v != 0) ? est[j].est / v : est[j].est;
+}
+
+template <typename T>
+__global__ void gerfs_zero(rocblas_int nrhs, T *ferr, T *berr) {
+  const rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  if (j < nrhs)
+    ferr[j] = berr[j] = 0;
+}
+
+/*
+ * Iterative refinement of the solutions X of op(A)*X = B from the LU
+ * factors AF and ipiv of getrf, with componentwise backward errors berr and
+ * forward error bounds ferr, as in the reference LAPACK. All right hand
+ * sides are refined together: the residuals take one gemm (gemv for a
+ * single right hand side) and the corrections one getrs, and every right
+ * hand side that has converged is left alone by device-side flags. The
+ * forward error bounds take batched estimates by lacn2. Nothing is copied
+ * back to the host; ferr and berr are in device memory.
+ */
+template <typename T>
+rocblas_status rocsolver_gerfs_template(
+    rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+    rocblas_int nrhs, const T *A, rocblas_int lda, const T *AF,
+    rocblas_int ldaf, const rocblas_int *ipiv, const T *B, rocblas_int ldb,
+    T *X, rocblas_int ldx, T *ferr, T *berr) {
+
+  if (n < 0 || nrhs < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, n) || ldaf < max(1, n) || ldb < max(1, n) ||
+             ldx < max(1, n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  if (nrhs == 0) {
+    return rocblas_status_success;
+  } else if (n == 0) {
+    hipLaunchKernelGGL(gerfs_zero<T>, dim3((nrhs - 1) / GERFS_BLOCKSIZE + 1),
+                       dim3(GERFS_BLOCKSIZE), 0, stream, nrhs, ferr, berr);
+    return rocblas_status_success;
+  }
+
+  // LAPACK's eps (half the machine epsilon) and safe minimum
+  const T eps = numeric_limits<T>::epsilon() / 2;
+  const T safe1 = numeric_limits<T>::min();
+  const T safe2 = (n + 1) * safe1;
+
+  const rocblas_int nn = n * nrhs;
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, sizeof(T) * (GERFS_WORK + GERFS_NWORK * nn));
+  T inpsResHost[GERFS_WORK];
+  inpsResHost[GERFS_INPONE] = static_cast<T>(1);
+  inpsResHost[GERFS_INPMINONE] = static_cast<T>(-1);
+  inpsResHost[GERFS_INPZERO] = static_cast<T>(0);
+  hipMemcpy(inpsResGPU, inpsResHost, sizeof(T) * GERFS_WORK,
+            hipMemcpyHostToDevice);
+
+  gerfs_state<T> *state;
+  hipMalloc(&state, sizeof(gerfs_state<T>) * nrhs);
+  lacn2_state<T> *est;
+  hipMalloc(&est, sizeof(lacn2_state<T>) * nrhs);
+
+  const T *one = &inpsResGPU[GERFS_INPONE];
+  const T *minone = &inpsResGPU[GERFS_INPMINONE];
+  T *R = &inpsResGPU[GERFS_WORK];
+  T *Rkeep = R + nn;
+  T *W = Rkeep + nn;
+  T *work = W + nn;
+
+  const rocblas_operation transt = (trans == rocblas_operation_none)
+                                       ? rocblas_operation_transpose
+                                       : rocblas_operation_none;
+  const dim3 grid((n - 1) / GERFS_BLOCKSIZE + 1, nrhs, 1);
+  const dim3 threads(GERFS_BLOCKSIZE, 1, 1);
+  const dim3 rthreads(LANGE_BLOCKSIZE, 1, 1);
+
+  hipLaunchKernelGGL(gerfs_init<T>, dim3((nrhs - 1) / GERFS_BLOCKSIZE + 1),
+                     threads, 0, stream, nrhs, state);
+
+  for (rocblas_int it = 0; it <= GERFS_ITMAX; ++it) {
+    // R := B - op(A)*X
+    hipLaunchKernelGGL(gerfs_copy<T>, grid, threads, 0, stream, n, B, ldb, R,
+                       n);
+    if (nrhs == 1)
+      rocblas_gemv<T>(handle, trans, n, n, minone, A, lda, X, 1, one, R, 1);
+    else
+      rocblas_gemm<T>(handle, trans, rocblas_operation_none, n, nrhs, n,
+                      minone, A, lda, X, ldx, one, R, n);
+
+    if (trans == rocblas_operation_none)
+      hipLaunchKernelGGL(gerfs_denominators_none<T>, grid, threads, 0, stream,
+                         n, A, lda, B, ldb, X, ldx, W, state);
+    else
+      hipLaunchKernelGGL(gerfs_denominators_trans<T>, dim3(n, nrhs), rthreads,
+                         0, stream, n, A, lda, B, ldb, X, ldx, W, state);
+
+    hipLaunchKernelGGL(gerfs_berr<T>, dim3(nrhs), rthreads, 0, stream, n, R, W,
+                       Rkeep, eps, safe1, safe2, berr, state);
+
+    // the last residual only gives the errors
+    if (it < GERFS_ITMAX) {
+      rocsolver_getrs_async_template<T>(handle, trans, n, nrhs, AF, ldaf, ipiv,
+                                        R, n, inpsResGPU);
+      hipLaunchKernelGGL(gerfs_update<T>, grid, threads, 0, stream, n, R, X,
+                         ldx, state);
+    }
+  }
+
+  // the forward error bounds from the norms of inv(op(A))*diag(W)
+  hipLaunchKernelGGL(gerfs_weights<T>, grid, threads, 0, stream, n, Rkeep, W,
+                     eps, safe1, safe2);
+
+  auto solve = [&](rocblas_int kase, T *x) {
+    if (kase == 1) {
+      // x := diag(W)*inv(op(A)**T)*x
+      rocsolver_getrs_async_template<T>(handle, transt, n, nrhs, AF, ldaf,
+                                        ipiv, x, n, inpsResGPU);
+      hipLaunchKernelGGL(gerfs_scale<T>, grid, threads, 0, stream, n, W, x);
+    } else {
+      // x := inv(op(A))*diag(W)*x
+      hipLaunchKernelGGL(gerfs_scale<T>, grid, threads, 0, stream, n, W, x);
+      rocsolver_getrs_async_template<T>(handle, trans, n, nrhs, AF, ldaf, ipiv,
+                                        x, n, inpsResGPU);
+    }
+  };
+
+  roclapack_lacn2_template<T>(handle, n, nrhs, solve, work, est);
+
+  hipLaunchKernelGGL(gerfs_ferr<T>, dim3(nrhs), rthreads, 0, stream, n, X, ldx,
+                     est, ferr);
+
+  hipFree(est);
+  hipFree(state);
+  hipFree(inpsResGPU);
+
+  return rocblas_status_success;
+}
+
+#undef GERFS_ITMAX
+#undef GERFS_INPONE
+#undef GERFS_INPMINONE
+#undef GERFS_INPZERO
+#undef GERFS_WORK
+#undef GERFS_NWORK
+
+#endif /* ROCLAPACK_GERFS_HPP */
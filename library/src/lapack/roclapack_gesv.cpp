@@ -0,0 +1,30 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesv.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgesv(rocsolver_handle handle, rocsolver_int n, rocsolver_int nrhs,
+                float *A, rocsolver_int lda, rocsolver_int *ipiv, float *B,
+                rocsolver_int ldb) {
+  return rocsolver_gesv_template<float>(handle, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgesv(rocsolver_handle handle, rocsolver_int n, rocsolver_int nrhs,
+                double *A, rocsolver_int lda, rocsolver_int *ipiv, double *B,
+                rocsolver_int ldb) {
+  return rocsolver_gesv_template<double>(handle, n, nrhs, A, lda, ipiv, B,
+                                         ldb);
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GESV_HPP
+#define ROCLAPACK_GESV_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "ideal_sizes.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+
+// one buffer for the whole solve: it has the layout getrf expects, and getrs
+// finds its constant one at the start of it
+#define GESV_INPONE 0
+#define GESV_INPMINONE 1
+#define GESV_RESSING 2
+
+/*
+ * Solve A * X = B through the LU factorization of A. Factorization and solve
+ * are enqueued back to back on the handle's stream and share one buffer of
+ * constants and results; the host only synchronizes once, at the end, to
+ * read back whether a zero pivot was met.
+ */
+template <typename T>
+rocblas_status rocsolver_gesv_template(rocblas_handle handle, rocblas_int n,
+                                       rocblas_int nrhs, T *A, rocblas_int lda,
+                                       rocblas_int *ipiv, T *B,
+                                       rocblas_int ldb) {
+
+  if (n < 0 || nrhs < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, n) || ldb < max(1, n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (n == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  T inpsResHost[3];
+  inpsResHost[GESV_INPONE] = static_cast<T>(1);
+  inpsResHost[GESV_INPMINONE] = static_cast<T>(-1);
+  inpsResHost[GESV_RESSING] = static_cast<T>(42);
+
+  // allocate a tiny bit of memory on device to avoid going onto CPU and needing
+  // to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, 3 * sizeof(T));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T), hipMemcpyHostToDevice);
+
+  rocblas_status status = rocsolver_getrf_async_template<T>(
+      handle, n, n, A, lda, ipiv, inpsResGPU);
+
+  if (status == rocblas_status_success && nrhs > 0) {
+    rocsolver_getrs_async_template<T>(handle, rocblas_operation_none, n, nrhs,
+                                      A, lda, ipiv, B, ldb,
+                                      &inpsResGPU[GESV_INPONE]);
+  }
+
+  // let's see if we encountered any singularity
+  hipMemcpy(&inpsResHost[GESV_RESSING], &inpsResGPU[GESV_RESSING], sizeof(T),
+            hipMemcpyDeviceToHost);
+  hipFree(inpsResGPU);
+
+  if (status != rocblas_status_success) {
+    return status;
+  }
+  if (inpsResHost[GESV_RESSING] <= 0.0) {
+    const size_t elem = static_cast<size_t>(fabs(inpsResHost[GESV_RESSING]));
+    cerr << "ERROR: Input matrix has singularity/-ies. Last "
+            "occurrence of this in element "
+         << elem << endl;
+    return rocblas_status_internal_error;
+  }
+
+  return rocblas_status_success;
+}
+
+#undef GESV_INPONE
+#undef GESV_INPMINONE
+#undef GESV_RESSING
+
+#endif /* ROCLAPACK_GESV_HPP */
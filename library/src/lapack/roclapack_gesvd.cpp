@@ -0,0 +1,30 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesvd.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgesvd(rocblas_handle handle, rocsolver_svect left_svect,
+                 rocsolver_svect right_svect, rocblas_int m, rocblas_int n,
+                 float *A, rocblas_int lda, float *S, float *U, rocblas_int ldu,
+                 float *V, rocblas_int ldv, rocblas_int *info) {
+  return rocsolver_gesvd_template<float>(handle, left_svect, right_svect, m,
+                                         n, A, lda, S, U, ldu, V, ldv, info);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgesvd(rocblas_handle handle, rocsolver_svect left_svect,
+                 rocsolver_svect right_svect, rocblas_int m, rocblas_int n,
+                 double *A, rocblas_int lda, double *S, double *U,
+                 rocblas_int ldu, double *V, rocblas_int ldv,
+                 rocblas_int *info) {
+  return rocsolver_gesvd_template<double>(handle, left_svect, right_svect, m,
+                                          n, A, lda, S, U, ldu, V, ldv, info);
+}
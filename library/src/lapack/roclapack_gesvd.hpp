@@ -0,0 +1,387 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GESVD_HPP
+#define ROCLAPACK_GESVD_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_bdsqr.hpp"
+#include "roclapack_gebrd.hpp"
+#include "roclapack_geqrf.hpp"
+#include "roclapack_ormqr.hpp"
+
+using namespace std;
+
+/*
+ * All cases are reduced to an M x N matrix with M >= N: A itself if m >= n,
+ * and A**T otherwise, whose left singular vectors are the right ones of A
+ * and the other way round. When M >= GESVD_QR_RATIO * N the matrix is first
+ * factored by geqrf and only the N x N triangle R is bidiagonalized; U is
+ * then Q times the left vectors of R.
+ */
+
+// the constants, then the workspace
+#define GESVD_INPONE 0
+#define GESVD_INPZERO 1
+#define GESVD_INPMINONE 2
+#define GESVD_WORK 3
+
+// A := I outside its leading k x k block, for the m x n matrix A
+template <typename T>
+__global__ void gesvd_identity(rocblas_int m, rocblas_int n, rocblas_int k,
+                               T *A, rocblas_int lda) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < m && (i >= k || j >= k))
+    A[idx2D(i, j, lda)] = (i == j) ? 1 : 0;
+}
+
+// R := the upper triangle of the leading n x n block of A, zeros below
+template <typename T>
+__global__ void gesvd_copy_r(rocblas_int n, const T *A, rocblas_int lda, T *R,
+                             rocblas_int ldr) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < n)
+    R[idx2D(i, j, ldr)] = (i <= j) ? A[idx2D(i, j, lda)] : 0;
+}
+
+// the vectors of the reflectors G(i) of gebrd, from the rows of the n x n
+// matrix A, into the columns of the (n-1) x (n-1) matrix P as geqrf leaves
+// them, so that ormqr applies them
+template <typename T>
+__global__ void gesvd_copy_p(rocblas_int n, const T *A, rocblas_int lda, T *P,
+                             rocblas_int ldp) {
+  const rocblas_int r = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int i = hipBlockIdx_y;
+  if (r > i && r < n - 1)
+    P[idx2D(r, i, ldp)] = A[idx2D(i, r + 1, lda)];
+}
+
+// B := A**T for the m x n matrix A
+template <typename T>
+__global__ void gesvd_transpose(rocblas_int m, rocblas_int n, const T *A,
+                                rocblas_int lda, T *B, rocblas_int ldb) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < m)
+    B[idx2D(j, i, ldb)] = A[idx2D(i, j, lda)];
+}
+
+// A := A**T in place for the n x n matrix A
+template <typename T>
+__global__ void gesvd_transpose_square(rocblas_int n, T *A, rocblas_int lda) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < j) {
+    const T t = A[idx2D(i, j, lda)];
+    A[idx2D(i, j, lda)] = A[idx2D(j, i, lda)];
+    A[idx2D(j, i, lda)] = t;
+  }
+}
+
+inline bool gesvd_qr_first(rocblas_int m, rocblas_int n) {
+  return m >= GESVD_QR_RATIO * n;
+}
+
+// elements of the workspace of the bidiagonalization path for m >= n: E,
+// tauq and taup, then what gebrd, bdsqr and the two ormqr need one after
+// the other; ucols is the number of columns of U
+inline size_t gesvd_core_work_size(bool left, rocblas_int ucols, bool right,
+                                   rocblas_int m, rocblas_int n) {
+  size_t size = max(gebrd_work_size(m, n), bdsqr_work_size(n));
+  if (left)
+    size = max(size, ormqr_work_size(rocblas_side_left, m, ucols));
+  if (right)
+    size = max(size, size_t(n - 1) * (n - 1) +
+                         ormqr_work_size(rocblas_side_right, n, n - 1));
+  return 3 * size_t(n) + size;
+}
+
+// the same for m >= n on either path; tau and R come first on the QR path
+// (whose geqrf buffer is apart, see gesvd_geqrf_buffer)
+inline size_t gesvd_tall_work_size(bool left, rocblas_int ucols, bool right,
+                                   rocblas_int m, rocblas_int n) {
+  if (!gesvd_qr_first(m, n))
+    return gesvd_core_work_size(left, ucols, right, m, n);
+  size_t size = gesvd_core_work_size(left, n, right, n, n);
+  if (left)
+    size = max(size, ormqr_work_size(rocblas_side_left, m, ucols));
+  return size_t(n) + size_t(n) * n + size;
+}
+
+// elements of the workspace after the constants; A**T and its left vectors
+// come first when m < n, and the geqrf buffer of the QR path comes last
+inline size_t gesvd_work_size(rocsolver_svect left_svect,
+                              rocsolver_svect right_svect, rocblas_int m,
+                              rocblas_int n) {
+  const bool left = (left_svect != rocsolver_svect_none);
+  const bool right = (right_svect != rocsolver_svect_none);
+  const rocblas_int M = max(m, n);
+  const rocblas_int N = min(m, n);
+  const size_t geqrf = gesvd_qr_first(M, N) ? geqrf_buffer_size(M, N) : 0;
+  if (m >= n)
+    return gesvd_tall_work_size(
+               left, (left_svect == rocsolver_svect_all) ? m : n, right, m,
+               n) +
+           geqrf;
+  const rocblas_int lcols = (right_svect == rocsolver_svect_all) ? n : m;
+  return size_t(n) * m + (right ? size_t(n) * lcols : 0) +
+         gesvd_tall_work_size(right, lcols, left, n, m) + geqrf;
+}
+
+// the geqrf buffer at the end of the workspace, or null when A is not
+// factored by geqrf first; its constants are put in place by
+// geqrf_init_buffer before the async template runs
+template <typename T>
+T *gesvd_geqrf_buffer(T *inpsResGPU, rocsolver_svect left_svect,
+                      rocsolver_svect right_svect, rocblas_int m,
+                      rocblas_int n) {
+  const rocblas_int M = max(m, n);
+  const rocblas_int N = min(m, n);
+  if (!gesvd_qr_first(M, N))
+    return nullptr;
+  return &inpsResGPU[GESVD_WORK] + gesvd_work_size(left_svect, right_svect,
+                                                   m, n) -
+         geqrf_buffer_size(M, N);
+}
+
+/*
+ * The SVD of the m x n matrix A (m >= n) through its bidiagonal form: U (m
+ * x ucols) if left, and V**T (n x n) if right. B = Q**T * A * P from gebrd
+ * is diagonalized by bdsqr starting from U = I and V**T = I, after which
+ * U := Q * U and V**T := V**T * P**T by ormqr.
+ */
+template <typename T>
+void gesvd_core(rocblas_handle handle, bool left, rocblas_int ucols,
+                bool right, rocblas_int m, rocblas_int n, T *A,
+                rocblas_int lda, T *S, T *U, rocblas_int ldu, T *V,
+                rocblas_int ldv, rocblas_int *info, const T *one,
+                const T *zero, const T *minone, T *work, rocblas_int *iwork) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  T *E = work;
+  T *tauq = E + n;
+  T *taup = tauq + n;
+  T *w = taup + n;
+  const rocblas_int bs = LARFG_BLOCKSIZE;
+
+  rocsolver_gebrd_async_template<T>(handle, m, n, A, lda, S, E, tauq, taup,
+                                    one, zero, minone, w);
+
+  if (left)
+    hipLaunchKernelGGL(gesvd_identity<T>, dim3((m - 1) / bs + 1, ucols),
+                       dim3(bs), 0, stream, m, ucols, 0, U, ldu);
+  if (right)
+    hipLaunchKernelGGL(gesvd_identity<T>, dim3((n - 1) / bs + 1, n),
+                       dim3(bs), 0, stream, n, n, 0, V, ldv);
+
+  rocsolver_bdsqr_async_template<T>(handle, n, S, E, U, ldu, left ? n : 0, V,
+                                    ldv, right ? n : 0, w, iwork, info);
+
+  if (left)
+    rocsolver_ormqr_async_template<T>(handle, rocblas_side_left,
+                                      rocblas_operation_none, m, ucols, n, A,
+                                      lda, tauq, U, ldu, one, zero, minone, w);
+
+  // P acts on columns 1:n
+  if (right && n > 1) {
+    hipLaunchKernelGGL(gesvd_copy_p<T>, dim3((n - 2) / bs + 1, n - 1),
+                       dim3(bs), 0, stream, n, A, lda, w, n - 1);
+    rocsolver_ormqr_async_template<T>(
+        handle, rocblas_side_right, rocblas_operation_transpose, n, n - 1,
+        n - 1, w, n - 1, taup, &V[idx2D(0, 1, ldv)], ldv, one, zero, minone,
+        w + size_t(n - 1) * (n - 1));
+  }
+}
+
+// m >= n, with the QR factorization first for tall enough A, through the
+// initialized geqrf buffer geqrfBuf
+template <typename T>
+void gesvd_tall(rocblas_handle handle, bool left, rocblas_int ucols,
+                bool right, rocblas_int m, rocblas_int n, T *A,
+                rocblas_int lda, T *S, T *U, rocblas_int ldu, T *V,
+                rocblas_int ldv, rocblas_int *info, const T *one,
+                const T *zero, const T *minone, T *work, T *geqrfBuf,
+                rocblas_int *iwork) {
+
+  if (!gesvd_qr_first(m, n)) {
+    gesvd_core<T>(handle, left, ucols, right, m, n, A, lda, S, U, ldu, V, ldv,
+                  info, one, zero, minone, work, iwork);
+    return;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  T *tau = work;
+  T *R = tau + n;
+  T *w = R + size_t(n) * n;
+  const rocblas_int bs = LARFG_BLOCKSIZE;
+
+  rocsolver_geqrf_async_template<T>(handle, m, n, A, lda, tau, geqrfBuf);
+  hipLaunchKernelGGL(gesvd_copy_r<T>, dim3((n - 1) / bs + 1, n), dim3(bs), 0,
+                     stream, n, A, lda, R, n);
+
+  // the left vectors of R land in U(0:n,0:n), the rest of U is I before Q
+  // is applied
+  gesvd_core<T>(handle, left, n, right, n, n, R, n, S, U, ldu, V, ldv, info,
+                one, zero, minone, w, iwork);
+
+  if (left) {
+    hipLaunchKernelGGL(gesvd_identity<T>, dim3((m - 1) / bs + 1, ucols),
+                       dim3(bs), 0, stream, m, ucols, n, U, ldu);
+    rocsolver_ormqr_async_template<T>(handle, rocblas_side_left,
+                                      rocblas_operation_none, m, ucols, n, A,
+                                      lda, tau, U, ldu, one, zero, minone, w);
+  }
+}
+
+/*
+ * Enqueue the singular values (into S, descending) and optionally the
+ * singular vectors of A = U * diag(S) * V**T; V gets V**T. A is destroyed.
+ * It only enqueues work on the handle's stream, with the constants and
+ * workspace laid out by the GESVD_* indices above, the constants of the
+ * geqrf buffer (see gesvd_geqrf_buffer) already in place, and iwork of
+ * bdsqr_iwork_size(min(m, n)) elements.
+ */
+template <typename T>
+void rocsolver_gesvd_async_template(rocblas_handle handle,
+                                    rocsolver_svect left_svect,
+                                    rocsolver_svect right_svect,
+                                    rocblas_int m, rocblas_int n, T *A,
+                                    rocblas_int lda, T *S, T *U,
+                                    rocblas_int ldu, T *V, rocblas_int ldv,
+                                    rocblas_int *info, T *inpsResGPU,
+                                    rocblas_int *iwork) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const T *one = &inpsResGPU[GESVD_INPONE];
+  const T *zero = &inpsResGPU[GESVD_INPZERO];
+  const T *minone = &inpsResGPU[GESVD_INPMINONE];
+  T *work = &inpsResGPU[GESVD_WORK];
+  T *geqrfBuf = gesvd_geqrf_buffer(inpsResGPU, left_svect, right_svect, m, n);
+  const bool left = (left_svect != rocsolver_svect_none);
+  const bool right = (right_svect != rocsolver_svect_none);
+  const rocblas_int bs = LARFG_BLOCKSIZE;
+
+  if (m >= n) {
+    gesvd_tall<T>(handle, left, (left_svect == rocsolver_svect_all) ? m : n,
+                  right, m, n, A, lda, S, U, ldu, V, ldv, info, one, zero,
+                  minone, work, geqrfBuf, iwork);
+    return;
+  }
+
+  // A**T = U' * diag(S) * V'**T with V'**T (m x m) into U, and U' (n x
+  // lcols) aside; then U = V' and V**T = U'**T
+  const rocblas_int lcols = (right_svect == rocsolver_svect_all) ? n : m;
+  T *At = work;
+  T *Ut = At + size_t(n) * m;
+  T *w = Ut + (right ? size_t(n) * lcols : 0);
+
+  hipLaunchKernelGGL(gesvd_transpose<T>, dim3((m - 1) / bs + 1, n), dim3(bs),
+                     0, stream, m, n, A, lda, At, n);
+
+  gesvd_tall<T>(handle, right, lcols, left, n, m, At, n, S, Ut, n, U, ldu,
+                info, one, zero, minone, w, geqrfBuf, iwork);
+
+  if (left)
+    hipLaunchKernelGGL(gesvd_transpose_square<T>, dim3((m - 1) / bs + 1, m),
+                       dim3(bs), 0, stream, m, U, ldu);
+  if (right)
+    hipLaunchKernelGGL(gesvd_transpose<T>, dim3((n - 1) / bs + 1, lcols),
+                       dim3(bs), 0, stream, n, lcols, Ut, n, V, ldv);
+}
+
+template <typename T>
+rocblas_status
+rocsolver_gesvd_template(rocblas_handle handle, rocsolver_svect left_svect,
+                         rocsolver_svect right_svect, rocblas_int m,
+                         rocblas_int n, T *A, rocblas_int lda, T *S, T *U,
+                         rocblas_int ldu, T *V, rocblas_int ldv,
+                         rocblas_int *info) {
+
+  if (left_svect != rocsolver_svect_all &&
+      left_svect != rocsolver_svect_singular &&
+      left_svect != rocsolver_svect_none) {
+    return rocblas_status_not_implemented;
+  } else if (right_svect != rocsolver_svect_all &&
+             right_svect != rocsolver_svect_singular &&
+             right_svect != rocsolver_svect_none) {
+    return rocblas_status_not_implemented;
+  } else if (m < 0 || n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, m)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (left_svect != rocsolver_svect_none && ldu < max(1, m)) {
+    return rocblas_status_invalid_size;
+  } else if ((right_svect == rocsolver_svect_all && ldv < max(1, n)) ||
+             (right_svect == rocsolver_svect_singular &&
+              ldv < max(1, min(m, n)))) {
+    return rocblas_status_invalid_size;
+  } else if (ldu < 1 || ldv < 1) {
+    return rocblas_status_invalid_size;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  hipMemsetAsync(info, 0, sizeof(rocblas_int), stream);
+  if (m == 0 || n == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  T inpsResHost[3];
+  inpsResHost[GESVD_INPONE] = static_cast<T>(1);
+  inpsResHost[GESVD_INPZERO] = static_cast<T>(0);
+  inpsResHost[GESVD_INPMINONE] = static_cast<T>(-1);
+
+  // allocate the constants and workspace on device to avoid going onto CPU
+  // and needing to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU,
+            sizeof(T) *
+                (GESVD_WORK + gesvd_work_size(left_svect, right_svect, m, n)));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T),
+            hipMemcpyHostToDevice);
+  T *geqrfBuf = gesvd_geqrf_buffer(inpsResGPU, left_svect, right_svect, m, n);
+  if (geqrfBuf)
+    geqrf_init_buffer<T>(geqrfBuf);
+  rocblas_int *iwork;
+  hipMalloc(&iwork, sizeof(rocblas_int) * bdsqr_iwork_size(min(m, n)));
+
+  rocsolver_gesvd_async_template<T>(handle, left_svect, right_svect, m, n, A,
+                                    lda, S, U, ldu, V, ldv, info, inpsResGPU,
+                                    iwork);
+
+  hipFree(inpsResGPU);
+  hipFree(iwork);
+
+  return rocblas_status_success;
+}
+
+#undef GESVD_INPONE
+#undef GESVD_INPZERO
+#undef GESVD_INPMINONE
+#undef GESVD_WORK
+
+#endif /* ROCLAPACK_GESVD_HPP */
@@ -0,0 +1,59 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesvdj.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_sgesvdj_batched(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n,
+    float *const A[], rocblas_int lda, float tol, rocblas_int max_sweeps,
+    float *S, rocblas_int strideS, float *U, rocblas_int ldu,
+    rocblas_int strideU, float *V, rocblas_int ldv, rocblas_int strideV,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_gesvdj_template<float>(
+      handle, left_svect, right_svect, m, n, A, lda, 0, tol, max_sweeps, S,
+      strideS, U, ldu, strideU, V, ldv, strideV, info, batch_count);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_sgesvdj_strided_batched(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n, float *A,
+    rocblas_int lda, rocblas_int strideA, float tol, rocblas_int max_sweeps,
+    float *S, rocblas_int strideS, float *U, rocblas_int ldu,
+    rocblas_int strideU, float *V, rocblas_int ldv, rocblas_int strideV,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_gesvdj_template<float>(
+      handle, left_svect, right_svect, m, n, A, lda, strideA, tol, max_sweeps,
+      S, strideS, U, ldu, strideU, V, ldv, strideV, info, batch_count);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_dgesvdj_batched(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n,
+    double *const A[], rocblas_int lda, double tol, rocblas_int max_sweeps,
+    double *S, rocblas_int strideS, double *U, rocblas_int ldu,
+    rocblas_int strideU, double *V, rocblas_int ldv, rocblas_int strideV,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_gesvdj_template<double>(
+      handle, left_svect, right_svect, m, n, A, lda, 0, tol, max_sweeps, S,
+      strideS, U, ldu, strideU, V, ldv, strideV, info, batch_count);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_dgesvdj_strided_batched(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n, double *A,
+    rocblas_int lda, rocblas_int strideA, double tol, rocblas_int max_sweeps,
+    double *S, rocblas_int strideS, double *U, rocblas_int ldu,
+    rocblas_int strideU, double *V, rocblas_int ldv, rocblas_int strideV,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_gesvdj_template<double>(
+      handle, left_svect, right_svect, m, n, A, lda, strideA, tol, max_sweeps,
+      S, strideS, U, ldu, strideU, V, ldv, strideV, info, batch_count);
+}
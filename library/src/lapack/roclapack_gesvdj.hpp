@@ -0,0 +1,346 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GESVDJ_HPP
+#define ROCLAPACK_GESVDJ_HPP
+
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <rocblas.hpp>
+#include <vector>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_gesvd.hpp"
+#include "roclapack_syevj.hpp"
+
+using namespace std;
+
+/*
+ * One-sided (Hestenes) Jacobi on one matrix with m, n <= GESVDJ_MAX_SIZE
+ * per workgroup. The rows x cols matrix W (A if m >= n, A**T otherwise) is
+ * kept in LDS and its columns are made orthogonal by plane rotations from
+ * the right, W := W * J, in the round-robin ordering of syevj: the rotations
+ * of a round touch disjoint pairs of columns, so they are computed at once
+ * and applied at once. A pair is rotated while the cosine of the angle
+ * between its columns exceeds tol; the sweeps stop after one without any
+ * rotation (info 0), or after max_sweeps (info 1). The rotations are
+ * accumulated in X (cols x cols) and the normalized columns of W form Y
+ * (rows x ycols), so that W = Y * diag(S) * X**T: for m >= n, X is V and Y
+ * is U, and the other way round for m < n. X and Y are the output arrays,
+ * in global memory, seen through strides; columns of Y for singular values
+ * below rows * eps * ||A||_F, and those past cols, are completed to an
+ * orthonormal basis by Gram-Schmidt against the columns of the identity.
+ */
+template <typename T, typename P>
+__global__ void
+gesvdj_small(rocsolver_svect left_svect, rocsolver_svect right_svect,
+             rocblas_int m, rocblas_int n, P AA, rocblas_int lda,
+             rocblas_int strideA, T tol, rocblas_int max_sweeps, T *SS,
+             rocblas_int strideS, T *UU, rocblas_int ldu, rocblas_int strideU,
+             T *VV, rocblas_int ldv, rocblas_int strideV, rocblas_int *info,
+             T eps) {
+  __shared__ T sW[GESVDJ_MAX_SIZE * GESVDJ_MAX_SIZE];
+  __shared__ T sc[GESVDJ_MAX_SIZE / 2];
+  __shared__ T ss[GESVDJ_MAX_SIZE / 2];
+  __shared__ rocblas_int sp[GESVDJ_MAX_SIZE / 2];
+  __shared__ rocblas_int sq[GESVDJ_MAX_SIZE / 2];
+  __shared__ T ssig[GESVDJ_MAX_SIZE];
+  __shared__ rocblas_int srank[GESVDJ_MAX_SIZE];
+  __shared__ T sv[GESVDJ_MAX_SIZE];
+  __shared__ T sd[GESVDJ_MAX_SIZE];
+  __shared__ T sred[GESVDJ_BLOCKSIZE];
+  __shared__ int srot;
+
+  const int tid = hipThreadIdx_x;
+  const int nt = hipBlockDim_x;
+  const rocblas_int b = hipBlockIdx_x;
+  const bool tall = (m >= n);
+  const rocblas_int rows = tall ? m : n;
+  const rocblas_int cols = tall ? n : m;
+  const rocblas_int mm = cols + (cols & 1);
+  const rocblas_int half = mm / 2;
+  T *A = syevj_batch_matrix(AA, b, strideA);
+  T *S = SS + size_t(b) * strideS;
+  T *Uo = UU + size_t(b) * strideU;
+  T *Vo = VV + size_t(b) * strideV;
+
+  // X(i,j) is X[i * xr + j * xc], and Y(i,j) is Y[i * yr + j * yc]
+  const rocsolver_svect xsvect = tall ? right_svect : left_svect;
+  const rocsolver_svect ysvect = tall ? left_svect : right_svect;
+  T *X = tall ? Vo : Uo;
+  T *Y = tall ? Uo : Vo;
+  const rocblas_int xr = tall ? ldv : 1;
+  const rocblas_int xc = tall ? 1 : ldu;
+  const rocblas_int yr = tall ? 1 : ldv;
+  const rocblas_int yc = tall ? ldu : 1;
+  const bool xvec = (xsvect != rocsolver_svect_none);
+  const rocblas_int ycols =
+      (ysvect == rocsolver_svect_all)
+          ? rows
+          : (ysvect == rocsolver_svect_singular) ? cols : 0;
+
+  // W, and X = I
+  for (rocblas_int k = tid; k < rows * cols; k += nt) {
+    const rocblas_int i = k % rows;
+    const rocblas_int j = k / rows;
+    sW[k] = tall ? A[idx2D(i, j, lda)] : A[idx2D(j, i, lda)];
+  }
+  if (xvec)
+    for (rocblas_int k = tid; k < cols * cols; k += nt)
+      X[(k % cols) * xr + (k / cols) * xc] = (k % cols == k / cols) ? 1 : 0;
+  __syncthreads();
+
+  // columns of W with norm below rows * eps * ||W||_F are negligible: they
+  // are not rotated (their angles are noise) and are left out of Y
+  T fro2 = 0;
+  for (rocblas_int k = tid; k < rows * cols; k += nt)
+    fro2 += sW[k] * sW[k];
+  const T small = rows * eps * sqrt(syevj_sum(fro2, sred));
+  const T small2 = small * small;
+
+  bool converged = (cols < 2);
+  for (rocblas_int sweep = 0; sweep < max_sweeps && !converged; ++sweep) {
+    if (tid == 0)
+      srot = 0;
+    __syncthreads();
+
+    for (rocblas_int r = 0; r < mm - 1; ++r) {
+      // the rotations of the round; position 0 stays, the others turn, and
+      // a pair with the padding column is left alone
+      if (tid < half) {
+        const rocblas_int i1 = tid;
+        const rocblas_int i2 = mm - 1 - tid;
+        rocblas_int p = (i1 == 0) ? 0 : (i1 - 1 + r) % (mm - 1) + 1;
+        rocblas_int q = (i2 - 1 + r) % (mm - 1) + 1;
+        if (p > q) {
+          const rocblas_int t = p;
+          p = q;
+          q = t;
+        }
+        T c = 1, sn = 0;
+        if (q < cols) {
+          T alpha = 0, beta = 0, gamma = 0;
+          for (rocblas_int i = 0; i < rows; ++i) {
+            const T wp = sW[i + p * rows], wq = sW[i + q * rows];
+            alpha += wp * wp;
+            beta += wq * wq;
+            gamma += wp * wq;
+          }
+          if (alpha > small2 && beta > small2 &&
+              fabs(gamma) > tol * sqrt(alpha) * sqrt(beta)) {
+            const T theta = (beta - alpha) / (2 * gamma);
+            const T at = fabs(theta);
+            T t = (at > 1 / sqrt(eps)) ? 1 / (2 * at)
+                                       : 1 / (at + sqrt(1 + at * at));
+            if (theta < 0)
+              t = -t;
+            c = 1 / sqrt(1 + t * t);
+            sn = t * c;
+            srot = 1;
+          }
+        }
+        sp[tid] = p;
+        sq[tid] = q;
+        sc[tid] = c;
+        ss[tid] = sn;
+      }
+      __syncthreads();
+
+      // W := W * J and X := X * J, a row of a pair of columns per thread
+      for (rocblas_int k = tid; k < half * rows; k += nt) {
+        const rocblas_int x = k % half;
+        const rocblas_int i = k / half;
+        if (ss[x] != 0) {
+          const rocblas_int p = sp[x], q = sq[x];
+          const T c = sc[x], sn = ss[x];
+          const T wp = sW[i + p * rows], wq = sW[i + q * rows];
+          sW[i + p * rows] = c * wp - sn * wq;
+          sW[i + q * rows] = sn * wp + c * wq;
+        }
+      }
+      if (xvec) {
+        for (rocblas_int k = tid; k < half * cols; k += nt) {
+          const rocblas_int x = k % half;
+          const rocblas_int i = k / half;
+          if (ss[x] != 0) {
+            const rocblas_int p = sp[x], q = sq[x];
+            const T c = sc[x], sn = ss[x];
+            const T vp = X[i * xr + p * xc], vq = X[i * xr + q * xc];
+            X[i * xr + p * xc] = c * vp - sn * vq;
+            X[i * xr + q * xc] = sn * vp + c * vq;
+          }
+        }
+      }
+      __syncthreads();
+    }
+
+    converged = (srot == 0);
+    __syncthreads();
+  }
+
+  // the singular values in descending order (ties by index), and the
+  // columns of X along
+  for (rocblas_int j = tid; j < cols; j += nt) {
+    T s = 0;
+    for (rocblas_int i = 0; i < rows; ++i)
+      s += sW[i + j * rows] * sW[i + j * rows];
+    ssig[j] = sqrt(s);
+  }
+  __syncthreads();
+  for (rocblas_int j = tid; j < cols; j += nt) {
+    const T s = ssig[j];
+    rocblas_int rank = 0;
+    for (rocblas_int l = 0; l < cols; ++l)
+      if (ssig[l] > s || (ssig[l] == s && l < j))
+        ++rank;
+    srank[j] = rank;
+    S[rank] = s;
+  }
+  __syncthreads();
+
+  if (xvec) {
+    for (rocblas_int i = tid; i < cols; i += nt) {
+      T row[GESVDJ_MAX_SIZE];
+      for (rocblas_int j = 0; j < cols; ++j)
+        row[j] = X[i * xr + j * xc];
+      for (rocblas_int j = 0; j < cols; ++j)
+        X[i * xr + srank[j] * xc] = row[j];
+    }
+  }
+
+  if (ycols > 0) {
+    rocblas_int nr = 0;
+    for (rocblas_int j = 0; j < cols; ++j)
+      if (ssig[j] > small)
+        ++nr;
+
+    for (rocblas_int k = tid; k < rows * cols; k += nt) {
+      const rocblas_int i = k % rows;
+      const rocblas_int j = k / rows;
+      if (srank[j] < nr)
+        Y[i * yr + srank[j] * yc] = sW[k] / ssig[j];
+    }
+    __syncthreads();
+
+    // the rest of Y, from the columns of the identity not yet in its span
+    rocblas_int e = 0;
+    for (rocblas_int k = nr; k < ycols; ++k) {
+      while (e < rows) {
+        for (rocblas_int i = tid; i < rows; i += nt)
+          sv[i] = (i == e) ? 1 : 0;
+        ++e;
+        __syncthreads();
+        for (int pass = 0; pass < 2; ++pass) {
+          for (rocblas_int j = tid; j < k; j += nt) {
+            T d = 0;
+            for (rocblas_int i = 0; i < rows; ++i)
+              d += Y[i * yr + j * yc] * sv[i];
+            sd[j] = d;
+          }
+          __syncthreads();
+          for (rocblas_int i = tid; i < rows; i += nt) {
+            T v = sv[i];
+            for (rocblas_int j = 0; j < k; ++j)
+              v -= sd[j] * Y[i * yr + j * yc];
+            sv[i] = v;
+          }
+          __syncthreads();
+        }
+        T s = 0;
+        for (rocblas_int i = tid; i < rows; i += nt)
+          s += sv[i] * sv[i];
+        const T nrm = sqrt(syevj_sum(s, sred));
+        if (nrm > T(0.5)) {
+          for (rocblas_int i = tid; i < rows; i += nt)
+            Y[i * yr + k * yc] = sv[i] / nrm;
+          __syncthreads();
+          break;
+        }
+      }
+    }
+  }
+
+  if (tid == 0)
+    info[b] = converged ? 0 : 1;
+}
+
+/*
+ * The batch of gesvdj (an array of pointers to the matrices, or a strided
+ * block of them when P is T *). Matrices with m and n up to
+ * GESVDJ_MAX_SIZE are all solved by one kernel; larger ones one at a time
+ * by gesvd, with info as gesvd sets it.
+ */
+template <typename T, typename P>
+rocblas_status rocsolver_gesvdj_template(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n, P A,
+    rocblas_int lda, rocblas_int strideA, T tol, rocblas_int max_sweeps, T *S,
+    rocblas_int strideS, T *U, rocblas_int ldu, rocblas_int strideU, T *V,
+    rocblas_int ldv, rocblas_int strideV, rocblas_int *info,
+    rocblas_int batch_count) {
+
+  if (left_svect != rocsolver_svect_all &&
+      left_svect != rocsolver_svect_singular &&
+      left_svect != rocsolver_svect_none) {
+    return rocblas_status_not_implemented;
+  } else if (right_svect != rocsolver_svect_all &&
+             right_svect != rocsolver_svect_singular &&
+             right_svect != rocsolver_svect_none) {
+    return rocblas_status_not_implemented;
+  } else if (m < 0 || n < 0 || max_sweeps < 0 || batch_count < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, m)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (left_svect != rocsolver_svect_none && ldu < max(1, m)) {
+    return rocblas_status_invalid_size;
+  } else if ((right_svect == rocsolver_svect_all && ldv < max(1, n)) ||
+             (right_svect == rocsolver_svect_singular &&
+              ldv < max(1, min(m, n)))) {
+    return rocblas_status_invalid_size;
+  } else if (ldu < 1 || ldv < 1) {
+    return rocblas_status_invalid_size;
+  } else if (batch_count == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  if (m <= GESVDJ_MAX_SIZE && n <= GESVDJ_MAX_SIZE) {
+    const T eps = numeric_limits<T>::epsilon();
+    if (tol <= 0)
+      tol = max(max(m, n), 1) * eps;
+    hipLaunchKernelGGL((gesvdj_small<T, P>), dim3(batch_count),
+                       dim3(GESVDJ_BLOCKSIZE), 0, stream, left_svect,
+                       right_svect, m, n, A, lda, strideA, tol, max_sweeps, S,
+                       strideS, U, ldu, strideU, V, ldv, strideV, info, eps);
+    return rocblas_status_success;
+  }
+
+  // the matrices of an array of pointers are found on the host
+  vector<T *> hA(batch_count);
+  if (is_same<P, T *>::value) {
+    for (rocblas_int b = 0; b < batch_count; ++b)
+      hA[b] = syevj_batch_matrix(A, b, strideA);
+  } else {
+    hipMemcpy(hA.data(), A, sizeof(T *) * batch_count, hipMemcpyDeviceToHost);
+  }
+
+  for (rocblas_int b = 0; b < batch_count; ++b)
+    rocsolver_gesvd_template<T>(handle, left_svect, right_svect, m, n, hA[b],
+                                lda, S + size_t(b) * strideS,
+                                U + size_t(b) * strideU, ldu,
+                                V + size_t(b) * strideV, ldv, info + b);
+
+  return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GESVDJ_HPP */
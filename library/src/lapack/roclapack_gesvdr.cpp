@@ -0,0 +1,35 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesvdr.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_sgesvdr(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n, float *A,
+    rocblas_int lda, rocblas_int rank, rocblas_int oversample,
+    rocblas_int power_iters, float *S, float *U, rocblas_int ldu, float *V,
+    rocblas_int ldv, rocblas_int *info) {
+  return rocsolver_gesvdr_template<float>(handle, left_svect, right_svect, m,
+                                          n, A, lda, rank, oversample,
+                                          power_iters, S, U, ldu, V, ldv,
+                                          info);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_dgesvdr(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n, double *A,
+    rocblas_int lda, rocblas_int rank, rocblas_int oversample,
+    rocblas_int power_iters, double *S, double *U, rocblas_int ldu, double *V,
+    rocblas_int ldv, rocblas_int *info) {
+  return rocsolver_gesvdr_template<double>(handle, left_svect, right_svect, m,
+                                           n, A, lda, rank, oversample,
+                                           power_iters, S, U, ldu, V, ldv,
+                                           info);
+}
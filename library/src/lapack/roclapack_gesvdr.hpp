@@ -0,0 +1,225 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GESVDR_HPP
+#define ROCLAPACK_GESVDR_HPP
+
+#include <cmath>
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_geqrf.hpp"
+#include "roclapack_gesvd.hpp"
+#include "roclapack_orgqr.hpp"
+
+using namespace std;
+
+/*
+ * Randomized range finder: with l = rank + oversample columns (at most
+ * min(m,n)), Y = A * Omega for a Gaussian n x l matrix Omega, Q an
+ * orthonormal basis of Y, and power_iters times Q := orth(A * orth(A**T *
+ * Q)) to sharpen the gap between the wanted and the other singular values.
+ * Then B**T = A**T * Q (n x l) has the SVD B**T = Ub * diag(S) * Vb**T by
+ * gesvd, so that A ~ Q * B = (Q * Vb) * diag(S) * Ub**T: the first rank
+ * columns of Q * Vb are U and the first rank columns of Ub are the rows of
+ * V**T. Every pass over A is a gemm; the bases are made orthonormal by
+ * geqrf and orgqr.
+ */
+
+// the constants, then the workspace; the constants are those of gesvd, in
+// the same places, so that the buffer is also a gesvd buffer
+#define GESVDR_INPONE 0
+#define GESVDR_INPZERO 1
+#define GESVDR_INPMINONE 2
+#define GESVDR_WORK 3
+
+// the seed of Omega, fixed so that the results are reproducible
+#define GESVDR_SEED 0x5eed1234abcdULL
+
+// A := independent standard normal entries for the m x n matrix A, by the
+// Box-Muller transform of two uniform numbers hashed (splitmix64) from the
+// seed and the position of the entry
+template <typename T>
+__global__ void gesvdr_gaussian(rocblas_int m, rocblas_int n, T *A,
+                                rocblas_int lda, unsigned long long seed) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < m) {
+    unsigned long long x[2];
+    unsigned long long z = seed + 2 * (size_t(j) * m + i);
+    for (int t = 0; t < 2; ++t) {
+      unsigned long long y = (z += 0x9e3779b97f4a7c15ULL);
+      y = (y ^ (y >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      y = (y ^ (y >> 27)) * 0x94d049bb133111ebULL;
+      x[t] = y ^ (y >> 31);
+    }
+    const double u1 = ((x[0] >> 11) + 1) * (1.0 / 9007199254740992.0);
+    const double u2 = (x[1] >> 11) * (1.0 / 9007199254740992.0);
+    A[idx2D(i, j, lda)] =
+        T(sqrt(-2 * log(u1)) * cos(6.283185307179586 * u2));
+  }
+}
+
+inline rocblas_int gesvdr_cols(rocblas_int m, rocblas_int n,
+                               rocblas_int rank, rocblas_int oversample) {
+  return min(rank + oversample, min(m, n));
+}
+
+// elements of the workspace after the constants: what gesvd needs for the
+// n x l matrix B**T, a geqrf buffer, the workspace of orgqr, Omega (then
+// B**T), Q, tau, Ub, Vb**T and the l singular values
+inline size_t gesvdr_work_size(rocblas_int m, rocblas_int n, rocblas_int l) {
+  return gesvd_work_size(rocsolver_svect_singular, rocsolver_svect_singular,
+                         n, l) +
+         max(geqrf_buffer_size(m, l), geqrf_buffer_size(n, l)) +
+         orgqr_work_size(max(m, n), l) + 2 * size_t(n) * l +
+         size_t(m) * l + size_t(l) * l + 2 * size_t(l);
+}
+
+// the rows x l matrix Y := the orthonormal factor Q of Y = Q * R; one, zero
+// and minone are device constants, geqrfBuf an initialized geqrf buffer and
+// orgqrBuf the workspace of orgqr
+template <typename T>
+void gesvdr_orth(rocblas_handle handle, rocblas_int rows, rocblas_int l, T *Y,
+                 T *tau, const T *one, const T *zero, const T *minone,
+                 T *geqrfBuf, T *orgqrBuf) {
+  rocsolver_geqrf_async_template<T>(handle, rows, l, Y, rows, tau, geqrfBuf);
+  rocsolver_orgqr_async_template<T>(handle, rows, l, l, Y, rows, tau, one,
+                                    zero, minone, orgqrBuf);
+}
+
+template <typename T>
+rocblas_status rocsolver_gesvdr_template(
+    rocblas_handle handle, rocsolver_svect left_svect,
+    rocsolver_svect right_svect, rocblas_int m, rocblas_int n, T *A,
+    rocblas_int lda, rocblas_int rank, rocblas_int oversample,
+    rocblas_int power_iters, T *S, T *U, rocblas_int ldu, T *V,
+    rocblas_int ldv, rocblas_int *info) {
+
+  if (left_svect != rocsolver_svect_singular &&
+      left_svect != rocsolver_svect_none) {
+    // only the leading singular vectors are approximated
+    return rocblas_status_not_implemented;
+  } else if (right_svect != rocsolver_svect_singular &&
+             right_svect != rocsolver_svect_none) {
+    return rocblas_status_not_implemented;
+  } else if (m < 0 || n < 0 || oversample < 0 || power_iters < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (rank < 0 || rank > min(m, n)) {
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, m)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (left_svect != rocsolver_svect_none && ldu < max(1, m)) {
+    return rocblas_status_invalid_size;
+  } else if (right_svect != rocsolver_svect_none && ldv < max(1, rank)) {
+    return rocblas_status_invalid_size;
+  } else if (ldu < 1 || ldv < 1) {
+    return rocblas_status_invalid_size;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  hipMemsetAsync(info, 0, sizeof(rocblas_int), stream);
+  if (rank == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  const rocblas_int l = gesvdr_cols(m, n, rank, oversample);
+  const rocblas_int bs = LARFG_BLOCKSIZE;
+
+  T inpsResHost[3];
+  inpsResHost[GESVDR_INPONE] = static_cast<T>(1);
+  inpsResHost[GESVDR_INPZERO] = static_cast<T>(0);
+  inpsResHost[GESVDR_INPMINONE] = static_cast<T>(-1);
+
+  // allocate the constants and workspace on device to avoid going onto CPU
+  // and needing to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, sizeof(T) * (GESVDR_WORK + gesvdr_work_size(m, n, l)));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T),
+            hipMemcpyHostToDevice);
+  rocblas_int *iwork;
+  hipMalloc(&iwork, sizeof(rocblas_int) * bdsqr_iwork_size(l));
+
+  const T *one = &inpsResGPU[GESVDR_INPONE];
+  const T *zero = &inpsResGPU[GESVDR_INPZERO];
+  const T *minone = &inpsResGPU[GESVDR_INPMINONE];
+  T *geqrfBuf =
+      &inpsResGPU[GESVDR_WORK] +
+      gesvd_work_size(rocsolver_svect_singular, rocsolver_svect_singular, n, l);
+  T *orgqrBuf =
+      geqrfBuf + max(geqrf_buffer_size(m, l), geqrf_buffer_size(n, l));
+  T *Om = orgqrBuf + orgqr_work_size(max(m, n), l);
+  T *Q = Om + size_t(n) * l;
+  T *tau = Q + size_t(m) * l;
+  T *Ub = tau + l;
+  T *Vb = Ub + size_t(n) * l;
+  T *Sl = Vb + size_t(l) * l;
+  T *gesvdGeqrfBuf = gesvd_geqrf_buffer(inpsResGPU, rocsolver_svect_singular,
+                                        rocsolver_svect_singular, n, l);
+  geqrf_init_buffer<T>(geqrfBuf);
+  if (gesvdGeqrfBuf)
+    geqrf_init_buffer<T>(gesvdGeqrfBuf);
+
+  // Q = orth(A * Omega)
+  hipLaunchKernelGGL(gesvdr_gaussian<T>, dim3((n - 1) / bs + 1, l), dim3(bs),
+                     0, stream, n, l, Om, n, GESVDR_SEED);
+  rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none, m,
+                  l, n, one, A, lda, Om, n, zero, Q, m);
+  gesvdr_orth<T>(handle, m, l, Q, tau, one, zero, minone, geqrfBuf,
+                 orgqrBuf);
+
+  // the power iterations, through Omega as the n x l basis
+  for (rocblas_int it = 0; it < power_iters; ++it) {
+    rocblas_gemm<T>(handle, rocblas_operation_transpose,
+                    rocblas_operation_none, n, l, m, one, A, lda, Q, m, zero,
+                    Om, n);
+    gesvdr_orth<T>(handle, n, l, Om, tau, one, zero, minone, geqrfBuf,
+                   orgqrBuf);
+    rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none, m,
+                    l, n, one, A, lda, Om, n, zero, Q, m);
+    gesvdr_orth<T>(handle, m, l, Q, tau, one, zero, minone, geqrfBuf,
+                   orgqrBuf);
+  }
+
+  // B**T = A**T * Q = Ub * diag(S) * Vb**T
+  rocblas_gemm<T>(handle, rocblas_operation_transpose, rocblas_operation_none,
+                  n, l, m, one, A, lda, Q, m, zero, Om, n);
+  rocsolver_gesvd_async_template<T>(handle, rocsolver_svect_singular,
+                                    rocsolver_svect_singular, n, l, Om, n, Sl,
+                                    Ub, n, Vb, l, info, inpsResGPU, iwork);
+
+  hipMemcpyAsync(S, Sl, sizeof(T) * rank, hipMemcpyDeviceToDevice, stream);
+  if (left_svect != rocsolver_svect_none)
+    // U = Q * Vb(:,0:rank) = Q * (Vb**T(0:rank,:))**T
+    rocblas_gemm<T>(handle, rocblas_operation_none,
+                    rocblas_operation_transpose, m, rank, l, one, Q, m, Vb, l,
+                    zero, U, ldu);
+  if (right_svect != rocsolver_svect_none)
+    // V**T = Ub(:,0:rank)**T
+    hipLaunchKernelGGL(gesvd_transpose<T>, dim3((n - 1) / bs + 1, rank),
+                       dim3(bs), 0, stream, n, rank, Ub, n, V, ldv);
+
+  hipFree(inpsResGPU);
+  hipFree(iwork);
+
+  return rocblas_status_success;
+}
+
+#undef GESVDR_INPONE
+#undef GESVDR_INPZERO
+#undef GESVDR_INPMINONE
+#undef GESVDR_WORK
+#undef GESVDR_SEED
+
+#endif /* ROCLAPACK_GESVDR_HPP */
@@ -24,4 +24,19 @@ extern "C" ROCSOLVER_EXPORT rocblas_status
 rocsolver_dgetf2(rocblas_handle handle, rocblas_int m, rocblas_int n, double *A,
                  rocblas_int lda, rocblas_int *ipiv) {
   return rocsolver_getf2_template<double>(handle, m, n, A, lda, ipiv);
-}
\ No newline at end of file
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_cgetf2(rocblas_handle handle, rocblas_int m, rocblas_int n,
+                 rocblas_float_complex *A, rocblas_int lda, rocblas_int *ipiv) {
+  return rocsolver_getf2_template<rocblas_float_complex>(handle, m, n, A, lda,
+                                                         ipiv);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_zgetf2(rocblas_handle handle, rocblas_int m, rocblas_int n,
+                 rocblas_double_complex *A, rocblas_int lda,
+                 rocblas_int *ipiv) {
+  return rocsolver_getf2_template<rocblas_double_complex>(handle, m, n, A, lda,
+                                                          ipiv);
+}
@@ -25,15 +25,15 @@ using namespace std;
 
 template <typename T>
 __global__ void getf2_check_singularity(T *A, rocblas_int *jp, rocblas_int j,
-                                        rocblas_int lda,
-                                        rocblas_int *inpsResGPUInt) {
+                                        rocblas_int lda, rocblas_int offset,
+                                        T *inpsResGPU) {
 
   (*jp) = j + (*jp); // jp is 1 index, j is zero
 
-  if (A[j * lda + (*jp) - 1] == 0) {
-    inpsResGPUInt[GETF2_RESSING] = -j;
+  if (scalar_is_zero(A[j * lda + (*jp) - 1])) {
+    inpsResGPU[GETF2_RESSING] = scalar_const<T>(-(j + offset));
     // to not run into NaNs subsequently
-    A[j * lda + (*jp) - 1] = static_cast<T>(1e-6);
+    A[j * lda + (*jp) - 1] = scalar_const<T>(1e-6);
   }
 }
 
@@ -54,39 +54,25 @@ __global__ void getf2_scal(rocblas_int n, const T *alpha, T *x) {
   int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
   // bound
   if (tid < n) {
-    x[tid] = (x[tid]) / (*alpha);
+    x[tid] = scalar_div(x[tid], *alpha);
   }
 }
 
+/*
+ * Unblocked LU factorization of the m x n matrix A. It only enqueues work on
+ * the handle's stream: inpsResGPU holds the constants and results as laid out
+ * by the GETF2_* indices above, and a zero pivot is flagged in
+ * inpsResGPU[GETF2_RESSING] as the negated column index, shifted by offset
+ * when A is a panel of a larger matrix (its real part, for the complex
+ * types).
+ */
 template <typename T>
-rocblas_status rocsolver_getf2_template(rocblas_handle handle, rocblas_int m,
-                                        rocblas_int n, T *A, rocblas_int lda,
-                                        rocblas_int *ipiv) {
-
-  if (m == 0 || n == 0) {
-    // quick return
-    return rocblas_status_success;
-  } else if (m < 0) {
-    // less than zero dimensions in a matrix?!
-    return rocblas_status_invalid_size;
-  } else if (n < 0) {
-    // less than zero dimensions in a matrix?!
-    return rocblas_status_invalid_size;
-  } else if (lda < max(1, m)) {
-    // mismatch of provided first matrix dimension
-    return rocblas_status_invalid_size;
-  }
+void rocsolver_getf2_async_template(rocblas_handle handle, rocblas_int m,
+                                    rocblas_int n, T *A, rocblas_int lda,
+                                    rocblas_int *ipiv, rocblas_int offset,
+                                    T *inpsResGPU) {
 
   rocblas_int oneInt = 1;
-  T inpsResHost[2];
-  inpsResHost[GETF2_INPMINONE] = static_cast<T>(-1);
-  inpsResHost[GETF2_RESSING] = static_cast<T>(42);
-
-  // allocate a tiny bit of memory on device to avoid going onto CPU and needing
-  // to synchronize.
-  T *inpsResGPU;
-  hipMalloc(&inpsResGPU, 2 * sizeof(T));
-  hipMemcpy(inpsResGPU, &inpsResHost[0], 2 * sizeof(T), hipMemcpyHostToDevice);
 
   hipStream_t stream;
   rocblas_get_stream(handle, &stream);
@@ -103,7 +89,7 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle, rocblas_int m,
     // use Fortran 1-based indexing for the ipiv array as iamax does that as
     // well!
     hipLaunchKernelGGL(getf2_check_singularity<T>, dim3(1), dim3(1), 0, stream,
-                       A, &ipiv[j], j, lda, inpsResGPU);
+                       A, &ipiv[j], j, lda, offset, inpsResGPU);
 
     // Apply the interchange to columns 1:N
     hipLaunchKernelGGL(getf2_pivot<T>, gridPivot, threads, 0, stream, n, A, lda,
@@ -124,12 +110,45 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle, rocblas_int m,
                   lda, &A[idx2D(j + 1, j + 1, lda)], lda);
     }
   }
+}
+
+template <typename T>
+rocblas_status rocsolver_getf2_template(rocblas_handle handle, rocblas_int m,
+                                        rocblas_int n, T *A, rocblas_int lda,
+                                        rocblas_int *ipiv) {
+
+  if (m == 0 || n == 0) {
+    // quick return
+    return rocblas_status_success;
+  } else if (m < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, m)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  }
+
+  T inpsResHost[2];
+  inpsResHost[GETF2_INPMINONE] = scalar_const<T>(-1);
+  inpsResHost[GETF2_RESSING] = scalar_const<T>(42);
+
+  // allocate a tiny bit of memory on device to avoid going onto CPU and needing
+  // to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, 2 * sizeof(T));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 2 * sizeof(T), hipMemcpyHostToDevice);
+
+  rocsolver_getf2_async_template<T>(handle, m, n, A, lda, ipiv, 0, inpsResGPU);
 
   // let's see if we encountered any singularity
   hipMemcpy(&inpsResHost[GETF2_RESSING], &inpsResGPU[GETF2_RESSING], sizeof(T),
             hipMemcpyDeviceToHost);
-  if (inpsResHost[GETF2_RESSING] <= 0.0) {
-    const size_t elem = static_cast<size_t>(fabs(inpsResHost[GETF2_RESSING]));
+  if (scalar_real(inpsResHost[GETF2_RESSING]) <= 0.0) {
+    const size_t elem =
+        static_cast<size_t>(fabs(scalar_real(inpsResHost[GETF2_RESSING])));
     cerr << "ERROR: Input matrix has singularity/-ies. Last "
             "occurrence of this in element "
          << elem << endl;
@@ -24,4 +24,20 @@ extern "C" ROCSOLVER_EXPORT rocblas_status
 rocsolver_dgetrf(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
                  double *A, rocsolver_int lda, rocsolver_int *ipiv) {
   return rocsolver_getrf_template<double>(handle, m, n, A, lda, ipiv);
-}
\ No newline at end of file
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_cgetrf(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 rocsolver_float_complex *A, rocsolver_int lda,
+                 rocsolver_int *ipiv) {
+  return rocsolver_getrf_template<rocsolver_float_complex>(handle, m, n, A,
+                                                           lda, ipiv);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_zgetrf(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 rocsolver_double_complex *A, rocsolver_int lda,
+                 rocsolver_int *ipiv) {
+  return rocsolver_getrf_template<rocsolver_double_complex>(handle, m, n, A,
+                                                            lda, ipiv);
+}
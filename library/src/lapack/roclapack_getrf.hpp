@@ -15,109 +15,263 @@
 #include "ideal_sizes.hpp"
 #include "roclapack_getf2.hpp"
 #include "roclapack_laswp.hpp"
+#include "tile_dag.hpp"
 
-#define GETRF_INPMINONE 0
-#define GETRF_INPONE 1
+// the constants and results are shared by the whole factorization: getf2
+// gets the buffer from GETRF_INPMINONE on, which matches its own layout
+#define GETRF_INPONE 0
+#define GETRF_INPMINONE 1
+#define GETRF_RESSING 2
 
-__global__ void getrf_indices(rocblas_int n, rocblas_int j, rocblas_int *ipiv) {
+static __global__ void getrf_indices(rocblas_int n, rocblas_int j,
+                                     rocblas_int *ipiv) {
   int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
   if (tid < n) {
     ipiv[j + tid] += j;
   }
 }
 
+/*
+ * Factor the jb columns of A starting at row and column j, and adjust the
+ * pivot indices to refer to the whole matrix.
+ */
 template <typename T>
-rocblas_status rocsolver_getrf_template(rocblas_handle handle, rocblas_int m,
-                                        rocblas_int n, T *A, rocblas_int lda,
-                                        rocblas_int *ipiv) {
+void getrf_panel(rocblas_handle handle, rocblas_int m, rocblas_int j,
+                 rocblas_int jb, T *A, rocblas_int lda, rocblas_int *ipiv,
+                 T *inpsResGPU) {
 
-  // if the matrix is small, use the unblocked variant
-  if (m < GETRF_GETF2_SWITCHSIZE || n < GETRF_GETF2_SWITCHSIZE) {
-    return rocsolver_getf2_template<T>(handle, m, n, A, lda, ipiv);
-  }
-
-  if (m == 0 || n == 0) {
-    // quick return
-    return rocblas_status_success;
-  } else if (m < 0) {
-    // less than zero dimensions in a matrix?!
-    return rocblas_status_invalid_size;
-  } else if (n < 0) {
-    // less than zero dimensions in a matrix?!
-    return rocblas_status_invalid_size;
-  } else if (lda < max(1, m)) {
-    // mismatch of provided first matrix dimension
-    return rocblas_status_invalid_size;
-  }
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
 
-  T inpsResHost[2];
-  inpsResHost[GETRF_INPMINONE] = static_cast<T>(-1);
-  inpsResHost[GETRF_INPONE] = static_cast<T>(1);
+  rocsolver_getf2_async_template<T>(handle, m - j, jb, &A[idx2D(j, j, lda)],
+                                    lda, &ipiv[j], j,
+                                    &inpsResGPU[GETRF_INPMINONE]);
 
-  // allocate a tiny bit of memory on device to avoid going onto CPU and needing
-  // to synchronize.
-  T *inpsResGPU;
-  hipMalloc(&inpsResGPU, 2 * sizeof(T));
-  hipMemcpy(inpsResGPU, &inpsResHost[0], 2 * sizeof(T), hipMemcpyHostToDevice);
+  rocblas_int blocksPivot = (jb - 1) / LASWP_BLOCKSIZE + 1;
+  dim3 gridPivot(blocksPivot, 1, 1);
+  dim3 threads(LASWP_BLOCKSIZE, 1, 1);
+  hipLaunchKernelGGL(getrf_indices, gridPivot, threads, 0, stream, jb, j, ipiv);
+}
 
-  hipStream_t stream;
-  rocblas_get_stream(handle, &stream);
+/*
+ * Right-looking blocked LU, as in the reference LAPACK.
+ */
+template <typename T>
+rocblas_status rocsolver_getrf_blocked(rocblas_handle handle, rocblas_int m,
+                                       rocblas_int n, T *A, rocblas_int lda,
+                                       rocblas_int *ipiv, T *inpsResGPU) {
 
   for (rocblas_int j = 0; j < min(m, n); j += GETRF_GETF2_SWITCHSIZE) {
 
     const rocblas_int jb = min(min(m, n) - j, GETRF_GETF2_SWITCHSIZE);
 
     // Factor diagonal and subdiagonal blocks and test for exact singularity
-    const rocblas_status substat = rocsolver_getf2_template<T>(
-        handle, m - j, jb, &A[idx2D(j, j, lda)], lda, &ipiv[j]);
-    if (substat != rocblas_status_success) {
-      return substat;
-    }
-
-    // adjust pivot indices
-    rocblas_int sizePivot = min(m, j + jb);
-    rocblas_int blocksPivot = (sizePivot - 1) / 256 + 1;
-    dim3 gridPivot(blocksPivot, 1, 1);
-    dim3 threads(256, 1, 1);
-    hipLaunchKernelGGL(getrf_indices, gridPivot, threads, 0, stream, sizePivot,
-                       j, ipiv);
+    getrf_panel<T>(handle, m, j, jb, A, lda, ipiv, inpsResGPU);
 
     // apply interchanges to columns 1 : j-1
-    roclapack_laswp_template<T>(handle, j, A, lda, j, j + jb, ipiv, 1);
+    roclapack_laswp_device_template<T>(handle, j, A, lda, j, j + jb, ipiv, 1);
 
     if (j + jb < n) {
       // apply interchanges to columns j+jb : n
-      roclapack_laswp_template<T>(handle, (n - j - jb),
-                                  &A[idx2D(1, j + jb - 1, lda)], lda, j, j + jb,
-                                  ipiv, 1);
-
-      if (j >= 1)
-        return rocblas_status_success;
+      roclapack_laswp_device_template<T>(handle, (n - j - jb),
+                                         &A[idx2D(0, j + jb, lda)], lda, j,
+                                         j + jb, ipiv, 1);
 
       // compute block row of U
       rocblas_trsm(
           handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
           rocblas_diagonal_unit, jb, (n - j - jb), &inpsResGPU[GETRF_INPONE],
-          &A[idx2D(j, j, lda)], lda, &A[idx2D(j, j + jb - 1, lda)], lda);
+          &A[idx2D(j, j, lda)], lda, &A[idx2D(j, j + jb, lda)], lda);
 
       if (j + jb < m) {
         // update trailing submatrix
-        rocblas_gemm(
-            handle, rocblas_operation_none, rocblas_operation_none,
-            (m - j - jb), (n - j - jb), jb, &inpsResGPU[GETRF_INPMINONE],
-            &A[idx2D(j + jb - 1, j, lda)], lda, &A[idx2D(j, j + jb - 1, lda)],
-            lda, &inpsResGPU[GETRF_INPONE],
-            &A[idx2D(j + jb - 1, j + jb - 1, lda)], lda);
+        rocblas_gemm(handle, rocblas_operation_none, rocblas_operation_none,
+                     (m - j - jb), (n - j - jb), jb,
+                     &inpsResGPU[GETRF_INPMINONE], &A[idx2D(j + jb, j, lda)],
+                     lda, &A[idx2D(j, j + jb, lda)], lda,
+                     &inpsResGPU[GETRF_INPONE], &A[idx2D(j + jb, j + jb, lda)],
+                     lda);
       }
     }
   }
 
+  return rocblas_status_success;
+}
+
+/*
+ * Tiled LU. The blocked algorithm is expressed as tasks on GETRF_TILESIZE
+ * tiles: the panel factorization of a block column, the row interchanges plus
+ * triangular solve on every tile column to its right, the interchanges on the
+ * tile columns to its left and one GEMM per trailing tile. The tasks are
+ * scheduled as a DAG over several streams (see tile_dag.hpp), so the next
+ * panels are factored while the trailing updates are still running.
+ */
+template <typename T>
+rocblas_status rocsolver_getrf_tiled(rocblas_handle handle, rocblas_int m,
+                                     rocblas_int n, T *A, rocblas_int lda,
+                                     rocblas_int *ipiv, T *inpsResGPU) {
+
+  const rocblas_int nb = GETRF_TILESIZE;
+  const rocblas_int mt = (m - 1) / nb + 1;
+  const rocblas_int nt = (n - 1) / nb + 1;
+  const rocblas_int kt = (min(m, n) - 1) / nb + 1;
+
+  const T *one = &inpsResGPU[GETRF_INPONE];
+  const T *minone = &inpsResGPU[GETRF_INPMINONE];
+
+  // tiles are keyed by their position, and the pivots of every block column
+  // get a key of their own past the tiles
+  const rocblas_int pivKey = mt * nt;
+
+  tile_dag dag;
+
+  for (rocblas_int k = 0; k < kt; ++k) {
+    const rocblas_int k0 = k * nb;
+    const rocblas_int kb = min(nb, min(m, n) - k0);
+
+    vector<rocblas_int> panel;
+    for (rocblas_int i = k; i < mt; ++i)
+      panel.push_back(i + k * mt);
+    panel.push_back(pivKey + k);
+
+    dag.add_task(
+        [=](rocblas_handle h, hipStream_t) -> rocblas_status {
+          getrf_panel<T>(h, m, k0, kb, A, lda, ipiv, inpsResGPU);
+          return rocblas_status_success;
+        },
+        TILE_DAG_WEIGHT_TRSM * (mt - k), {}, panel);
+
+    for (rocblas_int j = 0; j < nt; ++j) {
+      // columns of tile j still to be permuted (and solved for if right of
+      // the panel); only the last panel of a wide matrix leaves a remainder
+      // of its own tile column
+      const rocblas_int c0 = (j == k) ? k0 + kb : j * nb;
+      const rocblas_int cb = min((j + 1) * nb, n) - c0;
+      if (cb <= 0)
+        continue;
+
+      vector<rocblas_int> rows;
+      for (rocblas_int i = k; i < mt; ++i)
+        rows.push_back(i + j * mt);
+
+      if (j < k) {
+        dag.add_task(
+            [=](rocblas_handle h, hipStream_t) -> rocblas_status {
+              roclapack_laswp_device_template<T>(
+                  h, cb, &A[idx2D(0, c0, lda)], lda, k0, k0 + kb, ipiv, 1);
+              return rocblas_status_success;
+            },
+            TILE_DAG_WEIGHT_SWAP, {pivKey + k}, rows);
+      } else {
+        dag.add_task(
+            [=](rocblas_handle h, hipStream_t) -> rocblas_status {
+              roclapack_laswp_device_template<T>(
+                  h, cb, &A[idx2D(0, c0, lda)], lda, k0, k0 + kb, ipiv, 1);
+              return rocblas_trsm<T>(
+                  h, rocblas_side_left, rocblas_fill_lower,
+                  rocblas_operation_none, rocblas_diagonal_unit, kb, cb, one,
+                  &A[idx2D(k0, k0, lda)], lda, &A[idx2D(k0, c0, lda)], lda);
+            },
+            TILE_DAG_WEIGHT_TRSM, {pivKey + k, k + k * mt}, rows);
+      }
+    }
+
+    // update of the trailing matrix
+    for (rocblas_int j = k + 1; j < nt; ++j) {
+      const rocblas_int j0 = j * nb;
+      const rocblas_int jb = min(nb, n - j0);
+
+      for (rocblas_int i = k + 1; i < mt; ++i) {
+        const rocblas_int i0 = i * nb;
+        const rocblas_int ib = min(nb, m - i0);
+
+        dag.add_task(
+            [=](rocblas_handle h, hipStream_t) -> rocblas_status {
+              return rocblas_gemm<T>(
+                  h, rocblas_operation_none, rocblas_operation_none, ib, jb, kb,
+                  minone, &A[idx2D(i0, k0, lda)], lda, &A[idx2D(k0, j0, lda)],
+                  lda, one, &A[idx2D(i0, j0, lda)], lda);
+            },
+            TILE_DAG_WEIGHT_GEMM, {i + k * mt, k + j * mt}, {i + j * mt});
+      }
+    }
+  }
+
+  return dag.execute(handle);
+}
+
+/*
+ * Enqueue the LU factorization of A without any host synchronization: the
+ * unblocked, blocked or tiled variant is picked by size, inpsResGPU holds the
+ * constants and results as laid out by the GETRF_* indices above.
+ */
+template <typename T>
+rocblas_status rocsolver_getrf_async_template(rocblas_handle handle,
+                                              rocblas_int m, rocblas_int n,
+                                              T *A, rocblas_int lda,
+                                              rocblas_int *ipiv,
+                                              T *inpsResGPU) {
+
+  if (m < GETRF_GETF2_SWITCHSIZE || n < GETRF_GETF2_SWITCHSIZE) {
+    rocsolver_getf2_async_template<T>(handle, m, n, A, lda, ipiv, 0,
+                                      &inpsResGPU[GETRF_INPMINONE]);
+    return rocblas_status_success;
+  } else if (m >= GETRF_TILED_SWITCHSIZE && n >= GETRF_TILED_SWITCHSIZE) {
+    return rocsolver_getrf_tiled<T>(handle, m, n, A, lda, ipiv, inpsResGPU);
+  } else {
+    return rocsolver_getrf_blocked<T>(handle, m, n, A, lda, ipiv, inpsResGPU);
+  }
+}
+
+template <typename T>
+rocblas_status rocsolver_getrf_template(rocblas_handle handle, rocblas_int m,
+                                        rocblas_int n, T *A, rocblas_int lda,
+                                        rocblas_int *ipiv) {
+
+  // if the matrix is small, use the unblocked variant
+  if (m < GETRF_GETF2_SWITCHSIZE || n < GETRF_GETF2_SWITCHSIZE) {
+    return rocsolver_getf2_template<T>(handle, m, n, A, lda, ipiv);
+  } else if (lda < m) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  }
+
+  T inpsResHost[3];
+  inpsResHost[GETRF_INPONE] = scalar_const<T>(1);
+  inpsResHost[GETRF_INPMINONE] = scalar_const<T>(-1);
+  inpsResHost[GETRF_RESSING] = scalar_const<T>(42);
+
+  // allocate a tiny bit of memory on device to avoid going onto CPU and needing
+  // to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, 3 * sizeof(T));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T), hipMemcpyHostToDevice);
+
+  rocblas_status status = rocsolver_getrf_async_template<T>(
+      handle, m, n, A, lda, ipiv, inpsResGPU);
+
+  // let's see if we encountered any singularity
+  hipMemcpy(&inpsResHost[GETRF_RESSING], &inpsResGPU[GETRF_RESSING], sizeof(T),
+            hipMemcpyDeviceToHost);
   hipFree(inpsResGPU);
 
+  if (status != rocblas_status_success) {
+    return status;
+  }
+  if (scalar_real(inpsResHost[GETRF_RESSING]) <= 0.0) {
+    const size_t elem =
+        static_cast<size_t>(fabs(scalar_real(inpsResHost[GETRF_RESSING])));
+    cerr << "ERROR: Input matrix has singularity/-ies. Last "
+            "occurrence of this in element "
+         << elem << endl;
+    return rocblas_status_internal_error;
+  }
+
   return rocblas_status_success;
 }
 
-#undef GETRF_INPMINONE
 #undef GETRF_INPONE
+#undef GETRF_INPMINONE
+#undef GETRF_RESSING
 
 #endif /* ROCLAPACK_GETRF_HPP */
@@ -0,0 +1,27 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getri.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgetri(rocsolver_handle handle, rocsolver_int n, float *A,
+                 rocsolver_int lda, const rocsolver_int *ipiv) {
+  return rocsolver_getri_template<float>(handle, n, A, lda, ipiv);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgetri(rocsolver_handle handle, rocsolver_int n, double *A,
+                 rocsolver_int lda, const rocsolver_int *ipiv) {
+  return rocsolver_getri_template<double>(handle, n, A, lda, ipiv);
+}
@@ -0,0 +1,182 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GETRI_HPP
+#define ROCLAPACK_GETRI_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_trtri.hpp"
+
+using namespace std;
+
+#define GETRI_INPONE 0
+#define GETRI_INPMINONE 1
+#define GETRI_RESSING 2
+
+template <typename T>
+__global__ void getri_check_singularity(rocblas_int n, const T *A,
+                                        rocblas_int lda, T *inpsResGPU) {
+  const int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  if (i < n && A[i + i * lda] == 0) {
+    inpsResGPU[GETRI_RESSING] = -static_cast<T>(i);
+  }
+}
+
+/*
+ * Move the strictly lower part of the block column A(:, j:j+jb) into W
+ * (leading dimension ldw) and zero it in A. One thread per row.
+ */
+template <typename T>
+__global__ void getri_take_lower(rocblas_int n, rocblas_int j, rocblas_int jb,
+                                 T *A, rocblas_int lda, T *W,
+                                 rocblas_int ldw) {
+  const int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  if (i < n) {
+    for (rocblas_int c = 0; c < jb && j + c < i; ++c) {
+      W[i + c * ldw] = A[i + (j + c) * lda];
+      A[i + (j + c) * lda] = 0;
+    }
+  }
+}
+
+/*
+ * Undo the row interchanges of getrf as column interchanges of the inverse,
+ * in reverse order. Every thread owns one row and replays all interchanges on
+ * it, so ipiv never leaves the device.
+ */
+template <typename T>
+__global__ void getri_swap_columns(rocblas_int n, T *A, rocblas_int lda,
+                                   const rocblas_int *ipiv) {
+  const int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  if (i < n) {
+    for (rocblas_int j = n - 2; j >= 0; --j) {
+      const rocblas_int jp = ipiv[j] - 1;
+      if (jp != j) {
+        const T orig = A[i + j * lda];
+        A[i + j * lda] = A[i + jp * lda];
+        A[i + jp * lda] = orig;
+      }
+    }
+  }
+}
+
+/*
+ * Inverse of A from its LU factorization (getrf), as in the reference
+ * LAPACK: U is inverted in place (roclapack_trtri_async_template), then
+ * inv(A)*L = inv(U) is solved for inv(A) by block columns from the right,
+ * each with one gemm and one trsm against the block column of L saved in a
+ * n x GETRI_BLOCKSIZE workspace. Finally the interchanges are applied to the
+ * columns.
+ */
+template <typename T>
+rocblas_status rocsolver_getri_template(rocblas_handle handle, rocblas_int n,
+                                        T *A, rocblas_int lda,
+                                        const rocblas_int *ipiv) {
+
+  if (n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (n == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  T inpsResHost[3];
+  inpsResHost[GETRI_INPONE] = static_cast<T>(1);
+  inpsResHost[GETRI_INPMINONE] = static_cast<T>(-1);
+  inpsResHost[GETRI_RESSING] = static_cast<T>(42);
+
+  // allocate a tiny bit of memory on device to avoid going onto CPU and needing
+  // to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, 3 * sizeof(T));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T), hipMemcpyHostToDevice);
+
+  // the workspace serves the diagonal blocks of trtri first, then the block
+  // columns of L
+  const rocblas_int ldw = n;
+  T *W;
+  hipMalloc(&W, sizeof(T) * max(roclapack_trtri_worksize(n),
+                                ldw * GETRI_BLOCKSIZE));
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  T *one = &inpsResGPU[GETRI_INPONE];
+  T *minone = &inpsResGPU[GETRI_INPMINONE];
+
+  const rocblas_int blocksRows = (n - 1) / GETRI_ROWS_BLOCKSIZE + 1;
+  dim3 gridRows(blocksRows, 1, 1);
+  dim3 threads(GETRI_ROWS_BLOCKSIZE, 1, 1);
+
+  // a zero on the diagonal of U means A is singular
+  hipLaunchKernelGGL(getri_check_singularity<T>, gridRows, threads, 0, stream,
+                     n, A, lda, inpsResGPU);
+
+  // form inv(U)
+  roclapack_trtri_async_template<T>(handle, rocblas_fill_upper,
+                                    rocblas_diagonal_non_unit, n, A, lda, W,
+                                    one, minone);
+
+  // solve the equation inv(A)*L = inv(U) for inv(A)
+  const rocblas_int nn = ((n - 1) / GETRI_BLOCKSIZE) * GETRI_BLOCKSIZE;
+  for (rocblas_int j = nn; j >= 0; j -= GETRI_BLOCKSIZE) {
+    const rocblas_int jb = min(GETRI_BLOCKSIZE, n - j);
+
+    // copy current block column of L to W and replace with zeros; W is used
+    // with the same row offsets as A
+    hipLaunchKernelGGL(getri_take_lower<T>, gridRows, threads, 0, stream, n, j,
+                       jb, A, lda, W, ldw);
+
+    // compute current block column of inv(A)
+    if (j + jb < n) {
+      rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none, n,
+                      jb, n - j - jb, minone, &A[idx2D(0, j + jb, lda)], lda,
+                      &W[j + jb], ldw, one, &A[idx2D(0, j, lda)], lda);
+    }
+    rocblas_trsm<T>(handle, rocblas_side_right, rocblas_fill_lower,
+                    rocblas_operation_none, rocblas_diagonal_unit, n, jb, one,
+                    &W[j], ldw, &A[idx2D(0, j, lda)], lda);
+  }
+
+  // apply column interchanges
+  hipLaunchKernelGGL(getri_swap_columns<T>, gridRows, threads, 0, stream, n, A,
+                     lda, ipiv);
+
+  // let's see if we encountered any singularity
+  hipMemcpy(&inpsResHost[GETRI_RESSING], &inpsResGPU[GETRI_RESSING], sizeof(T),
+            hipMemcpyDeviceToHost);
+  hipFree(W);
+  hipFree(inpsResGPU);
+
+  if (inpsResHost[GETRI_RESSING] <= 0.0) {
+    const size_t elem = static_cast<size_t>(fabs(inpsResHost[GETRI_RESSING]));
+    cerr << "ERROR: Input matrix has singularity/-ies. Last "
+            "occurrence of this in element "
+         << elem << endl;
+    return rocblas_status_internal_error;
+  }
+
+  return rocblas_status_success;
+}
+
+#undef GETRI_INPONE
+#undef GETRI_INPMINONE
+#undef GETRI_RESSING
+
+#endif /* ROCLAPACK_GETRI_HPP */
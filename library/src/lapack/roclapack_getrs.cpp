@@ -29,3 +29,59 @@ rocsolver_dgetrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
   return rocsolver_getrs_template<double>(handle, trans, n, nrhs, A, lda, ipiv,
                                           B, ldb);
 }
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_cgetrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                 rocblas_int nrhs, const rocblas_float_complex *A,
+                 rocblas_int lda, const rocblas_int *ipiv,
+                 rocblas_float_complex *B, rocblas_int ldb) {
+  return rocsolver_getrs_template<rocblas_float_complex>(
+      handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_zgetrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+                 rocblas_int nrhs, const rocblas_double_complex *A,
+                 rocblas_int lda, const rocblas_int *ipiv,
+                 rocblas_double_complex *B, rocblas_int ldb) {
+  return rocsolver_getrs_template<rocblas_double_complex>(
+      handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_getrs_invdiag_size(rocblas_int n, rocblas_int *size) {
+  if (n < 0)
+    return rocblas_status_invalid_size;
+  if (!size)
+    return rocblas_status_invalid_pointer;
+  *size = (n == 0) ? 0 : getrs_invdiag_size(n);
+  return rocblas_status_success;
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgetrs_invdiag(rocblas_handle handle, rocblas_int n, const float *A,
+                         rocblas_int lda, float *invD) {
+  return rocsolver_getrs_invdiag_template<float>(handle, n, A, lda, invD);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgetrs_invdiag(rocblas_handle handle, rocblas_int n, const double *A,
+                         rocblas_int lda, double *invD) {
+  return rocsolver_getrs_invdiag_template<double>(handle, n, A, lda, invD);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_with_invdiag(
+    rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+    rocblas_int nrhs, const float *A, rocblas_int lda, const rocblas_int *ipiv,
+    const float *invD, float *B, rocblas_int ldb) {
+  return rocsolver_getrs_template<float>(handle, trans, n, nrhs, A, lda, ipiv,
+                                         B, ldb, invD);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_with_invdiag(
+    rocblas_handle handle, rocblas_operation trans, rocblas_int n,
+    rocblas_int nrhs, const double *A, rocblas_int lda, const rocblas_int *ipiv,
+    const double *invD, double *B, rocblas_int ldb) {
+  return rocsolver_getrs_template<double>(handle, trans, n, nrhs, A, lda, ipiv,
+                                          B, ldb, invD);
+}
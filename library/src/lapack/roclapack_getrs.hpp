@@ -13,46 +13,354 @@
 #include <hip/hip_runtime.h>
 #include <rocblas.hpp>
 
+#include "helpers.h"
 #include "ideal_sizes.hpp"
 #include "roclapack_laswp.hpp"
 
+// only the constant one is needed unless the inverted diagonal blocks are
+// used
 #define GETRS_INPONE 0
+#define GETRS_INPMINONE 1
+#define GETRS_INPZERO 2
 
+/*
+ * Solve for a few right hand sides in a single workgroup: the interchanges
+ * are applied to B in place and both triangular solves follow without
+ * another launch. Every column of the factors is read once for all the right
+ * hand sides; the non-transposed solves update the trailing rows with the
+ * newly found unknown (column access of A), the transposed ones compute the
+ * next unknown as a reduction over the rows already solved, conjugating the
+ * factors for rocblas_operation_conjugate_transpose.
+ */
 template <typename T>
-rocblas_status
-rocsolver_getrs_template(rocblas_handle handle, rocblas_operation trans,
-                         rocblas_int n, rocblas_int nrhs, const T *A,
-                         rocblas_int lda, const rocblas_int *ipiv, T *B,
-                         rocblas_int ldb) {
+__global__ void getrs_fused_kernel(rocblas_operation trans, rocblas_int n,
+                                   rocblas_int nrhs, const T *A,
+                                   rocblas_int lda, const rocblas_int *ipiv,
+                                   T *B, rocblas_int ldb) {
 
-  // TODO remove const_cast here once rocBLAS is released with the correct API
+  const int tid = hipThreadIdx_x;
+  const int nthreads = hipBlockDim_x;
 
-  // check for possible input problems
-  if (n < 0 || nrhs < 0 || lda < max(1, n) || ldb < max(1, n)) {
-    cout << "Invalid size " << n << " " << nrhs << " " << lda << " " << ldb
-         << endl;
-    return rocblas_status_invalid_size;
+  __shared__ T sx[GETRS_FUSED_MAXRHS];
+  __shared__ T ssum[GETRS_FUSED_MAXRHS][GETRS_FUSED_BLOCKSIZE];
+
+  if (trans == rocblas_operation_none) {
+
+    // apply row interchanges to the right hand sides, one thread per column
+    if (tid < nrhs) {
+      T *b = B + tid * ldb;
+      for (rocblas_int i = 0; i < n; ++i) {
+        const rocblas_int p = ipiv[i] - 1;
+        if (p != i) {
+          const T orig = b[i];
+          b[i] = b[p];
+          b[p] = orig;
+        }
+      }
+    }
+    __syncthreads();
+
+    // solve L*X = B, overwriting B with X
+    for (rocblas_int j = 0; j < n - 1; ++j) {
+      if (tid < nrhs)
+        sx[tid] = B[j + tid * ldb];
+      __syncthreads();
+
+      for (rocblas_int i = j + 1 + tid; i < n; i += nthreads) {
+        const T a = A[i + j * lda];
+        for (rocblas_int r = 0; r < nrhs; ++r)
+          B[i + r * ldb] -= scalar_mul(a, sx[r]);
+      }
+      __syncthreads();
+    }
+
+    // solve U*X = B, overwriting B with X
+    for (rocblas_int j = n - 1; j >= 0; --j) {
+      if (tid < nrhs) {
+        B[j + tid * ldb] = scalar_div(B[j + tid * ldb], A[j + j * lda]);
+        sx[tid] = B[j + tid * ldb];
+      }
+      __syncthreads();
+
+      for (rocblas_int i = tid; i < j; i += nthreads) {
+        const T a = A[i + j * lda];
+        for (rocblas_int r = 0; r < nrhs; ++r)
+          B[i + r * ldb] -= scalar_mul(a, sx[r]);
+      }
+      __syncthreads();
+    }
+  } else {
+
+    const bool conj = (trans == rocblas_operation_conjugate_transpose);
+
+    // solve U**T*X = B (U**H*X = B), overwriting B with X
+    for (rocblas_int j = 0; j < n; ++j) {
+      T s[GETRS_FUSED_MAXRHS];
+      for (rocblas_int r = 0; r < nrhs; ++r)
+        s[r] = scalar_const<T>(0);
+      for (rocblas_int i = tid; i < j; i += nthreads) {
+        const T a = conj ? scalar_conj(A[i + j * lda]) : A[i + j * lda];
+        for (rocblas_int r = 0; r < nrhs; ++r)
+          s[r] += scalar_mul(a, B[i + r * ldb]);
+      }
+      for (rocblas_int r = 0; r < nrhs; ++r)
+        ssum[r][tid] = s[r];
+      __syncthreads();
+      for (int st = nthreads / 2; st > 0; st >>= 1) {
+        if (tid < st)
+          for (rocblas_int r = 0; r < nrhs; ++r)
+            ssum[r][tid] += ssum[r][tid + st];
+        __syncthreads();
+      }
+
+      if (tid < nrhs)
+        B[j + tid * ldb] =
+            scalar_div(B[j + tid * ldb] - ssum[tid][0],
+                       conj ? scalar_conj(A[j + j * lda]) : A[j + j * lda]);
+      __syncthreads();
+    }
+
+    // solve L**T*X = B (L**H*X = B), overwriting B with X
+    for (rocblas_int j = n - 2; j >= 0; --j) {
+      T s[GETRS_FUSED_MAXRHS];
+      for (rocblas_int r = 0; r < nrhs; ++r)
+        s[r] = scalar_const<T>(0);
+      for (rocblas_int i = j + 1 + tid; i < n; i += nthreads) {
+        const T a = conj ? scalar_conj(A[i + j * lda]) : A[i + j * lda];
+        for (rocblas_int r = 0; r < nrhs; ++r)
+          s[r] += scalar_mul(a, B[i + r * ldb]);
+      }
+      for (rocblas_int r = 0; r < nrhs; ++r)
+        ssum[r][tid] = s[r];
+      __syncthreads();
+      for (int st = nthreads / 2; st > 0; st >>= 1) {
+        if (tid < st)
+          for (rocblas_int r = 0; r < nrhs; ++r)
+            ssum[r][tid] += ssum[r][tid + st];
+        __syncthreads();
+      }
+
+      if (tid < nrhs)
+        B[j + tid * ldb] -= ssum[tid][0];
+      __syncthreads();
+    }
+
+    // apply row interchanges to the solution vectors, in reverse order
+    if (tid < nrhs) {
+      T *b = B + tid * ldb;
+      for (rocblas_int i = n - 1; i >= 0; --i) {
+        const rocblas_int p = ipiv[i] - 1;
+        if (p != i) {
+          const T orig = b[i];
+          b[i] = b[p];
+          b[p] = orig;
+        }
+      }
+    }
   }
+}
 
-  // quick return
-  if (n == 0 || nrhs == 0) {
+/*
+ * After a batched trtri, make every GETRS_INVDIAG_BLOCKSIZE block of invD a
+ * plain square matrix for gemm: zero the other triangle and the padding of
+ * the last block, and put explicit ones on a unit diagonal. One workgroup per
+ * block, one thread per column.
+ */
+template <typename T>
+__global__ void getrs_invdiag_clean(rocblas_fill uplo, rocblas_diagonal diag,
+                                    rocblas_int n, T *invD) {
+
+  const rocblas_int b = hipBlockIdx_x;
+  const rocblas_int c = hipThreadIdx_x;
+  const rocblas_int nb = GETRS_INVDIAG_BLOCKSIZE;
+  const rocblas_int jb = min(nb, n - b * nb);
+  T *w = invD + b * nb * nb;
+
+  for (rocblas_int r = 0; r < nb; ++r) {
+    if (r >= jb || c >= jb ||
+        (uplo == rocblas_fill_upper ? r > c : r < c))
+      w[r + c * nb] = scalar_const<T>(0);
+    else if (r == c && diag == rocblas_diagonal_unit)
+      w[r + c * nb] = scalar_const<T>(1);
+  }
+}
+
+// number of elements of the inverted diagonal blocks of L and U
+inline rocblas_int getrs_invdiag_size(rocblas_int n) {
+  const rocblas_int nb = GETRS_INVDIAG_BLOCKSIZE;
+  return 2 * ((n - 1) / nb + 1) * nb * nb;
+}
+
+/*
+ * Invert the GETRS_INVDIAG_BLOCKSIZE diagonal blocks of L and of U of the
+ * getrf factors in A once, so that later solves need no trsm (see
+ * getrs_invdiag_solve). invD holds the blocks of L followed by those of U.
+ */
+template <typename T>
+rocblas_status rocsolver_getrs_invdiag_template(rocblas_handle handle,
+                                                rocblas_int n, const T *A,
+                                                rocblas_int lda, T *invD) {
+
+  if (n < 0 || lda < max(1, n)) {
+    return rocblas_status_invalid_size;
+  } else if (n == 0) {
     return rocblas_status_success;
   }
 
-  T inpsResHost[2];
-  inpsResHost[GETRS_INPONE] = static_cast<T>(1);
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const rocblas_int nb = GETRS_INVDIAG_BLOCKSIZE;
+  const rocblas_int nfull = n / nb;
+  const rocblas_int rem = n - nfull * nb;
+  const rocblas_int nblocks = (n - 1) / nb + 1;
+  T *Ad = const_cast<T *>(A);
+
+  for (int f = 0; f < 2; ++f) {
+    const rocblas_fill uplo = f ? rocblas_fill_upper : rocblas_fill_lower;
+    const rocblas_diagonal diag =
+        f ? rocblas_diagonal_non_unit : rocblas_diagonal_unit;
+    T *w = invD + f * nblocks * nb * nb;
+
+    if (nfull > 0)
+      rocblas_trtri_batched<T>(handle, uplo, diag, nb, Ad, lda, nb * (lda + 1),
+                               w, nb, nb * nb, nfull);
+    if (rem > 0)
+      rocblas_trtri<T>(handle, uplo, diag, rem,
+                       &Ad[(n - rem) + (n - rem) * lda], lda,
+                       w + nfull * nb * nb, nb);
+
+    hipLaunchKernelGGL(getrs_invdiag_clean<T>, dim3(nblocks), dim3(nb), 0,
+                       stream, uplo, diag, n, w);
+  }
+
+  return rocblas_status_success;
+}
+
+/*
+ * Block forward and backward substitution with the inverted diagonal blocks
+ * from rocsolver_getrs_invdiag_template: per block row one gemm with the
+ * inverted block and one gemm updating the remaining rows, so trsm is never
+ * called. The first solve reads B and writes the n x nrhs workspace X, the
+ * second one reads X and writes B back.
+ */
+template <typename T>
+void getrs_invdiag_solve(rocblas_handle handle, rocblas_operation trans,
+                         rocblas_int n, rocblas_int nrhs, const T *A,
+                         rocblas_int lda, const T *invD, T *B, rocblas_int ldb,
+                         T *X, T *inpsResGPU) {
+
+  const rocblas_int nb = GETRS_INVDIAG_BLOCKSIZE;
+  const rocblas_int nblocks = (n - 1) / nb + 1;
+  const T *invL = invD;
+  const T *invU = invD + nblocks * nb * nb;
+  const rocblas_int ldx = n;
+
+  const T *one = &inpsResGPU[GETRS_INPONE];
+  const T *minone = &inpsResGPU[GETRS_INPMINONE];
+  const T *zero = &inpsResGPU[GETRS_INPZERO];
+
+  const rocblas_operation none = rocblas_operation_none;
+
+  if (trans == rocblas_operation_none) {
+
+    // solve L*Y = B, Y goes to X
+    for (rocblas_int k = 0; k < nblocks; ++k) {
+      const rocblas_int k0 = k * nb;
+      const rocblas_int kb = min(nb, n - k0);
+      rocblas_gemm<T>(handle, none, none, kb, nrhs, kb, one, invL + k * nb * nb,
+                      nb, B + k0, ldb, zero, X + k0, ldx);
+      if (k0 + kb < n)
+        rocblas_gemm<T>(handle, none, none, n - k0 - kb, nrhs, kb, minone,
+                        A + (k0 + kb) + k0 * lda, lda, X + k0, ldx, one,
+                        B + k0 + kb, ldb);
+    }
+
+    // solve U*X = Y, X goes to B
+    for (rocblas_int k = nblocks - 1; k >= 0; --k) {
+      const rocblas_int k0 = k * nb;
+      const rocblas_int kb = min(nb, n - k0);
+      rocblas_gemm<T>(handle, none, none, kb, nrhs, kb, one, invU + k * nb * nb,
+                      nb, X + k0, ldx, zero, B + k0, ldb);
+      if (k0 > 0)
+        rocblas_gemm<T>(handle, none, none, k0, nrhs, kb, minone, A + k0 * lda,
+                        lda, B + k0, ldb, one, X, ldx);
+    }
+  } else {
+
+    // solve U**T*Y = B, Y goes to X
+    for (rocblas_int k = 0; k < nblocks; ++k) {
+      const rocblas_int k0 = k * nb;
+      const rocblas_int kb = min(nb, n - k0);
+      rocblas_gemm<T>(handle, trans, none, kb, nrhs, kb, one,
+                      invU + k * nb * nb, nb, B + k0, ldb, zero, X + k0, ldx);
+      if (k0 + kb < n)
+        rocblas_gemm<T>(handle, trans, none, n - k0 - kb, nrhs, kb, minone,
+                        A + k0 + (k0 + kb) * lda, lda, X + k0, ldx, one,
+                        B + k0 + kb, ldb);
+    }
+
+    // solve L**T*X = Y, X goes to B
+    for (rocblas_int k = nblocks - 1; k >= 0; --k) {
+      const rocblas_int k0 = k * nb;
+      const rocblas_int kb = min(nb, n - k0);
+      rocblas_gemm<T>(handle, trans, none, kb, nrhs, kb, one,
+                      invL + k * nb * nb, nb, X + k0, ldx, zero, B + k0, ldb);
+      if (k0 > 0)
+        rocblas_gemm<T>(handle, trans, none, k0, nrhs, kb, minone, A + k0, lda,
+                        B + k0, ldb, one, X, ldx);
+    }
+  }
+}
+
+// few right hand sides are solved by getrs_fused_kernel in one launch
+inline bool getrs_use_fused(rocblas_int n, rocblas_int nrhs) {
+  return nrhs <= GETRS_FUSED_MAXRHS && n <= GETRS_FUSED_SWITCHSIZE;
+}
+
+/*
+ * Enqueue the solve with the LU factors of getrf without any host
+ * synchronization. inpsResGPU holds the constants as laid out by the GETRS_*
+ * indices above; it is not used by the fused kernel. If invD is given, the
+ * triangular solves use the inverted diagonal blocks and the n x nrhs
+ * workspace X instead of trsm.
+ */
+template <typename T>
+void rocsolver_getrs_async_template(rocblas_handle handle,
+                                    rocblas_operation trans, rocblas_int n,
+                                    rocblas_int nrhs, const T *A,
+                                    rocblas_int lda, const rocblas_int *ipiv,
+                                    T *B, rocblas_int ldb, T *inpsResGPU,
+                                    const T *invD = nullptr, T *X = nullptr) {
+
+  // TODO remove const_cast here once rocBLAS is released with the correct API
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
 
-  // allocate a tiny bit of memory on device to avoid going onto CPU and needing
-  // to synchronize.
-  T *inpsResGPU;
-  hipMalloc(&inpsResGPU, sizeof(T));
-  hipMemcpy(inpsResGPU, &inpsResHost[0], sizeof(T), hipMemcpyHostToDevice);
+  // few right hand sides: everything in one launch
+  if (getrs_use_fused(n, nrhs)) {
+    hipLaunchKernelGGL(getrs_fused_kernel<T>, dim3(1),
+                       dim3(GETRS_FUSED_BLOCKSIZE), 0, stream, trans, n, nrhs,
+                       A, lda, ipiv, B, ldb);
+    return;
+  }
+
+  if (invD) {
+    if (trans == rocblas_operation_none)
+      roclapack_laswp_device_template<T>(handle, nrhs, B, ldb, 0, n, ipiv, 1);
+    getrs_invdiag_solve<T>(handle, trans, n, nrhs, A, lda, invD, B, ldb, X,
+                           inpsResGPU);
+    if (trans != rocblas_operation_none)
+      roclapack_laswp_device_template<T>(handle, nrhs, B, ldb, 0, n, ipiv, -1);
+    return;
+  }
 
   if (trans == rocblas_operation_none) {
 
     // solve A * X = B
     // first apply row interchanges to the right hand sides
-    roclapack_laswp_template<T>(handle, nrhs, B, ldb, 1, n, ipiv, 1);
+    roclapack_laswp_device_template<T>(handle, nrhs, B, ldb, 0, n, ipiv, 1);
 
     // solve L*X - B, overwriting B with X
     rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower,
@@ -77,14 +385,61 @@ rocsolver_getrs_template(rocblas_handle handle, rocblas_operation trans,
                     const_cast<T *>(A), lda, B, ldb);
 
     // apply row interchanges to the solution vectors
-    roclapack_laswp_template<T>(handle, nrhs, B, ldb, 1, n, ipiv, -1);
+    roclapack_laswp_device_template<T>(handle, nrhs, B, ldb, 0, n, ipiv, -1);
   }
+}
+
+template <typename T>
+rocblas_status
+rocsolver_getrs_template(rocblas_handle handle, rocblas_operation trans,
+                         rocblas_int n, rocblas_int nrhs, const T *A,
+                         rocblas_int lda, const rocblas_int *ipiv, T *B,
+                         rocblas_int ldb, const T *invD = nullptr) {
+
+  // check for possible input problems
+  if (n < 0 || nrhs < 0 || lda < max(1, n) || ldb < max(1, n)) {
+    cout << "Invalid size " << n << " " << nrhs << " " << lda << " " << ldb
+         << endl;
+    return rocblas_status_invalid_size;
+  }
+
+  // quick return
+  if (n == 0 || nrhs == 0) {
+    return rocblas_status_success;
+  }
+
+  // the fused kernel needs no constants, so spare the allocation and copy
+  T *inpsResGPU = nullptr;
+  T *X = nullptr;
+  if (!getrs_use_fused(n, nrhs)) {
+    T inpsResHost[3];
+    inpsResHost[GETRS_INPONE] = scalar_const<T>(1);
+    inpsResHost[GETRS_INPMINONE] = scalar_const<T>(-1);
+    inpsResHost[GETRS_INPZERO] = scalar_const<T>(0);
+
+    // allocate a tiny bit of memory on device to avoid going onto CPU and
+    // needing to synchronize.
+    hipMalloc(&inpsResGPU, 3 * sizeof(T));
+    hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T),
+              hipMemcpyHostToDevice);
+
+    if (invD)
+      hipMalloc(&X, sizeof(T) * n * nrhs);
+  }
+
+  rocsolver_getrs_async_template<T>(handle, trans, n, nrhs, A, lda, ipiv, B,
+                                    ldb, inpsResGPU, invD, X);
 
-  hipFree(inpsResGPU);
+  if (X)
+    hipFree(X);
+  if (inpsResGPU)
+    hipFree(inpsResGPU);
 
   return rocblas_status_success;
 }
 
 #undef GETRS_INPONE
+#undef GETRS_INPMINONE
+#undef GETRS_INPZERO
 
 #endif /* ROCLAPACK_GETRS_HPP */
@@ -0,0 +1,45 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gtsv.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sgtsv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs,
+                const float *dl, const float *d, const float *du, float *B,
+                rocblas_int ldb, rocblas_int *info) {
+  return rocsolver_gtsv_template<float>(handle, n, nrhs, dl, d, du, 0, B, ldb,
+                                        0, info, 1);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dgtsv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs,
+                const double *dl, const double *d, const double *du, double *B,
+                rocblas_int ldb, rocblas_int *info) {
+  return rocsolver_gtsv_template<double>(handle, n, nrhs, dl, d, du, 0, B,
+                                         ldb, 0, info, 1);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_sgtsv_strided_batched(
+    rocblas_handle handle, rocblas_int n, rocblas_int nrhs, const float *dl,
+    const float *d, const float *du, rocblas_int strideD, float *B,
+    rocblas_int ldb, rocblas_int strideB, rocblas_int *info,
+    rocblas_int batch_count) {
+  return rocsolver_gtsv_template<float>(handle, n, nrhs, dl, d, du, strideD, B,
+                                        ldb, strideB, info, batch_count);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_dgtsv_strided_batched(
+    rocblas_handle handle, rocblas_int n, rocblas_int nrhs, const double *dl,
+    const double *d, const double *du, rocblas_int strideD, double *B,
+    rocblas_int ldb, rocblas_int strideB, rocblas_int *info,
+    rocblas_int batch_count) {
+  return rocsolver_gtsv_template<double>(handle, n, nrhs, dl, d, du, strideD,
+                                         B, ldb, strideB, info, batch_count);
+}
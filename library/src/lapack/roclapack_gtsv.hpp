@@ -0,0 +1,367 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_GTSV_HPP
+#define ROCLAPACK_GTSV_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+/*
+ * The tridiagonal system of order n has subdiagonal dl (n - 1),
+ * diagonal d (n) and superdiagonal du (n - 1); no pivoting is done, so the
+ * matrix should be diagonally dominant or otherwise safe for Gaussian
+ * elimination without interchanges. A zero pivot is reported in info as
+ * the (1-based) row it was met in; systems of the partitioned algorithm
+ * are solved at several levels, and rowstride maps the row i of a level to
+ * the row (i + 1) * rowstride of the original system.
+ */
+
+// info := row if no zero pivot was reported yet
+__device__ inline void gtsv_zero_pivot(rocblas_int *info, rocblas_int row) {
+  atomicCAS(info, 0, row);
+}
+
+/*
+ * Cyclic reduction in LDS, one workgroup per system and right hand side
+ * (the right hand side in hipBlockIdx_y). The reduction at stride s
+ * eliminates rows i - s and i + s from the rows i = 2s-1, 4s-1, ..., each
+ * of which then couples x(i - 2s), x(i) and x(i + 2s); once a single row
+ * is left it is solved, and the rows dropped at every stride are solved in
+ * turn from the neighbours already known. The reductions of a stride touch
+ * disjoint rows, so each takes one pass of the workgroup.
+ */
+template <typename T>
+__global__ void gtsv_small(rocblas_int n, const T *DL, const T *D,
+                           const T *DU, rocblas_int strideD, T *BB,
+                           rocblas_int ldb, rocblas_int strideB,
+                           rocblas_int *info, rocblas_int rowstride) {
+  __shared__ T sa[GTSV_MAX_SIZE];
+  __shared__ T sb[GTSV_MAX_SIZE];
+  __shared__ T sc[GTSV_MAX_SIZE];
+  __shared__ T sd[GTSV_MAX_SIZE];
+  __shared__ rocblas_int szero;
+
+  const int tid = hipThreadIdx_x;
+  const int nt = hipBlockDim_x;
+  const rocblas_int b = hipBlockIdx_x;
+  const T *dl = DL + size_t(b) * strideD;
+  const T *d = D + size_t(b) * strideD;
+  const T *du = DU + size_t(b) * strideD;
+  T *B = BB + size_t(b) * strideB + size_t(hipBlockIdx_y) * ldb;
+
+  for (rocblas_int i = tid; i < n; i += nt) {
+    sa[i] = (i > 0) ? dl[i - 1] : 0;
+    sb[i] = d[i];
+    sc[i] = (i < n - 1) ? du[i] : 0;
+    sd[i] = B[i];
+  }
+  if (tid == 0)
+    szero = n;
+  __syncthreads();
+
+  // forward reduction
+  rocblas_int s = 1;
+  for (; 2 * s - 1 < n; s *= 2) {
+    for (rocblas_int i = 2 * s - 1 + tid * 2 * s; i < n; i += nt * 2 * s) {
+      if (sb[i - s] == 0)
+        atomicMin(&szero, i - s);
+      const T k1 = sa[i] / sb[i - s];
+      T bi = sb[i] - sc[i - s] * k1;
+      T di = sd[i] - sd[i - s] * k1;
+      sa[i] = -sa[i - s] * k1;
+      if (i + s < n) {
+        if (sb[i + s] == 0)
+          atomicMin(&szero, i + s);
+        const T k2 = sc[i] / sb[i + s];
+        bi -= sa[i + s] * k2;
+        di -= sd[i + s] * k2;
+        sc[i] = -sc[i + s] * k2;
+      } else {
+        sc[i] = 0;
+      }
+      sb[i] = bi;
+      sd[i] = di;
+    }
+    __syncthreads();
+  }
+
+  // back substitution, x into sd
+  if (tid == 0) {
+    if (sb[s - 1] == 0)
+      atomicMin(&szero, s - 1);
+    sd[s - 1] /= sb[s - 1];
+  }
+  __syncthreads();
+  for (rocblas_int h = s / 2; h >= 1; h /= 2) {
+    for (rocblas_int i = h - 1 + tid * 2 * h; i < n; i += nt * 2 * h) {
+      T x = sd[i];
+      if (i >= h)
+        x -= sa[i] * sd[i - h];
+      if (i + h < n)
+        x -= sc[i] * sd[i + h];
+      if (sb[i] == 0)
+        atomicMin(&szero, i);
+      sd[i] = x / sb[i];
+    }
+    __syncthreads();
+  }
+
+  for (rocblas_int i = tid; i < n; i += nt)
+    B[i] = sd[i];
+  if (tid == 0 && szero < n)
+    gtsv_zero_pivot(info + b, (szero + 1) * rowstride);
+}
+
+/*
+ * The partitioned algorithm for larger systems. The rows are cut into
+ * blocks of GTSV_PARTITION_ROWS; the last row of every block but the last
+ * one is a separator, and the other rows of a block (its interior) couple
+ * only to the separators on either side. One thread per block solves its
+ * interior by the Thomas algorithm for the right hand sides (into B), the
+ * left spike V (the coupling to the left separator moved to the right hand
+ * side) and the right spike W, so that x = B - V * x(left) - W * x(right)
+ * there. Substituting this into the separator rows gives a tridiagonal
+ * system of the separators, solved in turn; G keeps the Thomas
+ * multipliers.
+ */
+template <typename T>
+__global__ void gtsv_spikes(rocblas_int n, rocblas_int nrhs, const T *DL,
+                            const T *D, const T *DU, rocblas_int strideD,
+                            T *BB, rocblas_int ldb, rocblas_int strideB,
+                            T *VV, T *WW, T *GG, rocblas_int *info,
+                            rocblas_int rowstride, rocblas_int batch_count) {
+  const rocblas_int m = GTSV_PARTITION_ROWS;
+  const rocblas_int p = (n - 1) / m + 1;
+  const size_t gid = size_t(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
+  if (gid >= size_t(p) * batch_count)
+    return;
+  const rocblas_int k = gid % p;
+  const rocblas_int b = gid / p;
+  const T *dl = DL + size_t(b) * strideD;
+  const T *d = D + size_t(b) * strideD;
+  const T *du = DU + size_t(b) * strideD;
+  T *B = BB + size_t(b) * strideB;
+  T *V = VV + size_t(b) * n;
+  T *W = WW + size_t(b) * n;
+  T *G = GG + size_t(b) * n;
+
+  // the interior rows lo:e+1
+  const rocblas_int lo = k * m;
+  const rocblas_int e = (k < p - 1) ? lo + m - 2 : n - 1;
+
+  bool zero = false;
+  for (rocblas_int r = lo; r <= e; ++r) {
+    const T a = (r > lo) ? dl[r - 1] : 0;
+    const T g = (r > lo) ? G[r - 1] : 0;
+    const T beta = d[r] - a * g;
+    if (beta == 0 && !zero) {
+      gtsv_zero_pivot(info + b, (r + 1) * rowstride);
+      zero = true;
+    }
+    G[r] = (r < e) ? du[r] / beta : 0;
+    const T v = (r == lo && lo > 0) ? dl[lo - 1] : 0;
+    const T w = (r == e && e < n - 1) ? du[e] : 0;
+    V[r] = (v - ((r > lo) ? a * V[r - 1] : 0)) / beta;
+    W[r] = (w - ((r > lo) ? a * W[r - 1] : 0)) / beta;
+    for (rocblas_int j = 0; j < nrhs; ++j) {
+      T y = B[idx2D(r, j, ldb)];
+      if (r > lo)
+        y -= a * B[idx2D(r - 1, j, ldb)];
+      B[idx2D(r, j, ldb)] = y / beta;
+    }
+  }
+  for (rocblas_int r = e - 1; r >= lo; --r) {
+    V[r] -= G[r] * V[r + 1];
+    W[r] -= G[r] * W[r + 1];
+    for (rocblas_int j = 0; j < nrhs; ++j)
+      B[idx2D(r, j, ldb)] -= G[r] * B[idx2D(r + 1, j, ldb)];
+  }
+}
+
+// the system of the q separators, one thread per separator: row k couples
+// separators k-1, k, k+1 with coefficients RL, RD, RU, right hand sides RB
+// (ld q); RL(0) and RU(q-1) are zero
+template <typename T>
+__global__ void gtsv_reduce(rocblas_int n, rocblas_int nrhs, const T *DL,
+                            const T *D, const T *DU, rocblas_int strideD,
+                            const T *BB, rocblas_int ldb, rocblas_int strideB,
+                            const T *VV, const T *WW, T *RL, T *RD, T *RU,
+                            T *RB, rocblas_int batch_count) {
+  const rocblas_int m = GTSV_PARTITION_ROWS;
+  const rocblas_int q = (n - 1) / m;
+  const size_t gid = size_t(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
+  if (gid >= size_t(q) * batch_count)
+    return;
+  const rocblas_int k = gid % q;
+  const rocblas_int b = gid / q;
+  const T *B = BB + size_t(b) * strideB;
+  const T *V = VV + size_t(b) * n;
+  const T *W = WW + size_t(b) * n;
+  const size_t o = size_t(b) * q;
+
+  const rocblas_int s = (k + 1) * m - 1;
+  const T a = DL[size_t(b) * strideD + s - 1];
+  const T c = DU[size_t(b) * strideD + s];
+  RL[o + k] = -a * V[s - 1];
+  RD[o + k] = D[size_t(b) * strideD + s] - a * W[s - 1] - c * V[s + 1];
+  RU[o + k] = -c * W[s + 1];
+  for (rocblas_int j = 0; j < nrhs; ++j)
+    RB[o * nrhs + idx2D(k, j, q)] = B[idx2D(s, j, ldb)] -
+                                    a * B[idx2D(s - 1, j, ldb)] -
+                                    c * B[idx2D(s + 1, j, ldb)];
+}
+
+// x from the separators: x = B - V * x(left) - W * x(right) in the
+// interiors, one thread per row
+template <typename T>
+__global__ void gtsv_backsub(rocblas_int n, rocblas_int nrhs, T *BB,
+                             rocblas_int ldb, rocblas_int strideB,
+                             const T *VV, const T *WW, const T *RB,
+                             rocblas_int batch_count) {
+  const rocblas_int m = GTSV_PARTITION_ROWS;
+  const rocblas_int q = (n - 1) / m;
+  const size_t gid = size_t(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
+  if (gid >= size_t(n) * batch_count)
+    return;
+  const rocblas_int r = gid % n;
+  const rocblas_int b = gid / n;
+  const rocblas_int k = r / m;
+  T *B = BB + size_t(b) * strideB;
+  const T *X = RB + size_t(b) * q * nrhs;
+
+  if (k < q && r == (k + 1) * m - 1) {
+    for (rocblas_int j = 0; j < nrhs; ++j)
+      B[idx2D(r, j, ldb)] = X[idx2D(k, j, q)];
+  } else {
+    const T v = VV[size_t(b) * n + r];
+    const T w = WW[size_t(b) * n + r];
+    for (rocblas_int j = 0; j < nrhs; ++j) {
+      T x = B[idx2D(r, j, ldb)];
+      if (k > 0)
+        x -= v * X[idx2D(k - 1, j, q)];
+      if (k < q)
+        x -= w * X[idx2D(k, j, q)];
+      B[idx2D(r, j, ldb)] = x;
+    }
+  }
+}
+
+// elements of the workspace of the partitioned algorithm, all its levels
+inline size_t gtsv_work_size(rocblas_int n, rocblas_int nrhs,
+                             rocblas_int batch_count) {
+  if (n <= GTSV_MAX_SIZE)
+    return 0;
+  const rocblas_int q = (n - 1) / GTSV_PARTITION_ROWS;
+  return (3 * size_t(n) + size_t(q) * (3 + nrhs)) * batch_count +
+         gtsv_work_size(q, nrhs, batch_count);
+}
+
+// enqueue the solve of the batch, through the partitioned algorithm (and
+// the system of its separators) if n > GTSV_MAX_SIZE; work has
+// gtsv_work_size(n, nrhs, batch_count) elements
+template <typename T>
+void rocsolver_gtsv_async_template(rocblas_handle handle, rocblas_int n,
+                                   rocblas_int nrhs, const T *dl, const T *d,
+                                   const T *du, rocblas_int strideD, T *B,
+                                   rocblas_int ldb, rocblas_int strideB,
+                                   rocblas_int *info, rocblas_int batch_count,
+                                   rocblas_int rowstride, T *work) {
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  if (n <= GTSV_MAX_SIZE) {
+    // a wavefront per 128 rows: the first stride reduces every other row
+    const rocblas_int threads = min(GTSV_BLOCKSIZE, ((n + 127) / 128) * 64);
+    hipLaunchKernelGGL(gtsv_small<T>, dim3(batch_count, nrhs), dim3(threads),
+                       0, stream, n, dl, d, du, strideD, B, ldb, strideB,
+                       info, rowstride);
+    return;
+  }
+
+  const rocblas_int bs = GTSV_BLOCKSIZE;
+  const rocblas_int p = (n - 1) / GTSV_PARTITION_ROWS + 1;
+  const rocblas_int q = p - 1;
+  T *V = work;
+  T *W = V + size_t(n) * batch_count;
+  T *G = W + size_t(n) * batch_count;
+  T *RL = G + size_t(n) * batch_count;
+  T *RD = RL + size_t(q) * batch_count;
+  T *RU = RD + size_t(q) * batch_count;
+  T *RB = RU + size_t(q) * batch_count;
+  T *next = RB + size_t(q) * nrhs * batch_count;
+
+  hipLaunchKernelGGL(gtsv_spikes<T>,
+                     dim3((size_t(p) * batch_count - 1) / bs + 1), dim3(bs),
+                     0, stream, n, nrhs, dl, d, du, strideD, B, ldb, strideB,
+                     V, W, G, info, rowstride, batch_count);
+  hipLaunchKernelGGL(gtsv_reduce<T>,
+                     dim3((size_t(q) * batch_count - 1) / bs + 1), dim3(bs),
+                     0, stream, n, nrhs, dl, d, du, strideD, B, ldb, strideB,
+                     V, W, RL, RD, RU, RB, batch_count);
+
+  // the separators, as a batch of systems of order q with q * nrhs
+  // right hand side elements per system
+  rocsolver_gtsv_async_template<T>(handle, q, nrhs, RL + 1, RD, RU, q, RB, q,
+                                   q * nrhs, info, batch_count,
+                                   rowstride * GTSV_PARTITION_ROWS, next);
+
+  hipLaunchKernelGGL(gtsv_backsub<T>,
+                     dim3((size_t(n) * batch_count - 1) / bs + 1), dim3(bs),
+                     0, stream, n, nrhs, B, ldb, strideB, V, W, RB,
+                     batch_count);
+}
+
+template <typename T>
+rocblas_status
+rocsolver_gtsv_template(rocblas_handle handle, rocblas_int n,
+                        rocblas_int nrhs, const T *dl, const T *d,
+                        const T *du, rocblas_int strideD, T *B,
+                        rocblas_int ldb, rocblas_int strideB,
+                        rocblas_int *info, rocblas_int batch_count) {
+
+  if (n < 0 || nrhs < 0 || batch_count < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (ldb < max(1, n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (batch_count == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  hipMemsetAsync(info, 0, sizeof(rocblas_int) * batch_count, stream);
+  if (n == 0 || nrhs == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  // the workspace of the partitioned algorithm, if any
+  T *work = nullptr;
+  const size_t size = gtsv_work_size(n, nrhs, batch_count);
+  if (size > 0)
+    hipMalloc(&work, sizeof(T) * size);
+
+  rocsolver_gtsv_async_template<T>(handle, n, nrhs, dl, d, du, strideD, B, ldb,
+                                   strideB, info, batch_count, 1, work);
+
+  if (size > 0)
+    hipFree(work);
+
+  return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GTSV_HPP */
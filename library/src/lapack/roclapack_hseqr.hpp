@@ -0,0 +1,1836 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_HSEQR_HPP
+#define ROCLAPACK_HSEQR_HPP
+
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+/*
+ * lanv2: the Schur factorization of the real 2 x 2 matrix [a b; c d] =
+ * [cs -sn; sn cs] * [aa bb; cc dd] * [cs sn; -sn cs], in standard form:
+ * cc = 0 (real eigenvalues), or aa = dd and bb * cc < 0 (complex ones,
+ * aa +- sqrt(bb * cc)). a, b, c and d are overwritten by aa, bb, cc and dd,
+ * and (rt1r, rt1i), (rt2r, rt2i) get the eigenvalues, rt1i >= 0.
+ */
+template <typename T>
+__device__ void hseqr_lanv2(T &a, T &b, T &c, T &d, T &rt1r, T &rt1i,
+                            T &rt2r, T &rt2i, T &cs, T &sn, T eps,
+                            T safmn2) {
+  const T multpl = 4;
+  const T safmx2 = 1 / safmn2;
+
+  if (c == 0) {
+    cs = 1;
+    sn = 0;
+  } else if (b == 0) {
+    // swap rows and columns
+    cs = 0;
+    sn = 1;
+    const T temp = d;
+    d = a;
+    a = temp;
+    b = -c;
+    c = 0;
+  } else if ((a - d) == 0 && copysign(T(1), b) != copysign(T(1), c)) {
+    cs = 1;
+    sn = 0;
+  } else {
+    T temp = a - d;
+    T p = temp / 2;
+    const T bcmax = max(fabs(b), fabs(c));
+    const T bcmis =
+        min(fabs(b), fabs(c)) * copysign(T(1), b) * copysign(T(1), c);
+    T scale = max(fabs(p), bcmax);
+    T z = (p / scale) * p + (bcmax / scale) * bcmis;
+
+    if (z >= multpl * eps) {
+      // real eigenvalues
+      z = p + copysign(sqrt(scale) * sqrt(z), p);
+      a = d + z;
+      d = d - (bcmax / z) * bcmis;
+      const T tau = hypot(c, z);
+      cs = z / tau;
+      sn = c / tau;
+      b = b - c;
+      c = 0;
+    } else {
+      // complex or nearly equal real eigenvalues: equal diagonal entries
+      T sigma = b + c;
+      for (int count = 0; count < 20; ++count) {
+        scale = max(fabs(temp), fabs(sigma));
+        if (scale >= safmx2) {
+          sigma *= safmn2;
+          temp *= safmn2;
+        } else if (scale <= safmn2) {
+          sigma *= safmx2;
+          temp *= safmx2;
+        } else {
+          break;
+        }
+      }
+      p = temp / 2;
+      T tau = hypot(sigma, temp);
+      cs = sqrt((1 + fabs(sigma) / tau) / 2);
+      sn = -(p / (tau * cs)) * copysign(T(1), sigma);
+
+      const T aa = a * cs + b * sn;
+      const T bb = -a * sn + b * cs;
+      const T cc = c * cs + d * sn;
+      const T dd = -c * sn + d * cs;
+      a = aa * cs + cc * sn;
+      b = bb * cs + dd * sn;
+      c = -aa * sn + cc * cs;
+      d = -bb * sn + dd * cs;
+
+      temp = (a + d) / 2;
+      a = temp;
+      d = temp;
+      if (c != 0) {
+        if (b != 0) {
+          if (copysign(T(1), b) == copysign(T(1), c)) {
+            // real eigenvalues after all: upper triangular form
+            const T sab = sqrt(fabs(b));
+            const T sac = sqrt(fabs(c));
+            p = copysign(sab * sac, c);
+            tau = 1 / sqrt(fabs(b + c));
+            a = temp + p;
+            d = temp - p;
+            b = b - c;
+            c = 0;
+            const T cs1 = sab * tau;
+            const T sn1 = sac * tau;
+            temp = cs * cs1 - sn * sn1;
+            sn = cs * sn1 + sn * cs1;
+            cs = temp;
+          }
+        } else {
+          b = -c;
+          c = 0;
+          temp = cs;
+          cs = -sn;
+          sn = temp;
+        }
+      }
+    }
+  }
+
+  rt1r = a;
+  rt2r = d;
+  if (c == 0) {
+    rt1i = 0;
+    rt2i = 0;
+  } else {
+    rt1i = sqrt(fabs(b)) * sqrt(fabs(c));
+    rt2i = -rt1i;
+  }
+}
+
+// the 2-norm of v(1:nr)
+template <typename T> __device__ T hseqr_xnorm(int nr, const T *v) {
+  T xnorm = 0;
+  for (int j = 1; j < nr; ++j)
+    xnorm = hypot(xnorm, v[j]);
+  return xnorm;
+}
+
+// the reflector (I - t1 * v * v**T, v(0) = 1) of order nr taking v(0:nr) to
+// (beta, 0, ..., 0); v(0) gets beta and v(1:nr) the vector. As in LAPACK's
+// larfg, v is scaled up while beta is below safmin, so that 1 / (v(0) -
+// beta) cannot overflow when the entries have become denormal
+template <typename T>
+__device__ void hseqr_larfg(int nr, T *v, T &t1, T safmin) {
+  T xnorm = hseqr_xnorm(nr, v);
+  if (xnorm == 0) {
+    t1 = 0;
+    return;
+  }
+  T beta = -copysign(hypot(v[0], xnorm), v[0]);
+  int knt = 0;
+  if (fabs(beta) < safmin) {
+    const T rsafmn = 1 / safmin;
+    do {
+      ++knt;
+      for (int j = 0; j < nr; ++j)
+        v[j] *= rsafmn;
+      beta *= rsafmn;
+    } while (fabs(beta) < safmin && knt < 20);
+    xnorm = hseqr_xnorm(nr, v);
+    beta = -copysign(hypot(v[0], xnorm), v[0]);
+  }
+  t1 = (beta - v[0]) / beta;
+  const T scal = 1 / (v[0] - beta);
+  for (int j = 1; j < nr; ++j)
+    v[j] *= scal;
+  for (int j = 0; j < knt; ++j)
+    beta *= safmin;
+  v[0] = beta;
+}
+
+/*
+ * The eigenvalues (wr + i * wi) of the n x n upper Hessenberg matrix H by
+ * the double-shift QR iteration of LAPACK's lahqr, by one workgroup. Thread
+ * 0 keeps the state of the iteration: it looks for a negligible
+ * subdiagonal entry that splits off the active block, deflates 1 x 1 and 2
+ * x 2 blocks at its bottom (the latter into standard form by lanv2) and
+ * otherwise computes the two shifts and the reflectors of a Francis sweep,
+ * one at a time; each reflector is applied by all threads. With wantt H is
+ * reduced to the real Schur form T, and with wantz the transformations are
+ * accumulated into the columns of Z (n x n). Complex conjugate pairs come
+ * out together, the one with positive imaginary part first. info gets i+1
+ * if the eigenvalue in row i did not converge within 30 * max(10, n)
+ * iterations, as in LAPACK; rows i+1:n are then deflated.
+ */
+template <typename T>
+__device__ void hseqr_lahqr(rocblas_int n, T *H, rocblas_int ldh, T *wr, T *wi,
+                            bool wantt, T *Z, rocblas_int ldz, bool wantz,
+                            rocblas_int *info, T ulp, T sfmin) {
+  __shared__ rocblas_int sact, sm, si, si1, si2, snr;
+  __shared__ T sv1, sv2, st1, scs, ssn;
+  const int tid = hipThreadIdx_x;
+  const T dat1 = 0.75;
+  const T dat2 = -0.4375;
+  const rocblas_int kexsh = 10;
+
+  // the entries below the first subdiagonal can be read, so they are zero
+  for (rocblas_int j = tid; j < n - 2; j += hipBlockDim_x) {
+    H[idx2D(j + 2, j, ldh)] = 0;
+    if (j + 3 < n)
+      H[idx2D(j + 3, j, ldh)] = 0;
+  }
+  __syncthreads();
+
+  // the state of the iteration, in thread 0
+  const T smlnum = sfmin * (T(n) / ulp);
+  const T safmn2 = ldexp(T(1), int(log2(sfmin / ulp) / 2));
+  const rocblas_int itmax = 30 * max(10, n);
+  rocblas_int i = n - 1, l = 0, its = 0, kdefl = 0;
+  T v[3];
+
+  while (true) {
+    if (tid == 0) {
+      // 0: done, 1: sweep, 2: rotate a 2 x 2 block, 3: nothing to apply
+      rocblas_int act = 3;
+      if (i < 0) {
+        act = 0;
+      } else if (its > itmax) {
+        *info = i + 1;
+        act = 0;
+      } else {
+        // look for a single small subdiagonal entry
+        rocblas_int k = i;
+        for (; k > l; --k) {
+          const T hkk1 = fabs(H[idx2D(k, k - 1, ldh)]);
+          if (hkk1 <= smlnum)
+            break;
+          T tst = fabs(H[idx2D(k - 1, k - 1, ldh)]) + fabs(H[idx2D(k, k, ldh)]);
+          if (tst == 0) {
+            if (k - 2 >= 0)
+              tst += fabs(H[idx2D(k - 1, k - 2, ldh)]);
+            if (k + 1 < n)
+              tst += fabs(H[idx2D(k + 1, k, ldh)]);
+          }
+          if (hkk1 <= ulp * tst) {
+            const T hk1k = fabs(H[idx2D(k - 1, k, ldh)]);
+            const T hkk = fabs(H[idx2D(k, k, ldh)]);
+            const T hd = fabs(H[idx2D(k - 1, k - 1, ldh)] - H[idx2D(k, k, ldh)]);
+            const T ab = max(hkk1, hk1k);
+            const T ba = min(hkk1, hk1k);
+            const T aa = max(hkk, hd);
+            const T bb = min(hkk, hd);
+            const T s = aa + ab;
+            if (ba * (ab / s) <= max(smlnum, ulp * (bb * (aa / s))))
+              break;
+          }
+        }
+        l = k;
+        if (l > 0)
+          H[idx2D(l, l - 1, ldh)] = 0;
+
+        if (l >= i - 1) {
+          // a 1 x 1 or 2 x 2 block has split off
+          if (l == i) {
+            wr[i] = H[idx2D(i, i, ldh)];
+            wi[i] = 0;
+          } else {
+            T cs, sn;
+            hseqr_lanv2(H[idx2D(i - 1, i - 1, ldh)], H[idx2D(i - 1, i, ldh)],
+                        H[idx2D(i, i - 1, ldh)], H[idx2D(i, i, ldh)],
+                        wr[i - 1], wi[i - 1], wr[i], wi[i], cs, sn, ulp,
+                        safmn2);
+            if (wantt || wantz) {
+              act = 2;
+              si = i;
+              scs = cs;
+              ssn = sn;
+            }
+          }
+          i = l - 1;
+          l = 0;
+          its = 0;
+          kdefl = 0;
+        } else {
+          ++its;
+          ++kdefl;
+          act = 1;
+          si = i;
+          si1 = wantt ? 0 : l;
+          si2 = wantt ? n - 1 : i;
+
+          // the shifts, exceptional every kexsh iterations
+          T h11, h12, h21, h22;
+          if (kdefl % (2 * kexsh) == 0) {
+            const T s = fabs(H[idx2D(i, i - 1, ldh)]) +
+                        fabs(H[idx2D(i - 1, i - 2, ldh)]);
+            h11 = dat1 * s + H[idx2D(i, i, ldh)];
+            h12 = dat2 * s;
+            h21 = s;
+            h22 = h11;
+          } else if (kdefl % kexsh == 0) {
+            const T s = fabs(H[idx2D(l + 1, l, ldh)]) +
+                        fabs(H[idx2D(l + 2, l + 1, ldh)]);
+            h11 = dat1 * s + H[idx2D(l, l, ldh)];
+            h12 = dat2 * s;
+            h21 = s;
+            h22 = h11;
+          } else {
+            h11 = H[idx2D(i - 1, i - 1, ldh)];
+            h21 = H[idx2D(i, i - 1, ldh)];
+            h12 = H[idx2D(i - 1, i, ldh)];
+            h22 = H[idx2D(i, i, ldh)];
+          }
+          T rt1r = 0, rt1i = 0, rt2r = 0, rt2i = 0;
+          const T s = fabs(h11) + fabs(h12) + fabs(h21) + fabs(h22);
+          if (s != 0) {
+            h11 /= s;
+            h21 /= s;
+            h12 /= s;
+            h22 /= s;
+            const T tr = (h11 + h22) / 2;
+            const T det = (h11 - tr) * (h22 - tr) - h12 * h21;
+            const T rtdisc = sqrt(fabs(det));
+            if (det >= 0) {
+              // complex conjugate shifts
+              rt1r = tr * s;
+              rt2r = rt1r;
+              rt1i = rtdisc * s;
+              rt2i = -rt1i;
+            } else {
+              // real shifts, both the one closer to h22
+              rt1r = tr + rtdisc;
+              rt2r = tr - rtdisc;
+              if (fabs(rt1r - h22) <= fabs(rt2r - h22))
+                rt1r *= s;
+              else
+                rt1r = rt2r * s;
+              rt2r = rt1r;
+            }
+          }
+
+          // look for two consecutive small subdiagonal entries
+          rocblas_int m = i - 2;
+          for (; m >= l; --m) {
+            const T hmm = H[idx2D(m, m, ldh)];
+            T h21s = H[idx2D(m + 1, m, ldh)];
+            const T s2 = fabs(hmm - rt2r) + fabs(rt2i) + fabs(h21s);
+            h21s /= s2;
+            v[0] = h21s * H[idx2D(m, m + 1, ldh)] +
+                   (hmm - rt1r) * ((hmm - rt2r) / s2) - rt1i * (rt2i / s2);
+            v[1] = h21s * (hmm + H[idx2D(m + 1, m + 1, ldh)] - rt1r - rt2r);
+            v[2] = h21s * H[idx2D(m + 2, m + 1, ldh)];
+            const T s3 = fabs(v[0]) + fabs(v[1]) + fabs(v[2]);
+            v[0] /= s3;
+            v[1] /= s3;
+            v[2] /= s3;
+            if (m == l)
+              break;
+            const T h00 = fabs(H[idx2D(m, m - 1, ldh)]) *
+                          (fabs(v[1]) + fabs(v[2]));
+            const T h01 =
+                fabs(v[0]) * (fabs(H[idx2D(m - 1, m - 1, ldh)]) + fabs(hmm) +
+                              fabs(H[idx2D(m + 1, m + 1, ldh)]));
+            if (h00 <= ulp * h01)
+              break;
+          }
+          sm = m;
+        }
+      }
+      sact = act;
+    }
+    __syncthreads();
+    const rocblas_int act = sact;
+    if (act == 0)
+      break;
+
+    if (act == 2) {
+      // the rotation of the 2 x 2 block at rows and columns i-1:i+1
+      const rocblas_int ii = si;
+      const T cs = scs, sn = ssn;
+      if (wantt) {
+        for (rocblas_int j = ii + 1 + tid; j < n; j += hipBlockDim_x) {
+          const T x = H[idx2D(ii - 1, j, ldh)];
+          const T y = H[idx2D(ii, j, ldh)];
+          H[idx2D(ii - 1, j, ldh)] = cs * x + sn * y;
+          H[idx2D(ii, j, ldh)] = cs * y - sn * x;
+        }
+        for (rocblas_int r = tid; r < ii - 1; r += hipBlockDim_x) {
+          const T x = H[idx2D(r, ii - 1, ldh)];
+          const T y = H[idx2D(r, ii, ldh)];
+          H[idx2D(r, ii - 1, ldh)] = cs * x + sn * y;
+          H[idx2D(r, ii, ldh)] = cs * y - sn * x;
+        }
+      }
+      if (wantz) {
+        for (rocblas_int r = tid; r < n; r += hipBlockDim_x) {
+          const T x = Z[idx2D(r, ii - 1, ldz)];
+          const T y = Z[idx2D(r, ii, ldz)];
+          Z[idx2D(r, ii - 1, ldz)] = cs * x + sn * y;
+          Z[idx2D(r, ii, ldz)] = cs * y - sn * x;
+        }
+      }
+    } else if (act == 1) {
+      // the Francis double-shift sweep on rows and columns m:i+1
+      const rocblas_int m = sm, ii = si, i1 = si1, i2 = si2;
+      for (rocblas_int k = m; k < ii; ++k) {
+        if (tid == 0) {
+          const int nr = min(3, ii - k + 1);
+          if (k > m) {
+            v[0] = H[idx2D(k, k - 1, ldh)];
+            v[1] = H[idx2D(k + 1, k - 1, ldh)];
+            if (nr == 3)
+              v[2] = H[idx2D(k + 2, k - 1, ldh)];
+          }
+          T t1;
+          hseqr_larfg(nr, v, t1, T(sfmin / ulp));
+          if (k > m) {
+            H[idx2D(k, k - 1, ldh)] = v[0];
+            H[idx2D(k + 1, k - 1, ldh)] = 0;
+            if (k < ii - 1)
+              H[idx2D(k + 2, k - 1, ldh)] = 0;
+          } else if (m > l) {
+            // rather than negating it, so that underflows in v are harmless
+            H[idx2D(k, k - 1, ldh)] *= (1 - t1);
+          }
+          snr = nr;
+          sv1 = v[1];
+          sv2 = (nr == 3) ? v[2] : 0;
+          st1 = t1;
+        }
+        __syncthreads();
+        const int nr = snr;
+        const T v2 = sv1, v3 = sv2, t1 = st1;
+        const T t2 = t1 * v2, t3 = t1 * v3;
+
+        // from the left on rows k:k+nr, then from the right on columns
+        // k:k+nr (and Z)
+        for (rocblas_int j = k + tid; j <= i2; j += hipBlockDim_x) {
+          T sum = H[idx2D(k, j, ldh)] + v2 * H[idx2D(k + 1, j, ldh)];
+          if (nr == 3)
+            sum += v3 * H[idx2D(k + 2, j, ldh)];
+          H[idx2D(k, j, ldh)] -= sum * t1;
+          H[idx2D(k + 1, j, ldh)] -= sum * t2;
+          if (nr == 3)
+            H[idx2D(k + 2, j, ldh)] -= sum * t3;
+        }
+        __syncthreads();
+        const rocblas_int rlast = min(k + 3, ii);
+        for (rocblas_int r = i1 + tid; r <= rlast; r += hipBlockDim_x) {
+          T sum = H[idx2D(r, k, ldh)] + v2 * H[idx2D(r, k + 1, ldh)];
+          if (nr == 3)
+            sum += v3 * H[idx2D(r, k + 2, ldh)];
+          H[idx2D(r, k, ldh)] -= sum * t1;
+          H[idx2D(r, k + 1, ldh)] -= sum * t2;
+          if (nr == 3)
+            H[idx2D(r, k + 2, ldh)] -= sum * t3;
+        }
+        if (wantz) {
+          for (rocblas_int r = tid; r < n; r += hipBlockDim_x) {
+            T sum = Z[idx2D(r, k, ldz)] + v2 * Z[idx2D(r, k + 1, ldz)];
+            if (nr == 3)
+              sum += v3 * Z[idx2D(r, k + 2, ldz)];
+            Z[idx2D(r, k, ldz)] -= sum * t1;
+            Z[idx2D(r, k + 1, ldz)] -= sum * t2;
+            if (nr == 3)
+              Z[idx2D(r, k + 2, ldz)] -= sum * t3;
+          }
+        }
+        __syncthreads();
+      }
+    }
+    __syncthreads();
+  }
+}
+
+template <typename T>
+__global__ void hseqr_kernel(rocblas_int n, T *H, rocblas_int ldh, T *wr,
+                             T *wi, bool wantt, T *Z, rocblas_int ldz,
+                             bool wantz, rocblas_int *info, T ulp, T sfmin) {
+  hseqr_lahqr<T>(n, H, ldh, wr, wi, wantt, Z, ldz, wantz, info, ulp, sfmin);
+}
+
+/*
+ * The multishift QR iteration of LAPACK's laqr0 for n >= HSEQR_MULTISHIFT_MINSIZE
+ * (Braman, Byers and Mathias). Each iteration first tries aggressive early
+ * deflation on a trailing window of the active block (hseqr_aed): the
+ * window is reduced to Schur form by lahqr in one workgroup, and the
+ * eigenvalues whose spike entries are negligible are deflated, the others
+ * being moved to the top by swaps of diagonal blocks (trexc). The
+ * undeflated ones are then the shifts of a sweep that chases a chain of
+ * small 3 x 3 bulges down the block: each window of 4 * nbmps rows and
+ * columns is chased by one workgroup (hseqr_chase), which accumulates its
+ * reflectors in an orthogonal U, and the rest of H and Z are updated by
+ * gemms with U. Both steps only touch the window in the kernels, so that
+ * the O(n^3) work is done by rocblas_gemm.
+ */
+
+// the entries of the state that the iteration reads back (iwork)
+#define HSEQR_KTOP 0
+#define HSEQR_JW 1
+#define HSEQR_ND 2
+#define HSEQR_LS 3
+#define HSEQR_APPLY 4
+#define HSEQR_STATE 5
+
+// the iterations without deflation after which the window grows (kexnw)
+// and the shifts are exceptional (kexsh), and the weights of the latter, as
+// in laqr0
+#define HSEQR_KEXNW 5
+#define HSEQR_KEXSH 6
+#define HSEQR_WILK1 0.75
+#define HSEQR_WILK2 -0.4375
+
+// (cs, sn) with -sn * f + cs * g = 0 and r = cs * f + sn * g, as in LAPACK's
+// lartg
+template <typename T>
+__device__ void hseqr_lartg(T f, T g, T &cs, T &sn, T &r) {
+  if (g == 0) {
+    cs = 1;
+    sn = 0;
+    r = f;
+  } else if (f == 0) {
+    cs = 0;
+    sn = 1;
+    r = g;
+  } else {
+    r = hypot(f, g);
+    cs = f / r;
+    sn = g / r;
+    if (fabs(f) > fabs(g) && cs < 0) {
+      cs = -cs;
+      sn = -sn;
+      r = -r;
+    }
+  }
+}
+
+// the rotation (x, y) := (cs * x + sn * y, cs * y - sn * x) of the cnt pairs
+// x(k * incx), y(k * incy), one thread per pair
+template <typename T>
+__device__ void hseqr_rot(rocblas_int cnt, T *x, rocblas_int incx, T *y,
+                          rocblas_int incy, T cs, T sn) {
+  for (rocblas_int k = hipThreadIdx_x; k < cnt; k += hipBlockDim_x) {
+    const T a = x[k * incx];
+    const T b = y[k * incy];
+    x[k * incx] = cs * a + sn * b;
+    y[k * incy] = cs * b - sn * a;
+  }
+}
+
+// A := (I - tau * u * u**T) * A for the m x nc matrix A, one thread per
+// column
+template <typename T>
+__device__ void hseqr_larf_left(rocblas_int m, rocblas_int nc, const T *u,
+                                T tau, T *A, rocblas_int lda) {
+  if (tau == 0)
+    return;
+  for (rocblas_int j = hipThreadIdx_x; j < nc; j += hipBlockDim_x) {
+    T s = 0;
+    for (rocblas_int i = 0; i < m; ++i)
+      s += u[i] * A[idx2D(i, j, lda)];
+    s *= tau;
+    for (rocblas_int i = 0; i < m; ++i)
+      A[idx2D(i, j, lda)] -= s * u[i];
+  }
+}
+
+// A := A * (I - tau * u * u**T) for the nr x m matrix A, one thread per row
+template <typename T>
+__device__ void hseqr_larf_right(rocblas_int nr, rocblas_int m, const T *u,
+                                 T tau, T *A, rocblas_int lda) {
+  if (tau == 0)
+    return;
+  for (rocblas_int i = hipThreadIdx_x; i < nr; i += hipBlockDim_x) {
+    T s = 0;
+    for (rocblas_int j = 0; j < m; ++j)
+      s += A[idx2D(i, j, lda)] * u[j];
+    s *= tau;
+    for (rocblas_int j = 0; j < m; ++j)
+      A[idx2D(i, j, lda)] -= s * u[j];
+  }
+}
+
+// the same with m = 3, by one thread: from the left on the 3 x cnt matrix A,
+// or from the right on the cnt x 3 one
+template <typename T>
+__device__ void hseqr_larf3(bool left, const T *u, T tau, T *A,
+                            rocblas_int lda, rocblas_int cnt) {
+  for (rocblas_int k = 0; k < cnt; ++k) {
+    T *a0 = left ? &A[idx2D(0, k, lda)] : &A[idx2D(k, 0, lda)];
+    const rocblas_int inc = left ? 1 : lda;
+    const T s = tau * (u[0] * a0[0] + u[1] * a0[inc] + u[2] * a0[2 * inc]);
+    a0[0] -= s * u[0];
+    a0[inc] -= s * u[1];
+    a0[2 * inc] -= s * u[2];
+  }
+}
+
+/*
+ * X (n1 x n2, leading dimension n1, n1 and n2 <= 2) with TL * X - X * TR =
+ * B, where TL = D(0:n1,0:n1), TR = D(n1:,n1:) and B = D(0:n1,n1:) are
+ * blocks of the 4 x 4 matrix D (leading dimension 4). As in LAPACK's lasy2,
+ * the Kronecker form of the equations is solved by Gaussian elimination
+ * with complete pivoting, pivots below smin replaced by smin; the scale
+ * factor is always one.
+ */
+template <typename T>
+__device__ void hseqr_lasy2(int n1, int n2, const T *D, T *X, T eps,
+                            T smlnum) {
+  const int m = n1 * n2;
+  T K[16], b[4], y[4];
+  int jp[4];
+
+  T smin = 0;
+  for (int j = 0; j < n1 + n2; ++j)
+    for (int i = 0; i < n1 + n2; ++i)
+      if ((i < n1) == (j < n1))
+        smin = max(smin, fabs(D[i + j * 4]));
+  smin = max(eps * smin, smlnum);
+
+  for (int j = 0; j < n2; ++j) {
+    for (int i = 0; i < n1; ++i) {
+      const int r = i + j * n1;
+      b[r] = D[i + (n1 + j) * 4];
+      for (int jj = 0; jj < n2; ++jj) {
+        for (int ii = 0; ii < n1; ++ii) {
+          T kv = 0;
+          if (jj == j)
+            kv += D[i + ii * 4];
+          if (ii == i)
+            kv -= D[(n1 + jj) + (n1 + j) * 4];
+          K[r + (ii + jj * n1) * 4] = kv;
+        }
+      }
+    }
+  }
+
+  for (int c = 0; c < m; ++c)
+    jp[c] = c;
+  for (int s = 0; s < m; ++s) {
+    int pr = s, pc = s;
+    T pmax = -1;
+    for (int jj = s; jj < m; ++jj) {
+      for (int ii = s; ii < m; ++ii) {
+        if (fabs(K[ii + jj * 4]) > pmax) {
+          pmax = fabs(K[ii + jj * 4]);
+          pr = ii;
+          pc = jj;
+        }
+      }
+    }
+    for (int jj = 0; jj < m; ++jj) {
+      const T t = K[s + jj * 4];
+      K[s + jj * 4] = K[pr + jj * 4];
+      K[pr + jj * 4] = t;
+    }
+    const T t = b[s];
+    b[s] = b[pr];
+    b[pr] = t;
+    for (int ii = 0; ii < m; ++ii) {
+      const T t2 = K[ii + s * 4];
+      K[ii + s * 4] = K[ii + pc * 4];
+      K[ii + pc * 4] = t2;
+    }
+    const int jt = jp[s];
+    jp[s] = jp[pc];
+    jp[pc] = jt;
+
+    if (fabs(K[s + s * 4]) < smin)
+      K[s + s * 4] = smin;
+    for (int ii = s + 1; ii < m; ++ii) {
+      const T f = K[ii + s * 4] / K[s + s * 4];
+      b[ii] -= f * b[s];
+      for (int jj = s + 1; jj < m; ++jj)
+        K[ii + jj * 4] -= f * K[s + jj * 4];
+    }
+  }
+  for (int s = m - 1; s >= 0; --s) {
+    T t = b[s];
+    for (int jj = s + 1; jj < m; ++jj)
+      t -= K[s + jj * 4] * y[jj];
+    y[s] = t / K[s + s * 4];
+  }
+  for (int s = 0; s < m; ++s)
+    X[jp[s]] = y[s];
+}
+
+/*
+ * Swap the adjacent diagonal blocks T11 (n1 x n1) and T22 (n2 x n2) of the
+ * n x n matrix T in Schur form, at rows and columns j1:j1+n1+n2, by an
+ * orthogonal similarity that is accumulated into Q (n x n), as in LAPACK's
+ * laexc. Thread 0 finds the transformation (for a 2 x 2 block, the
+ * reflectors of the solution of the Sylvester equation, rejected if they
+ * would change T11 or T22 by more than ten ulps of T), and all threads
+ * apply it. Returns, in all threads, whether the swap was done; the 2 x 2
+ * blocks are put back into standard form.
+ */
+template <typename T>
+__device__ bool hseqr_laexc(rocblas_int n, T *Tm, rocblas_int ldt, T *Q,
+                            rocblas_int ldq, rocblas_int j1, int n1, int n2,
+                            T ulp, T sfmin, T safmn2) {
+  __shared__ T su[6], stau[2], sdiag[2], scs, ssn;
+  __shared__ int sok;
+  const int tid = hipThreadIdx_x;
+  const rocblas_int j2 = j1 + 1, j3 = j1 + 2, j4 = j1 + 3;
+
+  if (n1 == 1 && n2 == 1) {
+    if (tid == 0) {
+      sdiag[0] = Tm[idx2D(j1, j1, ldt)];
+      sdiag[1] = Tm[idx2D(j2, j2, ldt)];
+      T r;
+      hseqr_lartg(Tm[idx2D(j1, j2, ldt)], sdiag[1] - sdiag[0], scs, ssn, r);
+    }
+    __syncthreads();
+    const T cs = scs, sn = ssn;
+    hseqr_rot(n - j3, &Tm[idx2D(j1, j3, ldt)], ldt, &Tm[idx2D(j2, j3, ldt)],
+              ldt, cs, sn);
+    hseqr_rot(j1, &Tm[idx2D(0, j1, ldt)], 1, &Tm[idx2D(0, j2, ldt)], 1, cs,
+              sn);
+    hseqr_rot(n, &Q[idx2D(0, j1, ldq)], 1, &Q[idx2D(0, j2, ldq)], 1, cs, sn);
+    if (tid == 0) {
+      Tm[idx2D(j1, j1, ldt)] = sdiag[1];
+      Tm[idx2D(j2, j2, ldt)] = sdiag[0];
+    }
+    __syncthreads();
+    return true;
+  }
+
+  const int k = n1 + n1 + n2 - 3;
+  if (tid == 0) {
+    const int nd = n1 + n2;
+    const T safmin = sfmin / ulp;
+    T D[16], X[4], v[3];
+    T dnorm = 0;
+    for (int j = 0; j < nd; ++j) {
+      for (int i = 0; i < nd; ++i) {
+        D[i + j * 4] = Tm[idx2D(j1 + i, j1 + j, ldt)];
+        dnorm = max(dnorm, fabs(D[i + j * 4]));
+      }
+    }
+    const T thresh = max(10 * ulp * dnorm, safmin);
+    hseqr_lasy2(n1, n2, D, X, ulp, safmin);
+
+    T res;
+    if (k == 1) {
+      // T11 1 x 1: the reflector takes (1, X) to a multiple of e3
+      v[0] = 1;
+      v[1] = X[0];
+      v[2] = X[1];
+      const T alpha = v[2];
+      v[2] = v[1];
+      v[1] = v[0];
+      v[0] = alpha;
+      hseqr_larfg(3, v, stau[0], safmin);
+      su[0] = v[1];
+      su[1] = v[2];
+      su[2] = 1;
+      sdiag[0] = Tm[idx2D(j1, j1, ldt)];
+      hseqr_larf3(true, su, stau[0], D, 4, 3);
+      hseqr_larf3(false, su, stau[0], D, 4, 3);
+      res = max(max(fabs(D[2]), fabs(D[6])), fabs(D[10] - sdiag[0]));
+    } else if (k == 2) {
+      // T22 1 x 1: the reflector takes (-X, 1) to a multiple of e1
+      v[0] = -X[0];
+      v[1] = -X[1];
+      v[2] = 1;
+      hseqr_larfg(3, v, stau[0], safmin);
+      su[0] = 1;
+      su[1] = v[1];
+      su[2] = v[2];
+      sdiag[0] = Tm[idx2D(j3, j3, ldt)];
+      hseqr_larf3(true, su, stau[0], D, 4, 3);
+      hseqr_larf3(false, su, stau[0], D, 4, 3);
+      res = max(max(fabs(D[1]), fabs(D[2])), fabs(D[0] - sdiag[0]));
+    } else {
+      // both 2 x 2: two reflectors take (-X, I) to upper triangular form
+      v[0] = -X[0];
+      v[1] = -X[1];
+      v[2] = 1;
+      hseqr_larfg(3, v, stau[0], safmin);
+      su[0] = 1;
+      su[1] = v[1];
+      su[2] = v[2];
+      const T temp = -stau[0] * (X[2] + su[1] * X[3]);
+      v[0] = -temp * su[1] - X[3];
+      v[1] = -temp * su[2];
+      v[2] = 1;
+      hseqr_larfg(3, v, stau[1], safmin);
+      su[3] = 1;
+      su[4] = v[1];
+      su[5] = v[2];
+      hseqr_larf3(true, su, stau[0], D, 4, 4);
+      hseqr_larf3(false, su, stau[0], D, 4, 4);
+      hseqr_larf3(true, su + 3, stau[1], D + 1, 4, 4);
+      hseqr_larf3(false, su + 3, stau[1], D + 4, 4, 4);
+      res = max(max(fabs(D[2]), fabs(D[6])), max(fabs(D[3]), fabs(D[7])));
+    }
+    sok = (res <= thresh);
+  }
+  __syncthreads();
+  const bool ok = sok;
+  __syncthreads();
+  if (!ok)
+    return false;
+
+  const T *u1 = su;
+  const T *u2 = su + 3;
+  const T tau1 = stau[0], tau2 = stau[1];
+  if (k == 1) {
+    hseqr_larf_left(3, n - j1, u1, tau1, &Tm[idx2D(j1, j1, ldt)], ldt);
+    __syncthreads();
+    hseqr_larf_right(j2 + 1, 3, u1, tau1, &Tm[idx2D(0, j1, ldt)], ldt);
+    hseqr_larf_right(n, 3, u1, tau1, &Q[idx2D(0, j1, ldq)], ldq);
+    __syncthreads();
+    if (tid == 0) {
+      Tm[idx2D(j3, j1, ldt)] = 0;
+      Tm[idx2D(j3, j2, ldt)] = 0;
+      Tm[idx2D(j3, j3, ldt)] = sdiag[0];
+    }
+  } else if (k == 2) {
+    hseqr_larf_right(j3 + 1, 3, u1, tau1, &Tm[idx2D(0, j1, ldt)], ldt);
+    hseqr_larf_right(n, 3, u1, tau1, &Q[idx2D(0, j1, ldq)], ldq);
+    __syncthreads();
+    hseqr_larf_left(3, n - j1 - 1, u1, tau1, &Tm[idx2D(j1, j2, ldt)], ldt);
+    __syncthreads();
+    if (tid == 0) {
+      Tm[idx2D(j1, j1, ldt)] = sdiag[0];
+      Tm[idx2D(j2, j1, ldt)] = 0;
+      Tm[idx2D(j3, j1, ldt)] = 0;
+    }
+  } else {
+    hseqr_larf_left(3, n - j1, u1, tau1, &Tm[idx2D(j1, j1, ldt)], ldt);
+    __syncthreads();
+    hseqr_larf_right(j4 + 1, 3, u1, tau1, &Tm[idx2D(0, j1, ldt)], ldt);
+    __syncthreads();
+    hseqr_larf_left(3, n - j1, u2, tau2, &Tm[idx2D(j2, j1, ldt)], ldt);
+    __syncthreads();
+    hseqr_larf_right(j4 + 1, 3, u2, tau2, &Tm[idx2D(0, j2, ldt)], ldt);
+    hseqr_larf_right(n, 3, u1, tau1, &Q[idx2D(0, j1, ldq)], ldq);
+    hseqr_larf_right(n, 3, u2, tau2, &Q[idx2D(0, j2, ldq)], ldq);
+    __syncthreads();
+    if (tid == 0) {
+      Tm[idx2D(j3, j1, ldt)] = 0;
+      Tm[idx2D(j3, j2, ldt)] = 0;
+      Tm[idx2D(j4, j1, ldt)] = 0;
+      Tm[idx2D(j4, j2, ldt)] = 0;
+    }
+  }
+  __syncthreads();
+
+  // the 2 x 2 blocks in their new places back into standard form
+  for (int b = 0; b < 2; ++b) {
+    if ((b == 0 ? n2 : n1) != 2)
+      continue;
+    const rocblas_int p = (b == 0) ? j1 : j1 + n2;
+    if (tid == 0) {
+      T rt1r, rt1i, rt2r, rt2i;
+      hseqr_lanv2(Tm[idx2D(p, p, ldt)], Tm[idx2D(p, p + 1, ldt)],
+                  Tm[idx2D(p + 1, p, ldt)], Tm[idx2D(p + 1, p + 1, ldt)],
+                  rt1r, rt1i, rt2r, rt2i, scs, ssn, ulp, safmn2);
+    }
+    __syncthreads();
+    const T cs = scs, sn = ssn;
+    hseqr_rot(n - p - 2, &Tm[idx2D(p, p + 2, ldt)], ldt,
+              &Tm[idx2D(p + 1, p + 2, ldt)], ldt, cs, sn);
+    hseqr_rot(p, &Tm[idx2D(0, p, ldt)], 1, &Tm[idx2D(0, p + 1, ldt)], 1, cs,
+              sn);
+    hseqr_rot(n, &Q[idx2D(0, p, ldq)], 1, &Q[idx2D(0, p + 1, ldq)], 1, cs, sn);
+    __syncthreads();
+  }
+  return true;
+}
+
+/*
+ * Move the diagonal block of T (n x n, Schur form) at row ifst up to row
+ * ilst <= ifst by swaps of adjacent blocks (hseqr_laexc), accumulated into
+ * Q, as in LAPACK's trexc. All threads take the same path, reading T after
+ * the swaps; ifst and ilst are moved to the first rows of their blocks, and
+ * if a swap is rejected ilst gets the row where the block stopped.
+ */
+template <typename T>
+__device__ void hseqr_trexc(rocblas_int n, T *Tm, rocblas_int ldt, T *Q,
+                            rocblas_int ldq, rocblas_int &ifst,
+                            rocblas_int &ilst, T ulp, T sfmin, T safmn2) {
+  if (ifst > 0 && Tm[idx2D(ifst, ifst - 1, ldt)] != 0)
+    --ifst;
+  int nbf = 1;
+  if (ifst < n - 1 && Tm[idx2D(ifst + 1, ifst, ldt)] != 0)
+    nbf = 2;
+  if (ilst > 0 && Tm[idx2D(ilst, ilst - 1, ldt)] != 0)
+    --ilst;
+  if (ifst == ilst)
+    return;
+
+  rocblas_int here = ifst;
+  do {
+    int nbnext = 1;
+    if (here >= 2 && Tm[idx2D(here - 1, here - 2, ldt)] != 0)
+      nbnext = 2;
+    if (nbf == 1 || nbf == 2) {
+      // the current block over the one above it
+      if (!hseqr_laexc(n, Tm, ldt, Q, ldq, here - nbnext, nbnext, nbf, ulp,
+                       sfmin, safmn2)) {
+        ilst = here;
+        return;
+      }
+      here -= nbnext;
+      // a 2 x 2 block can split into two 1 x 1 ones
+      if (nbf == 2 && Tm[idx2D(here + 1, here, ldt)] == 0)
+        nbf = 3;
+    } else {
+      // two 1 x 1 blocks, each moved on its own
+      if (!hseqr_laexc(n, Tm, ldt, Q, ldq, here - nbnext, nbnext, 1, ulp,
+                       sfmin, safmn2)) {
+        ilst = here;
+        return;
+      }
+      if (nbnext == 1) {
+        hseqr_laexc(n, Tm, ldt, Q, ldq, here, nbnext, 1, ulp, sfmin, safmn2);
+        --here;
+      } else {
+        if (Tm[idx2D(here, here - 1, ldt)] == 0)
+          nbnext = 1;
+        if (nbnext == 2) {
+          if (!hseqr_laexc(n, Tm, ldt, Q, ldq, here - 1, 2, 1, ulp, sfmin,
+                           safmn2)) {
+            ilst = here;
+            return;
+          }
+        } else {
+          hseqr_laexc(n, Tm, ldt, Q, ldq, here, 1, 1, ulp, sfmin, safmn2);
+          hseqr_laexc(n, Tm, ldt, Q, ldq, here - 1, 1, 1, ulp, sfmin,
+                      safmn2);
+        }
+        here -= 2;
+      }
+    }
+  } while (here > ilst);
+  ilst = here;
+}
+
+/*
+ * Aggressive early deflation (LAPACK's laqr2) on the active block of H that
+ * ends at row kbot, in one workgroup. The block is located (ktop), and its
+ * trailing window of order jw (nwreq, capped by nwmax and adjusted not to
+ * split a 2 x 2 block) is copied to Tw and reduced to Schur form by lahqr,
+ * with the transformation in Vw (both jw x jw, leading dimension ldw). The
+ * eigenvalues whose spike entries s * Vw(0,:) are negligible are deflated,
+ * the others moved to the top of the window; all of them go to WR and WI
+ * from kwtop = kbot - jw + 1 on. If anything deflated, the spike is
+ * reflected back and the undeflated part of Tw reduced to Hessenberg form,
+ * Tw is copied into H and Vw is left for the gemms that update the rest of
+ * H and Z. The state gets ktop, jw, the number of deflations (nd), that of
+ * the undeflated eigenvalues that can be shifts (ls), and whether Vw has to
+ * be applied.
+ */
+template <typename T>
+__global__ void hseqr_aed(rocblas_int n, T *H, rocblas_int ldh, T *WR, T *WI,
+                          rocblas_int kbot, rocblas_int nwreq,
+                          rocblas_int nwmax, T *Tw, T *Vw, rocblas_int ldw,
+                          T *u, rocblas_int *state, T ulp, T sfmin) {
+  __shared__ rocblas_int sktop, sjw, sinfo;
+  __shared__ T stau;
+  const int tid = hipThreadIdx_x;
+  const T smlnum = sfmin * (T(n) / ulp);
+  const T safmin = sfmin / ulp;
+  const T safmn2 = ldexp(T(1), int(log2(sfmin / ulp) / 2));
+
+  if (tid == 0) {
+    rocblas_int ktop = kbot;
+    while (ktop > 0 && H[idx2D(ktop, ktop - 1, ldh)] != 0)
+      --ktop;
+    const rocblas_int nh = kbot - ktop + 1;
+    rocblas_int nw = min(min(nh, nwmax), nwreq);
+    if (nw < nwmax) {
+      if (nw >= nh - 1) {
+        nw = nh;
+      } else {
+        const rocblas_int kw = kbot - nw + 1;
+        if (fabs(H[idx2D(kw, kw - 1, ldh)]) >
+            fabs(H[idx2D(kw - 1, kw - 2, ldh)]))
+          ++nw;
+      }
+    }
+    sktop = ktop;
+    sjw = nw;
+    sinfo = 0;
+  }
+  __syncthreads();
+  const rocblas_int ktop = sktop;
+  const rocblas_int jw = sjw;
+  const rocblas_int kwtop = kbot - jw + 1;
+  T s = (kwtop == ktop) ? 0 : H[idx2D(kwtop, kwtop - 1, ldh)];
+
+  if (jw == 1) {
+    // a 1 x 1 window deflates when its spike is small
+    if (tid == 0) {
+      const T hkk = H[idx2D(kwtop, kwtop, ldh)];
+      WR[kwtop] = hkk;
+      WI[kwtop] = 0;
+      rocblas_int nd = 0;
+      if (fabs(s) <= max(smlnum, ulp * fabs(hkk))) {
+        nd = 1;
+        if (kwtop > ktop)
+          H[idx2D(kwtop, kwtop - 1, ldh)] = 0;
+      }
+      state[HSEQR_KTOP] = ktop;
+      state[HSEQR_JW] = 1;
+      state[HSEQR_ND] = nd;
+      state[HSEQR_LS] = 1 - nd;
+      state[HSEQR_APPLY] = 0;
+    }
+    return;
+  }
+
+  // the window, and its Schur form
+  for (rocblas_int k = tid; k < jw * jw; k += hipBlockDim_x) {
+    const rocblas_int i = k % jw;
+    const rocblas_int j = k / jw;
+    Tw[idx2D(i, j, ldw)] = (i <= j + 1) ? H[idx2D(kwtop + i, kwtop + j, ldh)] : 0;
+    Vw[idx2D(i, j, ldw)] = (i == j) ? 1 : 0;
+  }
+  __syncthreads();
+  hseqr_lahqr<T>(jw, Tw, ldw, WR + kwtop, WI + kwtop, true, Vw, ldw, true,
+                 &sinfo, ulp, sfmin);
+  __syncthreads();
+  const rocblas_int infqr = sinfo;
+
+  // deflation detection: the bottom block deflates if its spike is small,
+  // and is otherwise moved up past the undeflatable ones
+  rocblas_int ns = jw, ilst = infqr;
+  while (ilst < ns) {
+    const bool bulge = (ns > 1) && Tw[idx2D(ns - 1, ns - 2, ldw)] != 0;
+    T foo = fabs(Tw[idx2D(ns - 1, ns - 1, ldw)]);
+    T spike = fabs(s * Vw[idx2D(0, ns - 1, ldw)]);
+    if (bulge) {
+      foo += sqrt(fabs(Tw[idx2D(ns - 1, ns - 2, ldw)])) *
+             sqrt(fabs(Tw[idx2D(ns - 2, ns - 1, ldw)]));
+      spike = max(spike, fabs(s * Vw[idx2D(0, ns - 2, ldw)]));
+    }
+    if (foo == 0)
+      foo = fabs(s);
+    if (spike <= max(smlnum, ulp * foo)) {
+      ns -= bulge ? 2 : 1;
+    } else {
+      rocblas_int ifst = ns - 1;
+      hseqr_trexc(jw, Tw, ldw, Vw, ldw, ifst, ilst, ulp, sfmin, safmn2);
+      ilst += bulge ? 2 : 1;
+    }
+  }
+  __syncthreads();
+  if (ns == 0)
+    s = 0;
+
+  // the eigenvalues of the window, from its (reordered) Schur form
+  if (tid == 0) {
+    rocblas_int i = jw - 1;
+    while (i >= infqr) {
+      if (i == infqr || Tw[idx2D(i, i - 1, ldw)] == 0) {
+        WR[kwtop + i] = Tw[idx2D(i, i, ldw)];
+        WI[kwtop + i] = 0;
+        --i;
+      } else {
+        T aa = Tw[idx2D(i - 1, i - 1, ldw)];
+        T bb = Tw[idx2D(i - 1, i, ldw)];
+        T cc = Tw[idx2D(i, i - 1, ldw)];
+        T dd = Tw[idx2D(i, i, ldw)];
+        T cs, sn;
+        hseqr_lanv2(aa, bb, cc, dd, WR[kwtop + i - 1], WI[kwtop + i - 1],
+                    WR[kwtop + i], WI[kwtop + i], cs, sn, ulp, safmn2);
+        i -= 2;
+      }
+    }
+  }
+
+  const bool apply = (ns < jw || s == 0);
+  if (apply) {
+    if (ns > 1 && s != 0) {
+      // the reflector of the spike, then Tw(0:ns,0:ns) back to Hessenberg
+      // form (gehd2), all accumulated into Vw
+      if (tid == 0) {
+        for (rocblas_int j = 0; j < ns; ++j)
+          u[j] = Vw[idx2D(0, j, ldw)];
+        T tau;
+        hseqr_larfg(ns, u, tau, safmin);
+        u[0] = 1;
+        stau = tau;
+      }
+      for (rocblas_int k = tid; k < jw * jw; k += hipBlockDim_x) {
+        const rocblas_int i = k % jw;
+        const rocblas_int j = k / jw;
+        if (i > j + 1)
+          Tw[idx2D(i, j, ldw)] = 0;
+      }
+      __syncthreads();
+      hseqr_larf_left(ns, jw, u, stau, Tw, ldw);
+      __syncthreads();
+      hseqr_larf_right(ns, ns, u, stau, Tw, ldw);
+      hseqr_larf_right(jw, ns, u, stau, Vw, ldw);
+      __syncthreads();
+
+      for (rocblas_int i = 0; i < ns - 2; ++i) {
+        const rocblas_int len = ns - i - 1;
+        if (tid == 0) {
+          for (rocblas_int r = 0; r < len; ++r)
+            u[r] = Tw[idx2D(i + 1 + r, i, ldw)];
+          T tau;
+          hseqr_larfg(len, u, tau, safmin);
+          Tw[idx2D(i + 1, i, ldw)] = u[0];
+          for (rocblas_int r = 1; r < len; ++r)
+            Tw[idx2D(i + 1 + r, i, ldw)] = 0;
+          u[0] = 1;
+          stau = tau;
+        }
+        __syncthreads();
+        hseqr_larf_left(len, jw - i - 1, u, stau, &Tw[idx2D(i + 1, i + 1, ldw)],
+                        ldw);
+        __syncthreads();
+        hseqr_larf_right(ns, len, u, stau, &Tw[idx2D(0, i + 1, ldw)], ldw);
+        hseqr_larf_right(jw, len, u, stau, &Vw[idx2D(0, i + 1, ldw)], ldw);
+        __syncthreads();
+      }
+    }
+
+    // back into H: the spike is now s * Vw(0,0) * e1
+    if (tid == 0 && kwtop > 0)
+      H[idx2D(kwtop, kwtop - 1, ldh)] = s * Vw[idx2D(0, 0, ldw)];
+    for (rocblas_int k = tid; k < jw * jw; k += hipBlockDim_x) {
+      const rocblas_int i = k % jw;
+      const rocblas_int j = k / jw;
+      if (i <= j + 1)
+        H[idx2D(kwtop + i, kwtop + j, ldh)] = Tw[idx2D(i, j, ldw)];
+    }
+  }
+
+  if (tid == 0) {
+    state[HSEQR_KTOP] = ktop;
+    state[HSEQR_JW] = jw;
+    state[HSEQR_ND] = jw - ns;
+    state[HSEQR_LS] = ns - infqr;
+    state[HSEQR_APPLY] = apply ? 1 : 0;
+  }
+}
+
+// v := a multiple of (H - (sr1 + i * si1) I) * (H - (sr2 + i * si2) I) * e1
+// for the nr x nr (2 or 3) matrix H, as in LAPACK's laqr1; the two shifts are
+// real or complex conjugate
+template <typename T>
+__device__ void hseqr_laqr1(int nr, const T *H, rocblas_int ldh, T sr1,
+                            T si1, T sr2, T si2, T *v) {
+  const T h11 = H[idx2D(0, 0, ldh)];
+  const T h21 = H[idx2D(1, 0, ldh)];
+  if (nr == 2) {
+    const T s = fabs(h11 - sr2) + fabs(si2) + fabs(h21);
+    if (s == 0) {
+      v[0] = 0;
+      v[1] = 0;
+    } else {
+      const T h21s = h21 / s;
+      v[0] = h21s * H[idx2D(0, 1, ldh)] + (h11 - sr1) * ((h11 - sr2) / s) -
+             si1 * (si2 / s);
+      v[1] = h21s * (h11 + H[idx2D(1, 1, ldh)] - sr1 - sr2);
+    }
+  } else {
+    const T h31 = H[idx2D(2, 0, ldh)];
+    const T s = fabs(h11 - sr2) + fabs(si2) + fabs(h21) + fabs(h31);
+    if (s == 0) {
+      v[0] = 0;
+      v[1] = 0;
+      v[2] = 0;
+    } else {
+      const T h21s = h21 / s;
+      const T h31s = h31 / s;
+      v[0] = (h11 - sr1) * ((h11 - sr2) / s) - si1 * (si2 / s) +
+             H[idx2D(0, 1, ldh)] * h21s + H[idx2D(0, 2, ldh)] * h31s;
+      v[1] = h21s * (h11 + H[idx2D(1, 1, ldh)] - sr1 - sr2) +
+             H[idx2D(1, 2, ldh)] * h31s;
+      v[2] = h31s * (h11 + H[idx2D(2, 2, ldh)] - sr1 - sr2) +
+             h21s * H[idx2D(2, 1, ldh)];
+    }
+  }
+}
+
+// H(k+1,k) := 0 if it is negligible by the criterion of Ahues and Kressner
+// (vigilant deflation, as in laqr5), for k in ktop:kbot
+template <typename T>
+__device__ void hseqr_vigilant(T *H, rocblas_int ldh, rocblas_int k,
+                               rocblas_int ktop, rocblas_int kbot, T smlnum,
+                               T ulp) {
+  if (k < ktop || H[idx2D(k + 1, k, ldh)] == 0)
+    return;
+  const T hk1k = fabs(H[idx2D(k + 1, k, ldh)]);
+  T tst1 = fabs(H[idx2D(k, k, ldh)]) + fabs(H[idx2D(k + 1, k + 1, ldh)]);
+  if (tst1 == 0) {
+    if (k >= ktop + 1)
+      tst1 += fabs(H[idx2D(k, k - 1, ldh)]);
+    if (k >= ktop + 2)
+      tst1 += fabs(H[idx2D(k, k - 2, ldh)]);
+    if (k >= ktop + 3)
+      tst1 += fabs(H[idx2D(k, k - 3, ldh)]);
+    if (k <= kbot - 2)
+      tst1 += fabs(H[idx2D(k + 2, k + 1, ldh)]);
+    if (k <= kbot - 3)
+      tst1 += fabs(H[idx2D(k + 3, k + 1, ldh)]);
+    if (k <= kbot - 4)
+      tst1 += fabs(H[idx2D(k + 4, k + 1, ldh)]);
+  }
+  if (hk1k <= max(smlnum, ulp * tst1)) {
+    const T hkk1 = fabs(H[idx2D(k, k + 1, ldh)]);
+    const T h12 = max(hk1k, hkk1);
+    const T h21 = min(hk1k, hkk1);
+    const T hd = fabs(H[idx2D(k, k, ldh)] - H[idx2D(k + 1, k + 1, ldh)]);
+    const T hkk = fabs(H[idx2D(k + 1, k + 1, ldh)]);
+    const T h11 = max(hkk, hd);
+    const T h22 = min(hkk, hd);
+    const T scl = h11 + h12;
+    const T tst2 = h22 * (h11 / scl);
+    if (tst2 == 0 || h21 * (h12 / scl) <= max(smlnum, ulp * tst2))
+      H[idx2D(k + 1, k, ldh)] = 0;
+  }
+}
+
+/*
+ * The shifts of a sweep on the active block ktop:kbot of H, as in laqr0, in
+ * one workgroup: every HSEQR_KEXSH iterations without deflation ns
+ * exceptional ones; else the ls undeflated eigenvalues that aggressive
+ * early deflation left at the bottom of WR and WI, or, if they are fewer
+ * than ns / 2, the eigenvalues of the trailing ns x ns block (by lahqr on a
+ * copy in Tw; if it fails, the missing ones are H(kbot,kbot)). They are
+ * sorted and shuffled into pairs of real or complex conjugate shifts, and
+ * the nsw (even) that the sweep uses end up in WR and WI at kbot-nsw+1:kbot.
+ * The trash below the first bulge is cleared.
+ */
+template <typename T>
+__global__ void hseqr_shifts(rocblas_int n, T *H, rocblas_int ldh, T *WR,
+                             T *WI, rocblas_int ktop, rocblas_int kbot,
+                             rocblas_int ns, rocblas_int ls, bool exc, T *Tw,
+                             rocblas_int ldw, T ulp, T sfmin) {
+  __shared__ rocblas_int sinfo;
+  const int tid = hipThreadIdx_x;
+  const T safmn2 = ldexp(T(1), int(log2(sfmin / ulp) / 2));
+
+  rocblas_int ks = kbot - ls + 1;
+  if (exc || ls <= ns / 2)
+    ks = kbot - ns + 1;
+
+  if (!exc && ls <= ns / 2) {
+    for (rocblas_int k = tid; k < ns * ns; k += hipBlockDim_x) {
+      const rocblas_int i = k % ns;
+      const rocblas_int j = k / ns;
+      Tw[idx2D(i, j, ldw)] = (i <= j + 1) ? H[idx2D(ks + i, ks + j, ldh)] : 0;
+    }
+    if (tid == 0)
+      sinfo = 0;
+    __syncthreads();
+    hseqr_lahqr<T>(ns, Tw, ldw, WR + ks, WI + ks, false, (T *)nullptr, 1,
+                   false, &sinfo, ulp, sfmin);
+    __syncthreads();
+  }
+
+  if (tid == 0) {
+    if (exc) {
+      for (rocblas_int i = kbot; i >= max(ks + 1, ktop + 2); i -= 2) {
+        const T ss = fabs(H[idx2D(i, i - 1, ldh)]) +
+                     fabs(H[idx2D(i - 1, i - 2, ldh)]);
+        T aa = T(HSEQR_WILK1) * ss + H[idx2D(i, i, ldh)];
+        T bb = ss;
+        T cc = T(HSEQR_WILK2) * ss;
+        T dd = aa;
+        T cs, sn;
+        hseqr_lanv2(aa, bb, cc, dd, WR[i - 1], WI[i - 1], WR[i], WI[i], cs, sn,
+                    ulp, safmn2);
+      }
+      if (ks == ktop) {
+        WR[ks + 1] = H[idx2D(ks + 1, ks + 1, ldh)];
+        WI[ks + 1] = 0;
+        WR[ks] = WR[ks + 1];
+        WI[ks] = WI[ks + 1];
+      }
+    } else {
+      if (ls <= ns / 2) {
+        for (rocblas_int i = 0; i < sinfo; ++i) {
+          WR[ks + i] = H[idx2D(kbot, kbot, ldh)];
+          WI[ks + i] = 0;
+        }
+      }
+
+      // more candidates than needed: the smallest ones go to the bottom
+      if (kbot - ks + 1 > ns) {
+        bool sorted = false;
+        for (rocblas_int k = kbot; k > ks && !sorted; --k) {
+          sorted = true;
+          for (rocblas_int i = ks; i < k; ++i) {
+            if (fabs(WR[i]) + fabs(WI[i]) < fabs(WR[i + 1]) + fabs(WI[i + 1])) {
+              sorted = false;
+              const T r = WR[i];
+              WR[i] = WR[i + 1];
+              WR[i + 1] = r;
+              const T m = WI[i];
+              WI[i] = WI[i + 1];
+              WI[i + 1] = m;
+            }
+          }
+        }
+      }
+
+      // pairs of real shifts and complex conjugate pairs
+      for (rocblas_int i = kbot; i >= ks + 2; i -= 2) {
+        if (WI[i] != -WI[i - 1]) {
+          T swap = WR[i];
+          WR[i] = WR[i - 1];
+          WR[i - 1] = WR[i - 2];
+          WR[i - 2] = swap;
+          swap = WI[i];
+          WI[i] = WI[i - 1];
+          WI[i - 1] = WI[i - 2];
+          WI[i - 2] = swap;
+        }
+      }
+    }
+
+    // of two real shifts, both the one closer to H(kbot,kbot)
+    if (kbot - ks + 1 == 2 && WI[kbot] == 0) {
+      const T hkk = H[idx2D(kbot, kbot, ldh)];
+      if (fabs(WR[kbot] - hkk) < fabs(WR[kbot - 1] - hkk))
+        WR[kbot - 1] = WR[kbot];
+      else
+        WR[kbot] = WR[kbot - 1];
+    }
+
+    // the shifts of the sweep, complex conjugate pairs kept together
+    rocblas_int nsw = min(ns, kbot - ks + 1);
+    nsw -= nsw % 2;
+    T *sr = WR + kbot - nsw + 1;
+    T *si = WI + kbot - nsw + 1;
+    for (rocblas_int i = 0; i + 2 < nsw; i += 2) {
+      if (si[i] != -si[i + 1]) {
+        T swap = sr[i];
+        sr[i] = sr[i + 1];
+        sr[i + 1] = sr[i + 2];
+        sr[i + 2] = swap;
+        swap = si[i];
+        si[i] = si[i + 1];
+        si[i + 1] = si[i + 2];
+        si[i + 2] = swap;
+      }
+    }
+
+    if (ktop + 2 <= kbot)
+      H[idx2D(ktop + 2, ktop, ldh)] = 0;
+  }
+}
+
+/*
+ * One window of the small-bulge multishift sweep of LAPACK's laqr5 on the
+ * active block ktop:kbot of H, in one workgroup: the chain of nbmps 3 x 3
+ * bulges (shifts sr + i * si) is chased 2 * nbmps columns down, within
+ * rows and columns incol+1:incol+1+kdu, kdu = 4 * nbmps, and the
+ * reflectors are accumulated into U (kdu x kdu, leading dimension kdu), so
+ * that the rest of H and Z can be updated by gemms. Thread 0 makes the
+ * reflectors, one per bulge and column, which are applied by all threads;
+ * the reflector of bulge m is kept in Vb(0:3,m) (tau, v(1), v(2)) from one
+ * window to the next, for the delayed update of the row below it.
+ */
+template <typename T>
+__global__ void hseqr_chase(rocblas_int n, T *H, rocblas_int ldh,
+                            rocblas_int ktop, rocblas_int kbot,
+                            rocblas_int nbmps, const T *sr, const T *si,
+                            rocblas_int incol, T *U, T *Vb, T ulp, T sfmin) {
+  const int tid = hipThreadIdx_x;
+  const rocblas_int kdu = 4 * nbmps;
+  const rocblas_int ndcol = incol + kdu;
+  const rocblas_int jtop = max(ktop, incol);
+  const rocblas_int jbot = min(ndcol, kbot);
+  const T smlnum = sfmin * (T(kbot - ktop + 1) / ulp);
+  const T safmin = sfmin / ulp;
+
+  for (rocblas_int k = tid; k < kdu * kdu; k += hipBlockDim_x)
+    U[k] = (k % kdu == k / kdu) ? 1 : 0;
+  __syncthreads();
+
+  for (rocblas_int krcol = incol;
+       krcol <= min(incol + 2 * nbmps - 1, kbot - 2); ++krcol) {
+    // the bulges in the block, and whether the bottom one is 2 x 2
+    const rocblas_int mtop = max(0, (ktop - krcol) / 2);
+    const rocblas_int mbot = min(nbmps, (kbot - krcol - 1) / 2) - 1;
+    const rocblas_int m22 = mbot + 1;
+    const bool bmp22 = (m22 < nbmps) && (krcol + 2 * m22 == kbot - 2);
+
+    if (bmp22) {
+      const rocblas_int k = krcol + 2 * m22;
+      T *v = Vb + 3 * m22;
+      if (tid == 0) {
+        T w[3];
+        if (k == ktop - 1) {
+          hseqr_laqr1(2, &H[idx2D(k + 1, k + 1, ldh)], ldh, sr[2 * m22],
+                      si[2 * m22], sr[2 * m22 + 1], si[2 * m22 + 1], w);
+          hseqr_larfg(2, w, v[0], safmin);
+        } else {
+          w[0] = H[idx2D(k + 1, k, ldh)];
+          w[1] = H[idx2D(k + 2, k, ldh)];
+          hseqr_larfg(2, w, v[0], safmin);
+          H[idx2D(k + 1, k, ldh)] = w[0];
+          H[idx2D(k + 2, k, ldh)] = 0;
+        }
+        v[1] = w[1];
+        v[2] = 0;
+      }
+      __syncthreads();
+      const T t1 = v[0];
+      const T v2 = v[1];
+      const T t2 = t1 * v2;
+      for (rocblas_int j = jtop + tid; j <= min(kbot, k + 3);
+           j += hipBlockDim_x) {
+        const T refsum = H[idx2D(j, k + 1, ldh)] + v2 * H[idx2D(j, k + 2, ldh)];
+        H[idx2D(j, k + 1, ldh)] -= refsum * t1;
+        H[idx2D(j, k + 2, ldh)] -= refsum * t2;
+      }
+      const rocblas_int kms = k - incol;
+      for (rocblas_int j = tid; j < kdu; j += hipBlockDim_x) {
+        const T refsum =
+            t1 * (U[idx2D(j, kms, kdu)] + v2 * U[idx2D(j, kms + 1, kdu)]);
+        U[idx2D(j, kms, kdu)] -= refsum;
+        U[idx2D(j, kms + 1, kdu)] -= refsum * v2;
+      }
+      __syncthreads();
+      for (rocblas_int j = k + 1 + tid; j <= jbot; j += hipBlockDim_x) {
+        const T refsum = H[idx2D(k + 1, j, ldh)] + v2 * H[idx2D(k + 2, j, ldh)];
+        H[idx2D(k + 1, j, ldh)] -= refsum * t1;
+        H[idx2D(k + 2, j, ldh)] -= refsum * t2;
+      }
+      __syncthreads();
+      if (tid == 0)
+        hseqr_vigilant(H, ldh, k, ktop, kbot, smlnum, ulp);
+      __syncthreads();
+    }
+
+    // the 3 x 3 bulges, bottom to top: thread 0 finishes the bulge below
+    // (the column left of it and the deflation check) and makes the
+    // reflector, which all threads apply from the right
+    for (rocblas_int m = mbot; m >= mtop - 1; --m) {
+      if (tid == 0) {
+        if (m < mbot) {
+          const rocblas_int k = krcol + 2 * (m + 1);
+          const T *v = Vb + 3 * (m + 1);
+          const T t1 = v[0];
+          const T refsum = H[idx2D(k + 1, k + 1, ldh)] +
+                           v[1] * H[idx2D(k + 2, k + 1, ldh)] +
+                           v[2] * H[idx2D(k + 3, k + 1, ldh)];
+          H[idx2D(k + 1, k + 1, ldh)] -= refsum * t1;
+          H[idx2D(k + 2, k + 1, ldh)] -= refsum * t1 * v[1];
+          H[idx2D(k + 3, k + 1, ldh)] -= refsum * t1 * v[2];
+          hseqr_vigilant(H, ldh, k, ktop, kbot, smlnum, ulp);
+        }
+        if (m >= mtop) {
+          const rocblas_int k = krcol + 2 * m;
+          T *v = Vb + 3 * m;
+          const T *srm = sr + 2 * m;
+          const T *sim = si + 2 * m;
+          T w[3];
+          if (k == ktop - 1) {
+            // a new bulge
+            hseqr_laqr1(3, &H[idx2D(ktop, ktop, ldh)], ldh, srm[0], sim[0],
+                        srm[1], sim[1], w);
+            hseqr_larfg(3, w, v[0], safmin);
+            v[1] = w[1];
+            v[2] = w[2];
+          } else {
+            // the delayed update of the row below the bulge, then its
+            // reflector one column further
+            const T t1 = v[0];
+            const T refsum = v[2] * H[idx2D(k + 3, k + 2, ldh)];
+            H[idx2D(k + 3, k, ldh)] = -refsum * t1;
+            H[idx2D(k + 3, k + 1, ldh)] = -refsum * t1 * v[1];
+            H[idx2D(k + 3, k + 2, ldh)] -= refsum * t1 * v[2];
+
+            w[0] = H[idx2D(k + 1, k, ldh)];
+            w[1] = H[idx2D(k + 2, k, ldh)];
+            w[2] = H[idx2D(k + 3, k, ldh)];
+            T tau;
+            hseqr_larfg(3, w, tau, safmin);
+            const T beta = w[0];
+            bool keep = true;
+            if (H[idx2D(k + 3, k, ldh)] == 0 &&
+                H[idx2D(k + 3, k + 1, ldh)] == 0 &&
+                H[idx2D(k + 3, k + 2, ldh)] != 0) {
+              // the bulge has collapsed: reintroduce it if that is the
+              // smaller perturbation of H(k+1:k+3,k)
+              T vt[3];
+              hseqr_laqr1(3, &H[idx2D(k + 1, k + 1, ldh)], ldh, srm[0],
+                          sim[0], srm[1], sim[1], vt);
+              T taut;
+              hseqr_larfg(3, vt, taut, safmin);
+              const T rs = H[idx2D(k + 1, k, ldh)] +
+                           vt[1] * H[idx2D(k + 2, k, ldh)];
+              if (!(fabs(H[idx2D(k + 2, k, ldh)] - rs * taut * vt[1]) +
+                        fabs(rs * taut * vt[2]) >
+                    ulp * (fabs(H[idx2D(k, k, ldh)]) +
+                           fabs(H[idx2D(k + 1, k + 1, ldh)]) +
+                           fabs(H[idx2D(k + 2, k + 2, ldh)])))) {
+                H[idx2D(k + 1, k, ldh)] -= rs * taut;
+                H[idx2D(k + 2, k, ldh)] = 0;
+                H[idx2D(k + 3, k, ldh)] = 0;
+                v[0] = taut;
+                v[1] = vt[1];
+                v[2] = vt[2];
+                keep = false;
+              }
+            }
+            if (keep) {
+              H[idx2D(k + 1, k, ldh)] = beta;
+              H[idx2D(k + 2, k, ldh)] = 0;
+              H[idx2D(k + 3, k, ldh)] = 0;
+              v[0] = tau;
+              v[1] = w[1];
+              v[2] = w[2];
+            }
+          }
+        }
+      }
+      __syncthreads();
+      if (m >= mtop) {
+        const rocblas_int k = krcol + 2 * m;
+        const T *v = Vb + 3 * m;
+        const T t1 = v[0], v2 = v[1], v3 = v[2];
+        for (rocblas_int j = jtop + tid; j <= min(kbot, k + 3);
+             j += hipBlockDim_x) {
+          const T refsum = t1 * (H[idx2D(j, k + 1, ldh)] +
+                                 v2 * H[idx2D(j, k + 2, ldh)] +
+                                 v3 * H[idx2D(j, k + 3, ldh)]);
+          H[idx2D(j, k + 1, ldh)] -= refsum;
+          H[idx2D(j, k + 2, ldh)] -= refsum * v2;
+          H[idx2D(j, k + 3, ldh)] -= refsum * v3;
+        }
+      }
+      __syncthreads();
+    }
+
+    // the reflectors from the left on the rest of the window, one thread per
+    // column, and accumulated into U, one thread per row
+    const rocblas_int jfirst = max(ktop, krcol + 2 * mtop + 2);
+    for (rocblas_int j = jfirst + tid; j <= jbot; j += hipBlockDim_x) {
+      for (rocblas_int m = mbot; m >= mtop; --m) {
+        const rocblas_int k = krcol + 2 * m;
+        if (j < max(ktop, k + 2))
+          continue;
+        const T *v = Vb + 3 * m;
+        const T refsum =
+            v[0] * (H[idx2D(k + 1, j, ldh)] + v[1] * H[idx2D(k + 2, j, ldh)] +
+                    v[2] * H[idx2D(k + 3, j, ldh)]);
+        H[idx2D(k + 1, j, ldh)] -= refsum;
+        H[idx2D(k + 2, j, ldh)] -= refsum * v[1];
+        H[idx2D(k + 3, j, ldh)] -= refsum * v[2];
+      }
+    }
+    for (rocblas_int j = tid; j < kdu; j += hipBlockDim_x) {
+      for (rocblas_int m = mbot; m >= mtop; --m) {
+        const rocblas_int kms = krcol + 2 * m - incol;
+        const T *v = Vb + 3 * m;
+        const T refsum =
+            v[0] * (U[idx2D(j, kms, kdu)] + v[1] * U[idx2D(j, kms + 1, kdu)] +
+                    v[2] * U[idx2D(j, kms + 2, kdu)]);
+        U[idx2D(j, kms, kdu)] -= refsum;
+        U[idx2D(j, kms + 1, kdu)] -= refsum * v[1];
+        U[idx2D(j, kms + 2, kdu)] -= refsum * v[2];
+      }
+    }
+    __syncthreads();
+  }
+}
+
+// B := A for m x n matrices, one thread per entry (blockIdx.y is the column)
+template <typename T>
+__global__ void hseqr_copy(rocblas_int m, rocblas_int n, const T *A,
+                           rocblas_int lda, T *B, rocblas_int ldb) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < m && j < n)
+    B[idx2D(i, j, ldb)] = A[idx2D(i, j, lda)];
+}
+
+// zero the entries of H below its first subdiagonal (blockIdx.y is the
+// column)
+template <typename T>
+__global__ void hseqr_clear(rocblas_int n, T *H, rocblas_int ldh) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < n && i > j + 1)
+    H[idx2D(i, j, ldh)] = 0;
+}
+
+// the number of shifts recommended by LAPACK's iparmq for order n
+inline rocblas_int hseqr_iparmq(rocblas_int n) {
+  rocblas_int ns = 2;
+  if (n >= 30)
+    ns = 4;
+  if (n >= 60)
+    ns = 10;
+  if (n >= 150)
+    ns = max(10, n / int(lround(log2(double(n)))));
+  if (n >= 590)
+    ns = 64;
+  if (n >= 3000)
+    ns = 128;
+  if (n >= 6000)
+    ns = 256;
+  return max(2, ns - ns % 2);
+}
+
+// the number of shifts of a sweep, even and at most (n + 6) / 9 as in laqr0
+inline rocblas_int hseqr_nshifts(rocblas_int n) {
+  const rocblas_int ns = min(hseqr_iparmq(n), max(2, (n + 6) / 9));
+  return max(2, ns - ns % 2);
+}
+
+// the order of the deflation window (iparmq), at most (n - 1) / 3
+inline rocblas_int hseqr_nwindow(rocblas_int n) {
+  const rocblas_int ns = hseqr_iparmq(n);
+  const rocblas_int nw = (n <= 500) ? ns : 3 * ns / 2;
+  return min((n - 1) / 3, max(2, nw));
+}
+
+// the largest window: it doubles once after HSEQR_KEXNW iterations without
+// deflation
+inline rocblas_int hseqr_nwmax(rocblas_int n) {
+  return min((n - 1) / 3, 2 * hseqr_nwindow(n));
+}
+
+// elements of the workspace of rocsolver_hseqr_template: the window and its
+// transformation, a reflector, U and the reflectors of the sweep, and the
+// result of the gemms
+inline size_t hseqr_work_size(rocblas_int n) {
+  if (n < HSEQR_MULTISHIFT_MINSIZE)
+    return 0;
+  const size_t nwmax = hseqr_nwmax(n);
+  const size_t kdu = 2 * size_t(hseqr_nshifts(n));
+  return 2 * nwmax * nwmax + nwmax + kdu * kdu + 3 * kdu / 4 +
+         size_t(n) * max(kdu, nwmax);
+}
+
+// elements of iwork: the state of the iteration
+inline size_t hseqr_iwork_size(rocblas_int n) { return HSEQR_STATE; }
+
+/*
+ * Enqueue the eigenvalues (WR + i * WI) of the n x n upper Hessenberg
+ * matrix H, entries below its subdiagonal ignored, by the double-shift QR
+ * iteration (see hseqr_kernel). With wantt H gets the real Schur form T,
+ * and with wantz Z := Z * Q for H = Q * T * Q**T. info is a device
+ * pointer.
+ */
+template <typename T>
+void rocsolver_hseqr_async_template(rocblas_handle handle, rocblas_int n,
+                                    T *H, rocblas_int ldh, T *WR, T *WI,
+                                    bool wantt, T *Z, rocblas_int ldz,
+                                    bool wantz, rocblas_int *info) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  hipLaunchKernelGGL(hseqr_kernel<T>, dim3(1), dim3(HSEQR_BLOCKSIZE), 0,
+                     stream, n, H, ldh, WR, WI, wantt, Z, ldz, wantz, info,
+                     numeric_limits<T>::epsilon(), numeric_limits<T>::min());
+}
+
+// C := op(A) * B for the m x nc matrix C, through W as C overlaps A or B
+template <typename T>
+void hseqr_gemm(rocblas_handle handle, rocblas_operation transA,
+                rocblas_int m, rocblas_int nc, rocblas_int k, const T *A,
+                rocblas_int lda, const T *B, rocblas_int ldb, T *C,
+                rocblas_int ldc, const T *one, const T *zero, T *W) {
+  if (m <= 0 || nc <= 0)
+    return;
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const rocblas_int bs = HSEQR_BLOCKSIZE;
+  rocblas_gemm<T>(handle, transA, rocblas_operation_none, m, nc, k, one, A,
+                  lda, B, ldb, zero, W, m);
+  hipLaunchKernelGGL(hseqr_copy<T>, dim3((m - 1) / bs + 1, nc), dim3(bs), 0,
+                     stream, m, nc, W, m, C, ldc);
+}
+
+/*
+ * The same as rocsolver_hseqr_async_template, by the multishift iteration
+ * for n >= HSEQR_MULTISHIFT_MINSIZE. Unlike the async templates, it waits
+ * for the device: the sizes of the gemms depend on the active block and on
+ * what deflated, so the HSEQR_STATE integers of the state are read back
+ * once per iteration. If the active block does not split within 30 *
+ * max(10, n) iterations, info gets its last row + 1. one and zero are
+ * device constants, work has hseqr_work_size(n) elements and iwork
+ * hseqr_iwork_size(n).
+ */
+template <typename T>
+void rocsolver_hseqr_template(rocblas_handle handle, rocblas_int n, T *H,
+                              rocblas_int ldh, T *WR, T *WI, bool wantt, T *Z,
+                              rocblas_int ldz, bool wantz, rocblas_int *info,
+                              const T *one, const T *zero, T *work,
+                              rocblas_int *iwork) {
+  if (n < HSEQR_MULTISHIFT_MINSIZE) {
+    rocsolver_hseqr_async_template<T>(handle, n, H, ldh, WR, WI, wantt, Z, ldz,
+                                      wantz, info);
+    return;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const T ulp = numeric_limits<T>::epsilon();
+  const T sfmin = numeric_limits<T>::min();
+  const rocblas_int bs = HSEQR_BLOCKSIZE;
+  const rocblas_int nsr = hseqr_nshifts(n);
+  const rocblas_int nwr = hseqr_nwindow(n);
+  const rocblas_int nwmax = hseqr_nwmax(n);
+  const rocblas_int kdumax = 2 * nsr;
+  T *Tw = work;
+  T *Vw = Tw + size_t(nwmax) * nwmax;
+  T *u = Vw + size_t(nwmax) * nwmax;
+  T *U = u + nwmax;
+  T *Vb = U + size_t(kdumax) * kdumax;
+  T *W = Vb + 3 * kdumax / 4;
+
+  // the entries below the first subdiagonal can be read, so they are zero
+  hipLaunchKernelGGL(hseqr_clear<T>, dim3((n - 1) / bs + 1, n), dim3(bs), 0,
+                     stream, n, H, ldh);
+
+  rocblas_int state[HSEQR_STATE];
+  rocblas_int kbot = n - 1, nw = nwr, ndfl = 1;
+  const rocblas_int itmax = 30 * max(10, n);
+  for (rocblas_int it = 0; kbot >= 0 && it < itmax; ++it) {
+    // aggressive early deflation, on a larger window after HSEQR_KEXNW
+    // iterations without deflation
+    const rocblas_int nwreq = (ndfl < HSEQR_KEXNW) ? nwr : 2 * nw;
+    hipLaunchKernelGGL(hseqr_aed<T>, dim3(1), dim3(bs), 0, stream, n, H, ldh,
+                       WR, WI, kbot, nwreq, nwmax, Tw, Vw, nwmax, u, iwork,
+                       ulp, sfmin);
+    hipMemcpyAsync(state, iwork, sizeof(rocblas_int) * HSEQR_STATE,
+                   hipMemcpyDeviceToHost, stream);
+    hipStreamSynchronize(stream);
+    const rocblas_int ktop = state[HSEQR_KTOP];
+    const rocblas_int ld = state[HSEQR_ND];
+    const rocblas_int ls = state[HSEQR_LS];
+    nw = state[HSEQR_JW];
+
+    // the transformation of the window on the rows above it, the columns
+    // right of it and Z
+    if (state[HSEQR_APPLY] && nw > 1) {
+      const rocblas_int kwtop = kbot - nw + 1;
+      const rocblas_int ltop = wantt ? 0 : ktop;
+      hseqr_gemm<T>(handle, rocblas_operation_none, kwtop - ltop, nw, nw,
+                    &H[idx2D(ltop, kwtop, ldh)], ldh, Vw, nwmax,
+                    &H[idx2D(ltop, kwtop, ldh)], ldh, one, zero, W);
+      if (wantt)
+        hseqr_gemm<T>(handle, rocblas_operation_transpose, nw, n - 1 - kbot,
+                      nw, Vw, nwmax, &H[idx2D(kwtop, kbot + 1, ldh)], ldh,
+                      &H[idx2D(kwtop, kbot + 1, ldh)], ldh, one, zero, W);
+      if (wantz)
+        hseqr_gemm<T>(handle, rocblas_operation_none, n, nw, nw,
+                      &Z[idx2D(0, kwtop, ldz)], ldz, Vw, nwmax,
+                      &Z[idx2D(0, kwtop, ldz)], ldz, one, zero, W);
+    }
+    kbot -= ld;
+
+    // a sweep, unless enough deflated (HSEQR_NIBBLE percent of the window)
+    // or the block left is small enough for the window to take it
+    if (kbot > ktop &&
+        (ld == 0 || (100 * ld <= nw * HSEQR_NIBBLE &&
+                     kbot - ktop + 1 > min(HSEQR_MULTISHIFT_MINSIZE, nwmax)))) {
+      rocblas_int ns = min(nsr, max(2, kbot - ktop));
+      ns -= ns % 2;
+      const bool exc = (ndfl % HSEQR_KEXSH == 0);
+      rocblas_int nsw = (exc || ls <= ns / 2) ? ns : min(ns, ls);
+      nsw -= nsw % 2;
+      hipLaunchKernelGGL(hseqr_shifts<T>, dim3(1), dim3(bs), 0, stream, n, H,
+                         ldh, WR, WI, ktop, kbot, ns, ls, exc, Tw, nwmax, ulp,
+                         sfmin);
+
+      const rocblas_int nbmps = nsw / 2;
+      const rocblas_int kdu = 4 * nbmps;
+      const T *sr = WR + kbot - nsw + 1;
+      const T *si = WI + kbot - nsw + 1;
+      const rocblas_int jtop = wantt ? 0 : ktop;
+      const rocblas_int jbot = wantt ? n - 1 : kbot;
+      for (rocblas_int incol = ktop - 2 * nbmps + 1; incol <= kbot - 2;
+           incol += 2 * nbmps) {
+        hipLaunchKernelGGL(hseqr_chase<T>, dim3(1), dim3(bs), 0, stream, n, H,
+                           ldh, ktop, kbot, nbmps, sr, si, incol, U, Vb, ulp,
+                           sfmin);
+
+        // U on rows r0:r0+nu of H right of the window, on its columns
+        // above it, and on Z
+        const rocblas_int ndcol = incol + kdu;
+        const rocblas_int k1 = max(0, ktop - incol - 1);
+        const rocblas_int nu = kdu - max(0, ndcol - kbot) - k1;
+        const rocblas_int r0 = incol + 1 + k1;
+        const rocblas_int c0 = min(ndcol, kbot) + 1;
+        const T *Uk = U + idx2D(k1, k1, kdu);
+        hseqr_gemm<T>(handle, rocblas_operation_transpose, nu, jbot - c0 + 1,
+                      nu, Uk, kdu, &H[idx2D(r0, c0, ldh)], ldh,
+                      &H[idx2D(r0, c0, ldh)], ldh, one, zero, W);
+        hseqr_gemm<T>(handle, rocblas_operation_none, max(ktop, incol) - jtop,
+                      nu, nu, &H[idx2D(jtop, r0, ldh)], ldh, Uk, kdu,
+                      &H[idx2D(jtop, r0, ldh)], ldh, one, zero, W);
+        if (wantz)
+          hseqr_gemm<T>(handle, rocblas_operation_none, n, nu, nu,
+                        &Z[idx2D(0, r0, ldz)], ldz, Uk, kdu,
+                        &Z[idx2D(0, r0, ldz)], ldz, one, zero, W);
+      }
+    }
+    ndfl = (ld > 0) ? 1 : ndfl + 1;
+  }
+
+  const rocblas_int hinfo = kbot + 1;
+  if (kbot >= 0)
+    hipMemcpyAsync(info, &hinfo, sizeof(rocblas_int), hipMemcpyHostToDevice,
+                   stream);
+  hipLaunchKernelGGL(hseqr_clear<T>, dim3((n - 1) / bs + 1, n), dim3(bs), 0,
+                     stream, n, H, ldh);
+  hipStreamSynchronize(stream);
+}
+
+#undef HSEQR_KTOP
+#undef HSEQR_JW
+#undef HSEQR_ND
+#undef HSEQR_LS
+#undef HSEQR_APPLY
+#undef HSEQR_STATE
+#undef HSEQR_KEXNW
+#undef HSEQR_KEXSH
+#undef HSEQR_WILK1
+#undef HSEQR_WILK2
+
+#endif /* ROCLAPACK_HSEQR_HPP */
@@ -0,0 +1,310 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_LACN2_HPP
+#define ROCLAPACK_LACN2_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+// iterations of the estimator as in the reference LAPACK, and the largest
+// number of products with inv(A) or inv(A)**T it may ask for
+#define LACN2_ITMAX 5
+#define LACN2_NSOLVES (2 * LACN2_ITMAX + 1)
+
+// where the estimator is to continue after the next product (0: finished),
+// which product it expects, and the index of the last unit vector
+template <typename T> struct lacn2_state {
+  T est;
+  rocblas_int jump;
+  rocblas_int want;
+  rocblas_int iter;
+  rocblas_int j;
+};
+
+// sum of |x(i)| over the workgroup, the same in all threads
+template <typename T>
+__device__ T lacn2_asum(rocblas_int n, const T *x, T *sred) {
+  const int tid = hipThreadIdx_x;
+  T s = 0;
+  for (rocblas_int i = tid; i < n; i += LACN2_BLOCKSIZE)
+    s += fabs(x[i]);
+  sred[tid] = s;
+  __syncthreads();
+  for (int st = LACN2_BLOCKSIZE / 2; st > 0; st >>= 1) {
+    if (tid < st)
+      sred[tid] += sred[tid + st];
+    __syncthreads();
+  }
+  s = sred[0];
+  __syncthreads();
+  return s;
+}
+
+// first index of the largest |x(i)|, the same in all threads
+template <typename T>
+__device__ rocblas_int lacn2_iamax(rocblas_int n, const T *x, T *sred,
+                                   rocblas_int *sidx) {
+  const int tid = hipThreadIdx_x;
+  T m = -1;
+  rocblas_int im = 0;
+  for (rocblas_int i = tid; i < n; i += LACN2_BLOCKSIZE) {
+    if (fabs(x[i]) > m) {
+      m = fabs(x[i]);
+      im = i;
+    }
+  }
+  sred[tid] = m;
+  sidx[tid] = im;
+  __syncthreads();
+  for (int st = LACN2_BLOCKSIZE / 2; st > 0; st >>= 1) {
+    if (tid < st &&
+        (sred[tid + st] > sred[tid] ||
+         (sred[tid + st] == sred[tid] && sidx[tid + st] < sidx[tid]))) {
+      sred[tid] = sred[tid + st];
+      sidx[tid] = sidx[tid + st];
+    }
+    __syncthreads();
+  }
+  im = sidx[0];
+  __syncthreads();
+  return im;
+}
+
+/*
+ * One step of the 1-norm estimator of Hager and Higham (LAPACK's lacn2), run by
+ * one workgroup per estimate. Between two steps the caller multiplies x by
+ * inv(A) (kase = 1) or inv(A)**T (kase = 2) in place, always alternating and
+ * starting with kase = 1; kase is the product just done, 0 for the first step.
+ * The estimator does not always want the next product of this fixed sequence: a
+ * product it did not ask for is undone from the copy xs. This way all decisions
+ * stay on the device and the caller never synchronizes.
+ *
+ * work holds the n x batch matrices of the vectors x, xs, v and the sign
+ * vectors xi one after the other, so that the products of all batch
+ * estimates are taken at once.
+ */
+template <typename T>
+__global__ void lacn2_step(rocblas_int n, rocblas_int batch, rocblas_int kase,
+                           T *work, lacn2_state<T> *state) {
+
+  const int tid = hipThreadIdx_x;
+  const rocblas_int b = hipBlockIdx_x;
+  T *x = work + b * n;
+  T *xs = x + batch * n;
+  T *v = xs + batch * n;
+  T *xi = v + batch * n;
+  state += b;
+
+  __shared__ T sred[LACN2_BLOCKSIZE];
+  __shared__ rocblas_int sidx[LACN2_BLOCKSIZE];
+
+  lacn2_state<T> st;
+  if (kase == 0) {
+    st.est = 0;
+    st.jump = 1;
+    st.want = 1;
+    st.iter = 0;
+    st.j = 0;
+    for (rocblas_int i = tid; i < n; i += LACN2_BLOCKSIZE)
+      x[i] = xs[i] = static_cast<T>(1) / n;
+    if (tid == 0)
+      *state = st;
+    return;
+  }
+
+  st = *state;
+  if (st.jump == 0)
+    return;
+  if (st.want != kase) {
+    for (rocblas_int i = tid; i < n; i += LACN2_BLOCKSIZE)
+      x[i] = xs[i];
+    return;
+  }
+
+  bool alternate = false;
+  bool unit = false;
+
+  switch (st.jump) {
+  case 1:
+    // x was overwritten by inv(A)*x
+    if (n == 1) {
+      if (tid == 0)
+        v[0] = x[0];
+      st.est = fabs(x[0]);
+      st.jump = 0;
+      break;
+    }
+    st.est = lacn2_asum(n, x, sred);
+    for (rocblas_int i = tid; i < n; i += LACN2_BLOCKSIZE)
+      x[i] = xi[i] = (x[i] >= 0) ? 1 : -1;
+    st.want = 2;
+    st.jump = 2;
+    break;
+
+  case 2:
+    // x was overwritten by inv(A)**T*x
+    st.j = lacn2_iamax(n, x, sred, sidx);
+    st.iter = 2;
+    unit = true;
+    break;
+
+  case 3: {
+    // x was overwritten by inv(A)*x
+    for (rocblas_int i = tid; i < n; i += LACN2_BLOCKSIZE)
+      v[i] = x[i];
+    const T estold = st.est;
+    st.est = lacn2_asum(n, v, sred);
+
+    // a repeated sign vector means convergence
+    T diff = 0;
+    for (rocblas_int i = tid; i < n; i += LACN2_BLOCKSIZE)
+      if (((x[i] >= 0) ? 1 : -1) != xi[i])
+        diff = 1;
+    sred[tid] = diff;
+    __syncthreads();
+    for (int s = LACN2_BLOCKSIZE / 2; s > 0; s >>= 1) {
+      if (tid < s)
+        sred[tid] += sred[tid + s];
+      __syncthreads();
+    }
+    diff = sred[0];
+    __syncthreads();
+
+    if (diff == 0 || st.est <= estold) {
+      alternate = true;
+    } else {
+      for (rocblas_int i = tid; i < n; i += LACN2_BLOCKSIZE)
+        x[i] = xi[i] = (x[i] >= 0) ? 1 : -1;
+      st.want = 2;
+      st.jump = 4;
+    }
+    break;
+  }
+
+  case 4: {
+    // x was overwritten by inv(A)**T*x
+    const rocblas_int jlast = st.j;
+    st.j = lacn2_iamax(n, x, sred, sidx);
+    if (x[jlast] != fabs(x[st.j]) && st.iter < LACN2_ITMAX) {
+      st.iter++;
+      unit = true;
+    } else {
+      alternate = true;
+    }
+    break;
+  }
+
+  case 5: {
+    // x was overwritten by inv(A)*x for the alternating sign vector
+    const T temp = 2 * (lacn2_asum(n, x, sred) / (3 * n));
+    if (temp > st.est) {
+      for (rocblas_int i = tid; i < n; i += LACN2_BLOCKSIZE)
+        v[i] = x[i];
+      st.est = temp;
+    }
+    st.jump = 0;
+    break;
+  }
+  }
+
+  __syncthreads();
+  if (unit) {
+    // continue with the j-th unit vector
+    for (rocblas_int i = tid; i < n; i += LACN2_BLOCKSIZE)
+      x[i] = (i == st.j) ? 1 : 0;
+    st.want = 1;
+    st.jump = 3;
+  } else if (alternate) {
+    // final test with a vector of alternating signs
+    for (rocblas_int i = tid; i < n; i += LACN2_BLOCKSIZE)
+      x[i] = ((i % 2) ? -1 : 1) * (1 + static_cast<T>(i) / (n - 1));
+    st.want = 1;
+    st.jump = 5;
+  }
+
+  for (rocblas_int i = tid; i < n; i += LACN2_BLOCKSIZE)
+    xs[i] = x[i];
+  if (tid == 0)
+    *state = st;
+}
+
+/*
+ * Reciprocal condition number from the estimate of the norm of inv(A) and
+ * the norm of A; zero for a singular (or numerically singular) matrix.
+ */
+template <typename T>
+__global__ void lacn2_rcond(rocblas_int n, const lacn2_state<T> *state,
+                            const T *anorm, T *rcond) {
+  if (hipBlockIdx_x == 0 && hipThreadIdx_x == 0) {
+    if (n == 0) {
+      *rcond = 1;
+    } else {
+      const T ainvnm = state->est;
+      *rcond = (*anorm != 0 && ainvnm > 0 && !isinf(ainvnm))
+                   ? (1 / ainvnm) / *anorm
+                   : 0;
+    }
+  }
+}
+
+/*
+ * Enqueue batch estimates of the 1-norm of n x n matrices M, left in
+ * state(b).est on the device. solve(kase, x) must enqueue x := M*x
+ * (kase = 1) or M**T*x (kase = 2) for the n x batch matrix x (leading
+ * dimension n) on the device, column b with the b-th matrix. work needs
+ * 4*n*batch elements.
+ */
+template <typename T, typename Solve>
+void roclapack_lacn2_template(rocblas_handle handle, rocblas_int n,
+                              rocblas_int batch, Solve solve, T *work,
+                              lacn2_state<T> *state) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  if (n > 0 && batch > 0) {
+    rocblas_int kase = 0;
+    for (rocblas_int s = 0; s <= LACN2_NSOLVES; ++s) {
+      hipLaunchKernelGGL(lacn2_step<T>, dim3(batch), dim3(LACN2_BLOCKSIZE), 0,
+                         stream, n, batch, kase, work, state);
+      if (s < LACN2_NSOLVES) {
+        kase = (s % 2 == 0) ? 1 : 2;
+        solve(kase, work);
+      }
+    }
+  }
+}
+
+/*
+ * Enqueue the estimate of the 1-norm of inv(A) and the reciprocal condition
+ * number rcond = 1 / (norm(A) * norm(inv(A))), both left in device memory.
+ * solve(kase, x) must enqueue x := inv(A)*x (kase = 1) or inv(A)**T*x
+ * (kase = 2) for the n-vector x on the device. work needs 4*n elements.
+ */
+template <typename T, typename Solve>
+void roclapack_lacn2_rcond_template(rocblas_handle handle, rocblas_int n,
+                                    Solve solve, const T *anorm, T *rcond,
+                                    T *work, lacn2_state<T> *state) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  roclapack_lacn2_template<T>(handle, n, 1, solve, work, state);
+
+  hipLaunchKernelGGL(lacn2_rcond<T>, dim3(1), dim3(1), 0, stream, n, state,
+                     anorm, rcond);
+}
+
+#endif /* ROCLAPACK_LACN2_HPP */
@@ -0,0 +1,293 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_LANGE_HPP
+#define ROCLAPACK_LANGE_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+// |A(i, j)| of a general matrix
+template <typename T> struct lange_general {
+  __device__ T operator()(const T *A, rocblas_int lda, rocblas_int i,
+                          rocblas_int j) const {
+    return fabs(A[i + j * lda]);
+  }
+};
+
+// |A(i, j)| of a symmetric matrix stored in the triangle uplo
+template <typename T> struct lange_symmetric {
+  rocblas_fill uplo;
+
+  __device__ T operator()(const T *A, rocblas_int lda, rocblas_int i,
+                          rocblas_int j) const {
+    const bool stored = (uplo == rocblas_fill_upper) ? (i <= j) : (i >= j);
+    return stored ? fabs(A[i + j * lda]) : fabs(A[j + i * lda]);
+  }
+};
+
+// |A(i, j)| of an upper or lower trapezoidal matrix, with an implicit unit
+// diagonal if diag is rocblas_diagonal_unit
+template <typename T> struct lange_trapezoidal {
+  rocblas_fill uplo;
+  rocblas_diagonal diag;
+
+  __device__ T operator()(const T *A, rocblas_int lda, rocblas_int i,
+                          rocblas_int j) const {
+    if (i == j && diag == rocblas_diagonal_unit)
+      return 1;
+    const bool stored = (uplo == rocblas_fill_upper) ? (i <= j) : (i >= j);
+    return stored ? fabs(A[i + j * lda]) : 0;
+  }
+};
+
+// the larger of a and b, or NaN if either one is, as LAPACK's disnan checks
+template <typename T> __device__ T lange_max(T a, T b) {
+  return (a >= b || a != a) ? a : b;
+}
+
+// the maximum (Max) or sum of v over the workgroup, the same in all threads
+template <typename T, bool Max> __device__ T lange_reduce(T v, T *sred) {
+  const int tid = hipThreadIdx_x;
+  sred[tid] = v;
+  __syncthreads();
+  for (int s = LANGE_BLOCKSIZE / 2; s > 0; s >>= 1) {
+    if (tid < s)
+      sred[tid] = Max ? lange_max(sred[tid], sred[tid + s])
+                      : sred[tid] + sred[tid + s];
+    __syncthreads();
+  }
+  v = sred[0];
+  __syncthreads();
+  return v;
+}
+
+/*
+ * First pass over the columns, one workgroup per column j of matrix b of
+ * the batch: work(j) gets the column sum (1-norm) or the column maximum (max
+ * and Frobenius norm). For the Frobenius norm the column is then summed
+ * again scaled by its maximum, as in LAPACK's lassq, and work(n + j) gets
+ * the scaled sum of squares.
+ */
+template <typename T, typename Elem>
+__global__ void lange_columns(rocblas_int m, rocblas_int n,
+                              rocsolver_norm_type norm, const T *A,
+                              rocblas_int lda, rocblas_int strideA, Elem elem,
+                              T *work, rocblas_int ldw) {
+  const int tid = hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_x;
+  const rocblas_int b = hipBlockIdx_y;
+  A += b * strideA;
+  work += b * ldw;
+
+  __shared__ T sred[LANGE_BLOCKSIZE];
+
+  T v = 0;
+  if (norm == rocsolver_norm_one) {
+    for (rocblas_int i = tid; i < m; i += LANGE_BLOCKSIZE)
+      v += elem(A, lda, i, j);
+    v = lange_reduce<T, false>(v, sred);
+  } else {
+    for (rocblas_int i = tid; i < m; i += LANGE_BLOCKSIZE)
+      v = lange_max(v, elem(A, lda, i, j));
+    v = lange_reduce<T, true>(v, sred);
+  }
+
+  if (norm == rocsolver_norm_frobenius) {
+    const T scale = v;
+    T ssq = 0;
+    if (scale > 0) {
+      for (rocblas_int i = tid; i < m; i += LANGE_BLOCKSIZE) {
+        const T a = elem(A, lda, i, j) / scale;
+        ssq += a * a;
+      }
+    }
+    ssq = lange_reduce<T, false>(ssq, sred);
+    if (tid == 0)
+      work[n + j] = ssq;
+  }
+
+  if (tid == 0)
+    work[j] = v;
+}
+
+/*
+ * First pass of the infinity-norm, one thread per row i of matrix b of the
+ * batch: work(i) gets the row sum. Neighbouring threads read neighbouring
+ * elements of each column.
+ */
+template <typename T, typename Elem>
+__global__ void lange_rows(rocblas_int m, rocblas_int n, const T *A,
+                           rocblas_int lda, rocblas_int strideA, Elem elem,
+                           T *work, rocblas_int ldw) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int b = hipBlockIdx_y;
+  A += b * strideA;
+  work += b * ldw;
+
+  if (i < m) {
+    T v = 0;
+    for (rocblas_int j = 0; j < n; ++j)
+      v += elem(A, lda, i, j);
+    work[i] = v;
+  }
+}
+
+/*
+ * Second pass, one workgroup per matrix b of the batch: the largest of the
+ * len partial results in work, or for the Frobenius norm the scaled sums of
+ * squares combined under a common scale, written to result(b).
+ */
+template <typename T>
+__global__ void lange_finish(rocblas_int len, rocsolver_norm_type norm,
+                             const T *work, rocblas_int ldw, T *result) {
+  const int tid = hipThreadIdx_x;
+  const rocblas_int b = hipBlockIdx_x;
+  work += b * ldw;
+
+  __shared__ T sred[LANGE_BLOCKSIZE];
+
+  T v = 0;
+  for (rocblas_int k = tid; k < len; k += LANGE_BLOCKSIZE)
+    v = lange_max(v, work[k]);
+  v = lange_reduce<T, true>(v, sred);
+
+  if (norm == rocsolver_norm_frobenius) {
+    const T scale = v;
+    T ssq = 0;
+    if (scale > 0) {
+      for (rocblas_int k = tid; k < len; k += LANGE_BLOCKSIZE) {
+        const T r = work[k] / scale;
+        ssq += work[len + k] * r * r;
+      }
+    }
+    ssq = lange_reduce<T, false>(ssq, sred);
+    v = scale * sqrt(ssq);
+  }
+
+  if (tid == 0)
+    result[b] = v;
+}
+
+// workspace of the norms of batch_count m x n matrices, ldw per matrix
+inline rocblas_int lange_worksize(rocblas_int m, rocblas_int n) {
+  return 2 * max(1, max(m, n));
+}
+
+/*
+ * Enqueue the norms of the batch_count m x n matrices A + b*strideA into
+ * result(b) in device memory, with elements read through elem. Symmetric
+ * matrices take the column pass for the infinity-norm too.
+ */
+template <typename T, typename Elem>
+void roclapack_lange_async_template(rocblas_handle handle,
+                                    rocsolver_norm_type norm, rocblas_int m,
+                                    rocblas_int n, const T *A, rocblas_int lda,
+                                    rocblas_int strideA, Elem elem, T *result,
+                                    rocblas_int batch_count, T *work,
+                                    bool rowsAsColumns = false) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const rocblas_int ldw = lange_worksize(m, n);
+  rocblas_int len = n;
+
+  if (m > 0 && n > 0) {
+    if (norm == rocsolver_norm_inf && !rowsAsColumns) {
+      const rocblas_int blocks = (m - 1) / LANGE_BLOCKSIZE + 1;
+      hipLaunchKernelGGL((lange_rows<T, Elem>), dim3(blocks, batch_count),
+                         dim3(LANGE_BLOCKSIZE), 0, stream, m, n, A, lda,
+                         strideA, elem, work, ldw);
+      len = m;
+    } else {
+      hipLaunchKernelGGL((lange_columns<T, Elem>), dim3(n, batch_count),
+                         dim3(LANGE_BLOCKSIZE), 0, stream, m, n,
+                         norm == rocsolver_norm_inf ? rocsolver_norm_one
+                                                    : norm,
+                         A, lda, strideA, elem, work, ldw);
+    }
+  } else {
+    len = 0;
+  }
+
+  hipLaunchKernelGGL(lange_finish<T>, dim3(batch_count), dim3(LANGE_BLOCKSIZE),
+                     0, stream, len, norm, work, ldw, result);
+}
+
+// argument checks shared by lange, lansy and lantr
+inline rocblas_status lange_check_args(rocsolver_norm_type norm,
+                                       rocblas_int m, rocblas_int n,
+                                       rocblas_int lda,
+                                       rocblas_int batch_count) {
+  if (m < 0 || n < 0 || batch_count < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, m)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (norm != rocsolver_norm_one && norm != rocsolver_norm_inf &&
+             norm != rocsolver_norm_max && norm != rocsolver_norm_frobenius) {
+    return rocblas_status_not_implemented;
+  }
+  return rocblas_status_success;
+}
+
+/*
+ * Generic two-pass norm: a first pass over the columns (or the rows for the
+ * infinity-norm) leaves one partial result per column (row) in a workspace,
+ * a second pass reduces them. Nothing but the workspace leaves the device.
+ */
+template <typename T, typename Elem>
+rocblas_status
+roclapack_lange_generic_template(rocblas_handle handle,
+                                 rocsolver_norm_type norm, rocblas_int m,
+                                 rocblas_int n, const T *A, rocblas_int lda,
+                                 rocblas_int strideA, Elem elem, T *result,
+                                 rocblas_int batch_count, bool rowsAsColumns) {
+
+  const rocblas_status status = lange_check_args(norm, m, n, lda, batch_count);
+  if (status != rocblas_status_success || batch_count == 0)
+    return status;
+
+  T *work;
+  hipMalloc(&work, sizeof(T) * lange_worksize(m, n) * batch_count);
+
+  roclapack_lange_async_template<T>(handle, norm, m, n, A, lda, strideA, elem,
+                                    result, batch_count, work, rowsAsColumns);
+
+  hipFree(work);
+
+  return rocblas_status_success;
+}
+
+/*
+ * The 1-norm, infinity-norm, largest absolute element or Frobenius norm of
+ * the general m x n matrices A + b*strideA, b < batch_count, as LAPACK's
+ * lange; result(b) is in device memory.
+ */
+template <typename T>
+rocblas_status
+rocsolver_lange_template(rocblas_handle handle, rocsolver_norm_type norm,
+                         rocblas_int m, rocblas_int n, const T *A,
+                         rocblas_int lda, rocblas_int strideA, T *result,
+                         rocblas_int batch_count) {
+  return roclapack_lange_generic_template<T>(handle, norm, m, n, A, lda,
+                                             strideA, lange_general<T>(),
+                                             result, batch_count, false);
+}
+
+#endif /* ROCLAPACK_LANGE_HPP */
@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_lansy.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_slansy(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_fill uplo, rocsolver_int n, const float *A,
+                 rocsolver_int lda, float *result) {
+  return rocsolver_lansy_template<float>(handle, norm, uplo, n, A, lda, 0,
+                                         result, 1);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_slansy_strided_batched(rocsolver_handle handle,
+                                 rocsolver_norm_type norm, rocsolver_fill uplo,
+                                 rocsolver_int n, const float *A,
+                                 rocsolver_int lda, rocsolver_int strideA,
+                                 float *result, rocsolver_int batch_count) {
+  return rocsolver_lansy_template<float>(handle, norm, uplo, n, A, lda, strideA,
+                                         result, batch_count);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dlansy(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_fill uplo, rocsolver_int n, const double *A,
+                 rocsolver_int lda, double *result) {
+  return rocsolver_lansy_template<double>(handle, norm, uplo, n, A, lda, 0,
+                                          result, 1);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dlansy_strided_batched(rocsolver_handle handle,
+                                 rocsolver_norm_type norm, rocsolver_fill uplo,
+                                 rocsolver_int n, const double *A,
+                                 rocsolver_int lda, rocsolver_int strideA,
+                                 double *result, rocsolver_int batch_count) {
+  return rocsolver_lansy_template<double>(handle, norm, uplo, n, A, lda,
+                                          strideA, result, batch_count);
+}
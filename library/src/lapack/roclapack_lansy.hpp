@@ -0,0 +1,32 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_LANSY_HPP
+#define ROCLAPACK_LANSY_HPP
+
+#include "roclapack_lange.hpp"
+
+/*
+ * The norms of lange for the symmetric n x n matrices A + b*strideA, of
+ * which only the triangle uplo is referenced, as LAPACK's lansy. The 1-norm
+ * and the infinity-norm are the same and take the same column pass.
+ */
+template <typename T>
+rocblas_status
+rocsolver_lansy_template(rocblas_handle handle, rocsolver_norm_type norm,
+                         rocblas_fill uplo, rocblas_int n, const T *A,
+                         rocblas_int lda, rocblas_int strideA, T *result,
+                         rocblas_int batch_count) {
+  lange_symmetric<T> elem;
+  elem.uplo = uplo;
+  return roclapack_lange_generic_template<T>(handle, norm, n, n, A, lda,
+                                             strideA, elem, result,
+                                             batch_count, true);
+}
+
+#endif /* ROCLAPACK_LANSY_HPP */
@@ -0,0 +1,55 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_lantr.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_slantr(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_fill uplo, rocsolver_diagonal diag, rocsolver_int m,
+                 rocsolver_int n, const float *A, rocsolver_int lda,
+                 float *result) {
+  return rocsolver_lantr_template<float>(handle, norm, uplo, diag, m, n, A, lda,
+                                         0, result, 1);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_slantr_strided_batched(rocsolver_handle handle,
+                                 rocsolver_norm_type norm, rocsolver_fill uplo,
+                                 rocsolver_diagonal diag, rocsolver_int m,
+                                 rocsolver_int n, const float *A,
+                                 rocsolver_int lda, rocsolver_int strideA,
+                                 float *result, rocsolver_int batch_count) {
+  return rocsolver_lantr_template<float>(handle, norm, uplo, diag, m, n, A, lda,
+                                         strideA, result, batch_count);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dlantr(rocsolver_handle handle, rocsolver_norm_type norm,
+                 rocsolver_fill uplo, rocsolver_diagonal diag, rocsolver_int m,
+                 rocsolver_int n, const double *A, rocsolver_int lda,
+                 double *result) {
+  return rocsolver_lantr_template<double>(handle, norm, uplo, diag, m, n, A,
+                                          lda, 0, result, 1);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dlantr_strided_batched(rocsolver_handle handle,
+                                 rocsolver_norm_type norm, rocsolver_fill uplo,
+                                 rocsolver_diagonal diag, rocsolver_int m,
+                                 rocsolver_int n, const double *A,
+                                 rocsolver_int lda, rocsolver_int strideA,
+                                 double *result, rocsolver_int batch_count) {
+  return rocsolver_lantr_template<double>(handle, norm, uplo, diag, m, n, A,
+                                          lda, strideA, result, batch_count);
+}
@@ -0,0 +1,34 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_LANTR_HPP
+#define ROCLAPACK_LANTR_HPP
+
+#include "roclapack_lange.hpp"
+
+/*
+ * The norms of lange for the upper or lower trapezoidal m x n matrices
+ * A + b*strideA, as LAPACK's lantr. Only the triangle uplo is referenced,
+ * and not even its diagonal if diag is rocblas_diagonal_unit.
+ */
+template <typename T>
+rocblas_status
+rocsolver_lantr_template(rocblas_handle handle, rocsolver_norm_type norm,
+                         rocblas_fill uplo, rocblas_diagonal diag,
+                         rocblas_int m, rocblas_int n, const T *A,
+                         rocblas_int lda, rocblas_int strideA, T *result,
+                         rocblas_int batch_count) {
+  lange_trapezoidal<T> elem;
+  elem.uplo = uplo;
+  elem.diag = diag;
+  return roclapack_lange_generic_template<T>(handle, norm, m, n, A, lda,
+                                             strideA, elem, result,
+                                             batch_count, false);
+}
+
+#endif /* ROCLAPACK_LANTR_HPP */
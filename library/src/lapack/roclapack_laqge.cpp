@@ -0,0 +1,33 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_laqge.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_slaqge(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 float *A, rocsolver_int lda, const float *r, const float *c,
+                 const float *rowcnd, const float *colcnd, const float *amax,
+                 rocsolver_equed *equed) {
+  return rocsolver_laqge_template<float>(handle, m, n, A, lda, r, c, rowcnd,
+                                         colcnd, amax, equed);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dlaqge(rocsolver_handle handle, rocsolver_int m, rocsolver_int n,
+                 double *A, rocsolver_int lda, const double *r, const double *c,
+                 const double *rowcnd, const double *colcnd, const double *amax,
+                 rocsolver_equed *equed) {
+  return rocsolver_laqge_template<double>(handle, m, n, A, lda, r, c, rowcnd,
+                                          colcnd, amax, equed);
+}
@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_LAQGE_HPP
+#define ROCLAPACK_LAQGE_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include <limits>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+// scaling is skipped for ratios of at least this, as in the reference LAPACK
+#define LAQGE_THRESH 0.1
+
+/*
+ * Which of the scalings laqge applies, decided from the results of geequ.
+ * Every thread takes the same decision, so nothing goes back to the host.
+ */
+template <typename T>
+__device__ rocsolver_equed laqge_equed(const T *rowcnd, const T *colcnd,
+                                       const T *amax, T small) {
+  const T large = 1 / small;
+  const bool rows = !(*rowcnd >= LAQGE_THRESH && *amax >= small &&
+                      *amax <= large);
+  const bool cols = !(*colcnd >= LAQGE_THRESH);
+  if (rows)
+    return cols ? rocsolver_equed_both : rocsolver_equed_row;
+  return cols ? rocsolver_equed_column : rocsolver_equed_none;
+}
+
+/*
+ * A(i,j) := r(i)*A(i,j)*c(j), leaving out the factors of a scaling that is
+ * not needed; one thread per element.
+ */
+template <typename T>
+__global__ void laqge_scale(rocblas_int m, rocblas_int n, T *A,
+                            rocblas_int lda, const T *r, const T *c,
+                            const T *rowcnd, const T *colcnd, const T *amax,
+                            T small, rocsolver_equed *equed) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+
+  const rocsolver_equed eq = laqge_equed(rowcnd, colcnd, amax, small);
+  if (i == 0 && j == 0)
+    *equed = eq;
+
+  if (i < m && eq != rocsolver_equed_none) {
+    T s = 1;
+    if (eq == rocsolver_equed_row || eq == rocsolver_equed_both)
+      s *= r[i];
+    if (eq == rocsolver_equed_column || eq == rocsolver_equed_both)
+      s *= c[j];
+    A[i + j * lda] *= s;
+  }
+}
+
+static __global__ void laqge_none(rocsolver_equed *equed) {
+  if (hipBlockIdx_x == 0 && hipThreadIdx_x == 0)
+    *equed = rocsolver_equed_none;
+}
+
+/*
+ * Equilibrate A with the scale factors from geequ, as in the reference
+ * LAPACK: rows are scaled unless rowcnd >= 0.1 and amax is far from
+ * underflow and overflow, columns unless colcnd >= 0.1. The decision is
+ * taken on the device and reported in equed, also in device memory.
+ */
+template <typename T>
+rocblas_status rocsolver_laqge_template(rocblas_handle handle, rocblas_int m,
+                                        rocblas_int n, T *A, rocblas_int lda,
+                                        const T *r, const T *c,
+                                        const T *rowcnd, const T *colcnd,
+                                        const T *amax,
+                                        rocsolver_equed *equed) {
+
+  if (m < 0 || n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, m)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  if (m == 0 || n == 0) {
+    hipLaunchKernelGGL(laqge_none, dim3(1), dim3(1), 0, stream, equed);
+    return rocblas_status_success;
+  }
+
+  const T small = numeric_limits<T>::min() / numeric_limits<T>::epsilon();
+
+  dim3 grid((m - 1) / LAQGE_BLOCKSIZE + 1, n, 1);
+  dim3 threads(LAQGE_BLOCKSIZE, 1, 1);
+  hipLaunchKernelGGL(laqge_scale<T>, grid, threads, 0, stream, m, n, A, lda, r,
+                     c, rowcnd, colcnd, amax, small, equed);
+
+  return rocblas_status_success;
+}
+
+#undef LAQGE_THRESH
+
+#endif /* ROCLAPACK_LAQGE_HPP */
@@ -0,0 +1,66 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_LARFB_HPP
+#define ROCLAPACK_LARFB_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "definitions.h"
+#include "helpers.h"
+
+using namespace std;
+
+/*
+ * Enqueue the application of the block reflector H = I - V * T * V**T from
+ * larft, or of its transpose, to the m x n matrix C from the left or the
+ * right:
+ *    C := op(H) * C = C - V * op(T) * (V**T * C)     (side = left)
+ *    C := C * op(H) = C - (C * V) * op(T) * V**T     (side = right)
+ * V is m x k (left) or n x k (right) with its zeros and ones explicit, so
+ * all three products are gemm calls. W and W2 need k*n (left) or m*k (right)
+ * elements each.
+ */
+template <typename T>
+void roclapack_larfb_template(rocblas_handle handle, rocblas_side side,
+                              rocblas_operation trans, rocblas_int m,
+                              rocblas_int n, rocblas_int k, const T *V,
+                              rocblas_int ldv, const T *Tm, rocblas_int ldt,
+                              T *C, rocblas_int ldc, T *W, T *W2,
+                              const T *one, const T *zero, const T *minone) {
+
+  if (m == 0 || n == 0 || k == 0)
+    return;
+
+  const rocblas_operation transT = (trans == rocblas_operation_none)
+                                       ? rocblas_operation_none
+                                       : rocblas_operation_transpose;
+
+  if (side == rocblas_side_left) {
+    // W := V**T * C,  W2 := op(T) * W,  C := C - V * W2
+    rocblas_gemm<T>(handle, rocblas_operation_transpose,
+                    rocblas_operation_none, k, n, m, one, V, ldv, C, ldc,
+                    zero, W, k);
+    rocblas_gemm<T>(handle, transT, rocblas_operation_none, k, n, k, one, Tm,
+                    ldt, W, k, zero, W2, k);
+    rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none, m,
+                    n, k, minone, V, ldv, W2, k, one, C, ldc);
+  } else {
+    // W := C * V,  W2 := W * op(T),  C := C - W2 * V**T
+    rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none, m,
+                    k, n, one, C, ldc, V, ldv, zero, W, m);
+    rocblas_gemm<T>(handle, rocblas_operation_none, transT, m, k, k, one, W,
+                    m, Tm, ldt, zero, W2, m);
+    rocblas_gemm<T>(handle, rocblas_operation_none,
+                    rocblas_operation_transpose, m, n, k, minone, W2, m, V,
+                    ldv, one, C, ldc);
+  }
+}
+
+#endif /* ROCLAPACK_LARFB_HPP */
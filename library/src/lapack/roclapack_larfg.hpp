@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_LARFG_HPP
+#define ROCLAPACK_LARFG_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+/*
+ * Elementary reflector H = I - tau * v * v**T of order n, with v(0) = 1,
+ * such that H * (alpha, x) = (beta, 0), computed by a workgroup of
+ * LARFG_BLOCKSIZE threads with the shared scratch sred. On exit alpha is
+ * beta and x is v(1:n-1), written by thread 0 and the owners of the entries;
+ * the caller synchronizes before reading them. The 2-norm of x is taken
+ * scaled by its largest entry so that it neither overflows nor underflows.
+ */
+template <typename T>
+__device__ void larfg_device(rocblas_int n, T *alpha, T *x, rocblas_int incx,
+                             T *tau, T *sred) {
+  const int tid = hipThreadIdx_x;
+
+  const T a = *alpha;
+
+  T s = 0;
+  for (rocblas_int i = tid; i < n - 1; i += LARFG_BLOCKSIZE)
+    s = max(s, fabs(x[i * incx]));
+  sred[tid] = s;
+  __syncthreads();
+  for (int st = LARFG_BLOCKSIZE / 2; st > 0; st >>= 1) {
+    if (tid < st)
+      sred[tid] = max(sred[tid], sred[tid + st]);
+    __syncthreads();
+  }
+  const T xmax = sred[0];
+  __syncthreads();
+
+  if (xmax == 0) {
+    // H is the identity
+    if (tid == 0)
+      *tau = 0;
+    return;
+  }
+
+  s = 0;
+  for (rocblas_int i = tid; i < n - 1; i += LARFG_BLOCKSIZE) {
+    const T t = x[i * incx] / xmax;
+    s += t * t;
+  }
+  sred[tid] = s;
+  __syncthreads();
+  for (int st = LARFG_BLOCKSIZE / 2; st > 0; st >>= 1) {
+    if (tid < st)
+      sred[tid] += sred[tid + st];
+    __syncthreads();
+  }
+  const T xnorm = xmax * sqrt(sred[0]);
+
+  const T h = hypot(a, xnorm);
+  const T beta = (a >= 0) ? -h : h;
+  const T scal = 1 / (a - beta);
+  for (rocblas_int i = tid; i < n - 1; i += LARFG_BLOCKSIZE)
+    x[i * incx] *= scal;
+  if (tid == 0) {
+    *tau = (beta - a) / beta;
+    *alpha = beta;
+  }
+}
+
+// sum of s over the workgroup of LARFG_BLOCKSIZE threads, the same in all
+// threads
+template <typename T> __device__ T larfg_sum(T s, T *sred) {
+  const int tid = hipThreadIdx_x;
+  sred[tid] = s;
+  __syncthreads();
+  for (int st = LARFG_BLOCKSIZE / 2; st > 0; st >>= 1) {
+    if (tid < st)
+      sred[tid] += sred[tid + st];
+    __syncthreads();
+  }
+  s = sred[0];
+  __syncthreads();
+  return s;
+}
+
+/*
+ * x := H * x for the reflector H = I - tau * v * v**T of order n from
+ * larfg_device (v(0) = 1 is not read), by a workgroup of LARFG_BLOCKSIZE
+ * threads. Thread t updates x(1+t), x(1+t+LARFG_BLOCKSIZE), ... and thread
+ * 0 also x(0).
+ */
+template <typename T>
+__device__ void larf_device(rocblas_int n, T tau, const T *v, rocblas_int incv,
+                            T *x, rocblas_int incx, T *sred) {
+  const int tid = hipThreadIdx_x;
+
+  // x(0) is read before the reduction, thread 0 updates it after
+  const T x0 = x[0];
+  T s = 0;
+  for (rocblas_int i = 1 + tid; i < n; i += LARFG_BLOCKSIZE)
+    s += v[i * incv] * x[i * incx];
+  s = tau * (x0 + larfg_sum(s, sred));
+  for (rocblas_int i = 1 + tid; i < n; i += LARFG_BLOCKSIZE)
+    x[i * incx] -= s * v[i * incv];
+  if (tid == 0)
+    x[0] -= s;
+}
+
+// the reflector of larfg_device, run by one workgroup
+template <typename T>
+__global__ void larfg_kernel(rocblas_int n, T *alpha, T *x, rocblas_int incx,
+                             T *tau) {
+  __shared__ T sred[LARFG_BLOCKSIZE];
+  larfg_device<T>(n, alpha, x, incx, tau, sred);
+}
+
+/*
+ * Enqueue the generation of the elementary reflector that annihilates x
+ * (see larfg_kernel); alpha, x and tau are in device memory.
+ */
+template <typename T>
+void roclapack_larfg_template(rocblas_handle handle, rocblas_int n, T *alpha,
+                              T *x, rocblas_int incx, T *tau) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  if (n > 0)
+    hipLaunchKernelGGL(larfg_kernel<T>, dim3(1), dim3(LARFG_BLOCKSIZE), 0,
+                       stream, n, alpha, x, incx, tau);
+}
+
+#endif /* ROCLAPACK_LARFG_HPP */
@@ -0,0 +1,88 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_LARFT_HPP
+#define ROCLAPACK_LARFT_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+// V := the m x k unit lower trapezoidal matrix of the reflectors stored
+// below the diagonal of A, with its zeros and ones written out
+template <typename T>
+__global__ void larft_copy_v(rocblas_int m, const T *A, rocblas_int lda,
+                             T *V) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+  if (i < m)
+    V[i + j * m] = (i < j) ? 0 : (i == j) ? 1 : A[i + j * lda];
+}
+
+/*
+ * The upper triangular factor T of the block reflector, one column at a
+ * time from G = V**T * V:
+ *    T(i,i) = tau(i),  T(0:i-1,i) = -tau(i) * T(0:i-1,0:i-1) * G(0:i-1,i)
+ * The recurrence is short (k is a block size) and runs in one workgroup.
+ */
+template <typename T>
+__global__ void larft_triangle(rocblas_int k, const T *tau, const T *G,
+                               T *Tm) {
+  const int tid = hipThreadIdx_x;
+
+  for (rocblas_int r = tid; r < k * k; r += hipBlockDim_x)
+    Tm[r] = 0;
+  __syncthreads();
+
+  for (rocblas_int i = 0; i < k; ++i) {
+    for (rocblas_int r = tid; r < i; r += hipBlockDim_x) {
+      T s = 0;
+      for (rocblas_int c = r; c < i; ++c)
+        s += Tm[r + c * k] * G[c + i * k];
+      Tm[r + i * k] = -tau[i] * s;
+    }
+    if (tid == 0)
+      Tm[i + i * k] = tau[i];
+    __syncthreads();
+  }
+}
+
+/*
+ * Enqueue the compact WY form I - V * T * V**T of the product
+ * H(0) * H(1) * ... * H(k-1) of the k reflectors of order m stored in the
+ * columns of A (forward, columnwise as left by geqr2). V (m x k) gets the
+ * explicit reflectors so that the block reflector is applied with plain
+ * gemm calls, T (k x k, upper triangular with zeros below) gets the
+ * triangular factor and G (k x k) is workspace.
+ */
+template <typename T>
+void roclapack_larft_template(rocblas_handle handle, rocblas_int m,
+                              rocblas_int k, const T *A, rocblas_int lda,
+                              const T *tau, T *V, T *Tm, T *G, const T *one,
+                              const T *zero) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  hipLaunchKernelGGL(larft_copy_v<T>,
+                     dim3((m - 1) / LARFT_BLOCKSIZE + 1, k, 1),
+                     dim3(LARFT_BLOCKSIZE, 1, 1), 0, stream, m, A, lda, V);
+
+  rocblas_gemm<T>(handle, rocblas_operation_transpose, rocblas_operation_none,
+                  k, k, m, one, V, m, V, m, zero, G, k);
+
+  hipLaunchKernelGGL(larft_triangle<T>, dim3(1), dim3(GEQRF_BLOCKSIZE), 0,
+                     stream, k, tau, G, Tm);
+}
+
+#endif /* ROCLAPACK_LARFT_HPP */
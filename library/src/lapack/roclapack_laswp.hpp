@@ -27,6 +27,39 @@ __global__ void laswp_external(const rocblas_int n, T *a, const rocblas_int lda,
   }
 }
 
+template <typename T>
+__global__ void laswp_columns(const rocblas_int n, T *a, const rocblas_int lda,
+                              const rocblas_int k1, const rocblas_int k2,
+                              const rocblas_int *ipiv,
+                              const rocblas_int incx) {
+
+  // every thread owns one column and replays all interchanges on it, so the
+  // pivots are applied in order without any synchronization
+  const int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  if (tid < n) {
+    T *col = a + lda * tid;
+    if (incx > 0) {
+      for (rocblas_int i = k1; i < k2; ++i) {
+        const rocblas_int p = ipiv[i] - 1;
+        if (p != i) {
+          const T orig = col[i];
+          col[i] = col[p];
+          col[p] = orig;
+        }
+      }
+    } else {
+      for (rocblas_int i = k2 - 1; i >= k1; --i) {
+        const rocblas_int p = ipiv[i] - 1;
+        if (p != i) {
+          const T orig = col[i];
+          col[i] = col[p];
+          col[p] = orig;
+        }
+      }
+    }
+  }
+}
+
 /**
  *  LASWP performs a series of row interchanges on the matrix A.
  *  One row interchange is initiated for each of rows K1 through K2 of A.
@@ -126,4 +159,32 @@ void roclapack_laswp_template(rocblas_handle handle, rocblas_int n, T *A,
   }
 }
 
+/**
+ *  Same as roclapack_laswp_template, but ipiv is only read on the device: no
+ *  copy to the host, no synchronization, and no restriction on the contents
+ *  of ipiv. Elements k1 through k2-1 of ipiv are applied (in reverse order if
+ *  incx is negative); incx must be 1 or -1.
+ */
+template <typename T>
+void roclapack_laswp_device_template(rocblas_handle handle, rocblas_int n,
+                                     T *A, rocblas_int lda, rocblas_int k1,
+                                     rocblas_int k2, const rocblas_int *ipiv,
+                                     rocblas_int incx) {
+
+  if (n == 0 || k2 <= k1) {
+    // quick return
+    return;
+  }
+
+  rocblas_int blocksPivot = (n - 1) / LASWP_BLOCKSIZE + 1;
+  dim3 gridPivot(blocksPivot, 1, 1);
+  dim3 threads(LASWP_BLOCKSIZE, 1, 1);
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  hipLaunchKernelGGL(laswp_columns<T>, gridPivot, threads, 0, stream, n, A, lda,
+                     k1, k2, ipiv, incx);
+}
+
 #endif /* ROCLAPACK_LASWP_HPP */
@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_lu_plan.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_lu_plan_create(rocsolver_handle handle, rocsolver_precision precision,
+                         rocsolver_int n, rocsolver_int nrhs,
+                         rocsolver_lu_plan *plan) {
+  return rocsolver_lu_plan_create_template(handle, precision, n, nrhs, plan);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_lu_plan_destroy(rocsolver_lu_plan plan) {
+  return rocsolver_lu_plan_destroy_template(plan);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_slu_plan_factor(rocsolver_lu_plan plan, const float *A,
+                          rocsolver_int lda) {
+  return rocsolver_lu_plan_factor_template<float>(plan, A, lda);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dlu_plan_factor(rocsolver_lu_plan plan, const double *A,
+                          rocsolver_int lda) {
+  return rocsolver_lu_plan_factor_template<double>(plan, A, lda);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_slu_plan_factor_equilibrated(rocsolver_lu_plan plan, const float *A,
+                                       rocsolver_int lda, const float *r,
+                                       const float *c) {
+  return rocsolver_lu_plan_factor_template<float>(plan, A, lda, r, c);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dlu_plan_factor_equilibrated(rocsolver_lu_plan plan, const double *A,
+                                       rocsolver_int lda, const double *r,
+                                       const double *c) {
+  return rocsolver_lu_plan_factor_template<double>(plan, A, lda, r, c);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_slu_plan_solve(rocsolver_lu_plan plan, rocsolver_operation trans,
+                         rocsolver_int nrhs, float *B, rocsolver_int ldb) {
+  return rocsolver_lu_plan_solve_template<float>(plan, trans, nrhs, B, ldb);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dlu_plan_solve(rocsolver_lu_plan plan, rocsolver_operation trans,
+                         rocsolver_int nrhs, double *B, rocsolver_int ldb) {
+  return rocsolver_lu_plan_solve_template<double>(plan, trans, nrhs, B, ldb);
+}
@@ -0,0 +1,387 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_LU_PLAN_HPP
+#define ROCLAPACK_LU_PLAN_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+
+using namespace std;
+
+// the device constants of a plan: getrf gets the buffer from
+// LU_PLAN_GETRF_CONSTS on, getrs from LU_PLAN_GETRS_CONSTS on, each in its own
+// layout
+#define LU_PLAN_GETRF_CONSTS 0
+#define LU_PLAN_RESSING 2
+#define LU_PLAN_GETRS_CONSTS 3
+#define LU_PLAN_NCONSTS 6
+
+/*
+ * Everything a sequence of solves with the same matrix needs, allocated once
+ * by rocsolver_lu_plan_create: the factors (leading dimension n), the pivots
+ * and the row permutation they amount to, the inverted diagonal blocks for
+ * getrs_invdiag_solve, a workspace for nrhs right hand sides, the row and
+ * column scale factors of an equilibrated matrix and the constants.
+ */
+struct _rocsolver_lu_plan {
+  rocblas_handle handle;
+  rocblas_precision precision;
+  rocblas_int n;
+  rocblas_int nrhs;
+  void *A;
+  rocblas_int *ipiv;
+  rocblas_int *perm;
+  void *invD;
+  void *X;
+  void *scale;
+  void *consts;
+  bool rowScaled;
+  bool colScaled;
+  bool factored;
+};
+
+/*
+ * Turn the pivots into one permutation: row i of P*B is row perm(i) of B.
+ * The interchanges depend on each other, so a single thread replays them.
+ */
+static __global__ void lu_plan_make_perm(rocblas_int n, const rocblas_int *ipiv,
+                                         rocblas_int *perm) {
+  if (hipBlockIdx_x == 0 && hipThreadIdx_x == 0) {
+    for (rocblas_int i = 0; i < n; ++i)
+      perm[i] = i;
+    for (rocblas_int i = 0; i < n; ++i) {
+      const rocblas_int p = ipiv[i] - 1;
+      const rocblas_int orig = perm[i];
+      perm[i] = perm[p];
+      perm[p] = orig;
+    }
+  }
+}
+
+/*
+ * Copy the m x n matrix In to Out, one thread per element. With perm the
+ * rows are gathered (Out(i,:) = In(perm(i),:), forward = true) or scattered
+ * (Out(perm(i),:) = In(i,:)). Given rscale and cscale, the elements are
+ * multiplied by the factor of their row in the unpermuted order and of
+ * their column on the way; In and Out may then be the same matrix.
+ */
+template <typename T>
+__global__ void lu_plan_copy(rocblas_int m, rocblas_int n,
+                             const rocblas_int *perm, bool forward, const T *In,
+                             rocblas_int ldi, T *Out, rocblas_int ldo,
+                             const T *rscale, const T *cscale) {
+  const int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const int j = hipBlockIdx_y;
+  if (i < m) {
+    const rocblas_int p = perm ? perm[i] : i;
+    T s = 1;
+    if (rscale)
+      s *= rscale[p];
+    if (cscale)
+      s *= cscale[j];
+    if (!perm)
+      Out[i + j * ldo] = s * In[i + j * ldi];
+    else if (forward)
+      Out[i + j * ldo] = s * In[p + j * ldi];
+    else
+      Out[p + j * ldo] = s * In[i + j * ldi];
+  }
+}
+
+template <typename T>
+void lu_plan_copy_template(hipStream_t stream, rocblas_int m, rocblas_int n,
+                           const rocblas_int *perm, bool forward, const T *In,
+                           rocblas_int ldi, T *Out, rocblas_int ldo,
+                           const T *rscale = nullptr,
+                           const T *cscale = nullptr) {
+  dim3 grid((m - 1) / LU_PLAN_BLOCKSIZE + 1, n, 1);
+  dim3 threads(LU_PLAN_BLOCKSIZE, 1, 1);
+  hipLaunchKernelGGL(lu_plan_copy<T>, grid, threads, 0, stream, m, n, perm,
+                     forward, In, ldi, Out, ldo, rscale, cscale);
+}
+
+template <typename T> inline rocblas_precision lu_plan_precision();
+template <> inline rocblas_precision lu_plan_precision<float>() {
+  return rocblas_precision_single;
+}
+template <> inline rocblas_precision lu_plan_precision<double>() {
+  return rocblas_precision_double;
+}
+
+template <typename T> void lu_plan_init_consts(void *consts) {
+  T inpsResHost[LU_PLAN_NCONSTS];
+  inpsResHost[LU_PLAN_GETRF_CONSTS] = static_cast<T>(1);
+  inpsResHost[LU_PLAN_GETRF_CONSTS + 1] = static_cast<T>(-1);
+  inpsResHost[LU_PLAN_RESSING] = static_cast<T>(42);
+  inpsResHost[LU_PLAN_GETRS_CONSTS] = static_cast<T>(1);
+  inpsResHost[LU_PLAN_GETRS_CONSTS + 1] = static_cast<T>(-1);
+  inpsResHost[LU_PLAN_GETRS_CONSTS + 2] = static_cast<T>(0);
+  hipMemcpy(consts, &inpsResHost[0], LU_PLAN_NCONSTS * sizeof(T),
+            hipMemcpyHostToDevice);
+}
+
+inline rocblas_status
+rocsolver_lu_plan_destroy_template(rocsolver_lu_plan plan) {
+  if (!plan) {
+    return rocblas_status_invalid_pointer;
+  }
+  hipFree(plan->A);
+  hipFree(plan->ipiv);
+  hipFree(plan->perm);
+  hipFree(plan->invD);
+  hipFree(plan->X);
+  hipFree(plan->scale);
+  hipFree(plan->consts);
+  delete plan;
+  return rocblas_status_success;
+}
+
+/*
+ * Allocate a plan for matrices of order n in the given precision, with a
+ * workspace for nrhs right hand sides per solve.
+ */
+inline rocblas_status rocsolver_lu_plan_create_template(
+    rocblas_handle handle, rocblas_precision precision, rocblas_int n,
+    rocblas_int nrhs, rocsolver_lu_plan *plan) {
+
+  if (!handle || !plan) {
+    return rocblas_status_invalid_pointer;
+  } else if (n < 0 || nrhs < 0) {
+    return rocblas_status_invalid_size;
+  }
+
+  size_t elem;
+  if (precision == rocblas_precision_single) {
+    elem = sizeof(float);
+  } else if (precision == rocblas_precision_double) {
+    elem = sizeof(double);
+  } else {
+    return rocblas_status_not_implemented;
+  }
+
+  rocsolver_lu_plan p = new _rocsolver_lu_plan();
+  p->handle = handle;
+  p->precision = precision;
+  p->n = n;
+  p->nrhs = (n == 0) ? 0 : nrhs;
+  p->rowScaled = false;
+  p->colScaled = false;
+  p->factored = false;
+
+  if (n > 0) {
+    bool ok = hipMalloc(&p->A, elem * n * n) == hipSuccess;
+    ok = ok && hipMalloc(&p->ipiv, sizeof(rocblas_int) * n) == hipSuccess;
+    ok = ok && hipMalloc(&p->perm, sizeof(rocblas_int) * n) == hipSuccess;
+    ok = ok &&
+         hipMalloc(&p->invD, elem * getrs_invdiag_size(n)) == hipSuccess;
+    ok = ok && (nrhs == 0 || hipMalloc(&p->X, elem * n * nrhs) == hipSuccess);
+    ok = ok && hipMalloc(&p->scale, elem * 2 * n) == hipSuccess;
+    ok = ok && hipMalloc(&p->consts, elem * LU_PLAN_NCONSTS) == hipSuccess;
+    if (!ok) {
+      rocsolver_lu_plan_destroy_template(p);
+      return rocblas_status_memory_error;
+    }
+
+    if (precision == rocblas_precision_single)
+      lu_plan_init_consts<float>(p->consts);
+    else
+      lu_plan_init_consts<double>(p->consts);
+  }
+
+  *plan = p;
+  return rocblas_status_success;
+}
+
+/*
+ * Factor the n x n matrix A into the plan. A itself is left untouched; the
+ * pivots are turned into perm and the diagonal blocks of the factors are
+ * inverted here, once, for all later solves. Given row and column scale
+ * factors r and c (geequ), the plan factors diag(r)*A*diag(c) instead; the
+ * scaling is applied by the copy into the plan, so it costs no extra pass
+ * over the matrix, and the solves take it into account.
+ */
+template <typename T>
+rocblas_status rocsolver_lu_plan_factor_template(rocsolver_lu_plan plan,
+                                                 const T *A, rocblas_int lda,
+                                                 const T *r = nullptr,
+                                                 const T *c = nullptr) {
+
+  if (!plan) {
+    return rocblas_status_invalid_pointer;
+  } else if (plan->precision != lu_plan_precision<T>()) {
+    return rocblas_status_invalid_pointer;
+  } else if (lda < max(1, plan->n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  }
+
+  plan->factored = false;
+  plan->rowScaled = (r != nullptr);
+  plan->colScaled = (c != nullptr);
+  const rocblas_int n = plan->n;
+  if (n == 0) {
+    plan->factored = true;
+    return rocblas_status_success;
+  }
+
+  rocblas_handle handle = plan->handle;
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  T *F = static_cast<T *>(plan->A);
+  T *consts = static_cast<T *>(plan->consts);
+
+  T ressing = static_cast<T>(42);
+  hipMemcpy(&consts[LU_PLAN_RESSING], &ressing, sizeof(T),
+            hipMemcpyHostToDevice);
+
+  // keep the scale factors for the solves
+  T *S = static_cast<T *>(plan->scale);
+  if (r)
+    lu_plan_copy_template<T>(stream, n, 1, nullptr, true, r, n, S, n);
+  if (c)
+    lu_plan_copy_template<T>(stream, n, 1, nullptr, true, c, n, S + n, n);
+
+  lu_plan_copy_template<T>(stream, n, n, nullptr, true, A, lda, F, n, r, c);
+
+  rocblas_status status = rocsolver_getrf_async_template<T>(
+      handle, n, n, F, n, plan->ipiv, &consts[LU_PLAN_GETRF_CONSTS]);
+
+  // let's see if we encountered any singularity
+  hipMemcpy(&ressing, &consts[LU_PLAN_RESSING], sizeof(T),
+            hipMemcpyDeviceToHost);
+
+  if (status != rocblas_status_success) {
+    return status;
+  }
+  if (ressing <= 0.0) {
+    const size_t elem = static_cast<size_t>(fabs(ressing));
+    cerr << "ERROR: Input matrix has singularity/-ies. Last "
+            "occurrence of this in element "
+         << elem << endl;
+    return rocblas_status_internal_error;
+  }
+
+  hipLaunchKernelGGL(lu_plan_make_perm, dim3(1), dim3(1), 0, stream, n,
+                     plan->ipiv, plan->perm);
+
+  status = rocsolver_getrs_invdiag_template<T>(handle, n, F, n,
+                                               static_cast<T *>(plan->invD));
+  if (status != rocblas_status_success) {
+    return status;
+  }
+
+  plan->factored = true;
+  return rocblas_status_success;
+}
+
+/*
+ * Solve with the factors of the plan. Nothing is allocated, copied from the
+ * device or synchronized unless nrhs exceeds the columns of the workspace,
+ * which is then grown once. Few right hand sides take the fused getrs kernel;
+ * otherwise the rows are permuted by one gather (scatter for the transposed
+ * system) through the workspace and the triangular solves use the inverted
+ * diagonal blocks. For an equilibrated plan, (R*A*C)*y = R*b is solved and
+ * x = C*y, or (R*A*C)**T*y = C*b and x = R*y; the scaling before or after
+ * the permutation is fused into it.
+ */
+template <typename T>
+rocblas_status rocsolver_lu_plan_solve_template(rocsolver_lu_plan plan,
+                                                rocblas_operation trans,
+                                                rocblas_int nrhs, T *B,
+                                                rocblas_int ldb) {
+
+  if (!plan) {
+    return rocblas_status_invalid_pointer;
+  } else if (plan->precision != lu_plan_precision<T>()) {
+    return rocblas_status_invalid_pointer;
+  } else if (nrhs < 0 || ldb < max(1, plan->n)) {
+    return rocblas_status_invalid_size;
+  } else if (!plan->factored) {
+    cerr << "ERROR: The LU plan holds no valid factorization" << endl;
+    return rocblas_status_internal_error;
+  }
+
+  const rocblas_int n = plan->n;
+  if (n == 0 || nrhs == 0) {
+    return rocblas_status_success;
+  }
+
+  rocblas_handle handle = plan->handle;
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const T *F = static_cast<const T *>(plan->A);
+  T *consts = static_cast<T *>(plan->consts);
+  T *getrsConsts = &consts[LU_PLAN_GETRS_CONSTS];
+
+  const T *S = static_cast<const T *>(plan->scale);
+  const T *rowScale = plan->rowScaled ? S : nullptr;
+  const T *colScale = plan->colScaled ? S + n : nullptr;
+  const T *pre = (trans == rocblas_operation_none) ? rowScale : colScale;
+  const T *post = (trans == rocblas_operation_none) ? colScale : rowScale;
+
+  if (getrs_use_fused(n, nrhs)) {
+    if (pre)
+      lu_plan_copy_template<T>(stream, n, nrhs, nullptr, true, B, ldb, B, ldb,
+                               pre);
+    rocsolver_getrs_async_template<T>(handle, trans, n, nrhs, F, n, plan->ipiv,
+                                      B, ldb, getrsConsts);
+    if (post)
+      lu_plan_copy_template<T>(stream, n, nrhs, nullptr, true, B, ldb, B, ldb,
+                               post);
+    return rocblas_status_success;
+  }
+
+  if (nrhs > plan->nrhs) {
+    void *X;
+    if (hipMalloc(&X, sizeof(T) * n * nrhs) != hipSuccess) {
+      return rocblas_status_memory_error;
+    }
+    hipFree(plan->X);
+    plan->X = X;
+    plan->nrhs = nrhs;
+  }
+
+  T *X = static_cast<T *>(plan->X);
+  const T *invD = static_cast<const T *>(plan->invD);
+
+  if (trans == rocblas_operation_none) {
+    lu_plan_copy_template<T>(stream, n, nrhs, plan->perm, true, B, ldb, X, n,
+                             pre);
+    lu_plan_copy_template<T>(stream, n, nrhs, nullptr, true, X, n, B, ldb);
+    getrs_invdiag_solve<T>(handle, trans, n, nrhs, F, n, invD, B, ldb, X,
+                           getrsConsts);
+    if (post)
+      lu_plan_copy_template<T>(stream, n, nrhs, nullptr, true, B, ldb, B, ldb,
+                               post);
+  } else {
+    if (pre)
+      lu_plan_copy_template<T>(stream, n, nrhs, nullptr, true, B, ldb, B, ldb,
+                               pre);
+    getrs_invdiag_solve<T>(handle, trans, n, nrhs, F, n, invD, B, ldb, X,
+                           getrsConsts);
+    lu_plan_copy_template<T>(stream, n, nrhs, plan->perm, false, B, ldb, X, n,
+                             post);
+    lu_plan_copy_template<T>(stream, n, nrhs, nullptr, true, X, n, B, ldb);
+  }
+
+  return rocblas_status_success;
+}
+
+#undef LU_PLAN_GETRF_CONSTS
+#undef LU_PLAN_RESSING
+#undef LU_PLAN_GETRS_CONSTS
+#undef LU_PLAN_NCONSTS
+
+#endif /* ROCLAPACK_LU_PLAN_HPP */
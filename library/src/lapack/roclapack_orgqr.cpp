@@ -0,0 +1,27 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_orgqr.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_sorgqr(rocblas_handle handle, rocblas_int m, rocblas_int n,
+                 rocblas_int k, float *A, rocblas_int lda, const float *tau) {
+  return rocsolver_orgqr_template<float>(handle, m, n, k, A, lda, tau);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dorgqr(rocblas_handle handle, rocblas_int m, rocblas_int n,
+                 rocblas_int k, double *A, rocblas_int lda, const double *tau) {
+  return rocsolver_orgqr_template<double>(handle, m, n, k, A, lda, tau);
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_ORGQR_HPP
+#define ROCLAPACK_ORGQR_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_larfb.hpp"
+#include "roclapack_larft.hpp"
+
+using namespace std;
+
+// the constants, then the workspace of the block reflectors
+#define ORGQR_INPONE 0
+#define ORGQR_INPZERO 1
+#define ORGQR_INPMINONE 2
+#define ORGQR_WORK 3
+
+// columns c0 : c0 + gridDim.y of A := the same columns of the identity
+template <typename T>
+__global__ void orgqr_identity(rocblas_int m, T *A, rocblas_int lda,
+                               rocblas_int c0) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = c0 + hipBlockIdx_y;
+  if (i < m)
+    A[i + j * lda] = (i == j) ? 1 : 0;
+}
+
+// elements of the workspace after the constants
+inline size_t orgqr_work_size(rocblas_int m, rocblas_int n) {
+  const size_t nb = GEQRF_BLOCKSIZE;
+  return nb * m + 2 * nb * nb + 2 * nb * n;
+}
+
+/*
+ * Enqueue the generation of the m x n matrix Q with orthonormal columns,
+ * the first n columns of H(0) * H(1) * ... * H(k-1) from geqrf, overwriting
+ * the reflectors in A. The blocks of reflectors are applied from the last
+ * to the first: the columns of a block are first reset to those of the
+ * identity (once its reflectors are copied out by larft), then the block
+ * reflector is applied to them and to all the columns on their right with
+ * larfb. one, zero and minone are device constants and work has
+ * orgqr_work_size(m, n) elements.
+ */
+template <typename T>
+void rocsolver_orgqr_async_template(rocblas_handle handle, rocblas_int m,
+                                    rocblas_int n, rocblas_int k, T *A,
+                                    rocblas_int lda, const T *tau,
+                                    const T *one, const T *zero,
+                                    const T *minone, T *work) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const rocblas_int nb = GEQRF_BLOCKSIZE;
+  const dim3 threads(LARFT_BLOCKSIZE, 1, 1);
+  const rocblas_int blocks = (m - 1) / LARFT_BLOCKSIZE + 1;
+
+  T *V = work;
+  T *Tm = V + nb * m;
+  T *G = Tm + nb * nb;
+  T *W = G + nb * nb;
+  T *W2 = W + nb * n;
+
+  if (k == 0) {
+    hipLaunchKernelGGL(orgqr_identity<T>, dim3(blocks, n, 1), threads, 0,
+                       stream, m, A, lda, 0);
+    return;
+  }
+
+  const rocblas_int jlast = ((k - 1) / nb) * nb;
+  for (rocblas_int j = jlast; j >= 0; j -= nb) {
+    const rocblas_int jb = min(nb, k - j);
+
+    roclapack_larft_template<T>(handle, m - j, jb, &A[idx2D(j, j, lda)], lda,
+                                &tau[j], V, Tm, G, one, zero);
+
+    // the columns beyond the reflectors start as the identity too
+    const rocblas_int ncols = (j == jlast) ? n - j : jb;
+    hipLaunchKernelGGL(orgqr_identity<T>, dim3(blocks, ncols, 1), threads, 0,
+                       stream, m, A, lda, j);
+
+    roclapack_larfb_template<T>(handle, rocblas_side_left,
+                                rocblas_operation_none, m - j, n - j, jb, V,
+                                m - j, Tm, jb, &A[idx2D(j, j, lda)], lda, W,
+                                W2, one, zero, minone);
+  }
+}
+
+template <typename T>
+rocblas_status rocsolver_orgqr_template(rocblas_handle handle, rocblas_int m,
+                                        rocblas_int n, rocblas_int k, T *A,
+                                        rocblas_int lda, const T *tau) {
+
+  if (m < 0 || n < 0 || n > m || k < 0 || k > n) {
+    // wrong dimensions of Q or number of reflectors
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, m)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (n == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  T inpsResHost[3];
+  inpsResHost[ORGQR_INPONE] = static_cast<T>(1);
+  inpsResHost[ORGQR_INPZERO] = static_cast<T>(0);
+  inpsResHost[ORGQR_INPMINONE] = static_cast<T>(-1);
+
+  // allocate the constants and workspace on device to avoid going onto CPU
+  // and needing to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, sizeof(T) * (ORGQR_WORK + orgqr_work_size(m, n)));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T),
+            hipMemcpyHostToDevice);
+
+  rocsolver_orgqr_async_template<T>(
+      handle, m, n, k, A, lda, tau, &inpsResGPU[ORGQR_INPONE],
+      &inpsResGPU[ORGQR_INPZERO], &inpsResGPU[ORGQR_INPMINONE],
+      &inpsResGPU[ORGQR_WORK]);
+
+  hipFree(inpsResGPU);
+
+  return rocblas_status_success;
+}
+
+#undef ORGQR_INPONE
+#undef ORGQR_INPZERO
+#undef ORGQR_INPMINONE
+#undef ORGQR_WORK
+
+#endif /* ROCLAPACK_ORGQR_HPP */
@@ -0,0 +1,31 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_ormqr.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_sormqr(
+    rocsolver_handle handle, rocsolver_side side, rocsolver_operation trans,
+    rocsolver_int m, rocsolver_int n, rocsolver_int k, const float *A,
+    rocsolver_int lda, const float *tau, float *C, rocsolver_int ldc) {
+  return rocsolver_ormqr_template<float>(handle, side, trans, m, n, k, A, lda,
+                                         tau, C, ldc);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_dormqr(
+    rocsolver_handle handle, rocsolver_side side, rocsolver_operation trans,
+    rocsolver_int m, rocsolver_int n, rocsolver_int k, const double *A,
+    rocsolver_int lda, const double *tau, double *C, rocsolver_int ldc) {
+  return rocsolver_ormqr_template<double>(handle, side, trans, m, n, k, A,
+                                          lda, tau, C, ldc);
+}
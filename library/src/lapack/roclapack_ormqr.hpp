@@ -0,0 +1,136 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_ORMQR_HPP
+#define ROCLAPACK_ORMQR_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_larfb.hpp"
+#include "roclapack_larft.hpp"
+
+using namespace std;
+
+// the constants, then the workspace of the block reflectors
+#define ORMQR_INPONE 0
+#define ORMQR_INPZERO 1
+#define ORMQR_INPMINONE 2
+#define ORMQR_WORK 3
+
+// elements of the workspace after the constants
+inline size_t ormqr_work_size(rocblas_side side, rocblas_int m,
+                              rocblas_int n) {
+  const size_t nb = GEQRF_BLOCKSIZE;
+  const size_t nq = (side == rocblas_side_left) ? m : n;
+  return nb * nq + 2 * nb * nb + 2 * nb * max(m, n);
+}
+
+/*
+ * Enqueue C := op(Q) * C or C * op(Q), Q = H(0) * H(1) * ... * H(k-1) from
+ * geqrf, one block of reflectors at a time in compact WY form. one, zero
+ * and minone are device constants and work has ormqr_work_size elements.
+ */
+template <typename T>
+void rocsolver_ormqr_async_template(rocblas_handle handle, rocblas_side side,
+                                    rocblas_operation trans, rocblas_int m,
+                                    rocblas_int n, rocblas_int k, const T *A,
+                                    rocblas_int lda, const T *tau, T *C,
+                                    rocblas_int ldc, const T *one,
+                                    const T *zero, const T *minone, T *work) {
+
+  if (m == 0 || n == 0 || k == 0)
+    return;
+
+  const bool left = (side == rocblas_side_left);
+  const bool notrans = (trans == rocblas_operation_none);
+  const rocblas_int nq = left ? m : n;
+  const rocblas_int nb = GEQRF_BLOCKSIZE;
+
+  T *V = work;
+  T *Tm = V + nb * nq;
+  T *G = Tm + nb * nb;
+  T *W = G + nb * nb;
+  T *W2 = W + nb * max(m, n);
+
+  // Q**T * C and C * Q take the reflectors first to last
+  const bool forward = (left && !notrans) || (!left && notrans);
+  const rocblas_int nblocks = (k - 1) / nb + 1;
+
+  for (rocblas_int b = 0; b < nblocks; ++b) {
+    const rocblas_int i = (forward ? b : nblocks - 1 - b) * nb;
+    const rocblas_int ib = min(nb, k - i);
+
+    roclapack_larft_template<T>(handle, nq - i, ib, &A[idx2D(i, i, lda)], lda,
+                                &tau[i], V, Tm, G, one, zero);
+
+    if (left)
+      roclapack_larfb_template<T>(handle, side, trans, m - i, n, ib, V,
+                                  m - i, Tm, ib, &C[idx2D(i, 0, ldc)], ldc, W,
+                                  W2, one, zero, minone);
+    else
+      roclapack_larfb_template<T>(handle, side, trans, m, n - i, ib, V,
+                                  n - i, Tm, ib, &C[idx2D(0, i, ldc)], ldc, W,
+                                  W2, one, zero, minone);
+  }
+}
+
+template <typename T>
+rocblas_status
+rocsolver_ormqr_template(rocblas_handle handle, rocblas_side side,
+                         rocblas_operation trans, rocblas_int m, rocblas_int n,
+                         rocblas_int k, const T *A, rocblas_int lda,
+                         const T *tau, T *C, rocblas_int ldc) {
+
+  const rocblas_int nq = (side == rocblas_side_left) ? m : n;
+
+  if (m < 0 || n < 0 || k < 0 || k > nq) {
+    // less than zero dimensions or too many reflectors
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, nq) || ldc < max(1, m)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (m == 0 || n == 0 || k == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  T inpsResHost[3];
+  inpsResHost[ORMQR_INPONE] = static_cast<T>(1);
+  inpsResHost[ORMQR_INPZERO] = static_cast<T>(0);
+  inpsResHost[ORMQR_INPMINONE] = static_cast<T>(-1);
+
+  // allocate the constants and workspace on device to avoid going onto CPU
+  // and needing to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU,
+            sizeof(T) * (ORMQR_WORK + ormqr_work_size(side, m, n)));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 3 * sizeof(T),
+            hipMemcpyHostToDevice);
+
+  rocsolver_ormqr_async_template<T>(
+      handle, side, trans, m, n, k, A, lda, tau, C, ldc,
+      &inpsResGPU[ORMQR_INPONE], &inpsResGPU[ORMQR_INPZERO],
+      &inpsResGPU[ORMQR_INPMINONE], &inpsResGPU[ORMQR_WORK]);
+
+  hipFree(inpsResGPU);
+
+  return rocblas_status_success;
+}
+
+#undef ORMQR_INPONE
+#undef ORMQR_INPZERO
+#undef ORMQR_INPMINONE
+#undef ORMQR_WORK
+
+#endif /* ROCLAPACK_ORMQR_HPP */
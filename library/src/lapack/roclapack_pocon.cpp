@@ -0,0 +1,31 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pocon.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_spocon(rocsolver_handle handle, rocsolver_fill uplo,
+                 rocsolver_int n, const float *A, rocsolver_int lda,
+                 const float *anorm, float *rcond) {
+  return rocsolver_pocon_template<float>(handle, uplo, n, A, lda, anorm,
+                                         rcond);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dpocon(rocsolver_handle handle, rocsolver_fill uplo,
+                 rocsolver_int n, const double *A, rocsolver_int lda,
+                 const double *anorm, double *rcond) {
+  return rocsolver_pocon_template<double>(handle, uplo, n, A, lda, anorm,
+                                          rcond);
+}
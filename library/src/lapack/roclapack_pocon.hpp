@@ -0,0 +1,88 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_POCON_HPP
+#define ROCLAPACK_POCON_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_lacn2.hpp"
+
+using namespace std;
+
+#define POCON_INPONE 0
+#define POCON_WORK 1
+
+/*
+ * Reciprocal condition number in the 1-norm of the symmetric positive
+ * definite matrix A from its Cholesky factor (potf2/potrf) and the norm
+ * anorm of the original matrix, as in the reference LAPACK. inv(A) is
+ * symmetric, so both products of the estimator are the same two triangular
+ * solves. anorm and rcond are in device memory and nothing is copied back to
+ * the host.
+ */
+template <typename T>
+rocblas_status rocsolver_pocon_template(rocblas_handle handle,
+                                        rocblas_fill uplo, rocblas_int n,
+                                        const T *A, rocblas_int lda,
+                                        const T *anorm, T *rcond) {
+
+  if (n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  }
+
+  // the constant one, then the work vectors of the estimator
+  T one = static_cast<T>(1);
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, (POCON_WORK + 4 * n) * sizeof(T));
+  hipMemcpy(&inpsResGPU[POCON_INPONE], &one, sizeof(T), hipMemcpyHostToDevice);
+
+  lacn2_state<T> *state;
+  hipMalloc(&state, sizeof(lacn2_state<T>));
+
+  T *Ad = const_cast<T *>(A);
+  T *oneGPU = &inpsResGPU[POCON_INPONE];
+
+  // A = U**T*U or L*L**T: x := inv(U)*inv(U**T)*x or inv(L**T)*inv(L)*x
+  const rocblas_operation first = (uplo == rocblas_fill_upper)
+                                      ? rocblas_operation_transpose
+                                      : rocblas_operation_none;
+  const rocblas_operation second = (uplo == rocblas_fill_upper)
+                                       ? rocblas_operation_none
+                                       : rocblas_operation_transpose;
+
+  auto solve = [&](rocblas_int kase, T *x) {
+    rocblas_trsm<T>(handle, rocblas_side_left, uplo, first,
+                    rocblas_diagonal_non_unit, n, 1, oneGPU, Ad, lda, x, n);
+    rocblas_trsm<T>(handle, rocblas_side_left, uplo, second,
+                    rocblas_diagonal_non_unit, n, 1, oneGPU, Ad, lda, x, n);
+  };
+
+  roclapack_lacn2_rcond_template<T>(handle, n, solve, anorm, rcond,
+                                    &inpsResGPU[POCON_WORK], state);
+
+  hipFree(state);
+  hipFree(inpsResGPU);
+
+  return rocblas_status_success;
+}
+
+#undef POCON_INPONE
+#undef POCON_WORK
+
+#endif /* ROCLAPACK_POCON_HPP */
@@ -25,3 +25,17 @@ rocsolver_dpotf2(rocblas_handle handle, rocblas_fill uplo, rocblas_int n,
                  double *A, rocblas_int lda) {
   return rocsolver_potf2_template<double>(handle, uplo, n, A, lda);
 }
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_cpotf2(rocblas_handle handle, rocblas_fill uplo, rocblas_int n,
+                 rocblas_float_complex *A, rocblas_int lda) {
+  return rocsolver_potf2_template<rocblas_float_complex>(handle, uplo, n, A,
+                                                         lda);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_zpotf2(rocblas_handle handle, rocblas_fill uplo, rocblas_int n,
+                 rocblas_double_complex *A, rocblas_int lda) {
+  return rocsolver_potf2_template<rocblas_double_complex>(handle, uplo, n, A,
+                                                          lda);
+}
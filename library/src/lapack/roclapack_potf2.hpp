@@ -16,6 +16,7 @@
 
 #include "definitions.h"
 #include "helpers.h"
+#include "ideal_sizes.hpp"
 
 using namespace std;
 
@@ -25,51 +26,62 @@ using namespace std;
 #define POTF2_RESDOT 3
 #define POTF2_RESINVDOT 4
 
+// for the complex types, the diagonal of a Hermitian matrix and the
+// conjugated dot of a row or column with itself are real: their imaginary
+// parts are ignored, and the diagonal of the factor is set real
 template <typename T> __global__ void sqrtDiagFirst(T *a, size_t loc, T *res) {
-  const T t = a[loc];
+  const auto t = scalar_real(a[loc]);
   if (t <= 0.0) {
-    res[POTF2_RESPOSDEF] = -loc;
+    res[POTF2_RESPOSDEF] = scalar_const<T>(-static_cast<double>(loc));
   } // error for non-positive definiteness
-  a[loc] = sqrt(t);
-  res[POTF2_RESINVDOT] = 1 / a[loc];
+  const auto s = sqrt(t);
+  a[loc] = scalar_const<T>(s);
+  res[POTF2_RESINVDOT] = scalar_const<T>(1 / s);
 }
 
 template <typename T> __global__ void sqrtDiagOnward(T *a, size_t loc, T *res) {
-  const T t = a[loc] - res[POTF2_RESDOT];
+  const auto t = scalar_real(a[loc]) - scalar_real(res[POTF2_RESDOT]);
   if (t <= 0.0) {
-    res[POTF2_RESPOSDEF] = -loc;
+    res[POTF2_RESPOSDEF] = scalar_const<T>(-static_cast<double>(loc));
   } // error for non-positive definiteness
-  a[loc] = sqrt(t);
-  res[POTF2_RESINVDOT] = 1 / a[loc];
+  const auto s = sqrt(t);
+  a[loc] = scalar_const<T>(s);
+  res[POTF2_RESINVDOT] = scalar_const<T>(1 / s);
 }
 
+// conjugates the n entries of x, as LAPACK's clacgv and zlacgv
 template <typename T>
-rocblas_status rocsolver_potf2_template(rocblas_handle handle,
-                                        rocblas_fill uplo, rocblas_int n, T *a,
-                                        rocblas_int lda) {
+__global__ void potf2_lacgv(rocblas_int n, T *x, rocblas_int incx) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  if (i < n)
+    x[size_t(i) * incx] = scalar_conj(x[size_t(i) * incx]);
+}
 
-  if (n == 0) {
-    // quick return
-    return rocblas_status_success;
-  } else if (n < 0) {
-    // less than zero dimensions in a matrix?!
-    return rocblas_status_invalid_size;
-  } else if (lda < max(1, n)) {
-    // mismatch of provided first matrix dimension
-    return rocblas_status_invalid_size;
-  }
+// conjugation of the row or column of the factor that enters the gemv; a
+// no-op for the real types
+template <typename T>
+void potf2_conj(hipStream_t stream, rocblas_int n, T *x, rocblas_int incx) {
+  if (is_complex<T>::value && n > 0)
+    hipLaunchKernelGGL(potf2_lacgv<T>, dim3((n - 1) / POTF2_BLOCKSIZE + 1),
+                       dim3(POTF2_BLOCKSIZE), 0, stream, n, x, incx);
+}
 
-  rocblas_int oneInt = 1;
-  T inpsResHost[5];
-  inpsResHost[POTF2_INPONE] = static_cast<T>(1);
-  inpsResHost[POTF2_INPMINONE] = static_cast<T>(-1);
-  inpsResHost[POTF2_RESPOSDEF] = static_cast<T>(1);
+/*
+ * Unblocked Cholesky factorization of the n x n diagonal block of a starting at
+ * (j0, j0). It only enqueues work on the handle's stream: the constants and
+ * results live in inpsResGPU (laid out as the POTF2_* indices above) and
+ * non-positive-definiteness is flagged in inpsResGPU[POTF2_RESPOSDEF] as the
+ * negated linear index of the offending element of a (its real part, for
+ * the complex types). For these, a is Hermitian and A = U**H * U or
+ * A = L * L**H: the dots are conjugated and, as in zpotf2, the row or column
+ * of the factor is conjugated around the gemv.
+ */
+template <typename T>
+void rocsolver_potf2_async_template(rocblas_handle handle, rocblas_fill uplo,
+                                    rocblas_int n, T *a, rocblas_int lda,
+                                    rocblas_int j0, T *inpsResGPU) {
 
-  // allocate a tiny bit of memory on device to avoid going onto CPU and needing
-  // to synchronize.
-  T *inpsResGPU;
-  hipMalloc(&inpsResGPU, 5 * sizeof(T));
-  hipMemcpy(inpsResGPU, &inpsResHost[0], 5 * sizeof(T), hipMemcpyHostToDevice);
+  rocblas_int oneInt = 1;
 
   hipStream_t stream;
   rocblas_get_stream(handle, &stream);
@@ -79,11 +91,12 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
 
     // Compute the Cholesky factorization A = U'*U.
 
-    for (rocblas_int j = 0; j < n; ++j) {
+    for (rocblas_int j = j0; j < j0 + n; ++j) {
       // Compute U(J,J) and test for non-positive-definiteness.
-      if (j > 0) {
-        rocblas_dot<T>(handle, j, &a[idx2D(0, j, lda)], oneInt,
-                       &a[idx2D(0, j, lda)], oneInt, &inpsResGPU[POTF2_RESDOT]);
+      if (j > j0) {
+        rocblas_dotc<T>(handle, j - j0, &a[idx2D(j0, j, lda)], oneInt,
+                        &a[idx2D(j0, j, lda)], oneInt,
+                        &inpsResGPU[POTF2_RESDOT]);
         hipLaunchKernelGGL(sqrtDiagOnward<T>, dim3(1), dim3(1), 0, stream, a,
                            idx2D(j, j, lda), inpsResGPU);
       } else {
@@ -93,13 +106,15 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
 
       // Compute elements J+1:N of row J
 
-      if (j < n - 1) {
-        rocblas_gemv<T>(handle, rocblas_operation_transpose, j, n - j - 1,
-                        &(inpsResGPU[POTF2_INPMINONE]),
-                        &a[idx2D(0, j + 1, lda)], lda, &a[idx2D(0, j, lda)],
+      if (j < j0 + n - 1) {
+        potf2_conj<T>(stream, j - j0, &a[idx2D(j0, j, lda)], oneInt);
+        rocblas_gemv<T>(handle, rocblas_operation_transpose, j - j0,
+                        j0 + n - j - 1, &(inpsResGPU[POTF2_INPMINONE]),
+                        &a[idx2D(j0, j + 1, lda)], lda, &a[idx2D(j0, j, lda)],
                         oneInt, &(inpsResGPU[POTF2_INPONE]),
                         &a[idx2D(j, j + 1, lda)], lda);
-        rocblas_scal<T>(handle, n - j - 1, &inpsResGPU[POTF2_RESINVDOT],
+        potf2_conj<T>(stream, j - j0, &a[idx2D(j0, j, lda)], oneInt);
+        rocblas_scal<T>(handle, j0 + n - j - 1, &inpsResGPU[POTF2_RESINVDOT],
                         &a[idx2D(j, j + 1, lda)], lda);
       }
     }
@@ -107,11 +122,11 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
 
     // Compute the Cholesky factorization A = L'*L.
 
-    for (rocblas_int j = 0; j < n; ++j) {
+    for (rocblas_int j = j0; j < j0 + n; ++j) {
       // Compute L(J,J) and test for non-positive-definiteness.
-      if (j > 0) {
-        rocblas_dot<T>(handle, j, &a[idx2D(j, 0, lda)], lda,
-                       &a[idx2D(j, 0, lda)], lda, &inpsResGPU[POTF2_RESDOT]);
+      if (j > j0) {
+        rocblas_dotc<T>(handle, j - j0, &a[idx2D(j, j0, lda)], lda,
+                        &a[idx2D(j, j0, lda)], lda, &inpsResGPU[POTF2_RESDOT]);
         hipLaunchKernelGGL(sqrtDiagOnward<T>, dim3(1), dim3(1), 0, stream, a,
                            idx2D(j, j, lda), inpsResGPU);
       } else {
@@ -121,23 +136,56 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
 
       // Compute elements J+1:N of row J
 
-      if (j < n - 1) {
-        rocblas_gemv<T>(handle, rocblas_operation_none, n - j - 1, j,
+      if (j < j0 + n - 1) {
+        potf2_conj<T>(stream, j - j0, &a[idx2D(j, j0, lda)], lda);
+        rocblas_gemv<T>(handle, rocblas_operation_none, j0 + n - j - 1, j - j0,
                         &(inpsResGPU[POTF2_INPMINONE]),
-                        &a[idx2D(j + 1, 0, lda)], lda, &a[idx2D(j, 0, lda)],
+                        &a[idx2D(j + 1, j0, lda)], lda, &a[idx2D(j, j0, lda)],
                         lda, &(inpsResGPU[POTF2_INPONE]),
                         &a[idx2D(j + 1, j, lda)], oneInt);
-        rocblas_scal<T>(handle, n - j - 1, &inpsResGPU[POTF2_RESINVDOT],
+        potf2_conj<T>(stream, j - j0, &a[idx2D(j, j0, lda)], lda);
+        rocblas_scal<T>(handle, j0 + n - j - 1, &inpsResGPU[POTF2_RESINVDOT],
                         &a[idx2D(j + 1, j, lda)], oneInt);
       }
     }
   }
+}
+
+template <typename T>
+rocblas_status rocsolver_potf2_template(rocblas_handle handle,
+                                        rocblas_fill uplo, rocblas_int n, T *a,
+                                        rocblas_int lda) {
+
+  if (n == 0) {
+    // quick return
+    return rocblas_status_success;
+  } else if (n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  }
+
+  T inpsResHost[5];
+  inpsResHost[POTF2_INPONE] = scalar_const<T>(1);
+  inpsResHost[POTF2_INPMINONE] = scalar_const<T>(-1);
+  inpsResHost[POTF2_RESPOSDEF] = scalar_const<T>(1);
+
+  // allocate a tiny bit of memory on device to avoid going onto CPU and needing
+  // to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, 5 * sizeof(T));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 5 * sizeof(T), hipMemcpyHostToDevice);
+
+  rocsolver_potf2_async_template<T>(handle, uplo, n, a, lda, 0, inpsResGPU);
 
   // get the error code using memcpy and return internal error if there is one
   hipMemcpy(&inpsResHost[POTF2_RESPOSDEF], &inpsResGPU[POTF2_RESPOSDEF],
             sizeof(T), hipMemcpyDeviceToHost);
-  if (inpsResHost[POTF2_RESPOSDEF] <= 0.0) {
-    const size_t elem = static_cast<size_t>(fabs(inpsResHost[POTF2_RESPOSDEF]));
+  if (scalar_real(inpsResHost[POTF2_RESPOSDEF]) <= 0.0) {
+    const size_t elem =
+        static_cast<size_t>(fabs(scalar_real(inpsResHost[POTF2_RESPOSDEF])));
     cerr << "ERROR: Input matrix not strictly positive definite. Last "
             "occurrence of this in element "
          << elem << endl;
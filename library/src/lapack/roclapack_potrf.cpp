@@ -0,0 +1,27 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_potrf.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_spotrf(rocblas_handle handle, rocblas_fill uplo, rocblas_int n,
+                 float *A, rocblas_int lda) {
+  return rocsolver_potrf_template<float>(handle, uplo, n, A, lda);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dpotrf(rocblas_handle handle, rocblas_fill uplo, rocblas_int n,
+                 double *A, rocblas_int lda) {
+  return rocsolver_potrf_template<double>(handle, uplo, n, A, lda);
+}
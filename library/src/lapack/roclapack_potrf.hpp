@@ -0,0 +1,215 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_POTRF_HPP
+#define ROCLAPACK_POTRF_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "ideal_sizes.hpp"
+#include "roclapack_potf2.hpp"
+#include "tile_dag.hpp"
+
+// the first entries follow the POTF2 layout so that the buffer can be handed
+// to potf2 directly
+#define POTRF_INPONE 0
+#define POTRF_INPMINONE 1
+#define POTRF_RESPOSDEF 2
+#define POTRF_INPZERO 5
+
+/*
+ * A -= W on the lower (upper) triangle of an n x n tile only. This turns the
+ * gemm into the scratch tile W into the SYRK update of a diagonal tile, as
+ * the strictly upper (lower) part of A must not be referenced.
+ */
+template <typename T>
+__global__ void potrf_syrk_update(rocblas_fill uplo, rocblas_int n, T *A,
+                                  rocblas_int lda, const T *W,
+                                  rocblas_int ldw) {
+  const int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+  if (i < n && j < n && (uplo == rocblas_fill_lower ? i >= j : i <= j)) {
+    A[i + j * lda] -= W[i + j * ldw];
+  }
+}
+
+/*
+ * Tiled Cholesky factorization. The matrix is cut into POTRF_TILESIZE square
+ * tiles and the right-looking algorithm is expressed as POTRF, TRSM, SYRK and
+ * GEMM tasks on those tiles, which are scheduled as a DAG over several
+ * streams (see tile_dag.hpp). Small matrices go to potf2 directly.
+ */
+template <typename T>
+rocblas_status rocsolver_potrf_template(rocblas_handle handle,
+                                        rocblas_fill uplo, rocblas_int n, T *A,
+                                        rocblas_int lda) {
+
+  if (n <= POTRF_TILESIZE) {
+    return rocsolver_potf2_template<T>(handle, uplo, n, A, lda);
+  } else if (lda < n) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  }
+
+  T inpsResHost[6];
+  inpsResHost[POTRF_INPONE] = static_cast<T>(1);
+  inpsResHost[POTRF_INPMINONE] = static_cast<T>(-1);
+  inpsResHost[POTRF_RESPOSDEF] = static_cast<T>(1);
+  inpsResHost[POTRF_INPZERO] = static_cast<T>(0);
+
+  // allocate a tiny bit of memory on device to avoid going onto CPU and needing
+  // to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, 6 * sizeof(T));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 6 * sizeof(T), hipMemcpyHostToDevice);
+
+  const rocblas_int nb = POTRF_TILESIZE;
+  const rocblas_int nt = (n - 1) / nb + 1;
+
+  // one scratch tile per block row for the SYRK tasks; the SYRK updates of
+  // the same diagonal tile are serialized by the DAG, so they can share it
+  T *work;
+  hipMalloc(&work, sizeof(T) * nb * nb * nt);
+
+  const T *one = &inpsResGPU[POTRF_INPONE];
+  const T *minone = &inpsResGPU[POTRF_INPMINONE];
+  const T *zero = &inpsResGPU[POTRF_INPZERO];
+  const bool lower = (uplo == rocblas_fill_lower);
+
+  tile_dag dag;
+
+  for (rocblas_int k = 0; k < nt; ++k) {
+    const rocblas_int k0 = k * nb;
+    const rocblas_int kb = min(nb, n - k0);
+
+    // factor the diagonal tile
+    dag.add_task(
+        [=](rocblas_handle h, hipStream_t) -> rocblas_status {
+          rocsolver_potf2_async_template<T>(h, uplo, kb, A, lda, k0,
+                                            inpsResGPU);
+          return rocblas_status_success;
+        },
+        TILE_DAG_WEIGHT_FACTOR, {}, {k + k * nt});
+
+    // triangular solves for the tiles of the block column (row)
+    for (rocblas_int i = k + 1; i < nt; ++i) {
+      const rocblas_int i0 = i * nb;
+      const rocblas_int ib = min(nb, n - i0);
+      const rocblas_int tik = lower ? i + k * nt : k + i * nt;
+
+      dag.add_task(
+          [=](rocblas_handle h, hipStream_t) -> rocblas_status {
+            if (lower)
+              return rocblas_trsm<T>(h, rocblas_side_right, rocblas_fill_lower,
+                                     rocblas_operation_transpose,
+                                     rocblas_diagonal_non_unit, ib, kb, one,
+                                     &A[idx2D(k0, k0, lda)], lda,
+                                     &A[idx2D(i0, k0, lda)], lda);
+            else
+              return rocblas_trsm<T>(h, rocblas_side_left, rocblas_fill_upper,
+                                     rocblas_operation_transpose,
+                                     rocblas_diagonal_non_unit, kb, ib, one,
+                                     &A[idx2D(k0, k0, lda)], lda,
+                                     &A[idx2D(k0, i0, lda)], lda);
+          },
+          TILE_DAG_WEIGHT_TRSM, {k + k * nt}, {tik});
+    }
+
+    // update of the trailing matrix
+    for (rocblas_int j = k + 1; j < nt; ++j) {
+      const rocblas_int j0 = j * nb;
+      const rocblas_int jb = min(nb, n - j0);
+      const rocblas_int tjk = lower ? j + k * nt : k + j * nt;
+      T *w = &work[j * nb * nb];
+
+      dag.add_task(
+          [=](rocblas_handle h, hipStream_t stream) -> rocblas_status {
+            rocblas_status status;
+            if (lower)
+              status = rocblas_gemm<T>(
+                  h, rocblas_operation_none, rocblas_operation_transpose, jb,
+                  jb, kb, one, &A[idx2D(j0, k0, lda)], lda,
+                  &A[idx2D(j0, k0, lda)], lda, zero, w, nb);
+            else
+              status = rocblas_gemm<T>(
+                  h, rocblas_operation_transpose, rocblas_operation_none, jb,
+                  jb, kb, one, &A[idx2D(k0, j0, lda)], lda,
+                  &A[idx2D(k0, j0, lda)], lda, zero, w, nb);
+            if (status != rocblas_status_success)
+              return status;
+
+            const rocblas_int blocks = (jb - 1) / POTRF_SYRK_BLOCKSIZE + 1;
+            hipLaunchKernelGGL(
+                potrf_syrk_update<T>, dim3(blocks, blocks, 1),
+                dim3(POTRF_SYRK_BLOCKSIZE, POTRF_SYRK_BLOCKSIZE, 1), 0, stream,
+                uplo, jb, &A[idx2D(j0, j0, lda)], lda, w, nb);
+            return rocblas_status_success;
+          },
+          TILE_DAG_WEIGHT_SYRK, {tjk}, {j + j * nt});
+
+      for (rocblas_int i = j + 1; i < nt; ++i) {
+        const rocblas_int i0 = i * nb;
+        const rocblas_int ib = min(nb, n - i0);
+
+        if (lower) {
+          // A(i,j) -= A(i,k) * A(j,k)'
+          dag.add_task(
+              [=](rocblas_handle h, hipStream_t) -> rocblas_status {
+                return rocblas_gemm<T>(
+                    h, rocblas_operation_none, rocblas_operation_transpose, ib,
+                    jb, kb, minone, &A[idx2D(i0, k0, lda)], lda,
+                    &A[idx2D(j0, k0, lda)], lda, one, &A[idx2D(i0, j0, lda)],
+                    lda);
+              },
+              TILE_DAG_WEIGHT_GEMM, {i + k * nt, j + k * nt}, {i + j * nt});
+        } else {
+          // A(j,i) -= A(k,j)' * A(k,i)
+          dag.add_task(
+              [=](rocblas_handle h, hipStream_t) -> rocblas_status {
+                return rocblas_gemm<T>(
+                    h, rocblas_operation_transpose, rocblas_operation_none, jb,
+                    ib, kb, minone, &A[idx2D(k0, j0, lda)], lda,
+                    &A[idx2D(k0, i0, lda)], lda, one, &A[idx2D(j0, i0, lda)],
+                    lda);
+              },
+              TILE_DAG_WEIGHT_GEMM, {k + j * nt, k + i * nt}, {j + i * nt});
+        }
+      }
+    }
+  }
+
+  const rocblas_status status = dag.execute(handle);
+
+  // get the error code using memcpy and return internal error if there is one
+  hipMemcpy(&inpsResHost[POTRF_RESPOSDEF], &inpsResGPU[POTRF_RESPOSDEF],
+            sizeof(T), hipMemcpyDeviceToHost);
+  hipFree(work);
+  hipFree(inpsResGPU);
+
+  if (status != rocblas_status_success) {
+    return status;
+  }
+  if (inpsResHost[POTRF_RESPOSDEF] <= 0.0) {
+    const size_t elem = static_cast<size_t>(fabs(inpsResHost[POTRF_RESPOSDEF]));
+    cerr << "ERROR: Input matrix not strictly positive definite. Last "
+            "occurrence of this in element "
+         << elem << endl;
+    return rocblas_status_internal_error;
+  }
+
+  return rocblas_status_success;
+}
+
+#undef POTRF_INPONE
+#undef POTRF_INPMINONE
+#undef POTRF_RESPOSDEF
+#undef POTRF_INPZERO
+
+#endif /* ROCLAPACK_POTRF_HPP */
@@ -0,0 +1,43 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_potupdate.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_spotupdate(rocsolver_handle handle, rocsolver_fill uplo,
+                     rocsolver_int n, rocsolver_int k, float *A,
+                     rocsolver_int lda, float *X, rocsolver_int ldx) {
+  return rocsolver_potupdate_template<float>(handle, uplo, n, k, A, lda, X,
+                                             ldx, false);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dpotupdate(rocsolver_handle handle, rocsolver_fill uplo,
+                     rocsolver_int n, rocsolver_int k, double *A,
+                     rocsolver_int lda, double *X, rocsolver_int ldx) {
+  return rocsolver_potupdate_template<double>(handle, uplo, n, k, A, lda, X,
+                                              ldx, false);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_spotdowndate(rocsolver_handle handle, rocsolver_fill uplo,
+                       rocsolver_int n, rocsolver_int k, float *A,
+                       rocsolver_int lda, float *X, rocsolver_int ldx) {
+  return rocsolver_potupdate_template<float>(handle, uplo, n, k, A, lda, X,
+                                             ldx, true);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dpotdowndate(rocsolver_handle handle, rocsolver_fill uplo,
+                       rocsolver_int n, rocsolver_int k, double *A,
+                       rocsolver_int lda, double *X, rocsolver_int ldx) {
+  return rocsolver_potupdate_template<double>(handle, uplo, n, k, A, lda, X,
+                                              ldx, true);
+}
@@ -0,0 +1,217 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_POTUPDATE_HPP
+#define ROCLAPACK_POTUPDATE_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+#define POTUPDATE_RESPOSDEF 0
+
+/*
+ * Element (i,j), i >= j, of the lower triangular factor L; for uplo = upper
+ * the factor is stored as U = L**T.
+ */
+template <typename T>
+__device__ inline T &potupdate_elem(rocblas_fill uplo, T *A, rocblas_int lda,
+                                    rocblas_int i, rocblas_int j) {
+  return uplo == rocblas_fill_lower ? A[i + j * lda] : A[j + i * lda];
+}
+
+/*
+ * Panel step: applies the k rotations of every column of the diagonal block
+ * A(j0:j0+jb, j0:j0+jb) (held in shared memory) and records them in C and S
+ * for the trailing rows. Thread r owns row j0+r of the block and of X.
+ *
+ * With sign = 1 every rotation is a Givens rotation (update), with sign = -1
+ * a hyperbolic one (downdate); for a downdate that would leave the matrix
+ * indefinite the rotation is skipped and the failure is flagged.
+ */
+template <typename T>
+__global__ void potupdate_panel(rocblas_fill uplo, T sign, rocblas_int j0,
+                                rocblas_int jb, rocblas_int k, T *A,
+                                rocblas_int lda, T *X, rocblas_int ldx, T *C,
+                                T *S, T *inpsResGPU) {
+
+  const int r = hipThreadIdx_x;
+
+  __shared__ T D[POTUPDATE_BLOCKSIZE][POTUPDATE_BLOCKSIZE];
+  __shared__ T cs[2];
+
+  for (rocblas_int c = 0; c < jb; ++c)
+    if (r >= c && r < jb)
+      D[r][c] = potupdate_elem(uplo, A, lda, j0 + r, j0 + c);
+
+  for (rocblas_int t = 0; t < k; ++t) {
+    T x = (r < jb) ? X[j0 + r + t * ldx] : 0;
+    __syncthreads();
+
+    for (rocblas_int c = 0; c < jb; ++c) {
+      if (r == c) {
+        const T d = D[c][c];
+        const T rr = d * d + sign * x * x;
+        T cc = 1, ss = 0;
+        if (rr > 0) {
+          D[c][c] = sqrt(rr);
+          cc = D[c][c] / d;
+          ss = x / d;
+        } else {
+          inpsResGPU[POTUPDATE_RESPOSDEF] = -static_cast<T>(j0 + c);
+        }
+        cs[0] = cc;
+        cs[1] = ss;
+        C[c + t * POTUPDATE_BLOCKSIZE] = cc;
+        S[c + t * POTUPDATE_BLOCKSIZE] = ss;
+        x = 0;
+      }
+      __syncthreads();
+
+      if (r > c && r < jb) {
+        const T l = (D[r][c] + sign * cs[1] * x) / cs[0];
+        x = cs[0] * x - cs[1] * l;
+        D[r][c] = l;
+      }
+      __syncthreads();
+    }
+
+    if (r < jb)
+      X[j0 + r + t * ldx] = x;
+  }
+
+  for (rocblas_int c = 0; c < jb; ++c)
+    if (r >= c && r < jb)
+      potupdate_elem(uplo, A, lda, j0 + r, j0 + c) = D[r][c];
+}
+
+/*
+ * Trailing step: every thread owns one row i below the diagonal block, keeps
+ * L(i, j0:j0+jb) in registers and replays the rotations of the panel on it
+ * and on X(i, :).
+ */
+template <typename T>
+__global__ void potupdate_apply(rocblas_fill uplo, T sign, rocblas_int n,
+                                rocblas_int j0, rocblas_int jb, rocblas_int k,
+                                T *A, rocblas_int lda, T *X, rocblas_int ldx,
+                                const T *C, const T *S) {
+
+  const rocblas_int i =
+      j0 + jb + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+  if (i < n) {
+    T l[POTUPDATE_BLOCKSIZE];
+    for (rocblas_int c = 0; c < jb; ++c)
+      l[c] = potupdate_elem(uplo, A, lda, i, j0 + c);
+
+    for (rocblas_int t = 0; t < k; ++t) {
+      T x = X[i + t * ldx];
+      for (rocblas_int c = 0; c < jb; ++c) {
+        const T cc = C[c + t * POTUPDATE_BLOCKSIZE];
+        const T ss = S[c + t * POTUPDATE_BLOCKSIZE];
+        l[c] = (l[c] + sign * ss * x) / cc;
+        x = cc * x - ss * l[c];
+      }
+      X[i + t * ldx] = x;
+    }
+
+    for (rocblas_int c = 0; c < jb; ++c)
+      potupdate_elem(uplo, A, lda, i, j0 + c) = l[c];
+  }
+}
+
+/*
+ * Rank-k modification of a Cholesky factor: on entry A holds the factor of
+ * a symmetric positive definite matrix M (as computed by potf2/potrf), on
+ * exit the factor of M + X*X**T (downdate = false) or M - X*X**T
+ * (downdate = true). X is n x k and is overwritten.
+ *
+ * The columns are processed in panels of POTUPDATE_BLOCKSIZE: the panel
+ * kernel rotates the diagonal block and all k vectors into it, and the
+ * trailing rows then apply the recorded rotations independently, so the
+ * work is O(k*n^2) in n/POTUPDATE_BLOCKSIZE pairs of launches.
+ */
+template <typename T>
+rocblas_status rocsolver_potupdate_template(rocblas_handle handle,
+                                            rocblas_fill uplo, rocblas_int n,
+                                            rocblas_int k, T *A,
+                                            rocblas_int lda, T *X,
+                                            rocblas_int ldx, bool downdate) {
+
+  if (n < 0 || k < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, n) || ldx < max(1, n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (n == 0 || k == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  T inpsResHost[1];
+  inpsResHost[POTUPDATE_RESPOSDEF] = static_cast<T>(1);
+
+  // allocate a tiny bit of memory on device to avoid going onto CPU and needing
+  // to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU, sizeof(T));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], sizeof(T), hipMemcpyHostToDevice);
+
+  // rotations (cosines and sines) of one panel, for all k vectors
+  T *rot;
+  hipMalloc(&rot, 2 * sizeof(T) * POTUPDATE_BLOCKSIZE * k);
+  T *C = rot;
+  T *S = rot + POTUPDATE_BLOCKSIZE * k;
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const T sign = downdate ? static_cast<T>(-1) : static_cast<T>(1);
+
+  for (rocblas_int j0 = 0; j0 < n; j0 += POTUPDATE_BLOCKSIZE) {
+    const rocblas_int jb = min(POTUPDATE_BLOCKSIZE, n - j0);
+
+    hipLaunchKernelGGL(potupdate_panel<T>, dim3(1), dim3(POTUPDATE_BLOCKSIZE),
+                       0, stream, uplo, sign, j0, jb, k, A, lda, X, ldx, C, S,
+                       inpsResGPU);
+
+    const rocblas_int rows = n - j0 - jb;
+    if (rows > 0) {
+      const rocblas_int blocks = (rows - 1) / POTUPDATE_APPLY_BLOCKSIZE + 1;
+      hipLaunchKernelGGL(potupdate_apply<T>, dim3(blocks),
+                         dim3(POTUPDATE_APPLY_BLOCKSIZE), 0, stream, uplo, sign,
+                         n, j0, jb, k, A, lda, X, ldx, C, S);
+    }
+  }
+
+  // get the error code using memcpy and return internal error if there is one
+  hipMemcpy(&inpsResHost[POTUPDATE_RESPOSDEF],
+            &inpsResGPU[POTUPDATE_RESPOSDEF], sizeof(T),
+            hipMemcpyDeviceToHost);
+  hipFree(rot);
+  hipFree(inpsResGPU);
+
+  if (inpsResHost[POTUPDATE_RESPOSDEF] <= 0.0) {
+    const size_t elem =
+        static_cast<size_t>(fabs(inpsResHost[POTUPDATE_RESPOSDEF]));
+    cerr << "ERROR: Downdated matrix not strictly positive definite. Last "
+            "occurrence of this in element "
+         << elem << endl;
+    return rocblas_status_internal_error;
+  }
+
+  return rocblas_status_success;
+}
+
+#undef POTUPDATE_RESPOSDEF
+
+#endif /* ROCLAPACK_POTUPDATE_HPP */
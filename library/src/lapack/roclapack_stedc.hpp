@@ -0,0 +1,805 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_STEDC_HPP
+#define ROCLAPACK_STEDC_HPP
+
+#include <cmath>
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+/*
+ * Eigenvalues and eigenvectors of the symmetric tridiagonal matrix with
+ * diagonal D and subdiagonal E (E(n-1) = 0), all in device memory:
+ *  - stebz: eigenvalues only, by bisection on Sturm counts, one thread per
+ *    eigenvalue (the LAPACK xstebz);
+ *  - steqr: the implicit QL iteration in one workgroup, one thread chasing
+ *    the shifts while the workgroup applies the rotations of every sweep to
+ *    the rows of the eigenvectors (the LAPACK xsteqr, as in tql2);
+ *  - stedc: divide and conquer (the LAPACK xstedc). The matrix is torn into
+ *    a power of two of leaves of at most STEDC_LEAFSIZE rows, solved by
+ *    steqr one workgroup each, and pairs of neighbours are merged level
+ *    after level: deflation in one workgroup per merge, the roots of the
+ *    secular equations and the eigenvectors of the rank-one updates one
+ *    thread per eigenvalue over the whole level, and a gemm per merge.
+ * Eigenvalues come out in ascending order, eigenvectors in the columns of Q.
+ */
+
+// Sturm count: the eigenvalues of (D, E) that are less than x
+template <typename T>
+__device__ rocblas_int stebz_count(rocblas_int n, const T *D, const T *E,
+                                   T x, T pivmin) {
+  rocblas_int count = 0;
+  T q = 1;
+  for (rocblas_int i = 0; i < n; ++i) {
+    q = D[i] - x - ((i > 0) ? E[i - 1] * E[i - 1] / q : 0);
+    if (fabs(q) < pivmin)
+      q = -pivmin;
+    if (q < 0)
+      ++count;
+  }
+  return count;
+}
+
+// eigenvalue k of (D, E) into W(k), bisecting the Gershgorin interval down
+// to eps times the norm of the matrix (or eps relative to the eigenvalue)
+template <typename T>
+__global__ void stebz_bisect(rocblas_int n, const T *D, const T *E, T *W,
+                             T eps, T safmin) {
+  const rocblas_int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+  if (k >= n)
+    return;
+
+  T gl = D[0], gu = D[0], e2max = 0;
+  for (rocblas_int i = 0; i < n; ++i) {
+    const T r = ((i > 0) ? fabs(E[i - 1]) : 0) + fabs(E[i]);
+    gl = min(gl, D[i] - r);
+    gu = max(gu, D[i] + r);
+    e2max = max(e2max, E[i] * E[i]);
+  }
+  const T pivmin = safmin * max(T(1), e2max);
+  const T tnorm = max(fabs(gl), fabs(gu));
+  const T atol = eps * tnorm;
+
+  T lo = gl - 2 * atol - 2 * pivmin;
+  T hi = gu + 2 * atol + 2 * pivmin;
+  for (rocblas_int it = 0; it < 256; ++it) {
+    if (hi - lo <= max(max(atol, pivmin), 2 * eps * max(fabs(lo), fabs(hi))))
+      break;
+    const T mid = (lo + hi) / 2;
+    if (stebz_count<T>(n, D, E, mid, pivmin) > k)
+      hi = mid;
+    else
+      lo = mid;
+  }
+  W[k] = (lo + hi) / 2;
+}
+
+// one QL sweep with implicit shift on rows and columns l to m of (d, e),
+// carrying the shift in f; the rotation of columns i and i + 1, taken from
+// i = m - 1 down to l, goes to rc(i), rs(i)
+template <typename T>
+__device__ void steqr_sweep(rocblas_int l, rocblas_int m, rocblas_int n, T *d,
+                            T *e, T &f, T *rc, T *rs) {
+  T g = d[l];
+  T p = (d[l + 1] - g) / (2 * e[l]);
+  T r = hypot(p, T(1));
+  if (p < 0)
+    r = -r;
+  d[l] = e[l] / (p + r);
+  d[l + 1] = e[l] * (p + r);
+  const T dl1 = d[l + 1];
+  T h = g - d[l];
+  for (rocblas_int i = l + 2; i < n; ++i)
+    d[i] -= h;
+  f += h;
+
+  p = d[m];
+  T c = 1, c2 = 1, c3 = 1, s = 0, s2 = 0;
+  const T el1 = e[l + 1];
+  for (rocblas_int i = m - 1; i >= l; --i) {
+    c3 = c2;
+    c2 = c;
+    s2 = s;
+    g = c * e[i];
+    h = c * p;
+    r = hypot(p, e[i]);
+    e[i + 1] = s * r;
+    s = e[i] / r;
+    c = p / r;
+    p = c * d[i] - s * g;
+    d[i + 1] = h + s * (c * g + s * d[i]);
+    rc[i] = c;
+    rs[i] = s;
+  }
+  p = -s * s2 * c3 * el1 * e[l] / dl1;
+  e[l] = s * p;
+  d[l] = c * p;
+}
+
+/*
+ * The implicit QL iteration on (d, e) of order n by the whole workgroup,
+ * with Q (n x n, on input the identity or the vectors to update) taking the
+ * rotations. Thread 0 keeps the state of the iteration and produces one
+ * sweep of rotations at a time. The eigenvalues are sorted at the end, the
+ * columns of Q along. At most 30 sweeps per eigenvalue on average, as in
+ * LAPACK, are taken.
+ */
+template <typename T>
+__device__ void steqr_device(rocblas_int n, T *d, T *e, T *Q, rocblas_int ldq,
+                             T *rc, T *rs, T eps) {
+  __shared__ rocblas_int sl, sm;
+  const int tid = hipThreadIdx_x;
+
+  // the state of the iteration, in thread 0
+  rocblas_int l = 0, m = 0, sweeps = 0;
+  T f = 0, tst1 = 0;
+  bool newl = true;
+
+  while (true) {
+    if (tid == 0) {
+      sl = -1;
+      while (l < n) {
+        if (newl) {
+          tst1 = max(tst1, fabs(d[l]) + fabs(e[l]));
+          m = l;
+          while (fabs(e[m]) > eps * tst1)
+            ++m;
+          newl = false;
+        }
+        if (m > l && fabs(e[l]) > eps * tst1 && sweeps < 30 * n) {
+          steqr_sweep<T>(l, m, n, d, e, f, rc, rs);
+          ++sweeps;
+          sl = l;
+          sm = m;
+          break;
+        }
+        d[l] += f;
+        e[l] = 0;
+        ++l;
+        newl = true;
+      }
+    }
+    __syncthreads();
+    const rocblas_int il = sl;
+    const rocblas_int im = sm;
+    if (il < 0)
+      break;
+
+    for (rocblas_int r = tid; r < n; r += hipBlockDim_x) {
+      for (rocblas_int i = im - 1; i >= il; --i) {
+        const T h = Q[idx2D(r, i + 1, ldq)];
+        const T q = Q[idx2D(r, i, ldq)];
+        Q[idx2D(r, i + 1, ldq)] = rs[i] * q + rc[i] * h;
+        Q[idx2D(r, i, ldq)] = rc[i] * q - rs[i] * h;
+      }
+    }
+    __syncthreads();
+  }
+
+  for (rocblas_int i = 0; i < n - 1; ++i) {
+    if (tid == 0) {
+      rocblas_int k = i;
+      for (rocblas_int j = i + 1; j < n; ++j)
+        if (d[j] < d[k])
+          k = j;
+      if (k != i) {
+        const T t = d[i];
+        d[i] = d[k];
+        d[k] = t;
+      }
+      sm = k;
+    }
+    __syncthreads();
+    const rocblas_int k = sm;
+    if (k != i) {
+      for (rocblas_int r = tid; r < n; r += hipBlockDim_x) {
+        const T t = Q[idx2D(r, i, ldq)];
+        Q[idx2D(r, i, ldq)] = Q[idx2D(r, k, ldq)];
+        Q[idx2D(r, k, ldq)] = t;
+      }
+    }
+    __syncthreads();
+  }
+}
+
+// steqr on the whole matrix, one workgroup
+template <typename T>
+__global__ void steqr_kernel(rocblas_int n, T *D, T *E, T *Q, rocblas_int ldq,
+                             T *rc, T *rs, T eps) {
+  steqr_device<T>(n, D, E, Q, ldq, rc, rs, eps);
+}
+
+// Q := I
+template <typename T>
+__global__ void stedc_identity(rocblas_int n, T *Q, rocblas_int ldq) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+
+  if (i < n)
+    Q[idx2D(i, j, ldq)] = (i == j) ? 1 : 0;
+}
+
+// the first row of leaf i of nleaf
+__host__ __device__ inline rocblas_int
+stedc_bound(rocblas_int i, rocblas_int n, rocblas_int nleaf) {
+  return rocblas_int((long long)(i)*n / nleaf);
+}
+
+// the leaf of row g
+__device__ inline rocblas_int stedc_leaf_of(rocblas_int g, rocblas_int n,
+                                            rocblas_int nleaf) {
+  rocblas_int i = rocblas_int((long long)(g)*nleaf / n);
+  while (i + 1 < nleaf && stedc_bound(i + 1, n, nleaf) <= g)
+    ++i;
+  while (stedc_bound(i, n, nleaf) > g)
+    --i;
+  return i;
+}
+
+// leaves of at most STEDC_LEAFSIZE rows, a power of two of them
+inline rocblas_int stedc_leaves(rocblas_int n) {
+  rocblas_int nleaf = 1;
+  while ((n - 1) / nleaf + 1 > STEDC_LEAFSIZE)
+    nleaf *= 2;
+  return nleaf;
+}
+
+// the vectors of the merges in the workspace, n elements each; a merge of
+// rows a to b - 1 uses elements a to b - 1 of each
+#define STEDC_DS 0   // d, sorted
+#define STEDC_ZS 1   // z, sorted
+#define STEDC_DK 2   // d of the secular equation (not deflated)
+#define STEDC_ZK 3   // its z, then the z that makes the vectors orthogonal
+#define STEDC_DD 4   // deflated eigenvalues
+#define STEDC_LAM 5  // roots of the secular equation
+#define STEDC_TAU 6  // the same, from the nearest pole
+#define STEDC_RC 7   // rotations of the deflation
+#define STEDC_RS 8
+#define STEDC_NVEC 9 // number of vectors
+#define STEDC_PERM 0 // columns of the sorted d
+#define STEDC_KCOL 1 // columns of DK
+#define STEDC_DCOL 2 // columns of DD
+#define STEDC_ORG 3  // pole nearest to every root
+#define STEDC_R1 4   // columns of the rotations
+#define STEDC_R2 5
+#define STEDC_CNT 6  // number of roots, and of rotations, of the merge at a
+#define STEDC_NROT 7
+#define STEDC_NIVEC 8
+
+// elements of the workspace: the vectors, S and the products of the merges
+// (n x n each), and of the integer workspace
+inline size_t stedc_work_size(rocblas_int n) {
+  return STEDC_NVEC * size_t(n) + 2 * size_t(n) * n;
+}
+
+inline size_t stedc_iwork_size(rocblas_int n) {
+  return STEDC_NIVEC * size_t(n);
+}
+
+// the rank-one tearing: D(m-1) and D(m) lose |E(m-1)| at the first row m
+// of every leaf but the first
+template <typename T>
+__global__ void stedc_tear(rocblas_int n, rocblas_int nleaf, T *D,
+                           const T *E) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x + 1;
+
+  if (i < nleaf) {
+    const rocblas_int m = stedc_bound(i, n, nleaf);
+    const T rho = fabs(E[m - 1]);
+    D[m - 1] -= rho;
+    D[m] -= rho;
+  }
+}
+
+// every leaf by steqr, one workgroup each (Q is the identity on input)
+template <typename T>
+__global__ void stedc_leaf(rocblas_int n, rocblas_int nleaf, T *D, const T *E,
+                           T *Q, rocblas_int ldq, T eps) {
+  __shared__ T e[STEDC_LEAFSIZE];
+  __shared__ T rc[STEDC_LEAFSIZE];
+  __shared__ T rs[STEDC_LEAFSIZE];
+  const int tid = hipThreadIdx_x;
+  const rocblas_int a = stedc_bound(hipBlockIdx_x, n, nleaf);
+  const rocblas_int k = stedc_bound(hipBlockIdx_x + 1, n, nleaf) - a;
+
+  for (rocblas_int i = tid; i < k; i += hipBlockDim_x)
+    e[i] = (i < k - 1) ? E[a + i] : 0;
+  __syncthreads();
+
+  steqr_device<T>(k, &D[a], e, &Q[idx2D(a, a, ldq)], ldq, rc, rs, eps);
+}
+
+// elements of the sorted x(0:n-1) less than v, or not greater if orequal
+template <typename T>
+__device__ rocblas_int stedc_rank(rocblas_int n, const T *x, T v,
+                                  bool orequal) {
+  rocblas_int lo = 0, hi = n;
+  while (lo < hi) {
+    const rocblas_int mid = (lo + hi) / 2;
+    if (x[mid] < v || (orequal && x[mid] == v))
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+// the merge of level p (leaves per merge) that holds row g: rows a to b - 1
+__device__ inline void stedc_merge_of(rocblas_int g, rocblas_int n,
+                                      rocblas_int nleaf, rocblas_int p,
+                                      rocblas_int &a, rocblas_int &b) {
+  const rocblas_int q = stedc_leaf_of(g, n, nleaf) / p;
+  a = stedc_bound(q * p, n, nleaf);
+  b = stedc_bound((q + 1) * p, n, nleaf);
+}
+
+/*
+ * First step of the merges of level p, one workgroup each (the LAPACK
+ * xlaed2). The eigenvalues of the two halves are merged in order and z is
+ * formed from the last row of the eigenvectors of the first half and the
+ * first row of those of the second. Then thread 0 deflates: the
+ * components of z that are negligible, and one of every pair of eigenvalues
+ * too close to be told apart after a rotation that zeroes its component of
+ * z. The rotations are applied to the columns of Q by the workgroup.
+ */
+template <typename T>
+__global__ void stedc_deflate(rocblas_int n, rocblas_int nleaf, rocblas_int p,
+                              const T *D, const T *E, T *Q, rocblas_int ldq,
+                              T *work, rocblas_int *iwork, T eps) {
+  __shared__ rocblas_int snrot;
+  const int tid = hipThreadIdx_x;
+  const rocblas_int q = hipBlockIdx_x;
+  const rocblas_int a = stedc_bound(q * p, n, nleaf);
+  const rocblas_int mid = stedc_bound(q * p + p / 2, n, nleaf);
+  const rocblas_int k = stedc_bound((q + 1) * p, n, nleaf) - a;
+  const rocblas_int n1 = mid - a;
+
+  T *ds = &work[STEDC_DS * n + a];
+  T *zs = &work[STEDC_ZS * n + a];
+  T *dk = &work[STEDC_DK * n + a];
+  T *zk = &work[STEDC_ZK * n + a];
+  T *dd = &work[STEDC_DD * n + a];
+  T *rc = &work[STEDC_RC * n + a];
+  T *rs = &work[STEDC_RS * n + a];
+  rocblas_int *perm = &iwork[STEDC_PERM * n + a];
+  rocblas_int *kcol = &iwork[STEDC_KCOL * n + a];
+  rocblas_int *dcol = &iwork[STEDC_DCOL * n + a];
+  rocblas_int *r1 = &iwork[STEDC_R1 * n + a];
+  rocblas_int *r2 = &iwork[STEDC_R2 * n + a];
+
+  const T beta = E[mid - 1];
+  const T rho = 2 * fabs(beta);
+  const T sgn = (beta < 0) ? -1 : 1;
+  const T scal = 1 / sqrt(T(2));
+
+  for (rocblas_int i = tid; i < k; i += hipBlockDim_x) {
+    const T di = D[a + i];
+    rocblas_int pos;
+    T zi;
+    if (i < n1) {
+      pos = i + stedc_rank<T>(k - n1, &D[mid], di, false);
+      zi = Q[idx2D(mid - 1, a + i, ldq)];
+    } else {
+      pos = i - n1 + stedc_rank<T>(n1, &D[a], di, true);
+      zi = sgn * Q[idx2D(mid, a + i, ldq)];
+    }
+    ds[pos] = di;
+    zs[pos] = zi * scal;
+    perm[pos] = i;
+  }
+  __syncthreads();
+
+  if (tid == 0) {
+    T dmax = 0, zmax = 0;
+    for (rocblas_int j = 0; j < k; ++j) {
+      dmax = max(dmax, fabs(ds[j]));
+      zmax = max(zmax, fabs(zs[j]));
+    }
+    const T tol = 8 * eps * max(dmax, zmax);
+
+    rocblas_int nk = 0, nd = 0, nrot = 0, jlam = -1;
+    for (rocblas_int j = 0; j < k; ++j) {
+      if (rho * fabs(zs[j]) <= tol) {
+        dd[nd] = ds[j];
+        dcol[nd++] = perm[j];
+        continue;
+      }
+      if (jlam < 0) {
+        jlam = j;
+        continue;
+      }
+      T s = zs[jlam];
+      T c = zs[j];
+      const T tau = hypot(c, s);
+      T t = ds[j] - ds[jlam];
+      c /= tau;
+      s = -s / tau;
+      if (fabs(t * c * s) <= tol) {
+        zs[j] = tau;
+        zs[jlam] = 0;
+        r1[nrot] = perm[jlam];
+        r2[nrot] = perm[j];
+        rc[nrot] = c;
+        rs[nrot++] = s;
+        t = ds[jlam] * c * c + ds[j] * s * s;
+        ds[j] = ds[jlam] * s * s + ds[j] * c * c;
+        dd[nd] = t;
+        dcol[nd++] = perm[jlam];
+      } else {
+        dk[nk] = ds[jlam];
+        zk[nk] = zs[jlam];
+        kcol[nk++] = perm[jlam];
+      }
+      jlam = j;
+    }
+    if (jlam >= 0) {
+      dk[nk] = ds[jlam];
+      zk[nk] = zs[jlam];
+      kcol[nk++] = perm[jlam];
+    }
+
+    // the deflated eigenvalues are nearly in order already
+    for (rocblas_int j = 1; j < nd; ++j) {
+      const T t = dd[j];
+      const rocblas_int col = dcol[j];
+      rocblas_int i = j;
+      for (; i > 0 && dd[i - 1] > t; --i) {
+        dd[i] = dd[i - 1];
+        dcol[i] = dcol[i - 1];
+      }
+      dd[i] = t;
+      dcol[i] = col;
+    }
+
+    iwork[STEDC_CNT * n + a] = nk;
+    iwork[STEDC_NROT * n + a] = nrot;
+    snrot = nrot;
+  }
+  __syncthreads();
+
+  // the rotations, x := c * x + s * y and y := c * y - s * x on the columns
+  const rocblas_int nrot = snrot;
+  for (rocblas_int i = tid; i < k; i += hipBlockDim_x) {
+    for (rocblas_int j = 0; j < nrot; ++j) {
+      T *x = &Q[idx2D(a + i, a + r1[j], ldq)];
+      T *y = &Q[idx2D(a + i, a + r2[j], ldq)];
+      const T xv = *x;
+      const T yv = *y;
+      *x = rc[j] * xv + rs[j] * yv;
+      *y = rc[j] * yv - rs[j] * xv;
+    }
+  }
+}
+
+// f(lambda) = 1 + rho * sum z(j)^2 / (d(j) - lambda) at lambda = d(o) + tau,
+// its derivative, and the sum of the absolute values of the terms (a bound
+// of the rounding error of f over eps)
+template <typename T>
+__device__ void stedc_secular(rocblas_int k, const T *d, const T *z, T rho,
+                              rocblas_int o, T tau, T &f, T &df, T &fabs_sum) {
+  f = 1;
+  df = 0;
+  fabs_sum = 1;
+  for (rocblas_int j = 0; j < k; ++j) {
+    const T t = z[j] / ((d[j] - d[o]) - tau);
+    const T term = rho * z[j] * t;
+    f += term;
+    df += rho * t * t;
+    fabs_sum += fabs(term);
+  }
+}
+
+/*
+ * The roots of the secular equations of the merges of level p, one thread
+ * per root: root i lies between d(i) and d(i+1) (the last one between
+ * d(k-1) and d(k-1) + rho * |z|^2). It is kept as the offset tau from the
+ * nearer pole, so that the differences d(j) - lambda are accurate, and
+ * found by Newton's method safeguarded by bisection.
+ */
+template <typename T>
+__global__ void stedc_roots(rocblas_int n, rocblas_int nleaf, rocblas_int p,
+                            const T *E, T *work, rocblas_int *iwork, T eps) {
+  const rocblas_int g = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+  if (g >= n)
+    return;
+
+  rocblas_int a, b;
+  stedc_merge_of(g, n, nleaf, p, a, b);
+  const rocblas_int k = iwork[STEDC_CNT * n + a];
+  const rocblas_int i = g - a;
+  if (i >= k)
+    return;
+
+  const rocblas_int mid = stedc_bound(stedc_leaf_of(a, n, nleaf) + p / 2, n,
+                                      nleaf);
+  const T rho = 2 * fabs(E[mid - 1]);
+  const T *d = &work[STEDC_DK * n + a];
+  const T *z = &work[STEDC_ZK * n + a];
+
+  T f, df, fsum;
+  rocblas_int o;
+  T lo, hi;
+  if (i < k - 1) {
+    const T half = (d[i + 1] - d[i]) / 2;
+    stedc_secular<T>(k, d, z, rho, i, half, f, df, fsum);
+    if (f >= 0) {
+      o = i;
+      lo = 0;
+      hi = half;
+    } else {
+      o = i + 1;
+      lo = -half;
+      hi = 0;
+    }
+  } else {
+    T z2 = 0;
+    for (rocblas_int j = 0; j < k; ++j)
+      z2 += z[j] * z[j];
+    o = i;
+    lo = 0;
+    hi = rho * z2;
+  }
+
+  T tau = (lo + hi) / 2;
+  for (rocblas_int it = 0; it < 256; ++it) {
+    stedc_secular<T>(k, d, z, rho, o, tau, f, df, fsum);
+    if (fabs(f) <= 8 * eps * fsum)
+      break;
+    if (f < 0)
+      lo = tau;
+    else
+      hi = tau;
+    if (hi - lo <= 2 * eps * max(fabs(lo), fabs(hi)))
+      break;
+    T next = tau - f / df;
+    if (!(next > lo && next < hi))
+      next = (lo + hi) / 2;
+    tau = next;
+  }
+
+  work[STEDC_LAM * n + a + i] = d[o] + tau;
+  work[STEDC_TAU * n + a + i] = tau;
+  iwork[STEDC_ORG * n + a + i] = o;
+}
+
+/*
+ * The z of the secular equations recomputed from the roots (Gu and
+ * Eisenstat, as in the LAPACK xlaed3), so that the eigenvectors come out
+ * orthogonal: z(j)^2 = prod_i (lambda(i) - d(j)) / prod_{i != j} (d(i) -
+ * d(j)), with the sign of the original z(j). One thread per z(j).
+ */
+template <typename T>
+__global__ void stedc_zhat(rocblas_int n, rocblas_int nleaf, rocblas_int p,
+                           T *work, const rocblas_int *iwork) {
+  const rocblas_int g = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+  if (g >= n)
+    return;
+
+  rocblas_int a, b;
+  stedc_merge_of(g, n, nleaf, p, a, b);
+  const rocblas_int k = iwork[STEDC_CNT * n + a];
+  const rocblas_int j = g - a;
+  if (j >= k)
+    return;
+
+  const T *d = &work[STEDC_DK * n + a];
+  const T *tau = &work[STEDC_TAU * n + a];
+  const rocblas_int *org = &iwork[STEDC_ORG * n + a];
+  T *z = &work[STEDC_ZK * n + a];
+
+  T prod = (d[org[j]] - d[j]) + tau[j];
+  for (rocblas_int i = 0; i < k; ++i)
+    if (i != j)
+      prod *= ((d[org[i]] - d[j]) + tau[i]) / (d[i] - d[j]);
+  z[j] = copysign(sqrt(fabs(prod)), z[j]);
+}
+
+/*
+ * The eigenvalues of the merges of level p in order, into D, and the
+ * eigenvectors of the rank-one updates into the columns of S (rows a to b
+ * - 1 and columns a to b - 1 for the merge of rows a to b - 1, the rows
+ * following the columns of Q), one thread per eigenvalue: the vector of
+ * root i has entries z(j) / (d(j) - lambda(i)) on the rows of the
+ * equation, that of a deflated eigenvalue is a column of the identity.
+ */
+template <typename T>
+__global__ void stedc_vectors(rocblas_int n, rocblas_int nleaf, rocblas_int p,
+                              T *D, T *S, rocblas_int lds, const T *work,
+                              const rocblas_int *iwork) {
+  const rocblas_int g = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+  if (g >= n)
+    return;
+
+  rocblas_int a, b;
+  stedc_merge_of(g, n, nleaf, p, a, b);
+  const rocblas_int k = iwork[STEDC_CNT * n + a];
+  const rocblas_int nd = b - a - k;
+  const rocblas_int i = g - a;
+
+  const T *d = &work[STEDC_DK * n + a];
+  const T *z = &work[STEDC_ZK * n + a];
+  const T *dd = &work[STEDC_DD * n + a];
+  const T *lam = &work[STEDC_LAM * n + a];
+  const rocblas_int *kcol = &iwork[STEDC_KCOL * n + a];
+
+  rocblas_int pos;
+  T lambda;
+  if (i < k) {
+    lambda = lam[i];
+    pos = i + stedc_rank<T>(nd, dd, lambda, false);
+  } else {
+    lambda = dd[i - k];
+    pos = i - k + stedc_rank<T>(k, lam, lambda, true);
+  }
+  D[a + pos] = lambda;
+
+  T *s = &S[idx2D(a, a + pos, lds)];
+  for (rocblas_int r = 0; r < b - a; ++r)
+    s[r] = 0;
+
+  if (i < k) {
+    const rocblas_int o = iwork[STEDC_ORG * n + a + i];
+    const T tau = work[STEDC_TAU * n + a + i];
+    T nrm = 0;
+    for (rocblas_int j = 0; j < k; ++j) {
+      const T t = z[j] / ((d[j] - d[o]) - tau);
+      nrm += t * t;
+    }
+    nrm = sqrt(nrm);
+    for (rocblas_int j = 0; j < k; ++j)
+      s[kcol[j]] = z[j] / ((d[j] - d[o]) - tau) / nrm;
+  } else {
+    s[iwork[STEDC_DCOL * n + a + i - k]] = 1;
+  }
+}
+
+// the diagonal blocks of the merges of level p from P back into Q
+template <typename T>
+__global__ void stedc_copy_blocks(rocblas_int n, rocblas_int nleaf,
+                                  rocblas_int p, const T *P, rocblas_int ldp,
+                                  T *Q, rocblas_int ldq) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+
+  if (i < n) {
+    rocblas_int a, b;
+    stedc_merge_of(j, n, nleaf, p, a, b);
+    if (i >= a && i < b)
+      Q[idx2D(i, j, ldq)] = P[idx2D(i, j, ldp)];
+  }
+}
+
+/*
+ * Enqueue the eigenvalues (into D, ascending) and eigenvectors (into Q,
+ * n x n) of (D, E) by steqr in one workgroup. work has 2 * n elements.
+ */
+template <typename T>
+void rocsolver_steqr_async_template(rocblas_handle handle, rocblas_int n,
+                                    T *D, T *E, T *Q, rocblas_int ldq,
+                                    T *work) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  hipLaunchKernelGGL(stedc_identity<T>,
+                     dim3((n - 1) / STEDC_BLOCKSIZE + 1, n, 1),
+                     dim3(STEDC_BLOCKSIZE, 1, 1), 0, stream, n, Q, ldq);
+
+  hipLaunchKernelGGL(steqr_kernel<T>, dim3(1), dim3(STEDC_BLOCKSIZE), 0,
+                     stream, n, D, E, Q, ldq, work, work + n,
+                     numeric_limits<T>::epsilon());
+}
+
+/*
+ * Enqueue the eigenvalues (into D, ascending) of (D, E) by bisection into
+ * W. D and E are left as they are.
+ */
+template <typename T>
+void rocsolver_stebz_async_template(rocblas_handle handle, rocblas_int n,
+                                    const T *D, const T *E, T *W) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  hipLaunchKernelGGL(stebz_bisect<T>, dim3((n - 1) / STEDC_BLOCKSIZE + 1),
+                     dim3(STEDC_BLOCKSIZE), 0, stream, n, D, E, W,
+                     numeric_limits<T>::epsilon(), numeric_limits<T>::min());
+}
+
+/*
+ * Enqueue the eigenvalues (into D, ascending) and eigenvectors (into Q,
+ * n x n) of (D, E) by divide and conquer. E is left as it is. one and zero
+ * are device constants, work has stedc_work_size(n) elements and iwork
+ * stedc_iwork_size(n).
+ */
+template <typename T>
+void rocsolver_stedc_async_template(rocblas_handle handle, rocblas_int n,
+                                    T *D, const T *E, T *Q, rocblas_int ldq,
+                                    const T *one, const T *zero, T *work,
+                                    rocblas_int *iwork) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const T eps = numeric_limits<T>::epsilon();
+  const rocblas_int nleaf = stedc_leaves(n);
+  const rocblas_int blocks = (n - 1) / STEDC_BLOCKSIZE + 1;
+  T *S = work + STEDC_NVEC * size_t(n);
+  T *P = S + size_t(n) * n;
+
+  hipLaunchKernelGGL(stedc_identity<T>, dim3(blocks, n, 1),
+                     dim3(STEDC_BLOCKSIZE, 1, 1), 0, stream, n, Q, ldq);
+
+  if (nleaf > 1)
+    hipLaunchKernelGGL(stedc_tear<T>,
+                       dim3((nleaf - 2) / STEDC_BLOCKSIZE + 1),
+                       dim3(STEDC_BLOCKSIZE), 0, stream, n, nleaf, D, E);
+
+  hipLaunchKernelGGL(stedc_leaf<T>, dim3(nleaf), dim3(STEDC_LEAFSIZE), 0,
+                     stream, n, nleaf, D, E, Q, ldq, eps);
+
+  for (rocblas_int p = 2; p <= nleaf; p *= 2) {
+    hipLaunchKernelGGL(stedc_deflate<T>, dim3(nleaf / p),
+                       dim3(STEDC_BLOCKSIZE), 0, stream, n, nleaf, p, D, E, Q,
+                       ldq, work, iwork, eps);
+    hipLaunchKernelGGL(stedc_roots<T>, dim3(blocks), dim3(STEDC_BLOCKSIZE), 0,
+                       stream, n, nleaf, p, E, work, iwork, eps);
+    hipLaunchKernelGGL(stedc_zhat<T>, dim3(blocks), dim3(STEDC_BLOCKSIZE), 0,
+                       stream, n, nleaf, p, work, iwork);
+    hipLaunchKernelGGL(stedc_vectors<T>, dim3(blocks), dim3(STEDC_BLOCKSIZE),
+                       0, stream, n, nleaf, p, D, S, n, work, iwork);
+
+    // the eigenvectors of the merged blocks: Q(a:b,a:b) * S(a:b,a:b)
+    for (rocblas_int q = 0; q < nleaf / p; ++q) {
+      const rocblas_int a = stedc_bound(q * p, n, nleaf);
+      const rocblas_int k = stedc_bound((q + 1) * p, n, nleaf) - a;
+      rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none,
+                      k, k, k, one, &Q[idx2D(a, a, ldq)], ldq,
+                      &S[idx2D(a, a, n)], n, zero, &P[idx2D(a, a, n)], n);
+    }
+    hipLaunchKernelGGL(stedc_copy_blocks<T>, dim3(blocks, n, 1),
+                       dim3(STEDC_BLOCKSIZE, 1, 1), 0, stream, n, nleaf, p, P,
+                       n, Q, ldq);
+  }
+}
+
+#undef STEDC_DS
+#undef STEDC_ZS
+#undef STEDC_DK
+#undef STEDC_ZK
+#undef STEDC_DD
+#undef STEDC_LAM
+#undef STEDC_TAU
+#undef STEDC_RC
+#undef STEDC_RS
+#undef STEDC_NVEC
+#undef STEDC_PERM
+#undef STEDC_KCOL
+#undef STEDC_DCOL
+#undef STEDC_ORG
+#undef STEDC_R1
+#undef STEDC_R2
+#undef STEDC_CNT
+#undef STEDC_NROT
+#undef STEDC_NIVEC
+
+#endif /* ROCLAPACK_STEDC_HPP */
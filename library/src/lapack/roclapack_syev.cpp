@@ -0,0 +1,29 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_syev.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_ssyev(rocblas_handle handle, rocsolver_evect evect, rocblas_fill uplo,
+                rocblas_int n, float *A, rocblas_int lda, float *W) {
+  return rocsolver_syev_template<float>(handle, evect, uplo, n, A, lda, W,
+                                        false);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status
+rocsolver_dsyev(rocblas_handle handle, rocsolver_evect evect, rocblas_fill uplo,
+                rocblas_int n, double *A, rocblas_int lda, double *W) {
+  return rocsolver_syev_template<double>(handle, evect, uplo, n, A, lda, W,
+                                         false);
+}
@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_SYEV_HPP
+#define ROCLAPACK_SYEV_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_ormqr.hpp"
+#include "roclapack_stedc.hpp"
+#include "roclapack_sytrd.hpp"
+
+using namespace std;
+
+// the constants, then E, D and the workspace of the reduction to
+// tridiagonal form, then that of the tridiagonal eigensolver, which ormtr
+// reuses afterwards
+#define SYEV_INPONE 0
+#define SYEV_INPZERO 1
+#define SYEV_INPMINONE 2
+#define SYEV_INPMINHALF 3
+#define SYEV_WORK 4
+
+// elements of the workspace after the constants
+inline size_t syev_work_size(rocsolver_evect evect, rocblas_int n,
+                             bool divide) {
+  size_t size = 2 * size_t(n) + sytrd_work_size(n);
+  if (evect == rocsolver_evect_original)
+    size += max(divide ? stedc_work_size(n) : 2 * size_t(n),
+                ormqr_work_size(rocblas_side_left, n, n));
+  return size;
+}
+
+/*
+ * Eigenvalues (ascending, into W) and optionally eigenvectors (into the
+ * columns of A) of the symmetric matrix A. A is reduced to tridiagonal form
+ * in two stages (see roclapack_sytrd.hpp); the eigenvalues alone are found
+ * by bisection, the eigenvectors of the tridiagonal matrix by divide and
+ * conquer (divide) or the QL iteration, and are taken back to A by ormtr.
+ * It only enqueues work on the handle's stream, with the constants and
+ * workspace laid out by the SYEV_* indices above (the geqrf constants of
+ * the reduction already uploaded) and iwork of stedc_iwork_size(n)
+ * elements.
+ */
+template <typename T>
+void rocsolver_syev_async_template(rocblas_handle handle,
+                                   rocsolver_evect evect, rocblas_fill uplo,
+                                   rocblas_int n, T *A, rocblas_int lda, T *W,
+                                   bool divide, T *inpsResGPU,
+                                   rocblas_int *iwork) {
+
+  const T *one = &inpsResGPU[SYEV_INPONE];
+  const T *zero = &inpsResGPU[SYEV_INPZERO];
+  const T *minone = &inpsResGPU[SYEV_INPMINONE];
+  const T *minhalf = &inpsResGPU[SYEV_INPMINHALF];
+  T *E = &inpsResGPU[SYEV_WORK];
+  T *D = E + n;
+  T *work = D + n;
+  T *twork = work + sytrd_work_size(n);
+  const bool vectors = (evect == rocsolver_evect_original);
+
+  // the eigenvectors are found in place of the eigenvalues
+  rocsolver_sytrd_async_template<T>(handle, uplo, n, A, lda, vectors ? W : D,
+                                    E, vectors, one, zero, minone, minhalf,
+                                    work);
+
+  if (!vectors) {
+    rocsolver_stebz_async_template<T>(handle, n, D, E, W);
+    return;
+  }
+
+  if (divide)
+    rocsolver_stedc_async_template<T>(handle, n, W, E, A, lda, one, zero,
+                                      twork, iwork);
+  else
+    rocsolver_steqr_async_template<T>(handle, n, W, E, A, lda, twork);
+
+  rocsolver_ormtr_async_template<T>(handle, n, n, A, lda, one, zero, minone,
+                                    work, twork);
+}
+
+template <typename T>
+rocblas_status rocsolver_syev_template(rocblas_handle handle,
+                                       rocsolver_evect evect,
+                                       rocblas_fill uplo, rocblas_int n, T *A,
+                                       rocblas_int lda, T *W, bool divide) {
+
+  if (evect != rocsolver_evect_none && evect != rocsolver_evect_original) {
+    return rocblas_status_not_implemented;
+  } else if (uplo != rocblas_fill_lower && uplo != rocblas_fill_upper) {
+    return rocblas_status_not_implemented;
+  } else if (n < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (n == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  // the QL iteration runs in one workgroup: the eigenvectors of larger
+  // matrices are found by divide and conquer
+  if (n > SYEV_STEQR_MAXSIZE)
+    divide = true;
+
+  T inpsResHost[4];
+  inpsResHost[SYEV_INPONE] = static_cast<T>(1);
+  inpsResHost[SYEV_INPZERO] = static_cast<T>(0);
+  inpsResHost[SYEV_INPMINONE] = static_cast<T>(-1);
+  inpsResHost[SYEV_INPMINHALF] = static_cast<T>(-0.5);
+
+  // allocate the constants and workspace on device to avoid going onto CPU
+  // and needing to synchronize.
+  T *inpsResGPU;
+  hipMalloc(&inpsResGPU,
+            sizeof(T) * (SYEV_WORK + syev_work_size(evect, n, divide)));
+  hipMemcpy(inpsResGPU, &inpsResHost[0], 4 * sizeof(T),
+            hipMemcpyHostToDevice);
+  geqrf_init_buffer<T>(
+      sytrd_geqrf_buffer<T>(n, &inpsResGPU[SYEV_WORK + 2 * size_t(n)]));
+  rocblas_int *iwork;
+  hipMalloc(&iwork, sizeof(rocblas_int) * stedc_iwork_size(n));
+
+  rocsolver_syev_async_template<T>(handle, evect, uplo, n, A, lda, W, divide,
+                                   inpsResGPU, iwork);
+
+  hipFree(inpsResGPU);
+  hipFree(iwork);
+
+  return rocblas_status_success;
+}
+
+#undef SYEV_INPONE
+#undef SYEV_INPZERO
+#undef SYEV_INPMINONE
+#undef SYEV_INPMINHALF
+#undef SYEV_WORK
+
+#endif /* ROCLAPACK_SYEV_HPP */
@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_syevj.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_ssyevj_batched(
+    rocblas_handle handle, rocsolver_evect evect, rocblas_fill uplo,
+    rocblas_int n, float *const A[], rocblas_int lda, float tol,
+    rocblas_int max_sweeps, float *W, rocblas_int strideW, rocblas_int *info,
+    rocblas_int batch_count) {
+  return rocsolver_syevj_template<float>(handle, evect, uplo, n, A, lda, 0,
+                                         tol, max_sweeps, W, strideW, info,
+                                         batch_count);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_ssyevj_strided_batched(
+    rocblas_handle handle, rocsolver_evect evect, rocblas_fill uplo,
+    rocblas_int n, float *A, rocblas_int lda, rocblas_int strideA, float tol,
+    rocblas_int max_sweeps, float *W, rocblas_int strideW, rocblas_int *info,
+    rocblas_int batch_count) {
+  return rocsolver_syevj_template<float>(handle, evect, uplo, n, A, lda,
+                                         strideA, tol, max_sweeps, W, strideW,
+                                         info, batch_count);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_dsyevj_batched(
+    rocblas_handle handle, rocsolver_evect evect, rocblas_fill uplo,
+    rocblas_int n, double *const A[], rocblas_int lda, double tol,
+    rocblas_int max_sweeps, double *W, rocblas_int strideW, rocblas_int *info,
+    rocblas_int batch_count) {
+  return rocsolver_syevj_template<double>(handle, evect, uplo, n, A, lda, 0,
+                                          tol, max_sweeps, W, strideW, info,
+                                          batch_count);
+}
+
+extern "C" ROCSOLVER_EXPORT rocblas_status rocsolver_dsyevj_strided_batched(
+    rocblas_handle handle, rocsolver_evect evect, rocblas_fill uplo,
+    rocblas_int n, double *A, rocblas_int lda, rocblas_int strideA,
+    double tol, rocblas_int max_sweeps, double *W, rocblas_int strideW,
+    rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_syevj_template<double>(handle, evect, uplo, n, A, lda,
+                                          strideA, tol, max_sweeps, W,
+                                          strideW, info, batch_count);
+}
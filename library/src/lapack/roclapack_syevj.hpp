@@ -0,0 +1,270 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_SYEVJ_HPP
+#define ROCLAPACK_SYEVJ_HPP
+
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <rocblas.hpp>
+#include <vector>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_syev.hpp"
+
+using namespace std;
+
+// matrix b of the batch, from an array of pointers or from a strided block
+template <typename T>
+__device__ __host__ T *syevj_batch_matrix(T *A, rocblas_int b,
+                                          rocblas_int strideA) {
+  return A + size_t(b) * strideA;
+}
+
+template <typename T>
+__device__ __host__ T *syevj_batch_matrix(T *const *A, rocblas_int b,
+                                          rocblas_int strideA) {
+  return A[b];
+}
+
+// threads of the workgroup for order n: a power of two, one thread per
+// element of the half of the (padded) matrix touched by a round, at least a
+// wavefront and at most SYEVJ_BLOCKSIZE
+inline rocblas_int syevj_threads(rocblas_int n) {
+  const rocblas_int m = n + (n & 1);
+  rocblas_int nt = 64;
+  while (nt < SYEVJ_BLOCKSIZE && nt < m * m / 2)
+    nt *= 2;
+  return nt;
+}
+
+// sum of s over the workgroup (of a power of two threads), the same in all
+// threads
+template <typename T> __device__ T syevj_sum(T s, T *sred) {
+  const int tid = hipThreadIdx_x;
+  sred[tid] = s;
+  __syncthreads();
+  for (int st = hipBlockDim_x / 2; st > 0; st >>= 1) {
+    if (tid < st)
+      sred[tid] += sred[tid + st];
+    __syncthreads();
+  }
+  s = sred[0];
+  __syncthreads();
+  return s;
+}
+
+/*
+ * Cyclic Jacobi on one matrix of order n <= SYEVJ_MAX_SIZE per workgroup,
+ * all of it (and the eigenvectors) in LDS. A sweep is m - 1 rounds of the
+ * round-robin ordering of the m = n + (n odd) indices (the padding index has
+ * a zero row and column): the m / 2 rotations of a round touch disjoint
+ * pairs of rows and columns, so they are computed at once and applied at
+ * once, first to the columns and then to the rows. The sweeps stop once the
+ * off-diagonal Frobenius norm is below tol times the norm of the matrix
+ * (info 0), or after max_sweeps (info 1). W gets the eigenvalues in
+ * ascending order and A the eigenvectors, column i for W(i).
+ */
+template <typename T, typename U>
+__global__ void syevj_small(rocsolver_evect evect, rocblas_fill uplo,
+                            rocblas_int n, U AA, rocblas_int lda,
+                            rocblas_int strideA, T tol, rocblas_int max_sweeps,
+                            T *WW, rocblas_int strideW, rocblas_int *info) {
+  __shared__ T sA[SYEVJ_MAX_SIZE * SYEVJ_MAX_SIZE];
+  __shared__ T sV[SYEVJ_MAX_SIZE * SYEVJ_MAX_SIZE];
+  __shared__ T sc[SYEVJ_MAX_SIZE / 2];
+  __shared__ T ss[SYEVJ_MAX_SIZE / 2];
+  __shared__ rocblas_int sp[SYEVJ_MAX_SIZE / 2];
+  __shared__ rocblas_int sq[SYEVJ_MAX_SIZE / 2];
+  __shared__ rocblas_int srank[SYEVJ_MAX_SIZE];
+  __shared__ T sred[SYEVJ_BLOCKSIZE];
+
+  const int tid = hipThreadIdx_x;
+  const int nt = hipBlockDim_x;
+  const rocblas_int b = hipBlockIdx_x;
+  const bool vectors = (evect == rocsolver_evect_original);
+  const rocblas_int m = n + (n & 1);
+  const rocblas_int half = m / 2;
+  T *A = syevj_batch_matrix(AA, b, strideA);
+  T *W = WW + size_t(b) * strideW;
+
+  // the whole matrix from the triangle given by uplo, and V = I
+  T s = 0;
+  for (rocblas_int k = tid; k < m * m; k += nt) {
+    const rocblas_int i = k % m;
+    const rocblas_int j = k / m;
+    T a = 0;
+    if (i < n && j < n) {
+      const bool stored = (uplo == rocblas_fill_lower) ? (i >= j) : (i <= j);
+      a = stored ? A[idx2D(i, j, lda)] : A[idx2D(j, i, lda)];
+    }
+    sA[k] = a;
+    if (vectors)
+      sV[k] = (i == j) ? 1 : 0;
+    s += a * a;
+  }
+  const T thresh = tol * tol * syevj_sum(s, sred);
+
+  bool converged = false;
+  for (rocblas_int sweep = 0;; ++sweep) {
+    s = 0;
+    for (rocblas_int k = tid; k < m * m; k += nt)
+      if (k % m != k / m)
+        s += sA[k] * sA[k];
+    if (syevj_sum(s, sred) <= thresh) {
+      converged = true;
+      break;
+    }
+    if (sweep == max_sweeps)
+      break;
+
+    for (rocblas_int r = 0; r < m - 1; ++r) {
+      // the rotations of the round; position 0 stays, the others turn
+      if (tid < half) {
+        const rocblas_int i1 = tid;
+        const rocblas_int i2 = m - 1 - tid;
+        rocblas_int p = (i1 == 0) ? 0 : (i1 - 1 + r) % (m - 1) + 1;
+        rocblas_int q = (i2 - 1 + r) % (m - 1) + 1;
+        if (p > q) {
+          const rocblas_int t = p;
+          p = q;
+          q = t;
+        }
+        const T apq = sA[p + q * m];
+        T c = 1, sn = 0;
+        if (apq != 0) {
+          const T theta = (sA[q + q * m] - sA[p + p * m]) / (2 * apq);
+          const T at = fabs(theta);
+          T t = (at > 1 / sqrt(numeric_limits<T>::epsilon()))
+                    ? 1 / (2 * at)
+                    : 1 / (at + sqrt(1 + at * at));
+          if (theta < 0)
+            t = -t;
+          c = 1 / sqrt(1 + t * t);
+          sn = t * c;
+        }
+        sp[tid] = p;
+        sq[tid] = q;
+        sc[tid] = c;
+        ss[tid] = sn;
+      }
+      __syncthreads();
+
+      // A := A * J and V := V * J, a row of a pair of columns per thread
+      for (rocblas_int k = tid; k < half * m; k += nt) {
+        const rocblas_int x = k % half;
+        const rocblas_int i = k / half;
+        const rocblas_int p = sp[x], q = sq[x];
+        const T c = sc[x], sn = ss[x];
+        const T ap = sA[i + p * m], aq = sA[i + q * m];
+        sA[i + p * m] = c * ap - sn * aq;
+        sA[i + q * m] = sn * ap + c * aq;
+        if (vectors) {
+          const T vp = sV[i + p * m], vq = sV[i + q * m];
+          sV[i + p * m] = c * vp - sn * vq;
+          sV[i + q * m] = sn * vp + c * vq;
+        }
+      }
+      __syncthreads();
+
+      // A := J**T * A, a column of a pair of rows per thread
+      for (rocblas_int k = tid; k < half * m; k += nt) {
+        const rocblas_int x = k % half;
+        const rocblas_int j = k / half;
+        const rocblas_int p = sp[x], q = sq[x];
+        const T c = sc[x], sn = ss[x];
+        const T ap = sA[p + j * m], aq = sA[q + j * m];
+        sA[p + j * m] = c * ap - sn * aq;
+        sA[q + j * m] = sn * ap + c * aq;
+      }
+      __syncthreads();
+    }
+  }
+
+  // the eigenvalues in ascending order (ties by index), and their vectors
+  for (rocblas_int i = tid; i < n; i += nt) {
+    const T d = sA[i + i * m];
+    rocblas_int rank = 0;
+    for (rocblas_int j = 0; j < n; ++j) {
+      const T dj = sA[j + j * m];
+      if (dj < d || (dj == d && j < i))
+        ++rank;
+    }
+    srank[i] = rank;
+    W[rank] = d;
+  }
+  __syncthreads();
+
+  if (vectors)
+    for (rocblas_int k = tid; k < n * n; k += nt)
+      A[idx2D(k % n, srank[k / n], lda)] = sV[k % n + (k / n) * m];
+
+  if (tid == 0)
+    info[b] = converged ? 0 : 1;
+}
+
+/*
+ * The batch of syevj (an array of pointers to the matrices, or a strided
+ * block of them when U is T *). Matrices of order up to SYEVJ_MAX_SIZE are
+ * all solved by one kernel; larger ones one at a time by syevd, with info
+ * 0.
+ */
+template <typename T, typename U>
+rocblas_status
+rocsolver_syevj_template(rocblas_handle handle, rocsolver_evect evect,
+                         rocblas_fill uplo, rocblas_int n, U A,
+                         rocblas_int lda, rocblas_int strideA, T tol,
+                         rocblas_int max_sweeps, T *W, rocblas_int strideW,
+                         rocblas_int *info, rocblas_int batch_count) {
+
+  if (evect != rocsolver_evect_none && evect != rocsolver_evect_original) {
+    return rocblas_status_not_implemented;
+  } else if (uplo != rocblas_fill_lower && uplo != rocblas_fill_upper) {
+    return rocblas_status_not_implemented;
+  } else if (n < 0 || max_sweeps < 0 || batch_count < 0) {
+    // less than zero dimensions in a matrix?!
+    return rocblas_status_invalid_size;
+  } else if (lda < max(1, n)) {
+    // mismatch of provided first matrix dimension
+    return rocblas_status_invalid_size;
+  } else if (batch_count == 0) {
+    // quick return
+    return rocblas_status_success;
+  }
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  if (n <= SYEVJ_MAX_SIZE) {
+    if (tol <= 0)
+      tol = max(n, 1) * numeric_limits<T>::epsilon();
+    hipLaunchKernelGGL((syevj_small<T, U>), dim3(batch_count),
+                       dim3(syevj_threads(n)), 0, stream, evect, uplo, n, A,
+                       lda, strideA, tol, max_sweeps, W, strideW, info);
+    return rocblas_status_success;
+  }
+
+  hipMemsetAsync(info, 0, sizeof(rocblas_int) * batch_count, stream);
+
+  // the matrices of an array of pointers are found on the host
+  vector<T *> hA(batch_count);
+  if (is_same<U, T *>::value) {
+    for (rocblas_int b = 0; b < batch_count; ++b)
+      hA[b] = syevj_batch_matrix(A, b, strideA);
+  } else {
+    hipMemcpy(hA.data(), A, sizeof(T *) * batch_count, hipMemcpyDeviceToHost);
+  }
+
+  for (rocblas_int b = 0; b < batch_count; ++b)
+    rocsolver_syev_template<T>(handle, evect, uplo, n, hA[b], lda,
+                               W + size_t(b) * strideW, true);
+
+  return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_SYEVJ_HPP */
@@ -0,0 +1,405 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_SYTRD_HPP
+#define ROCLAPACK_SYTRD_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "rocsolver.h"
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_geqrf.hpp"
+#include "roclapack_larfg.hpp"
+#include "roclapack_larft.hpp"
+#include "roclapack_ormqr.hpp"
+
+using namespace std;
+
+/*
+ * Two-stage reduction of a symmetric matrix to tridiagonal form, as the
+ * LAPACK xsytrd_2stage. The first stage (xsytrd_sy2sb) takes the matrix to
+ * band form of bandwidth nb = SYTRD_BANDWIDTH: every panel of nb columns
+ * below the band is factored by geqrf and the block reflector is applied to
+ * both sides of the trailing matrix with gemm alone. The second stage
+ * (xsytrd_sb2st) chases the band down to the tridiagonal with reflectors of
+ * order nb, with the sweeps pipelined over concurrent workgroups. The
+ * matrix is kept whole (both triangles) in A through both stages.
+ *
+ * Q = Q1 * Q2. Q1 is H(0) * H(1) * ... * H(n-nb-1), the reflector of column
+ * j starting at row j + nb, kept as geqrf leaves them in V1, so that ormqr
+ * applies it. Q2 is the product of the reflectors of the sweeps of the
+ * second stage in the order they were generated.
+ */
+
+// steps of the sweeps of the second stage: sweep j annihilates column j
+// below the subdiagonal and chases the bulge down the band nb rows at a time
+inline rocblas_int sytrd_steps(rocblas_int n) {
+  return (n > 2) ? (n - 3) / SYTRD_BANDWIDTH + 1 : 0;
+}
+
+// the reflectors of both stages in the workspace: tau1 and V1 (n x n,
+// leading dimension n) of the first, then nb + 1 elements, v and tau, for
+// every step of every sweep of the second; the rest is the workspace of the
+// first stage
+template <typename T> struct sytrd_factors {
+  T *tau1;
+  T *V1;
+  T *V2;
+  T *work;
+};
+
+template <typename T>
+sytrd_factors<T> sytrd_split_work(rocblas_int n, T *work) {
+  sytrd_factors<T> f;
+  f.tau1 = work;
+  f.V1 = f.tau1 + n;
+  f.V2 = f.V1 + size_t(n) * n;
+  f.work = f.V2 + size_t(max(n - 2, 0)) * sytrd_steps(n) *
+                      (SYTRD_BANDWIDTH + 1);
+  return f;
+}
+
+// elements of the workspace: the factors, the blocks of the two-sided
+// update (V, W and X of n x nb, T, G and M of nb x nb) and the geqrf buffer
+// of the largest panel (at least its constants)
+inline size_t sytrd_work_size(rocblas_int n) {
+  const rocblas_int nb = SYTRD_BANDWIDTH;
+  size_t geqrf_size = geqrf_buffer_size(1, 1);
+  for (rocblas_int k = 0; k < n - nb; k += nb)
+    geqrf_size = max(geqrf_size,
+                     geqrf_buffer_size(n - k - nb, nb));
+  return n + size_t(n) * n +
+         size_t(max(n - 2, 0)) * sytrd_steps(n) * (nb + 1) +
+         3 * size_t(n) * nb + 3 * nb * nb + geqrf_size;
+}
+
+// the geqrf buffer at the end of the workspace; its constants are uploaded
+// by the caller with geqrf_init_buffer before the reduction is enqueued
+template <typename T> T *sytrd_geqrf_buffer(rocblas_int n, T *work) {
+  const rocblas_int nb = SYTRD_BANDWIDTH;
+  return sytrd_split_work<T>(n, work).work + 3 * size_t(n) * nb +
+         3 * nb * nb;
+}
+
+// the other triangle of A from the one given by uplo
+template <typename T>
+__global__ void sytrd_symmetrize(rocblas_fill uplo, rocblas_int n, T *A,
+                                 rocblas_int lda) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+
+  if (i < n && i > j) {
+    if (uplo == rocblas_fill_lower)
+      A[idx2D(j, i, lda)] = A[idx2D(i, j, lda)];
+    else
+      A[idx2D(i, j, lda)] = A[idx2D(j, i, lda)];
+  }
+}
+
+// a panel of m x n from A into B
+template <typename T>
+__global__ void sytrd_copy_panel(rocblas_int m, const T *A, rocblas_int lda,
+                                 T *B, rocblas_int ldb) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+
+  if (i < m)
+    B[idx2D(i, j, ldb)] = A[idx2D(i, j, lda)];
+}
+
+// the band of the factored m x n panel: R of the panel (in V) and zeros
+// below it go into A, and transposed into its mirror At
+template <typename T>
+__global__ void sytrd_band_panel(rocblas_int m, const T *V, rocblas_int ldv,
+                                 T *A, T *At, rocblas_int lda) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int j = hipBlockIdx_y;
+
+  if (i < m) {
+    const T a = (i <= j) ? V[idx2D(i, j, ldv)] : 0;
+    A[idx2D(i, j, lda)] = a;
+    At[idx2D(j, i, lda)] = a;
+  }
+}
+
+/*
+ * The second stage, band to tridiagonal. Step t of sweep j takes the
+ * reflector of order L <= nb of rows s = j + 1 + t * nb to s + L - 1 of
+ * column c (c = j at the first step, then the first column of the bulge
+ * left by the step before) and applies it to both sides. Only the first
+ * column of every bulge is annihilated: the rest of it is annihilated by
+ * the next sweep, so that a row has nonzeros at most 2 * nb - 1 columns
+ * past its diagonal and every step reads and writes rows and columns c to
+ * s + 3 * nb - 1 only, a window of 4 * nb past s - nb.
+ *
+ * The sweeps are pipelined: sweep j takes its step t at time
+ * tau = SYTRD_SB2ST_LAG * j + t, so that the windows of the steps taken at
+ * the same time are disjoint, and every step comes after the ones it would
+ * follow in the sweep by sweep order that overlap it. One launch per time,
+ * one workgroup of LARFG_BLOCKSIZE threads per sweep taking a step. The
+ * reflectors go to V2 (unless null).
+ */
+#define SYTRD_SB2ST_LAG 5
+
+// the sweeps taking a step at time tau: j0 to j1
+inline void sytrd_sb2st_sweeps(rocblas_int n, rocblas_int tau,
+                               rocblas_int &j0, rocblas_int &j1) {
+  const rocblas_int lag = SYTRD_SB2ST_LAG;
+  const rocblas_int steps = sytrd_steps(n);
+  j0 = (tau < steps) ? 0 : (tau - steps) / lag + 1;
+  j1 = min(tau / lag, n - 3);
+}
+
+template <typename T>
+__global__ void sytrd_sb2st(rocblas_int n, rocblas_int tau, rocblas_int j0,
+                            T *A, rocblas_int lda, T *V2) {
+  __shared__ T sred[LARFG_BLOCKSIZE];
+  __shared__ T v[SYTRD_BANDWIDTH];
+  __shared__ T taus;
+  const int tid = hipThreadIdx_x;
+  const rocblas_int nb = SYTRD_BANDWIDTH;
+  const rocblas_int steps = sytrd_steps(n);
+  const rocblas_int j = j0 + hipBlockIdx_x;
+  const rocblas_int t = tau - SYTRD_SB2ST_LAG * j;
+  const rocblas_int s = j + 1 + t * nb;
+
+  if (s >= n - 1)
+    return;
+
+  const rocblas_int c = (t == 0) ? j : s - nb;
+  const rocblas_int L = min(nb, n - s);
+  T *slot = V2 ? &V2[(size_t(j) * steps + t) * (nb + 1)] : nullptr;
+
+  larfg_device<T>(L, &A[idx2D(s, c, lda)], &A[idx2D(s + 1, c, lda)], 1,
+                  &taus, sred);
+  __syncthreads();
+
+  // the column is now beta e1, in both triangles; v(0) = 1
+  for (rocblas_int i = tid; i < L; i += LARFG_BLOCKSIZE) {
+    const T vi = (i == 0) ? 1 : A[idx2D(s + i, c, lda)];
+    const T a = (i == 0) ? A[idx2D(s, c, lda)] : 0;
+    v[i] = vi;
+    A[idx2D(s + i, c, lda)] = a;
+    A[idx2D(c, s + i, lda)] = a;
+    if (slot)
+      slot[i] = vi;
+  }
+  if (slot && tid == 0)
+    slot[nb] = taus;
+  __syncthreads();
+
+  const T tv = taus;
+  if (tv == 0)
+    return;
+
+  const rocblas_int hi = min(n, s + L + 2 * nb);
+
+  // H from the left on rows s to s + L - 1
+  for (rocblas_int col = c + 1 + tid; col < hi; col += LARFG_BLOCKSIZE) {
+    T w = 0;
+    for (rocblas_int i = 0; i < L; ++i)
+      w += v[i] * A[idx2D(s + i, col, lda)];
+    w *= tv;
+    for (rocblas_int i = 0; i < L; ++i)
+      A[idx2D(s + i, col, lda)] -= w * v[i];
+  }
+  __syncthreads();
+
+  // and from the right on columns s to s + L - 1
+  for (rocblas_int row = c + 1 + tid; row < hi; row += LARFG_BLOCKSIZE) {
+    T w = 0;
+    for (rocblas_int i = 0; i < L; ++i)
+      w += A[idx2D(row, s + i, lda)] * v[i];
+    w *= tv;
+    for (rocblas_int i = 0; i < L; ++i)
+      A[idx2D(row, s + i, lda)] -= w * v[i];
+  }
+}
+
+// D and E from the tridiagonal left in A by the second stage
+template <typename T>
+__global__ void sytrd_copy_tridiag(rocblas_int n, const T *A, rocblas_int lda,
+                                   T *D, T *E) {
+  const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+  if (i < n) {
+    D[i] = A[idx2D(i, i, lda)];
+    E[i] = (i < n - 1) ? A[idx2D(i + 1, i, lda)] : 0;
+  }
+}
+
+/*
+ * C := Q2 * C for the n x m matrix C, one thread per column: the reflectors
+ * of the second stage from the last one generated back to the first.
+ */
+template <typename T>
+__global__ void sytrd_apply_q2(rocblas_int n, rocblas_int m, const T *V2,
+                               T *C, rocblas_int ldc) {
+  const rocblas_int col = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+  const rocblas_int nb = SYTRD_BANDWIDTH;
+  const rocblas_int steps = sytrd_steps(n);
+
+  if (col >= m)
+    return;
+
+  T *x = &C[idx2D(0, col, ldc)];
+  for (rocblas_int j = n - 3; j >= 0; --j) {
+    for (rocblas_int t = (n - 3 - j) / nb; t >= 0; --t) {
+      const rocblas_int s = j + 1 + t * nb;
+      const rocblas_int L = min(nb, n - s);
+      const T *v = &V2[(size_t(j) * steps + t) * (nb + 1)];
+      const T tau = v[nb];
+      if (tau == 0)
+        continue;
+
+      T w = 0;
+      for (rocblas_int i = 0; i < L; ++i)
+        w += v[i] * x[s + i];
+      w *= tau;
+      for (rocblas_int i = 0; i < L; ++i)
+        x[s + i] -= w * v[i];
+    }
+  }
+}
+
+/*
+ * Enqueue the reduction Q**T * A * Q = T of the symmetric matrix A (the
+ * triangle given by uplo) to the tridiagonal T with diagonal D and
+ * subdiagonal E (E(n-1) = 0). A is destroyed. The reflectors of the second
+ * stage are only kept if keep_q2 (they are only needed to apply Q). one,
+ * zero, minone and minhalf are device constants and work has
+ * sytrd_work_size(n) elements, with the geqrf constants already in
+ * sytrd_geqrf_buffer(n, work).
+ */
+template <typename T>
+void rocsolver_sytrd_async_template(rocblas_handle handle, rocblas_fill uplo,
+                                    rocblas_int n, T *A, rocblas_int lda,
+                                    T *D, T *E, bool keep_q2, const T *one,
+                                    const T *zero, const T *minone,
+                                    const T *minhalf, T *work) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const rocblas_int nb = SYTRD_BANDWIDTH;
+  const rocblas_int ldv = n;
+  sytrd_factors<T> f = sytrd_split_work<T>(n, work);
+  T *V = f.work;
+  T *W = V + size_t(n) * nb;
+  T *X = W + size_t(n) * nb;
+  T *Tm = X + size_t(n) * nb;
+  T *G = Tm + nb * nb;
+  T *M = G + nb * nb;
+  T *geqrf_buffer = sytrd_geqrf_buffer<T>(n, work);
+
+  hipLaunchKernelGGL(sytrd_symmetrize<T>,
+                     dim3((n - 1) / STEDC_BLOCKSIZE + 1, n, 1),
+                     dim3(STEDC_BLOCKSIZE, 1, 1), 0, stream, uplo, n, A, lda);
+
+  // the first stage, panel by panel of the columns below the band; the
+  // last panel may have fewer rows than columns, and is then factored whole
+  // all the same, as its reflectors reach the columns past the first pk
+  for (rocblas_int k = 0; k < n - nb; k += nb) {
+    const rocblas_int pn = n - k - nb;
+    const rocblas_int pk = min(pn, nb);
+    T *panel = &f.V1[idx2D(k + nb, k, ldv)];
+    T *A22 = &A[idx2D(k + nb, k + nb, lda)];
+
+    hipLaunchKernelGGL(sytrd_copy_panel<T>,
+                       dim3((pn - 1) / STEDC_BLOCKSIZE + 1, nb, 1),
+                       dim3(STEDC_BLOCKSIZE, 1, 1), 0, stream, pn,
+                       &A[idx2D(k + nb, k, lda)], lda, panel, ldv);
+
+    rocsolver_geqrf_async_template<T>(handle, pn, nb, panel, ldv,
+                                      &f.tau1[k], geqrf_buffer);
+
+    hipLaunchKernelGGL(sytrd_band_panel<T>,
+                       dim3((pn - 1) / STEDC_BLOCKSIZE + 1, nb, 1),
+                       dim3(STEDC_BLOCKSIZE, 1, 1), 0, stream, pn, panel, ldv,
+                       &A[idx2D(k + nb, k, lda)], &A[idx2D(k, k + nb, lda)],
+                       lda);
+
+    // the block reflector I - V * T * V**T of the panel
+    roclapack_larft_template<T>(handle, pn, pk, panel, ldv, &f.tau1[k], V,
+                                Tm, G, one, zero);
+
+    // W = A22 * V * T, W -= 1/2 * V * (T**T * V**T * W), and then
+    // A22 -= V * W**T + W * V**T
+    rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none,
+                    pn, pk, pn, one, A22, lda, V, pn, zero, X, pn);
+    rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none,
+                    pn, pk, pk, one, X, pn, Tm, pk, zero, W, pn);
+    rocblas_gemm<T>(handle, rocblas_operation_transpose,
+                    rocblas_operation_none, pk, pk, pn, one, V, pn, W, pn,
+                    zero, G, pk);
+    rocblas_gemm<T>(handle, rocblas_operation_transpose,
+                    rocblas_operation_none, pk, pk, pk, one, Tm, pk, G, pk,
+                    zero, M, pk);
+    rocblas_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none,
+                    pn, pk, pk, minhalf, V, pn, M, pk, one, W, pn);
+    rocblas_gemm<T>(handle, rocblas_operation_none,
+                    rocblas_operation_transpose, pn, pn, pk, minone, V, pn, W,
+                    pn, one, A22, lda);
+    rocblas_gemm<T>(handle, rocblas_operation_none,
+                    rocblas_operation_transpose, pn, pn, pk, minone, W, pn, V,
+                    pn, one, A22, lda);
+  }
+
+  // the second stage, one launch per time of the pipeline
+  const rocblas_int times =
+      (n > 2) ? SYTRD_SB2ST_LAG * (n - 3) + sytrd_steps(n) : 0;
+  for (rocblas_int tau = 0; tau < times; ++tau) {
+    rocblas_int j0, j1;
+    sytrd_sb2st_sweeps(n, tau, j0, j1);
+    if (j0 <= j1)
+      hipLaunchKernelGGL(sytrd_sb2st<T>, dim3(j1 - j0 + 1),
+                         dim3(LARFG_BLOCKSIZE), 0, stream, n, tau, j0, A, lda,
+                         keep_q2 ? f.V2 : nullptr);
+  }
+
+  hipLaunchKernelGGL(sytrd_copy_tridiag<T>,
+                     dim3((n - 1) / STEDC_BLOCKSIZE + 1),
+                     dim3(STEDC_BLOCKSIZE), 0, stream, n, A, lda, D, E);
+}
+
+/*
+ * Enqueue C := Q * C for the n x m matrix C, with Q = Q1 * Q2 from
+ * rocsolver_sytrd_async_template (with keep_q2) and the same work. ormqr
+ * takes its workspace from owork, of ormqr_work_size(left, n, m) elements.
+ */
+template <typename T>
+void rocsolver_ormtr_async_template(rocblas_handle handle, rocblas_int n,
+                                    rocblas_int m, T *C, rocblas_int ldc,
+                                    const T *one, const T *zero,
+                                    const T *minone, T *work, T *owork) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  const rocblas_int nb = SYTRD_BANDWIDTH;
+  sytrd_factors<T> f = sytrd_split_work<T>(n, work);
+
+  if (n > 2)
+    hipLaunchKernelGGL(sytrd_apply_q2<T>,
+                       dim3((m - 1) / STEDC_BLOCKSIZE + 1),
+                       dim3(STEDC_BLOCKSIZE), 0, stream, n, m, f.V2, C, ldc);
+
+  if (n > nb)
+    rocsolver_ormqr_async_template<T>(
+        handle, rocblas_side_left, rocblas_operation_none, n - nb, m, n - nb,
+        &f.V1[idx2D(nb, 0, n)], n, f.tau1, &C[idx2D(nb, 0, ldc)], ldc, one,
+        zero, minone, owork);
+}
+
+#undef SYTRD_SB2ST_LAG
+
+#endif /* ROCLAPACK_SYTRD_HPP */
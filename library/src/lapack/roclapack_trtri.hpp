@@ -0,0 +1,131 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_TRTRI_HPP
+#define ROCLAPACK_TRTRI_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+
+using namespace std;
+
+/*
+ * Copy the triangle of the inverted diagonal blocks from the workspace W
+ * (TRTRI_BLOCKSIZE x TRTRI_BLOCKSIZE blocks stored one after the other) back
+ * into A. One workgroup per block, one thread per column; the other triangle
+ * of A is left untouched, and so is the diagonal if it is unit.
+ */
+template <typename T>
+__global__ void trtri_copy_blocks(rocblas_fill uplo, rocblas_diagonal diag,
+                                  rocblas_int n, T *A, rocblas_int lda,
+                                  const T *W) {
+
+  const rocblas_int b = hipBlockIdx_x;
+  const rocblas_int c = hipThreadIdx_x;
+  const rocblas_int j0 = b * TRTRI_BLOCKSIZE;
+  const rocblas_int jb = min(TRTRI_BLOCKSIZE, n - j0);
+
+  if (c < jb) {
+    const T *w = W + b * TRTRI_BLOCKSIZE * TRTRI_BLOCKSIZE;
+    const rocblas_int skip = (diag == rocblas_diagonal_unit) ? 1 : 0;
+    const rocblas_int first = (uplo == rocblas_fill_upper) ? 0 : c + skip;
+    const rocblas_int last = (uplo == rocblas_fill_upper) ? c - skip : jb - 1;
+    for (rocblas_int r = first; r <= last; ++r)
+      A[(j0 + r) + (j0 + c) * lda] = w[r + c * TRTRI_BLOCKSIZE];
+  }
+}
+
+/*
+ * Off-diagonal part of the recursive inversion. With
+ *   U = [U11 U12; 0 U22]   (L = [L11 0; L21 L22])
+ * the off-diagonal block of the inverse is -inv(U11)*U12*inv(U22)
+ * (-inv(L22)*L21*inv(L11)), i.e. two triangular solves against the original
+ * diagonal blocks. It is therefore formed before recursing into them; the
+ * split is aligned to TRTRI_BLOCKSIZE, so the leaves are exactly the diagonal
+ * blocks inverted afterwards.
+ */
+template <typename T>
+void trtri_offdiag(rocblas_handle handle, rocblas_fill uplo,
+                   rocblas_diagonal diag, rocblas_int n, T *A, rocblas_int lda,
+                   T *one, T *minone) {
+
+  if (n <= TRTRI_BLOCKSIZE)
+    return;
+
+  const rocblas_int nblocks = (n - 1) / TRTRI_BLOCKSIZE + 1;
+  const rocblas_int n1 = (nblocks / 2) * TRTRI_BLOCKSIZE;
+  const rocblas_int n2 = n - n1;
+
+  T *A11 = A;
+  T *A22 = &A[idx2D(n1, n1, lda)];
+
+  if (uplo == rocblas_fill_upper) {
+    T *A12 = &A[idx2D(0, n1, lda)];
+    rocblas_trsm<T>(handle, rocblas_side_left, uplo, rocblas_operation_none,
+                    diag, n1, n2, one, A11, lda, A12, lda);
+    rocblas_trsm<T>(handle, rocblas_side_right, uplo, rocblas_operation_none,
+                    diag, n1, n2, minone, A22, lda, A12, lda);
+  } else {
+    T *A21 = &A[idx2D(n1, 0, lda)];
+    rocblas_trsm<T>(handle, rocblas_side_left, uplo, rocblas_operation_none,
+                    diag, n2, n1, one, A22, lda, A21, lda);
+    rocblas_trsm<T>(handle, rocblas_side_right, uplo, rocblas_operation_none,
+                    diag, n2, n1, minone, A11, lda, A21, lda);
+  }
+
+  trtri_offdiag<T>(handle, uplo, diag, n1, A11, lda, one, minone);
+  trtri_offdiag<T>(handle, uplo, diag, n2, A22, lda, one, minone);
+}
+
+// size of the workspace needed by roclapack_trtri_async_template
+inline rocblas_int roclapack_trtri_worksize(rocblas_int n) {
+  return ((n - 1) / TRTRI_BLOCKSIZE + 1) * TRTRI_BLOCKSIZE * TRTRI_BLOCKSIZE;
+}
+
+/*
+ * In-place inverse of the triangular matrix A, enqueued on the handle's
+ * stream. The off-diagonal blocks are formed by trsm (see trtri_offdiag),
+ * then all diagonal blocks are inverted by one batched trtri into W and
+ * copied back. W needs roclapack_trtri_worksize(n) elements; one and minone
+ * point to the constants on the device. Zero diagonal elements are not
+ * checked for here.
+ */
+template <typename T>
+void roclapack_trtri_async_template(rocblas_handle handle, rocblas_fill uplo,
+                                    rocblas_diagonal diag, rocblas_int n, T *A,
+                                    rocblas_int lda, T *W, T *one, T *minone) {
+
+  if (n == 0)
+    return;
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  trtri_offdiag<T>(handle, uplo, diag, n, A, lda, one, minone);
+
+  const rocblas_int nb = TRTRI_BLOCKSIZE;
+  const rocblas_int nfull = n / nb;
+  const rocblas_int rem = n - nfull * nb;
+
+  if (nfull > 0)
+    rocblas_trtri_batched<T>(handle, uplo, diag, nb, A, lda, nb * (lda + 1), W,
+                             nb, nb * nb, nfull);
+  if (rem > 0)
+    rocblas_trtri<T>(handle, uplo, diag, rem, &A[idx2D(n - rem, n - rem, lda)],
+                     lda, W + nfull * nb * nb, nb);
+
+  const rocblas_int nblocks = nfull + (rem > 0 ? 1 : 0);
+  hipLaunchKernelGGL(trtri_copy_blocks<T>, dim3(nblocks), dim3(nb), 0, stream,
+                     uplo, diag, n, A, lda, W);
+}
+
+#endif /* ROCLAPACK_TRTRI_HPP */
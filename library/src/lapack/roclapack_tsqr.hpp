@@ -0,0 +1,322 @@
+/* ************************************************************************
+ * Derived from the BSD2-licensed
+ * LAPACK routine (version 3.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley and NAG Ltd..
+ *     November 2006
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_TSQR_HPP
+#define ROCLAPACK_TSQR_HPP
+
+#include <hip/hip_runtime.h>
+#include <rocblas.hpp>
+#include <vector>
+
+#include "definitions.h"
+#include "helpers.h"
+#include "ideal_sizes.hpp"
+#include "roclapack_larfg.hpp"
+
+using namespace std;
+
+/*
+ * Tall-skinny QR. The rows of A are split in blocks that are factored
+ * independently, one workgroup each; their R factors are stacked TSQR_ARITY
+ * at a time and factored again, level after level, until a single R is
+ * left. Q is the product of the block diagonal factors of all levels, kept
+ * implicitly as the reflectors of every block. The whole matrix is read
+ * once, with no reduction over all its rows.
+ *
+ * geqrf returns the reflectors of the usual column by column algorithm, so
+ * that orgqr, ormqr and the reference LAPACK understand them. These are
+ * rebuilt from the explicit Q as in Ballard et al., "Reconstructing
+ * Householder vectors from Tall-Skinny QR" (2014): Q - S = L * U without
+ * pivoting, with the signs S = diag(-sign) chosen on the way, gives the
+ * reflectors V = L and tau(i) = -U(i,i) * S(i), and the factor is S * R.
+ */
+
+// a level of the tree: an m x n matrix in row blocks of mb rows, the last
+// one taking the remaining rows as well, and the n taus of every block
+template <typename T> struct tsqr_level {
+  T *A;
+  rocblas_int m;
+  rocblas_int mb;
+  rocblas_int lda;
+  rocblas_int nblocks;
+  T *tau;
+};
+
+inline rocblas_int tsqr_leaf_rows(rocblas_int n) {
+  return max(TSQR_LEAF_ROWS, 2 * n);
+}
+
+inline rocblas_int tsqr_nblocks(rocblas_int m, rocblas_int mb) {
+  return max(1, m / mb);
+}
+
+// elements of the workspace for an m x n matrix
+inline size_t tsqr_work_size(rocblas_int m, rocblas_int n) {
+  rocblas_int p = tsqr_nblocks(m, tsqr_leaf_rows(n));
+  size_t size = size_t(n) * n + n + size_t(p) * n;
+  while (p > 1) {
+    const size_t rows = size_t(p) * n;
+    p = max(1, p / TSQR_ARITY);
+    size += rows * n + size_t(p) * n;
+  }
+  return size;
+}
+
+// first row and number of rows of block b
+__device__ inline void tsqr_block(rocblas_int m, rocblas_int mb,
+                                  rocblas_int b, rocblas_int *r0,
+                                  rocblas_int *h) {
+  *r0 = b * mb;
+  *h = (b == max(1, m / mb) - 1) ? m - *r0 : mb;
+}
+
+// Householder QR of every block (geqr2), one workgroup per block
+template <typename T>
+__global__ void tsqr_geqr2(rocblas_int m, rocblas_int mb, rocblas_int n,
+                           T *A, rocblas_int lda, T *tau) {
+  const rocblas_int b = hipBlockIdx_x;
+  __shared__ T sred[LARFG_BLOCKSIZE];
+
+  rocblas_int r0, h;
+  tsqr_block(m, mb, b, &r0, &h);
+  A += r0;
+  tau += b * n;
+
+  for (rocblas_int j = 0; j < n; ++j) {
+    larfg_device<T>(h - j, &A[idx2D(j, j, lda)],
+                    &A[idx2D(min(j + 1, h - 1), j, lda)], 1, &tau[j], sred);
+    __syncthreads();
+
+    // apply H(j) to A(j:h,j+1:n) from the left
+    const T t = tau[j];
+    for (rocblas_int c = j + 1; c < n; ++c)
+      larf_device<T>(h - j, t, &A[idx2D(j, j, lda)], 1, &A[idx2D(j, c, lda)],
+                     1, sred);
+    __syncthreads();
+  }
+}
+
+// the first n columns of the Q of every block, in place of its reflectors
+// (org2r), one workgroup per block
+template <typename T>
+__global__ void tsqr_org2r(rocblas_int m, rocblas_int mb, rocblas_int n,
+                           T *A, rocblas_int lda, const T *tau) {
+  const int tid = hipThreadIdx_x;
+  const rocblas_int b = hipBlockIdx_x;
+  __shared__ T sred[LARFG_BLOCKSIZE];
+
+  rocblas_int r0, h;
+  tsqr_block(m, mb, b, &r0, &h);
+  A += r0;
+  tau += b * n;
+
+  for (rocblas_int j = n - 1; j >= 0; --j) {
+    // apply H(j) to A(j:h,j+1:n) from the left
+    const T t = tau[j];
+    for (rocblas_int c = j + 1; c < n; ++c)
+      larf_device<T>(h - j, t, &A[idx2D(j, j, lda)], 1, &A[idx2D(j, c, lda)],
+                     1, sred);
+
+    // column j of H(j) applied to the identity, once all threads are done
+    // with v
+    __syncthreads();
+    for (rocblas_int i = tid; i < h; i += LARFG_BLOCKSIZE) {
+      if (i < j)
+        A[idx2D(i, j, lda)] = 0;
+      else if (i == j)
+        A[idx2D(i, j, lda)] = 1 - t;
+      else
+        A[idx2D(i, j, lda)] *= -t;
+    }
+    __syncthreads();
+  }
+}
+
+// the R factor of every block of A, stacked in R with zeros below the
+// diagonals
+template <typename T>
+__global__ void tsqr_gather(rocblas_int m, rocblas_int mb, rocblas_int n,
+                            const T *A, rocblas_int lda, T *R,
+                            rocblas_int ldr) {
+  const rocblas_int b = hipBlockIdx_x;
+  A += b * mb;
+  R += b * n;
+
+  for (rocblas_int k = hipThreadIdx_x; k < n * n; k += LARFG_BLOCKSIZE) {
+    const rocblas_int i = k % n;
+    const rocblas_int j = k / n;
+    R[idx2D(i, j, ldr)] = (i <= j) ? A[idx2D(i, j, lda)] : 0;
+  }
+}
+
+// every block of A times its n x n factor from the level above, which is at
+// rows b * n of C; a workgroup takes TSQR_ROWMUL_ROWS rows of a block
+template <typename T>
+__global__ void tsqr_rowmul(rocblas_int m, rocblas_int mb, rocblas_int n,
+                            T *A, rocblas_int lda, const T *C,
+                            rocblas_int ldc) {
+  const int tid = hipThreadIdx_x;
+  const rocblas_int b = hipBlockIdx_y;
+  __shared__ T x[TSQR_ROWMUL_ROWS * GEQRF_TSQR_MAXCOLS];
+
+  rocblas_int r0, h;
+  tsqr_block(m, mb, b, &r0, &h);
+  const rocblas_int i0 = hipBlockIdx_x * TSQR_ROWMUL_ROWS;
+  if (i0 >= h)
+    return;
+  const rocblas_int rows = min(TSQR_ROWMUL_ROWS, h - i0);
+  A += r0 + i0;
+  C += b * n;
+
+  for (rocblas_int k = tid; k < rows * n; k += LARFG_BLOCKSIZE)
+    x[(k % rows) + (k / rows) * TSQR_ROWMUL_ROWS] =
+        A[idx2D(k % rows, k / rows, lda)];
+  __syncthreads();
+
+  for (rocblas_int k = tid; k < rows * n; k += LARFG_BLOCKSIZE) {
+    const rocblas_int i = k % rows;
+    const rocblas_int j = k / rows;
+    T s = 0;
+    for (rocblas_int l = 0; l < n; ++l)
+      s += x[i + l * TSQR_ROWMUL_ROWS] * C[idx2D(l, j, ldc)];
+    A[idx2D(i, j, lda)] = s;
+  }
+}
+
+// LU factorization without pivoting of Q(0:n,0:n) - S in place, choosing
+// S(i) = -sign(Q(i,i)) after the previous steps so that |U(i,i)| >= 1; run
+// by one workgroup
+template <typename T>
+__global__ void tsqr_lu_signs(rocblas_int n, T *A, rocblas_int lda, T *S) {
+  const int tid = hipThreadIdx_x;
+
+  for (rocblas_int i = 0; i < n; ++i) {
+    const T s = (A[idx2D(i, i, lda)] >= 0) ? -1 : 1;
+    const T d = A[idx2D(i, i, lda)] - s;
+    __syncthreads();
+    if (tid == 0) {
+      A[idx2D(i, i, lda)] = d;
+      S[i] = s;
+    }
+    for (rocblas_int k = i + 1 + tid; k < n; k += LARFG_BLOCKSIZE)
+      A[idx2D(k, i, lda)] /= d;
+    __syncthreads();
+
+    const rocblas_int nt = n - i - 1;
+    for (rocblas_int k = tid; k < nt * nt; k += LARFG_BLOCKSIZE) {
+      const rocblas_int r = i + 1 + k % nt;
+      const rocblas_int c = i + 1 + k / nt;
+      A[idx2D(r, c, lda)] -= A[idx2D(r, i, lda)] * A[idx2D(i, c, lda)];
+    }
+    __syncthreads();
+  }
+}
+
+// tau(i) = -U(i,i) * S(i), then S * R in place of U; run by one workgroup
+template <typename T>
+__global__ void tsqr_set_r(rocblas_int n, T *A, rocblas_int lda, const T *R,
+                           const T *S, T *tau) {
+  const int tid = hipThreadIdx_x;
+
+  for (rocblas_int i = tid; i < n; i += LARFG_BLOCKSIZE)
+    tau[i] = -A[idx2D(i, i, lda)] * S[i];
+  __syncthreads();
+
+  for (rocblas_int k = tid; k < n * n; k += LARFG_BLOCKSIZE) {
+    const rocblas_int i = k % n;
+    const rocblas_int j = k / n;
+    if (i <= j)
+      A[idx2D(i, j, lda)] = S[i] * R[idx2D(i, j, n)];
+  }
+}
+
+/*
+ * Enqueue the QR factorization of the m x n matrix A, m >= n and
+ * n <= GEQRF_TSQR_MAXCOLS, through TSQR, with the result of geqrf. one is
+ * the constant 1 in device memory and work holds tsqr_work_size(m, n)
+ * elements.
+ */
+template <typename T>
+void rocsolver_tsqr_template(rocblas_handle handle, rocblas_int m,
+                             rocblas_int n, T *A, rocblas_int lda, T *tau,
+                             const T *one, T *work) {
+
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+
+  T *R = work;
+  T *S = R + n * n;
+  T *next = S + n;
+
+  // the levels of the tree, from the leaves in A up to the root
+  vector<tsqr_level<T>> levels;
+  tsqr_level<T> l;
+  l.A = A;
+  l.m = m;
+  l.mb = tsqr_leaf_rows(n);
+  l.lda = lda;
+  l.nblocks = tsqr_nblocks(m, l.mb);
+  l.tau = next;
+  next += l.nblocks * n;
+  levels.push_back(l);
+  while (l.nblocks > 1) {
+    l.m = l.nblocks * n;
+    l.mb = TSQR_ARITY * n;
+    l.lda = l.m;
+    l.nblocks = tsqr_nblocks(l.m, l.mb);
+    l.A = next;
+    next += size_t(l.m) * n;
+    l.tau = next;
+    next += l.nblocks * n;
+    levels.push_back(l);
+  }
+  const rocblas_int top = levels.size() - 1;
+
+  // factor the blocks of every level and stack their R factors for the next
+  for (rocblas_int k = 0; k <= top; ++k) {
+    const tsqr_level<T> &c = levels[k];
+    if (k > 0) {
+      const tsqr_level<T> &p = levels[k - 1];
+      hipLaunchKernelGGL(tsqr_gather<T>, dim3(p.nblocks),
+                         dim3(LARFG_BLOCKSIZE), 0, stream, p.m, p.mb, n, p.A,
+                         p.lda, c.A, c.lda);
+    }
+    hipLaunchKernelGGL(tsqr_geqr2<T>, dim3(c.nblocks), dim3(LARFG_BLOCKSIZE),
+                       0, stream, c.m, c.mb, n, c.A, c.lda, c.tau);
+  }
+  hipLaunchKernelGGL(tsqr_gather<T>, dim3(1), dim3(LARFG_BLOCKSIZE), 0, stream,
+                     levels[top].m, levels[top].mb, n, levels[top].A,
+                     levels[top].lda, R, n);
+
+  // then the explicit Q, from the root down to the leaves
+  for (rocblas_int k = top; k >= 0; --k) {
+    const tsqr_level<T> &c = levels[k];
+    hipLaunchKernelGGL(tsqr_org2r<T>, dim3(c.nblocks), dim3(LARFG_BLOCKSIZE),
+                       0, stream, c.m, c.mb, n, c.A, c.lda, c.tau);
+    if (k < top) {
+      const tsqr_level<T> &p = levels[k + 1];
+      const rocblas_int hmax = c.m - (c.nblocks - 1) * c.mb;
+      const rocblas_int tiles = (hmax - 1) / TSQR_ROWMUL_ROWS + 1;
+      hipLaunchKernelGGL(tsqr_rowmul<T>, dim3(tiles, c.nblocks),
+                         dim3(LARFG_BLOCKSIZE), 0, stream, c.m, c.mb, n, c.A,
+                         c.lda, p.A, p.lda);
+    }
+  }
+
+  // and the reflectors of geqrf from it
+  hipLaunchKernelGGL(tsqr_lu_signs<T>, dim3(1), dim3(LARFG_BLOCKSIZE), 0,
+                     stream, n, A, lda, S);
+  if (m > n)
+    rocblas_trsm<T>(handle, rocblas_side_right, rocblas_fill_upper,
+                    rocblas_operation_none, rocblas_diagonal_non_unit, m - n,
+                    n, one, A, lda, &A[n], lda);
+  hipLaunchKernelGGL(tsqr_set_r<T>, dim3(1), dim3(LARFG_BLOCKSIZE), 0, stream,
+                     n, A, lda, R, S, tau);
+}
+
+#endif /* ROCLAPACK_TSQR_HPP */
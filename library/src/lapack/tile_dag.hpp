@@ -0,0 +1,234 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef TILE_DAG_HPP
+#define TILE_DAG_HPP
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocblas.h>
+
+#include "ideal_sizes.hpp"
+
+// relative cost of the tile tasks, in units of nb^3/3 flops
+#define TILE_DAG_WEIGHT_FACTOR 1
+#define TILE_DAG_WEIGHT_SWAP 1
+#define TILE_DAG_WEIGHT_TRSM 3
+#define TILE_DAG_WEIGHT_SYRK 3
+#define TILE_DAG_WEIGHT_GEMM 6
+
+/*
+ * Host-side dataflow scheduler for tiled factorizations.
+ *
+ * A factorization is described as a sequence of tasks in the order the
+ * sequential algorithm would execute them. Every task names the tiles (or
+ * any other piece of state, e.g. a pivot block) it reads and writes through
+ * integer keys; read-after-write, write-after-write and write-after-read
+ * dependencies are derived from that, so the resulting DAG is exactly the
+ * one of the sequential loop nest.
+ *
+ * execute() then dispatches tasks in priority order as soon as all their
+ * predecessors have been dispatched. Priorities are the length of the
+ * longest (weighted) path to the exit of the DAG, so the panel/diagonal
+ * tasks on the critical path always go first and the trailing updates fill
+ * in behind them. Tasks are spread over a pool of streams, and dependencies
+ * between tasks on different streams are released on device through events;
+ * the host never waits for the device.
+ */
+class tile_dag {
+public:
+  // a task gets the handle (already bound to the task's stream) and the
+  // stream for its own kernel launches
+  typedef std::function<rocblas_status(rocblas_handle, hipStream_t)> task_fn;
+
+  rocblas_int add_task(const task_fn &fn, rocblas_int weight,
+                       const std::vector<rocblas_int> &reads,
+                       const std::vector<rocblas_int> &writes) {
+    const rocblas_int t = static_cast<rocblas_int>(tasks.size());
+    tasks.push_back(task());
+    tasks[t].fn = fn;
+    tasks[t].weight = weight;
+
+    for (size_t r = 0; r < reads.size(); ++r) {
+      key_state &ks = state(reads[r]);
+      add_edge(ks.writer, t);
+      ks.readers.push_back(t);
+    }
+    for (size_t w = 0; w < writes.size(); ++w) {
+      key_state &ks = state(writes[w]);
+      add_edge(ks.writer, t);
+      for (size_t r = 0; r < ks.readers.size(); ++r)
+        add_edge(ks.readers[r], t);
+      ks.writer = t;
+      ks.readers.clear();
+    }
+
+    return t;
+  }
+
+  rocblas_int size() const { return static_cast<rocblas_int>(tasks.size()); }
+
+  rocblas_status execute(rocblas_handle handle) {
+
+    if (tasks.empty())
+      return rocblas_status_success;
+
+    hipStream_t origStream;
+    rocblas_get_stream(handle, &origStream);
+
+    // tasks are created in sequential order, so every edge points forward
+    // and a reverse sweep yields the bottom levels
+    for (rocblas_int t = size() - 1; t >= 0; --t) {
+      rocblas_int longest = 0;
+      for (size_t s = 0; s < tasks[t].succ.size(); ++s)
+        longest = std::max(longest, tasks[tasks[t].succ[s]].level);
+      tasks[t].level = tasks[t].weight + longest;
+    }
+
+    // fork the stream pool off the handle's stream
+    const rocblas_int nstreams =
+        std::min(static_cast<rocblas_int>(TILE_DAG_NSTREAMS), size());
+    std::vector<hipStream_t> streams(nstreams);
+    hipEvent_t fork;
+    hipEventCreateWithFlags(&fork, hipEventDisableTiming);
+    hipEventRecord(fork, origStream);
+    for (rocblas_int s = 0; s < nstreams; ++s) {
+      hipStreamCreateWithFlags(&streams[s], hipStreamNonBlocking);
+      hipStreamWaitEvent(streams[s], fork, 0);
+    }
+
+    std::vector<rocblas_int> waiting(tasks.size());
+    std::priority_queue<ready_task> ready;
+    for (rocblas_int t = 0; t < size(); ++t) {
+      waiting[t] = static_cast<rocblas_int>(tasks[t].pred.size());
+      if (waiting[t] == 0)
+        ready.push(ready_task(tasks[t].level, t));
+    }
+
+    rocblas_status status = rocblas_status_success;
+    rocblas_int next = 0;
+
+    while (!ready.empty()) {
+      const rocblas_int t = ready.top().id;
+      ready.pop();
+      task &tk = tasks[t];
+
+      tk.stream = next;
+      next = (next + 1) % nstreams;
+
+      // release the dependencies on tasks that ran on a different stream;
+      // the wait is captured at enqueue time, so events whose successors
+      // have all been dispatched can be recycled right away
+      for (size_t p = 0; p < tk.pred.size(); ++p) {
+        task &pt = tasks[tk.pred[p]];
+        if (pt.stream != tk.stream)
+          hipStreamWaitEvent(streams[tk.stream], events[pt.event], 0);
+        if (--pt.pending == 0)
+          free_events.push_back(pt.event);
+      }
+
+      rocblas_set_stream(handle, streams[tk.stream]);
+      status = tk.fn(handle, streams[tk.stream]);
+      if (status != rocblas_status_success)
+        break;
+
+      tk.pending = static_cast<rocblas_int>(tk.succ.size());
+      if (tk.pending > 0) {
+        tk.event = get_event();
+        hipEventRecord(events[tk.event], streams[tk.stream]);
+      }
+
+      for (size_t s = 0; s < tk.succ.size(); ++s) {
+        const rocblas_int st = tk.succ[s];
+        if (--waiting[st] == 0)
+          ready.push(ready_task(tasks[st].level, st));
+      }
+    }
+
+    // join the pool back into the handle's stream
+    for (rocblas_int s = 0; s < nstreams; ++s) {
+      hipEvent_t join;
+      hipEventCreateWithFlags(&join, hipEventDisableTiming);
+      hipEventRecord(join, streams[s]);
+      hipStreamWaitEvent(origStream, join, 0);
+      hipEventDestroy(join);
+      hipStreamDestroy(streams[s]);
+    }
+    hipEventDestroy(fork);
+    for (size_t e = 0; e < events.size(); ++e)
+      hipEventDestroy(events[e]);
+    events.clear();
+    free_events.clear();
+
+    rocblas_set_stream(handle, origStream);
+
+    return status;
+  }
+
+private:
+  struct task {
+    task_fn fn;
+    rocblas_int weight = 0;
+    rocblas_int level = 0;
+    rocblas_int stream = -1;
+    rocblas_int event = -1;
+    rocblas_int pending = 0;
+    std::vector<rocblas_int> pred;
+    std::vector<rocblas_int> succ;
+  };
+
+  struct key_state {
+    rocblas_int writer = -1;
+    std::vector<rocblas_int> readers;
+  };
+
+  struct ready_task {
+    rocblas_int level;
+    rocblas_int id;
+    ready_task(rocblas_int l, rocblas_int i) : level(l), id(i) {}
+    // higher level first, ties go to the earlier task of the sequential order
+    bool operator<(const ready_task &o) const {
+      return level < o.level || (level == o.level && id > o.id);
+    }
+  };
+
+  key_state &state(rocblas_int key) {
+    if (key >= static_cast<rocblas_int>(keys.size()))
+      keys.resize(key + 1);
+    return keys[key];
+  }
+
+  void add_edge(rocblas_int from, rocblas_int to) {
+    if (from < 0 || from == to)
+      return;
+    std::vector<rocblas_int> &pred = tasks[to].pred;
+    if (std::find(pred.begin(), pred.end(), from) != pred.end())
+      return;
+    pred.push_back(from);
+    tasks[from].succ.push_back(to);
+  }
+
+  rocblas_int get_event() {
+    if (!free_events.empty()) {
+      const rocblas_int e = free_events.back();
+      free_events.pop_back();
+      return e;
+    }
+    hipEvent_t ev;
+    hipEventCreateWithFlags(&ev, hipEventDisableTiming);
+    events.push_back(ev);
+    return static_cast<rocblas_int>(events.size()) - 1;
+  }
+
+  std::vector<task> tasks;
+  std::vector<key_state> keys;
+  std::vector<hipEvent_t> events;
+  std::vector<rocblas_int> free_events;
+};
+
+#endif /* TILE_DAG_HPP */